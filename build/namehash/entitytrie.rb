@@ -0,0 +1,158 @@
+#!/usr/bin/env ruby
+
+###############################################################################
+# entitytrie.rb
+#  Generates the tables Tidy uses to map between named character entities
+#  and code points, from the rows of the entities table in src/entities.c:
+#
+#    src/entitytrie.h   trie over the names, for reading entities
+#    src/entitycodes.h  index from code point to names, for writing them
+#
+#  Run it whenever a row is added to, removed from or moved within that
+#  table, and commit the regenerated headers together with the table change.
+#
+#  Trie nodes are laid out breadth first so that the children of every node
+#  are contiguous and sorted by character; entity_trie[0] is the root. Each
+#  node records the character leading to it, where its children start and
+#  how many there are, and the entities index + 1 of the name ending there
+#  (0 when no name ends there).
+#
+#  The code point index lists each distinct code point once, in ascending
+#  order, with the rows that carry it in table order, so a search can still
+#  return the first row whose versions match.
+###############################################################################
+
+ROOT = File.expand_path(File.join(File.dirname(__FILE__), '..', '..'))
+SOURCE = 'src/entities.c'
+OUTPUT = 'src/entitytrie.h'
+CODES = 'src/entitycodes.h'
+
+text = File.read(File.join(ROOT, SOURCE))
+table = text[/^static const entity entities\[\] =\s*\{(.*?)^\};/m, 1]
+abort "#{SOURCE}: entities table not found" unless table
+rows = table.scan(/^\s*\{\s*"([^"]+)"\s*,[^,]*,\s*(\d+)\s*\}/)
+names = rows.map(&:first)
+abort "#{SOURCE}: unexpected row in entities table" if names.length != table.scan(/^\s*\{\s*"/).length
+
+# nested hash trie: { char => node }, :entity => index
+trie = {}
+names.each_with_index do |name, i|
+  abort "#{SOURCE}: #{name} is not plain ASCII" unless name =~ /\A[\x21-\x7e]+\z/
+  node = trie
+  name.each_byte { |c| node = (node[c] ||= {}) }
+  abort "#{SOURCE}: #{name} appears twice" if node[:entity]
+  node[:entity] = i
+end
+
+# breadth first numbering; children of node n are queued consecutively
+nodes = []          # [ch, child, count, entity]
+queue = [[0, trie]]
+head = 0
+until head == queue.length
+  ch, node = queue[head]
+  head += 1
+  kids = node.keys.grep(Integer).sort
+  nodes << [ch, queue.length, kids.length, node[:entity] ? node[:entity] + 1 : 0]
+  kids.each { |k| queue << [k, node[k]] }
+end
+
+abort "#{SOURCE}: trie too large" if nodes.length > 65535
+abort "#{SOURCE}: node with too many children" if nodes.any? { |n| n[2] > 255 }
+
+def c_char( ch )
+  return '  0' if ch == 0
+  ch == 39 || ch == 92 ? "'\\#{ch.chr}'" : "'#{ch.chr}'"
+end
+
+File.open(File.join(ROOT, OUTPUT), 'w') do |f|
+  f.puts <<~HEADER
+    #ifndef __ENTITYTRIE_H__
+    #define __ENTITYTRIE_H__
+
+    /* entitytrie.h -- trie over the names in the entities table
+
+      THIS FILE IS MACHINE GENERATED by build/namehash/entitytrie.rb from
+      #{SOURCE}; do not edit it by hand. Regenerate it whenever a row
+      is added to, removed from or moved within the entities table.
+
+      (c) 2017 HTACG
+      See tidy.h for the copyright notice.
+    */
+
+    typedef struct _EntityTrieNode
+    {
+        unsigned char  ch;      /* character leading to this node */
+        unsigned char  count;   /* number of children */
+        unsigned short child;   /* index of the first child */
+        unsigned short entity;  /* entities index + 1, 0 if no name ends here */
+    } EntityTrieNode;
+
+    #define ENTITY_TRIE_NODES  #{nodes.length}u
+
+    static const EntityTrieNode entity_trie[ENTITY_TRIE_NODES] =
+    {
+  HEADER
+  cells = nodes.map do |ch, child, count, entity|
+    "{ #{c_char(ch)}, #{count.to_s.rjust(2)}, #{child.to_s.rjust(4)}, #{entity.to_s.rjust(4)} }"
+  end
+  f.puts cells.each_slice(4).map { |row| '    ' + row.join(', ') }.join(",\n")
+  f.puts <<~FOOTER
+    };
+
+    #endif /* __ENTITYTRIE_H__ */
+  FOOTER
+end
+puts "#{OUTPUT}: #{names.length} names, #{nodes.length} nodes"
+
+# code point index
+by_code = Hash.new { |h, k| h[k] = [] }
+rows.each_with_index { |(name, code), i| by_code[code.to_i] << i }
+codes = by_code.keys.sort
+first = [0]
+list = []
+codes.each { |code| list.concat(by_code[code]); first << list.length }
+
+def c_list( values, width )
+  values.each_slice(12).map { |row| '    ' + row.map { |v| v.to_s.rjust(width) }.join(', ') }.join(",\n")
+end
+
+File.open(File.join(ROOT, CODES), 'w') do |f|
+  f.puts <<~HEADER
+    #ifndef __ENTITYCODES_H__
+    #define __ENTITYCODES_H__
+
+    /* entitycodes.h -- index from code point to the entities table
+
+      THIS FILE IS MACHINE GENERATED by build/namehash/entitytrie.rb from
+      #{SOURCE}; do not edit it by hand. Regenerate it whenever a row
+      is added to, removed from or moved within the entities table.
+
+      (c) 2017 HTACG
+      See tidy.h for the copyright notice.
+    */
+
+    #define ENTITY_CODES  #{codes.length}u
+
+    /* every code point that has a name, ascending */
+    static const unsigned int entity_code[ENTITY_CODES] =
+    {
+    #{c_list(codes, 6)}
+    };
+
+    /* entity_code_row[entity_code_first[i] .. entity_code_first[i+1]-1]
+       are the rows for entity_code[i] */
+    static const unsigned short entity_code_first[ENTITY_CODES + 1] =
+    {
+    #{c_list(first, 4)}
+    };
+
+    /* entities indices, in table order for each code point */
+    static const unsigned short entity_code_row[#{list.length}] =
+    {
+    #{c_list(list, 4)}
+    };
+
+    #endif /* __ENTITYCODES_H__ */
+  HEADER
+end
+puts "#{CODES}: #{rows.length} names, #{codes.length} code points"
@@ -0,0 +1,134 @@
+#!/usr/bin/env ruby
+
+###############################################################################
+# namehash.rb
+#  Generates the perfect hash tables that Tidy uses to look up its built-in
+#  element and attribute names:
+#
+#    src/tagshash.h   from the rows of tag_defs in src/tags.c
+#    src/attrshash.h  from the rows of attribute_defs in src/attrs.c
+#
+#  Run it from this directory (or anywhere; paths are relative to this file)
+#  whenever a row is added to, removed from or moved within either table,
+#  and commit the regenerated headers together with the table change.
+#
+#  The hash is 32 bit FNV-1a over the name with ASCII letters folded to
+#  lower case, started from a per table seed. Bits 16 and up pick a bucket,
+#  and each bucket carries a displacement that is added to the hash before
+#  it is masked down to a slot, chosen so that no two names share a slot.
+#  tagsHash() and attrsHash() must stay in step with fnv() below.
+###############################################################################
+
+ROOT = File.expand_path(File.join(File.dirname(__FILE__), '..', '..'))
+
+TABLES = [
+  { :source => 'src/tags.c',   :output => 'src/tagshash.h',
+    :array => 'tag_defs', :row => /^\s*\{\s*TidyTag_\w+\s*,\s*"([^"]+)"/,
+    :prefix => 'TAG', :ident => 'tag', :skip_first => true,
+    :buckets => 64, :slots => 256 },
+  { :source => 'src/attrs.c',  :output => 'src/attrshash.h',
+    :array => 'attribute_defs', :row => /^\s*\{\s*TidyAttr_\w+\s*,\s*"([^"]+)"/,
+    :prefix => 'ATTR', :ident => 'attr', :skip_first => false,
+    :buckets => 128, :slots => 512 },
+]
+
+FNV_BASIS = 0x811c9dc5
+FNV_PRIME = 16777619
+
+
+def fnv( name, seed )
+  h = seed
+  name.each_byte do |c|
+    c += 32 if c >= 65 && c <= 90
+    h = ((h ^ c) * FNV_PRIME) & 0xffffffff
+  end
+  h
+end
+
+
+# Returns [disp, slots] or nil when this seed has no solution.
+def build( keys, seed, nbuckets, nslots )
+  buckets = Array.new(nbuckets) { [] }
+  keys.each do |index, name|
+    h = fnv(name, seed)
+    buckets[(h >> 16) & (nbuckets - 1)] << [index, h]
+  end
+
+  disp = Array.new(nbuckets, 0)
+  slots = Array.new(nslots, 0)
+  order = (0...nbuckets).sort_by { |b| [-buckets[b].length, b] }
+  order.each do |b|
+    next if buckets[b].empty?
+    found = (0...nslots).find do |d|
+      want = buckets[b].map { |index, h| (h + d) & (nslots - 1) }
+      want.uniq.length == want.length && want.all? { |s| slots[s] == 0 }
+    end
+    return nil unless found
+    disp[b] = found
+    buckets[b].each { |index, h| slots[(h + found) & (nslots - 1)] = index + 1 }
+  end
+  [disp, slots]
+end
+
+
+def c_array( values )
+  values.each_slice(16).map { |row| '    ' + row.map { |v| v.to_s.rjust(3) }.join(', ') }.join(",\n")
+end
+
+
+TABLES.each do |t|
+  names = File.readlines(File.join(ROOT, t[:source])).map { |l| l[t[:row], 1] }.compact
+  keys = names.each_with_index.map { |name, i| [i, name] }
+  keys.shift if t[:skip_first]
+
+  folded = keys.map { |i, name| name.downcase }
+  abort "#{t[:source]}: names differ only in case" if folded.uniq.length != folded.length
+  abort "#{t[:source]}: more names than slots" if keys.length >= t[:slots]
+
+  seed = FNV_BASIS
+  result = nil
+  1000.times do
+    break if (result = build(keys, seed, t[:buckets], t[:slots]))
+    seed = (seed + 1) & 0xffffffff
+  end
+  abort "#{t[:source]}: no perfect hash found, grow the table" unless result
+  disp, slots = result
+
+  p = t[:prefix]
+  guard = "__#{File.basename(t[:output], '.h').upcase}_H__"
+  File.open(File.join(ROOT, t[:output]), 'w') do |f|
+    f.puts <<~HEADER
+      #ifndef #{guard}
+      #define #{guard}
+
+      /* #{File.basename(t[:output])} -- perfect hash over the names in #{t[:array]}
+
+        THIS FILE IS MACHINE GENERATED by build/namehash/namehash.rb from
+        #{t[:source]}; do not edit it by hand. Regenerate it whenever a row
+        is added to, removed from or moved within #{t[:array]}.
+
+        (c) 2017 HTACG
+        See tidy.h for the copyright notice.
+      */
+
+      #define #{p}_HASH_SEED     0x#{seed.to_s(16)}u
+      #define #{p}_HASH_BUCKETS  #{t[:buckets]}u
+      #define #{p}_HASH_SLOTS    #{t[:slots]}u
+
+      /* added to the hash before masking, indexed by bits 16 and up */
+      static const unsigned short #{t[:ident]}_hash_disp[#{p}_HASH_BUCKETS] =
+      {
+      #{c_array(disp)}
+      };
+
+      /* #{t[:array]} index + 1 of the name in each slot; 0 marks a free slot */
+      static const unsigned short #{t[:ident]}_hash_slot[#{p}_HASH_SLOTS] =
+      {
+      #{c_array(slots)}
+      };
+
+      #endif /* #{guard} */
+    HEADER
+  end
+  puts "#{t[:output]}: #{keys.length} names, seed 0x#{seed.to_s(16)}"
+end
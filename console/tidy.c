@@ -25,7 +25,16 @@
 #include "sprtf.h"
 
 #if defined(_WIN32)
+#  if !defined(_WIN32_WINNT) || (_WIN32_WINNT < 0x0600)
+#    undef _WIN32_WINNT
+#    define _WIN32_WINNT 0x0600  /* Condition variables for -jobs. */
+#  endif
 #  include <windows.h>    /* Force console to UTF8. */
+#  include <io.h>         /* For _setmode(). */
+#  include <fcntl.h>
+#else
+#  include <pthread.h>    /* Workers for -jobs. */
+#  include <unistd.h>     /* For sysconf(). */
 #endif
 
 #if defined(ENABLE_DEBUG_LOG) && defined(_MSC_VER) && defined(_CRTDBG_MAP_ALLOC)
@@ -343,6 +352,8 @@ static const CmdOptDesc cmdopt_defs[] =  {
     { CmdOptFileManip, "-output <%s>",           TC_OPT_OUTPUT,   TC_LABEL_FILE, "output-file: <%s>", "-o <%s>" },
     { CmdOptFileManip, "-config <%s>",           TC_OPT_CONFIG,   TC_LABEL_FILE, NULL },
     { CmdOptFileManip, "-file <%s>",             TC_OPT_FILE,     TC_LABEL_FILE, "error-file: <%s>", "-f <%s>" },
+    { CmdOptFileManip, "-files0-from <%s>",      TC_OPT_FILES0,   TC_LABEL_FILE, NULL },
+    { CmdOptFileManip, "-jobs <%s>",             TC_OPT_JOBS,     TC_LABEL_NUM,  NULL },
     { CmdOptFileManip, "-modify",                TC_OPT_MODIFY,   0,             "write-back: yes", "-m" },
     { CmdOptProcDir,   "-indent",                TC_OPT_INDENT,   0,             "indent: auto", "-i" },
     { CmdOptProcDir,   "-wrap <%s>",             TC_OPT_WRAP,     TC_LABEL_COL,  "wrap: <%s>", "-w <%s>" },
@@ -2064,6 +2075,543 @@ static Bool TIDY_CALL reportCallback(TidyMessage tmessage)
 
 
 /** @} end experimental_stuff group */
+/* MARK: - Tidying Files */
+/***************************************************************************//**
+ ** @defgroup tidying_files Tidying Files
+ ** These functions tidy the files named on the command line. Without
+ ** `-jobs`, each is tidied in turn with the main document. With it, the
+ ** files between two options are tidied several at a time by workers, each
+ ** with a document of its own that uses the options compiled from the main
+ ** document, and what each file produces is written out in the order in
+ ** which the files were named. Either way, each file is tidied as if it
+ ** were the only one: its report ends with its own footnotes, and the
+ ** document is reset before the next, so that no count, footnote or
+ ** option that parsing changed carries over to it.
+ *******************************************************************************
+ ** @{
+ */
+
+
+/** The most workers `-jobs` will start, whatever it is asked for. */
+#define MAX_JOBS 64
+
+
+/** The errors and warnings found so far, for the exit status. */
+typedef struct {
+    uint contentErrors;    /**< Errors found. */
+    uint contentWarnings;  /**< Warnings found. */
+    uint accessWarnings;   /**< Accessibility warnings found. */
+} TidyTotals;
+
+
+/** A list of files waiting to be tidied. */
+typedef struct {
+    ctmbstr* names;  /**< The file names. */
+    uint count;      /**< Number of names. */
+    uint capacity;   /**< Number of names allocated. */
+} FileList;
+
+
+/** A file to be tidied by a worker, and what came of it. */
+typedef struct {
+    ctmbstr htmlfil;  /**< The file to tidy. */
+    TidyBuffer err;   /**< What is to be written to errout. */
+    TidyBuffer out;   /**< The tidied markup, unless written back. */
+    Bool hasOutput;   /**< Whether `out` is to be written. */
+    uint errors;      /**< Errors found. */
+    uint warnings;    /**< Warnings found. */
+    uint access;      /**< Accessibility warnings found. */
+    Bool done;        /**< Whether the worker has finished with it. */
+} JobSlot;
+
+
+#if defined(_WIN32)
+typedef HANDLE             JobThread;
+typedef CRITICAL_SECTION   JobLock;
+typedef CONDITION_VARIABLE JobCond;
+#  define jobLockInit(l)   InitializeCriticalSection(l)
+#  define jobLockFree(l)   DeleteCriticalSection(l)
+#  define jobLock(l)       EnterCriticalSection(l)
+#  define jobUnlock(l)     LeaveCriticalSection(l)
+#  define jobCondInit(c)   InitializeConditionVariable(c)
+#  define jobCondFree(c)   ((void)(c))
+#  define jobWait(c, l)    SleepConditionVariableCS(c, l, INFINITE)
+#  define jobWakeAll(c)    WakeAllConditionVariable(c)
+#else
+typedef pthread_t          JobThread;
+typedef pthread_mutex_t    JobLock;
+typedef pthread_cond_t     JobCond;
+#  define jobLockInit(l)   pthread_mutex_init(l, NULL)
+#  define jobLockFree(l)   pthread_mutex_destroy(l)
+#  define jobLock(l)       pthread_mutex_lock(l)
+#  define jobUnlock(l)     pthread_mutex_unlock(l)
+#  define jobCondInit(c)   pthread_cond_init(c, NULL)
+#  define jobCondFree(c)   pthread_cond_destroy(c)
+#  define jobWait(c, l)    pthread_cond_wait(c, l)
+#  define jobWakeAll(c)    pthread_cond_broadcast(c)
+#endif
+
+
+/** The files being tidied by a set of workers. The lock guards `next`,
+ ** `written` and the slots' `done` flags; the condition is signalled
+ ** whenever one of them changes.
+ */
+typedef struct {
+    TidyCompiledConfig config;  /**< The options every worker uses. */
+    JobSlot* slots;             /**< One slot per file, in order. */
+    uint count;                 /**< Number of files. */
+    uint next;                  /**< The next file to hand out. */
+    uint written;               /**< Number of files written out. */
+    uint window;                /**< How far workers may get ahead. */
+    JobLock lock;
+    JobCond cond;
+} JobBatch;
+
+
+/** Adds a file to a list.
+ */
+static void addFile( FileList* list,  /**< The list. */
+                     ctmbstr name     /**< The file to add. */
+                     )
+{
+    if ( list->count == list->capacity )
+    {
+        uint capacity = list->capacity ? 2 * list->capacity : 16;
+        ctmbstr* names = realloc( list->names, capacity * sizeof(ctmbstr) );
+        if ( !names )
+            outOfMemory();
+        list->names = names;
+        list->capacity = capacity;
+    }
+    list->names[list->count++] = name;
+}
+
+
+/** Reads file names separated by NUL characters, as `find -print0` writes
+ ** them, and adds them to a list. The names point into the text read.
+ ** @result Returns the text, which you must free after the list, or NULL
+ **         if the file cannot be opened.
+ */
+static tmbstr readFileList( ctmbstr listfil,  /**< The file, or "-" for stdin. */
+                            FileList* list    /**< The list to add to. */
+                            )
+{
+    FILE* fin = stdin;
+    tmbstr text = NULL;
+    size_t size = 0, len = 0, n = 0, i, start;
+
+    if ( strcmp(listfil, "-") != 0 && (fin = fopen(listfil, "rb")) == NULL )
+    {
+        fprintf( errout, tidyLocalizedString(FILE_CANT_OPEN), listfil );
+        return NULL;
+    }
+#if defined(_WIN32)
+    if ( fin == stdin )
+        _setmode( _fileno(stdin), _O_BINARY );
+#endif
+
+    do
+    {
+        if ( len == size )
+        {
+            size = size ? 2 * size : 4096;
+            if ( !(text = realloc(text, size + 1)) )
+                outOfMemory();
+        }
+        n = fread( text + len, 1, size - len, fin );
+        len += n;
+    } while ( n > 0 );
+    text[len] = '\0';
+
+    if ( fin != stdin )
+        fclose( fin );
+
+    for ( i = start = 0; i <= len; ++i )
+    {
+        if ( text[i] == '\0' )
+        {
+            if ( i > start )
+                addFile( list, text + start );
+            start = i + 1;
+        }
+    }
+    return text;
+}
+
+
+/** Returns the number of processors, for `-jobs 0`.
+ */
+static uint processorCount( void )
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    DWORD n = info.dwNumberOfProcessors;
+    return n > 0 ? (n < MAX_JOBS ? (uint) n : MAX_JOBS) : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf( _SC_NPROCESSORS_ONLN );
+    return n > 0 ? (n < MAX_JOBS ? (uint) n : MAX_JOBS) : 1;
+#else
+    return 1;
+#endif
+}
+
+
+/** Tidies a file, or stdin, with the main document, reporting as it goes,
+ ** and adds what it found to the totals. The document is reset afterwards,
+ ** keeping the options it was given.
+ */
+static void tidyFile( TidyDoc tdoc,         /**< The main document. */
+                      ctmbstr htmlfil,      /**< The file, or NULL for stdin. */
+                      TidyTotals* totals    /**< The totals to add to. */
+                      )
+{
+    int status;
+
+    if ( htmlfil )
+    {
+#ifdef ENABLE_DEBUG_LOG
+        SPRTF("Tidy: '%s'\n", htmlfil);
+#else /* !ENABLE_DEBUG_LOG */
+        /* Is #713 - show-filename option */
+        if (tidyOptGetBool(tdoc, TidyShowFilename))
+        {
+            fprintf(errout, "Tidy: '%s'", htmlfil);
+            fprintf(errout, "\n");
+        }
+#endif /* ENABLE_DEBUG_LOG yes/no */
+        if ( tidyOptGetBool(tdoc, TidyEmacs) || tidyOptGetBool(tdoc, TidyShowFilename))
+            tidySetEmacsFile( tdoc, htmlfil );
+        status = tidyParseFile( tdoc, htmlfil );
+    }
+    else
+    {
+        status = tidyParseStdin( tdoc );
+    }
+
+    if ( status >= 0 )
+        status = tidyCleanAndRepair( tdoc );
+
+    if ( status >= 0 ) {
+        status = tidyRunDiagnostics( tdoc );
+    }
+    if ( status > 1 ) /* If errors, do we want to force output? */
+        status = ( tidyOptGetBool(tdoc, TidyForceOutput) ? status : -1 );
+
+    if ( status >= 0 && tidyOptGetBool(tdoc, TidyShowMarkup) )
+    {
+        if ( tidyOptGetBool(tdoc, TidyWriteBack) && htmlfil )
+            status = tidySaveFile( tdoc, htmlfil );
+        else
+        {
+            ctmbstr outfil = tidyOptGetValue( tdoc, TidyOutFile );
+            if ( outfil ) {
+                status = tidySaveFile( tdoc, outfil );
+            } else {
+#ifdef ENABLE_DEBUG_LOG
+                static char tmp_buf[264];
+                sprintf(tmp_buf,"%s.html",get_log_file());
+                status = tidySaveFile( tdoc, tmp_buf );
+                SPRTF("Saved tidied content to '%s'\n",tmp_buf);
+#else
+                status = tidySaveStdout( tdoc );
+#endif
+            }
+        }
+    }
+
+    totals->contentErrors   += tidyErrorCount( tdoc );
+    totals->contentWarnings += tidyWarningCount( tdoc );
+    totals->accessWarnings  += tidyAccessWarningCount( tdoc );
+
+    /* blank line for screen formatting */
+    if ( errout == stderr && !tidyErrorCount(tdoc) && !tidyOptGetBool(tdoc, TidyQuiet) )
+        fprintf( errout, "\n" );
+
+    /* footnote printing only if errors or warnings */
+    if ( tidyErrorCount(tdoc) + tidyWarningCount(tdoc) > 0 )
+        tidyErrorSummary( tdoc );
+
+    tidyReset( tdoc );
+}
+
+
+/** Tidies the file in a slot with a worker's document, as tidyFile() would
+ ** with the main one. Reports go to the slot rather than to errout, and so
+ ** does the markup unless it is written back.
+ */
+static void tidyJob( TidyDoc tdoc,    /**< The worker's document. */
+                     JobSlot* slot    /**< The file to tidy. */
+                     )
+{
+    ctmbstr htmlfil = slot->htmlfil;
+    int status;
+
+    tidySetErrorBuffer( tdoc, &slot->err );
+
+    if ( tidyOptGetBool(tdoc, TidyShowFilename) )
+    {
+        tmbstr line = stringWithFormat( "Tidy: '%s'\n", htmlfil );
+        tidyBufAppend( &slot->err, line, (uint) strlen(line) );
+        free( line );
+    }
+    if ( tidyOptGetBool(tdoc, TidyEmacs) || tidyOptGetBool(tdoc, TidyShowFilename))
+        tidySetEmacsFile( tdoc, htmlfil );
+    status = tidyParseFile( tdoc, htmlfil );
+
+    if ( status >= 0 )
+        status = tidyCleanAndRepair( tdoc );
+
+    if ( status >= 0 )
+        status = tidyRunDiagnostics( tdoc );
+
+    if ( status > 1 )
+        status = ( tidyOptGetBool(tdoc, TidyForceOutput) ? status : -1 );
+
+    if ( status >= 0 && tidyOptGetBool(tdoc, TidyShowMarkup) )
+    {
+        if ( tidyOptGetBool(tdoc, TidyWriteBack) )
+            tidySaveFile( tdoc, htmlfil );
+        else
+            slot->hasOutput = ( tidySaveBuffer( tdoc, &slot->out ) >= 0 );
+    }
+
+    slot->errors   = tidyErrorCount( tdoc );
+    slot->warnings = tidyWarningCount( tdoc );
+    slot->access   = tidyAccessWarningCount( tdoc );
+
+    if ( errout == stderr && !slot->errors && !tidyOptGetBool(tdoc, TidyQuiet) )
+        tidyBufAppend( &slot->err, "\n", 1 );
+
+    if ( slot->errors + slot->warnings > 0 )
+        tidyErrorSummary( tdoc );
+
+    tidyReset( tdoc );
+}
+
+
+/** A worker: takes files from the batch in order and tidies them, staying
+ ** no more than the batch's window ahead of the files written out.
+ */
+static void runJobs( JobBatch* batch )
+{
+    TidyDoc tdoc = tidyCreate();
+    uint i;
+
+    tidySetMessageCallback( tdoc, reportCallback ); /* experimental group */
+    tidyOptUseConfig( tdoc, batch->config );
+
+    for ( ;; )
+    {
+        jobLock( &batch->lock );
+        while ( batch->next < batch->count &&
+                batch->next - batch->written >= batch->window )
+            jobWait( &batch->cond, &batch->lock );
+        i = ( batch->next < batch->count ? batch->next++ : batch->count );
+        jobUnlock( &batch->lock );
+
+        if ( i == batch->count )
+            break;
+
+        tidyJob( tdoc, &batch->slots[i] );
+
+        jobLock( &batch->lock );
+        batch->slots[i].done = yes;
+        jobWakeAll( &batch->cond );
+        jobUnlock( &batch->lock );
+    }
+
+    tidyRelease( tdoc );
+}
+
+
+#if defined(_WIN32)
+static DWORD WINAPI jobThread( LPVOID batch )
+{
+    runJobs( (JobBatch*) batch );
+    return 0;
+}
+#else
+static void* jobThread( void* batch )
+{
+    runJobs( (JobBatch*) batch );
+    return NULL;
+}
+#endif
+
+
+/** Starts a worker on a batch.
+ ** @result Returns yes if the thread was started.
+ */
+static Bool startJobThread( JobThread* thread, JobBatch* batch )
+{
+#if defined(_WIN32)
+    return ( (*thread = CreateThread(NULL, 0, jobThread, batch, 0, NULL)) != NULL );
+#else
+    return ( pthread_create(thread, NULL, jobThread, batch) == 0 );
+#endif
+}
+
+
+/** Waits for a worker to finish.
+ */
+static void joinJobThread( JobThread thread )
+{
+#if defined(_WIN32)
+    WaitForSingleObject( thread, INFINITE );
+    CloseHandle( thread );
+#else
+    pthread_join( thread, NULL );
+#endif
+}
+
+
+/** Writes out what a worker produced for a file, as tidyFile() would have
+ ** while tidying it, and adds what it found to the totals.
+ */
+static void writeJob( ctmbstr outfil,      /**< The output file, or NULL. */
+                      JobSlot* slot,       /**< The file's slot. */
+                      TidyTotals* totals   /**< The totals to add to. */
+                      )
+{
+    if ( slot->err.size > 0 )
+        fwrite( slot->err.bp, 1, slot->err.size, errout );
+
+    if ( slot->hasOutput && outfil )
+    {
+        FILE* fout = fopen( outfil, "wb" );
+        if ( fout )
+        {
+            fwrite( slot->out.bp, 1, slot->out.size, fout );
+            fclose( fout );
+        }
+        else
+            fprintf( errout, tidyLocalizedString(FILE_CANT_OPEN), outfil );
+    }
+    else if ( slot->hasOutput && slot->out.size > 0 )
+    {
+#if defined(_WIN32)
+        int oldmode = _setmode( _fileno(stdout), _O_BINARY );
+#endif
+        fwrite( slot->out.bp, 1, slot->out.size, stdout );
+        fflush( stdout );
+#if defined(_WIN32)
+        if ( oldmode != -1 )
+            _setmode( _fileno(stdout), oldmode );
+#endif
+    }
+
+    totals->contentErrors   += slot->errors;
+    totals->contentWarnings += slot->warnings;
+    totals->accessWarnings  += slot->access;
+
+    tidyBufFree( &slot->err );
+    tidyBufFree( &slot->out );
+}
+
+
+/** Tidies a list of files with up to `jobs` workers, writing out what
+ ** each produces in the order of the list, and empties the list.
+ */
+static void tidyFiles( TidyDoc tdoc,        /**< The main document. */
+                       FileList* files,     /**< The files to tidy. */
+                       uint jobs,           /**< The number of workers. */
+                       TidyTotals* totals   /**< The totals to add to. */
+                       )
+{
+    ctmbstr outfil = tidyOptGetValue( tdoc, TidyOutFile );
+    JobThread* threads;
+    JobBatch batch;
+    uint i, started = 0;
+
+    if ( jobs > files->count )
+        jobs = files->count;
+
+    memset( &batch, 0, sizeof(batch) );
+    batch.config = tidyOptCompileConfig( tdoc );
+    batch.slots = calloc( files->count, sizeof(JobSlot) );
+    threads = calloc( jobs > 0 ? jobs : 1, sizeof(JobThread) );
+    if ( !batch.config || !batch.slots || !threads )
+        outOfMemory();
+
+    batch.count = files->count;
+    batch.window = 4 * jobs;
+    for ( i = 0; i < batch.count; ++i )
+    {
+        batch.slots[i].htmlfil = files->names[i];
+        tidyBufInit( &batch.slots[i].err );
+        tidyBufInit( &batch.slots[i].out );
+    }
+    jobLockInit( &batch.lock );
+    jobCondInit( &batch.cond );
+
+    while ( started < jobs && startJobThread(&threads[started], &batch) )
+        ++started;
+
+    /* Without a worker, do the work here before writing it out. */
+    if ( started == 0 )
+    {
+        batch.window = batch.count;
+        runJobs( &batch );
+    }
+
+    for ( i = 0; i < batch.count; ++i )
+    {
+        jobLock( &batch.lock );
+        while ( !batch.slots[i].done )
+            jobWait( &batch.cond, &batch.lock );
+        jobUnlock( &batch.lock );
+
+        writeJob( outfil, &batch.slots[i], totals );
+
+        jobLock( &batch.lock );
+        batch.written = i + 1;
+        jobWakeAll( &batch.cond );
+        jobUnlock( &batch.lock );
+    }
+
+    while ( started > 0 )
+        joinJobThread( threads[--started] );
+
+    jobCondFree( &batch.cond );
+    jobLockFree( &batch.lock );
+    tidyOptReleaseConfig( batch.config );
+    free( threads );
+    free( batch.slots );
+    files->count = 0;
+}
+
+
+/** Tidies the files listed in a file, with the main document or, if `jobs`
+ ** is more than one, with workers.
+ ** @result Returns no if the list cannot be read.
+ */
+static Bool tidyFileList( TidyDoc tdoc,        /**< The main document. */
+                          ctmbstr listfil,     /**< The list, or "-" for stdin. */
+                          uint jobs,           /**< The number of workers. */
+                          TidyTotals* totals   /**< The totals to add to. */
+                          )
+{
+    FileList listed = { NULL, 0, 0 };
+    tmbstr text = readFileList( listfil, &listed );
+    uint i;
+
+    if ( !text )
+        return no;
+
+    if ( jobs > 1 && listed.count > 0 )
+        tidyFiles( tdoc, &listed, jobs, totals );
+    else
+        for ( i = 0; i < listed.count; ++i )
+            tidyFile( tdoc, listed.names[i], totals );
+
+    free( (void*) listed.names );
+    free( text );
+    return yes;
+}
+
+
+/** @} end tidying_files group */
 /* MARK: - main() */
 /***************************************************************************//**
  ** @defgroup main Main
@@ -2076,13 +2624,14 @@ static Bool TIDY_CALL reportCallback(TidyMessage tmessage)
 int main( int argc, char** argv )
 {
     ctmbstr prog = argv[0];
-    ctmbstr cfgfil = NULL, errfil = NULL, htmlfil = NULL;
+    ctmbstr cfgfil = NULL, errfil = NULL;
     TidyDoc tdoc = NULL;
     int status = 0;
 
-    uint contentErrors = 0;
-    uint contentWarnings = 0;
-    uint accessWarnings = 0;
+    TidyTotals totals = { 0, 0, 0 };
+    FileList pending = { NULL, 0, 0 };  /* files waiting for workers */
+    uint jobs = 1;
+    Bool listedFiles = no;
 
 #if defined(ENABLE_DEBUG_LOG) && defined(_MSC_VER)
 #  if defined(_CRTDBG_MAP_ALLOC)
@@ -2158,6 +2707,10 @@ int main( int argc, char** argv )
             /* support -foo and --foo */
             ctmbstr arg = argv[1] + 1;
 
+            /* Options apply only to the files named after them. */
+            if ( pending.count > 0 )
+                tidyFiles( tdoc, &pending, jobs, &totals );
+
             if ( strcasecmp(arg, "xml") == 0)
                 tidyOptSetBool( tdoc, TidyXmlTags, yes );
 
@@ -2399,6 +2952,38 @@ int main( int argc, char** argv )
                 return 0;  /* success */
 
             }
+            else if ( strcasecmp(arg,  "jobs") == 0 ||
+                        strcasecmp(arg, "-jobs") == 0 )
+            {
+                char* end = NULL;
+                long njobs = argc >= 3 ? strtol( argv[2], &end, 10 ) : -1;
+
+                if ( end == argv[2] || (end && *end != '\0') || njobs < 0 )
+                {
+                    fprintf( errout, tidyLocalizedString(TC_STRING_JOBS_MUST_SPECIFY) );
+                    fprintf( errout, "\n" );
+                    tidyRelease( tdoc );
+                    return 2;
+                }
+                if ( njobs == 0 )
+                    jobs = processorCount();
+                else
+                    jobs = njobs < MAX_JOBS ? (uint) njobs : MAX_JOBS;
+                --argc;
+                ++argv;
+            }
+            else if ( strcasecmp(arg,  "files0-from") == 0 ||
+                        strcasecmp(arg, "-files0-from") == 0 )
+            {
+                if ( argc >= 3 )
+                {
+                    if ( !tidyFileList( tdoc, argv[2], jobs, &totals ) )
+                        ++totals.contentErrors;
+                    listedFiles = yes;
+                    --argc;
+                    ++argv;
+                }
+            }
             else if ( strncmp(argv[1], "--", 2 ) == 0)
             {
                 if ( tidyOptParseValue(tdoc, argv[1]+2, argv[2]) )
@@ -2490,64 +3075,13 @@ int main( int argc, char** argv )
         }
 
 
-        if ( argc > 1 )
-        {
-            htmlfil = argv[1];
-#ifdef ENABLE_DEBUG_LOG
-            SPRTF("Tidy: '%s'\n", htmlfil);
-#else /* !ENABLE_DEBUG_LOG */
-            /* Is #713 - show-filename option */
-            if (tidyOptGetBool(tdoc, TidyShowFilename))
-            {
-                fprintf(errout, "Tidy: '%s'", htmlfil);
-                fprintf(errout, "\n");
-            }
-#endif /* ENABLE_DEBUG_LOG yes/no */
-            if ( tidyOptGetBool(tdoc, TidyEmacs) || tidyOptGetBool(tdoc, TidyShowFilename))
-                tidySetEmacsFile( tdoc, htmlfil );
-            status = tidyParseFile( tdoc, htmlfil );
-        }
-        else
-        {
-            htmlfil = "stdin";
-            status = tidyParseStdin( tdoc );
-        }
-
-        if ( status >= 0 )
-            status = tidyCleanAndRepair( tdoc );
-
-        if ( status >= 0 ) {
-            status = tidyRunDiagnostics( tdoc );
-        }
-        if ( status > 1 ) /* If errors, do we want to force output? */
-            status = ( tidyOptGetBool(tdoc, TidyForceOutput) ? status : -1 );
+        if ( argc > 1 && jobs > 1 )
+            addFile( &pending, argv[1] );
+        else if ( argc > 1 )
+            tidyFile( tdoc, argv[1], &totals );
+        else if ( !listedFiles )
+            tidyFile( tdoc, NULL, &totals );
 
-        if ( status >= 0 && tidyOptGetBool(tdoc, TidyShowMarkup) )
-        {
-            if ( tidyOptGetBool(tdoc, TidyWriteBack) && argc > 1 )
-                status = tidySaveFile( tdoc, htmlfil );
-            else
-            {
-                ctmbstr outfil = tidyOptGetValue( tdoc, TidyOutFile );
-                if ( outfil ) {
-                    status = tidySaveFile( tdoc, outfil );
-                } else {
-#ifdef ENABLE_DEBUG_LOG
-                    static char tmp_buf[264];
-                    sprintf(tmp_buf,"%s.html",get_log_file());
-                    status = tidySaveFile( tdoc, tmp_buf );
-                    SPRTF("Saved tidied content to '%s'\n",tmp_buf);
-#else
-                    status = tidySaveStdout( tdoc );
-#endif
-                }
-            }
-        }
-        
-        contentErrors   += tidyErrorCount( tdoc );
-        contentWarnings += tidyWarningCount( tdoc );
-        accessWarnings  += tidyAccessWarningCount( tdoc );
-        
         --argc;
         ++argv;
         
@@ -2555,13 +3089,9 @@ int main( int argc, char** argv )
             break;
     } /* read command line loop */
 
-    /* blank line for screen formatting */
-    if ( errout == stderr && !contentErrors && !tidyOptGetBool( tdoc, TidyQuiet ) )
-        fprintf(errout, "\n");
-
-    /* footnote printing only if errors or warnings */
-    if ( contentErrors + contentWarnings > 0 )
-        tidyErrorSummary(tdoc);
+    if ( pending.count > 0 )
+        tidyFiles( tdoc, &pending, jobs, &totals );
+    free( (void*) pending.names );
 
     /* prints the general info, if applicable */
     tidyGeneralInfo(tdoc);
@@ -2570,10 +3100,10 @@ int main( int argc, char** argv )
     tidyRelease( tdoc );
     
     /* return status can be used by scripts */
-    if ( contentErrors > 0 )
+    if ( totals.contentErrors > 0 )
         return 2;
     
-    if ( contentWarnings > 0 )
+    if ( totals.contentWarnings > 0 )
         return 1;
     
     /* 0 signifies all is ok */
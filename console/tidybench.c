@@ -0,0 +1,510 @@
+/*\
+ *  tidybench.c - micro-benchmarks for LibTidy's fast paths
+ *
+ *  Each benchmark times a fast path against the plain way of doing the
+ *  same work, on the same input, and checks that both give the same
+ *  result. The plain way is what LibTidy itself falls back to, or did
+ *  before the fast path was added, so the times can be compared.
+ *
+ *  Usage: tidybench [benchmark|all [iterations]]
+ *  Runs every benchmark when none is named. Exits with 0 when every
+ *  pair of results matches, 1 otherwise. Uses library internals, so
+ *  it is always linked with the static library.
+ *
+\*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "tidy.h"
+#include "tidybuffio.h"
+#include "tidy-int.h"
+#include "streamio.h"
+#include "utf8.h"
+#include "tags.h"
+#include "attrs.h"
+#include "tmbstr.h"
+
+typedef struct {
+    const char* name;
+    const char* description;
+    Bool (*run)( TidyDocImpl* doc, uint iterations );
+    uint iterations;   /* default */
+} Benchmark;
+
+static double seconds( clock_t start )
+{
+    return (double)( clock() - start ) / CLOCKS_PER_SEC;
+}
+
+static void report( const char* name, const char* way, double secs,
+                    uint iterations, double units, const char* unit )
+{
+    double per = secs * 1e9 / ( (double) iterations * units );
+    printf( "tidybench: %-10s %-28s %8.3f s  %8.2f ns/%s\n",
+            name, way, secs, per, unit );
+}
+
+static Bool sameBuffer( const TidyBuffer* a, const TidyBuffer* b )
+{
+    return a->size == b->size &&
+           ( a->size == 0 || memcmp(a->bp, b->bp, a->size) == 0 );
+}
+
+
+/*\
+ * transcode - WIN1252 text to UTF-8
+ *
+ * The lexer copies text runs through the table SingleByteUTF8Map()
+ * builds. Otherwise each byte goes through ReadChar(), which decodes
+ * it, and is then encoded to UTF-8 again, as AddCharToLexer() does.
+ * The text is prose with smart quotes and dashes (bytes 0x91-0x97)
+ * and accented letters, the kind of input the table is meant for.
+\*/
+
+static void makeWin1252Text( TidyBuffer* buf, uint size )
+{
+    static const char* words[] = {
+        "the", "caf\xe9", "\x93quoted\x94", "text", "\x96", "it\x92s",
+        "na\xefve", "and", "r\xe9sum\xe9", "\x85", "of", "\x91single\x92"
+    };
+    uint i = 0;
+
+    tidyBufInit( buf );
+    while ( buf->size < size )
+    {
+        const char* w = words[i++ % (sizeof(words) / sizeof(words[0]))];
+        tidyBufAppend( buf, (void*) w, strlen(w) );
+        tidyBufPutByte( buf, ' ' );
+    }
+}
+
+static void transcodeByChar( TidyDocImpl* doc, TidyBuffer* in, TidyBuffer* out )
+{
+    StreamIn* s;
+    tmbchar buf[10];
+    int count;
+    uint c;
+
+    in->next = 0;  /* reading moves it on */
+    s = TY_(BufferInput)( doc, in, WIN1252 );
+    tidyBufClear( out );
+    while ( (c = TY_(ReadChar)(s)) != EndOfStream )
+    {
+        TY_(EncodeCharToUTF8Bytes)( c, buf, NULL, &count );
+        tidyBufAppend( out, buf, count );
+    }
+    TY_(freeStreamIn)( s );
+}
+
+static void transcodeByTable( TidyDocImpl* doc, TidyBuffer* in, TidyBuffer* out )
+{
+    StreamIn* s;
+    const byte* map;
+    ctmbstr run = NULL;
+    uint i, n, len;
+
+    in->next = 0;
+    s = TY_(BufferInput)( doc, in, WIN1252 );
+    map = TY_(SingleByteUTF8Map)( s );
+    len = TY_(PeekRawRun)( s, &run );
+    tidyBufClear( out );
+    for ( i = 0; i < len; i = n )
+    {
+        const byte* m;
+
+        /* copy ASCII in runs, as the lexer does */
+        for ( n = i; n < len && (byte) run[n] < 128; ++n )
+            /**/;
+        tidyBufAppend( out, (void*)(run + i), n - i );
+        if ( n == len )
+            break;
+        m = map + ( (byte) run[n++] - 128 ) * 4;
+        tidyBufAppend( out, (void*)(m + 1), m[0] & ~SBMAP_LOCATES );
+    }
+    TY_(freeStreamIn)( s );
+}
+
+static Bool benchTranscode( TidyDocImpl* doc, uint iterations )
+{
+    TidyBuffer in, byChar, byTable;
+    clock_t start;
+    double slow, fast;
+    uint i;
+    Bool same;
+
+    makeWin1252Text( &in, 1 << 20 );
+    tidyBufInit( &byChar );
+    tidyBufInit( &byTable );
+
+    start = clock();
+    for ( i = 0; i < iterations; ++i )
+        transcodeByChar( doc, &in, &byChar );
+    slow = seconds( start );
+
+    start = clock();
+    for ( i = 0; i < iterations; ++i )
+        transcodeByTable( doc, &in, &byTable );
+    fast = seconds( start );
+
+    report( "transcode", "ReadChar() per byte", slow, iterations, in.size, "byte" );
+    report( "transcode", "SingleByteUTF8Map() table", fast, iterations, in.size, "byte" );
+
+    same = sameBuffer( &byChar, &byTable );
+    if ( !same )
+        fprintf( stderr, "tidybench: transcode: the table gives different text\n" );
+    tidyBufFree( &in );
+    tidyBufFree( &byChar );
+    tidyBufFree( &byTable );
+    return same;
+}
+
+
+/*\
+ * lookup - tag and attribute names to their definitions
+ *
+ * Built-in names are found through the perfect hashes in tagshash.h and
+ * attrshash.h. Before those, each document kept a chained hash of the
+ * names it had met, and on a miss walked every built-in definition,
+ * adding the one it found to the hash. Unknown names walked them all,
+ * every time. The old way is rebuilt here over the same definitions.
+ * The names are heap copies, so neither way can match them by pointer.
+\*/
+
+#define OLD_HASH_SIZE 178u  /* ELEMENT_HASH_SIZE and ATTRIBUTE_HASH_SIZE */
+#define MAX_DEFS 512
+
+typedef struct _OldEntry {
+    ctmbstr name;
+    struct _OldEntry* next;
+} OldEntry;
+
+typedef struct {
+    ctmbstr names[MAX_DEFS];     /* Every built-in name, in table order. */
+    uint count;
+    Bool caseless;               /* Attributes ignore case. */
+    OldEntry* hashtab[OLD_HASH_SIZE];
+    OldEntry pool[MAX_DEFS];     /* Entries for the names found so far. */
+    uint used;
+} OldTable;
+
+static uint oldHash( ctmbstr s )
+{
+    uint hashval;
+
+    for ( hashval = 0; *s != '\0'; s++ )
+        hashval = *s + 31*hashval;
+
+    return hashval % OLD_HASH_SIZE;
+}
+
+static int oldCompare( const OldTable* t, ctmbstr a, ctmbstr b )
+{
+    return t->caseless ? TY_(tmbstrcasecmp)( a, b ) : TY_(tmbstrcmp)( a, b );
+}
+
+static ctmbstr oldLookup( OldTable* t, ctmbstr s )
+{
+    const OldEntry* p;
+    uint i;
+
+    for ( p = t->hashtab[oldHash(s)]; p; p = p->next )
+        if ( oldCompare(t, s, p->name) == 0 )
+            return p->name;
+
+    for ( i = 0; i < t->count; ++i )
+    {
+        if ( oldCompare(t, s, t->names[i]) == 0 )
+        {
+            OldEntry* np = &t->pool[t->used++];
+            uint h = oldHash( t->names[i] );
+
+            np->name = t->names[i];
+            np->next = t->hashtab[h];
+            t->hashtab[h] = np;
+            return np->name;
+        }
+    }
+    return NULL;
+}
+
+static void oldClear( OldTable* t )
+{
+    memset( t->hashtab, 0, sizeof(t->hashtab) );
+    t->used = 0;
+}
+
+/* Element and attribute names in rough proportion to a typical page,
+   with a few that are not built in: namespaced, custom and data-*. */
+static const char* tagTokens[] = {
+    "p", "a", "div", "span", "li", "td", "tr", "a", "img", "br", "div",
+    "span", "b", "i", "ul", "table", "p", "a", "html", "head", "body",
+    "title", "meta", "link", "script", "style", "h1", "h2", "form",
+    "input", "option", "select", "label", "strong", "em", "nav",
+    "section", "footer", "o:p", "my-widget", "svg:path", "center"
+};
+
+static const char* attrTokens[] = {
+    "href", "class", "id", "style", "src", "alt", "class", "href",
+    "width", "height", "type", "name", "value", "onclick", "title",
+    "rel", "content", "lang", "class", "data-id", "aria-label", "role",
+    "xmlns:o", "tabindex", "target", "colspan", "border", "data-toggle"
+};
+
+#define TOKEN_COUNT(a) ( sizeof(a) / sizeof(a[0]) )
+
+static tmbstr* copyTokens( const char** tokens, uint count )
+{
+    tmbstr* copies = (tmbstr*) malloc( count * sizeof(tmbstr) );
+    uint i;
+
+    for ( i = 0; i < count; ++i )
+    {
+        copies[i] = (tmbstr) malloc( strlen(tokens[i]) + 1 );
+        strcpy( copies[i], tokens[i] );
+    }
+    return copies;
+}
+
+static void freeTokens( tmbstr* copies, uint count )
+{
+    uint i;
+
+    for ( i = 0; i < count; ++i )
+        free( copies[i] );
+    free( copies );
+}
+
+static ctmbstr newTagLookup( TidyDocImpl* doc, ctmbstr s )
+{
+    return TY_(BuiltInTagName)( doc, s );
+}
+
+static ctmbstr newAttrLookup( TidyDocImpl* doc, ctmbstr s )
+{
+    AttVal av;
+    const Attribute* np;
+
+    memset( &av, 0, sizeof(av) );
+    av.attribute = (tmbstr) s;
+    np = TY_(FindAttribute)( doc, &av );
+    return np ? np->name : NULL;
+}
+
+static Bool sameName( ctmbstr a, ctmbstr b )
+{
+    return a == b || ( a && b && strcmp(a, b) == 0 );
+}
+
+/* Times one kind of name, old way and new, over rounds of tokens. */
+static Bool benchNames( TidyDocImpl* doc, const char* kind, OldTable* old,
+                        ctmbstr (*lookup)( TidyDocImpl*, ctmbstr ),
+                        const char** tokens, uint count, uint iterations )
+{
+    tmbstr* names = copyTokens( tokens, count );
+    ulong rounds = (ulong) iterations * 10000;
+    ulong r, hits = 0, check = 0;
+    clock_t start;
+    double slow, fast;
+    char way[40];
+    uint i, failures = 0;
+
+    for ( i = 0; i < count; ++i )
+    {
+        ctmbstr a = oldLookup( old, names[i] );
+        ctmbstr b = lookup( doc, names[i] );
+
+        if ( !sameName(a, b) )
+        {
+            fprintf( stderr, "tidybench: lookup: %s %s: old way finds %s, "
+                     "new way %s\n", kind, names[i], a ? a : "nothing",
+                     b ? b : "nothing" );
+            ++failures;
+        }
+    }
+
+    /* each document used to start with an empty hash */
+    oldClear( old );
+    start = clock();
+    for ( r = 0; r < rounds; ++r )
+    {
+        if ( r % 1000 == 0 )
+            oldClear( old );
+        for ( i = 0; i < count; ++i )
+            hits += oldLookup( old, names[i] ) != NULL;
+    }
+    slow = seconds( start );
+
+    start = clock();
+    for ( r = 0; r < rounds; ++r )
+        for ( i = 0; i < count; ++i )
+            check += lookup( doc, names[i] ) != NULL;
+    fast = seconds( start );
+
+    sprintf( way, "%s, hash and walk", kind );
+    report( "lookup", way, slow, iterations * 10000, count, "name" );
+    sprintf( way, "%s, perfect hash", kind );
+    report( "lookup", way, fast, iterations * 10000, count, "name" );
+
+    if ( hits != check )
+    {
+        fprintf( stderr, "tidybench: lookup: %s: the ways found %lu and %lu "
+                 "names\n", kind, hits, check );
+        ++failures;
+    }
+    freeTokens( names, count );
+    return failures == 0;
+}
+
+static Bool benchLookup( TidyDocImpl* doc, uint iterations )
+{
+    static OldTable tags, attrs;
+    const Dict* tag;
+    const Attribute* attr;
+    uint id;
+    Bool ok;
+
+    memset( &tags, 0, sizeof(tags) );
+    memset( &attrs, 0, sizeof(attrs) );
+    for ( id = 1; id < N_TIDY_TAGS && tags.count < MAX_DEFS; ++id )
+        if ( (tag = TY_(LookupTagDef)(doc, (TidyTagId) id)) != NULL )
+            tags.names[tags.count++] = tag->name;
+    for ( id = 0; id < N_TIDY_ATTRIBS && attrs.count < MAX_DEFS; ++id )
+        if ( (attr = TY_(LookupAttrDef)((TidyAttrId) id)) != NULL && attr->name )
+            attrs.names[attrs.count++] = attr->name;
+    attrs.caseless = yes;
+
+    ok = benchNames( doc, "tags", &tags, newTagLookup,
+                     tagTokens, TOKEN_COUNT(tagTokens), iterations );
+    ok = benchNames( doc, "attributes", &attrs, newAttrLookup,
+                     attrTokens, TOKEN_COUNT(attrTokens), iterations ) && ok;
+    return ok;
+}
+
+
+/*\
+ * reset - many documents with one TidyDoc
+ *
+ * Tidies the same small page over and over, once creating, setting up
+ * and releasing a TidyDoc for each copy, and once resetting a single
+ * TidyDoc between copies with tidyReset(). Small pages are where the
+ * cost of setting up a document shows.
+\*/
+
+static const char* resetPage =
+    "<title>Page</title><h1>Heading</h1><p class=intro>Some <b>bold "
+    "<i>and</b> italic</i> text, a <a href=\"/x\">link</a> and an "
+    "<img src=a.png>.<table><tr><td>1<td>2<tr><td>3<td>4</table>"
+    "<ul><li>one<li>two<li>three</ul><p>caf\xc3\xa9 &amp; more</p>";
+
+static void resetOptions( TidyDoc tdoc, TidyBuffer* err )
+{
+    tidySetErrorBuffer( tdoc, err );
+    tidyOptSetBool( tdoc, TidyForceOutput, yes );
+    tidyOptSetValue( tdoc, TidyIndentContent, "auto" );
+    tidyOptSetInt( tdoc, TidyWrapLen, 68 );
+}
+
+static void resetTidy( TidyDoc tdoc, TidyBuffer* out, TidyBuffer* err )
+{
+    tidyBufClear( out );
+    tidyBufClear( err );
+    tidyParseString( tdoc, resetPage );
+    tidyCleanAndRepair( tdoc );
+    tidyRunDiagnostics( tdoc );
+    tidySaveBuffer( tdoc, out );
+}
+
+static Bool benchReset( TidyDocImpl* ARG_UNUSED(doc), uint iterations )
+{
+    TidyBuffer out1, err1, out2, err2;
+    TidyDoc tdoc;
+    clock_t start;
+    double slow, fast;
+    uint i;
+    Bool same;
+
+    tidyBufInit( &out1 );
+    tidyBufInit( &err1 );
+    tidyBufInit( &out2 );
+    tidyBufInit( &err2 );
+
+    start = clock();
+    for ( i = 0; i < iterations; ++i )
+    {
+        tdoc = tidyCreate();
+        resetOptions( tdoc, &err1 );
+        resetTidy( tdoc, &out1, &err1 );
+        tidyRelease( tdoc );
+    }
+    slow = seconds( start );
+
+    start = clock();
+    tdoc = tidyCreate();
+    resetOptions( tdoc, &err2 );
+    for ( i = 0; i < iterations; ++i )
+    {
+        if ( i > 0 )
+            tidyReset( tdoc );
+        resetTidy( tdoc, &out2, &err2 );
+    }
+    tidyRelease( tdoc );
+    fast = seconds( start );
+
+    report( "reset", "tidyCreate()/tidyRelease()", slow, iterations, 1, "doc" );
+    report( "reset", "tidyReset()", fast, iterations, 1, "doc" );
+
+    same = sameBuffer( &out1, &out2 ) && sameBuffer( &err1, &err2 );
+    if ( !same )
+        fprintf( stderr, "tidybench: reset: the reset document gives "
+                 "different results\n" );
+    tidyBufFree( &out1 );
+    tidyBufFree( &err1 );
+    tidyBufFree( &out2 );
+    tidyBufFree( &err2 );
+    return same;
+}
+
+
+static const Benchmark benchmarks[] = {
+    { "transcode", "WIN1252 text to UTF-8, per byte and by table",
+      benchTranscode, 20 },
+    { "lookup", "tag and attribute names, hash and walk or perfect hash",
+      benchLookup, 100 },
+    { "reset", "small pages, a TidyDoc each or one reset between them",
+      benchReset, 20000 },
+};
+
+#define BENCHMARK_COUNT ( sizeof(benchmarks) / sizeof(benchmarks[0]) )
+
+int main( int argc, char** argv )
+{
+    TidyDoc tdoc = tidyCreate();
+    TidyDocImpl* doc = tidyDocToImpl( tdoc );
+    const char* only = argc > 1 && strcmp(argv[1], "all") != 0 ? argv[1] : NULL;
+    uint iterations = argc > 2 ? (uint) atoi( argv[2] ) : 0;
+    uint ran = 0, failures = 0, i;
+
+    for ( i = 0; i < BENCHMARK_COUNT; ++i )
+    {
+        const Benchmark* b = &benchmarks[i];
+
+        if ( only && strcmp(only, b->name) != 0 )
+            continue;
+        ++ran;
+        if ( !b->run( doc, iterations ? iterations : b->iterations ) )
+            ++failures;
+    }
+    tidyRelease( tdoc );
+
+    if ( ran == 0 )
+    {
+        fprintf( stderr, "usage: tidybench [benchmark|all [iterations]]\n" );
+        for ( i = 0; i < BENCHMARK_COUNT; ++i )
+            fprintf( stderr, "  %-10s %s\n", benchmarks[i].name,
+                     benchmarks[i].description );
+        return 1;
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,250 @@
+/*\
+ *  tidyjobscheck.c - checks that `tidy -jobs` gives what tidying in turn does
+ *
+ *  Writes some sample files to the current directory, then runs the given
+ *  tidy on them for several sets of options: once tidying the files in
+ *  turn, and once with `-jobs 4`. The markup, the reports and the exit
+ *  status must be the same. The files are named on the command line,
+ *  with one that doesn't exist among them, and then listed, separated by
+ *  NUL characters, in a file given to `-files0-from`. With `-m`, the
+ *  files written back must be the same.
+ *
+ *  Usage: tidyjobscheck path/to/tidy
+ *  Exits with 0 when all the results match, 1 otherwise.
+ *
+\*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#  define exitStatus(s) (s)
+#else
+#  include <sys/wait.h>
+#  define exitStatus(s) ( WIFEXITED(s) ? WEXITSTATUS(s) : -1 )
+#endif
+
+static const char* samples[] = {
+    "<title>t</title><p>clean",
+    "<p>x</b><table><td>1</table>",
+    "<title>t</title><p>\x93quoted\x94 <font>f</font>",
+    "<html><body><p>bad<<<foo></p></body><body>",
+    "<title>t</title><img src=x>",
+    "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.0 Strict//EN\" "
+    "\"http://www.w3.org/TR/xhtml1/DTD/xhtml1-strict.dtd\">"
+    "<html xmlns=\"http://www.w3.org/1999/xhtml\"><title>x</title><p>xhtml",
+    "<title>t</title><form><input type=text></form><a href=\"a b\">link</a>",
+    "<o:p></o:p><p class=MsoNormal>Word</p><my-widget>w</my-widget>"
+};
+
+static const char* optionSets[] = {
+    "",
+    "-q",
+    "-e",
+    "--force-output yes",
+    "-access 3",
+    "-q --show-errors 2",
+    "-q -asxhtml",
+    "-q -m"
+};
+
+#define SAMPLE_COUNT ( sizeof(samples) / sizeof(samples[0]) )
+#define OPTION_SET_COUNT ( sizeof(optionSets) / sizeof(optionSets[0]) )
+
+#define FILE_COUNT 24       /* More than the workers may get ahead by. */
+#define MISSING_FILE 5      /* Where the file that doesn't exist goes. */
+
+typedef struct {
+    char* out;              /* The markup. */
+    char* err;              /* The reports. */
+    char* written;          /* The files, after being written back. */
+    int status;
+} Run;
+
+static const char* tidy;
+
+
+static void fileName( char* name, unsigned i )
+{
+    if ( i == MISSING_FILE )
+        strcpy( name, "tidyjobs-missing.html" );
+    else
+        sprintf( name, "tidyjobs-%u.html", i );
+}
+
+/* Writes the sample files afresh, with a comment to tell them apart. */
+static int writeSamples( void )
+{
+    char name[32];
+    unsigned i;
+
+    for ( i = 0; i < FILE_COUNT; ++i )
+    {
+        FILE* f;
+
+        fileName( name, i );
+        if ( i == MISSING_FILE )
+        {
+            remove( name );
+            continue;
+        }
+        if ( !(f = fopen(name, "wb")) )
+        {
+            fprintf( stderr, "tidyjobscheck: cannot write %s\n", name );
+            return 0;
+        }
+        fprintf( f, "<!-- %u -->%s", i, samples[i % SAMPLE_COUNT] );
+        fclose( f );
+    }
+    return 1;
+}
+
+static int writeList( void )
+{
+    char name[32];
+    unsigned i;
+    FILE* f = fopen( "tidyjobs-list", "wb" );
+
+    if ( !f )
+        return 0;
+    for ( i = 0; i < FILE_COUNT; ++i )
+    {
+        fileName( name, i );
+        fwrite( name, 1, strlen(name) + 1, f );
+    }
+    fclose( f );
+    return 1;
+}
+
+/* Reads a whole file, or returns an empty string if there is none. */
+static char* readFile( const char* name )
+{
+    FILE* f = fopen( name, "rb" );
+    char* text = NULL;
+    size_t size = 0, len = 0, n;
+
+    do
+    {
+        if ( len == size )
+        {
+            size = size ? 2 * size : 4096;
+            text = (char*) realloc( text, size + 1 );
+        }
+        n = f ? fread( text + len, 1, size - len, f ) : 0;
+        len += n;
+    } while ( n > 0 );
+    text[len] = '\0';
+    if ( f )
+        fclose( f );
+    return text;
+}
+
+/* Runs tidy with options on the files, named or listed, into r. */
+static int runTidy( const char* jobs, const char* options, int listed, Run* r )
+{
+    char command[2048], name[32];
+    size_t len;
+    unsigned i;
+
+    if ( !writeSamples() )
+        return 0;
+    len = (size_t) sprintf( command, "\"%s\" %s %s", tidy, jobs, options );
+    if ( listed )
+        len += (size_t) sprintf( command + len, " -files0-from tidyjobs-list" );
+    else
+    {
+        for ( i = 0; i < FILE_COUNT; ++i )
+        {
+            fileName( name, i );
+            len += (size_t) sprintf( command + len, " %s", name );
+        }
+    }
+    sprintf( command + len, " > tidyjobs-out 2> tidyjobs-err" );
+
+    r->status = exitStatus( system(command) );
+    r->out = readFile( "tidyjobs-out" );
+    r->err = readFile( "tidyjobs-err" );
+
+    /* everything that is in the files afterwards */
+    r->written = (char*) calloc( 1, 1 );
+    for ( i = 0; i < FILE_COUNT; ++i )
+    {
+        char* text;
+
+        fileName( name, i );
+        text = readFile( name );
+        len = strlen( r->written );
+        r->written = (char*) realloc( r->written, len + strlen(text) + 1 );
+        strcpy( r->written + len, text );
+        free( text );
+    }
+    return 1;
+}
+
+static void freeRun( Run* r )
+{
+    free( r->out );
+    free( r->err );
+    free( r->written );
+}
+
+int main( int argc, char** argv )
+{
+    unsigned failures = 0, set;
+    int listed;
+
+    if ( argc != 2 )
+    {
+        fprintf( stderr, "usage: tidyjobscheck path/to/tidy\n" );
+        return 1;
+    }
+    tidy = argv[1];
+    if ( !writeList() )
+    {
+        fprintf( stderr, "tidyjobscheck: cannot write the file list\n" );
+        return 1;
+    }
+
+    for ( set = 0; set < OPTION_SET_COUNT; ++set )
+    {
+        for ( listed = 0; listed <= 1; ++listed )
+        {
+            Run inTurn, parallel;
+            const char* what = NULL;
+
+            if ( !runTidy("", optionSets[set], listed, &inTurn) ||
+                 !runTidy("-jobs 4", optionSets[set], listed, &parallel) )
+                return 1;
+
+            if ( inTurn.status < 0 || !*inTurn.err )
+            {
+                fprintf( stderr, "tidyjobscheck: %s didn't run\n", tidy );
+                return 1;
+            }
+
+            if ( strcmp(inTurn.out, parallel.out) != 0 )
+                what = "markup";
+            else if ( strcmp(inTurn.err, parallel.err) != 0 )
+                what = "reports";
+            else if ( inTurn.status != parallel.status )
+                what = "exit status";
+            else if ( strcmp(inTurn.written, parallel.written) != 0 )
+                what = "files written back";
+            if ( what )
+            {
+                fprintf( stderr, "tidyjobscheck: options \"%s\", %s files: "
+                         "-jobs gives different %s\n", optionSets[set],
+                         listed ? "listed" : "named", what );
+                ++failures;
+            }
+            freeRun( &inTurn );
+            freeRun( &parallel );
+        }
+    }
+
+    printf( "tidyjobscheck: %u option sets, %u files: %s\n",
+            (unsigned) OPTION_SET_COUNT, (unsigned) FILE_COUNT,
+            failures ? "FAILED" : "ok" );
+    return failures ? 1 : 0;
+}
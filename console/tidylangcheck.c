@@ -0,0 +1,103 @@
+/*\
+ *  tidylangcheck.c - checks the string index of every installed language
+ *
+ *  LibTidy finds localized strings through an index of each language's
+ *  dictionary. This walks every dictionary the plain way, entry by
+ *  entry, and checks that the index finds the same string for each key
+ *  and plural form, including keys and forms a language doesn't have.
+ *
+ *  Usage: tidylangcheck
+ *  Exits with 0 when every lookup matches, 1 otherwise.
+ *
+\*/
+
+#include <stdio.h>
+#include "tidy.h"
+#include "language.h"
+
+#define MAX_PLURAL_FORMS 4
+#define DICTIONARY_SIZE ( sizeof(languageDictionary) / sizeof(languageDictionaryEntry) )
+
+/* The first entry for the key and plural form, as a walk finds it. */
+static ctmbstr tidyLocalizedStringScan( uint messageType, languageDefinition *definition, uint pluralForm )
+{
+    uint i;
+    languageDictionary *dictionary = &definition->messages;
+
+    for (i = 0; i < DICTIONARY_SIZE && (*dictionary)[i].value; ++i)
+    {
+        if ( (*dictionary)[i].key == messageType && (*dictionary)[i].pluralForm == pluralForm )
+        {
+            return (*dictionary)[i].value;
+        }
+    }
+    return NULL;
+}
+
+/* Compares the index with the walk for one key and plural form. */
+static uint checkString( ctmbstr code, languageDefinition *definition, uint key, uint form )
+{
+    ctmbstr indexed = TY_(tidyLocalizedStringForm)( key, definition, form );
+    ctmbstr scanned = tidyLocalizedStringScan( key, definition, form );
+
+    if ( indexed == scanned )
+        return 0;
+    fprintf( stderr, "tidylangcheck: %s: key %u, plural form %u: index finds %s%s%s, "
+             "the dictionary %s%s%s\n", code, key, form,
+             indexed ? "\"" : "", indexed ? indexed : "nothing", indexed ? "\"" : "",
+             scanned ? "\"" : "", scanned ? scanned : "nothing", scanned ? "\"" : "" );
+    return 1;
+}
+
+static uint checkLanguage( ctmbstr code, languageDefinition *definition )
+{
+    languageDictionary *dictionary = &definition->messages;
+    uint failures = 0, count, key, form;
+
+    for (count = 0; count < DICTIONARY_SIZE && (*dictionary)[count].value; ++count)
+        /**/;
+    if ( count == DICTIONARY_SIZE )
+    {
+        fprintf( stderr, "tidylangcheck: %s: the dictionary fills all %u entries, "
+                 "leaving none to end it\n", code, (uint) DICTIONARY_SIZE );
+        return 1;
+    }
+
+    for ( key = 0; key < TIDYSTRINGS_LAST; ++key )
+        for ( form = 0; form < MAX_PLURAL_FORMS; ++form )
+            failures += checkString( code, definition, key, form );
+
+    printf( "tidylangcheck: %s: %u entries, %s\n", code, count,
+            failures ? "FAILED" : "ok" );
+    return failures;
+}
+
+int main( void )
+{
+    TidyDoc tdoc = tidyCreate();  /* builds the indexes */
+    TidyIterator iter = getInstalledLanguageList();
+    uint languages = 0, failures = 0;
+
+    while ( iter )
+    {
+        ctmbstr code = getNextInstalledLanguage( &iter );
+        languageDefinition *definition = TY_(tidyTestLanguage)( code );
+
+        ++languages;
+        if ( !definition )
+        {
+            fprintf( stderr, "tidylangcheck: %s is listed but not installed\n", code );
+            ++failures;
+            continue;
+        }
+        failures += checkLanguage( code, definition );
+    }
+    tidyRelease( tdoc );
+
+    if ( languages == 0 )
+    {
+        fprintf( stderr, "tidylangcheck: no languages are installed\n" );
+        ++failures;
+    }
+    return failures ? 1 : 0;
+}
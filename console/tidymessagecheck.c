@@ -0,0 +1,636 @@
+/*\
+ *  tidymessagecheck.c - checks the messages LibTidy builds on demand
+ *
+ *  A message's strings are formatted from a copy of its arguments only
+ *  when they are asked for. For each report, the report callback, which
+ *  is given the original arguments, formats the message straight away,
+ *  as Tidy used to; the message callback that follows must then give
+ *  the same text. This is done in English and in the other installed
+ *  languages.
+ *
+ *  Muted reports are dropped before they are built when nothing else
+ *  would see them. Each document is tidied with some codes muted, with
+ *  and without a message callback, and once with nothing muted: the
+ *  reports written must be the same whether or not the messages were
+ *  built, none of them may be a muted one, the callback must see the
+ *  muted ones flagged as such, and the counts must not change.
+ *
+ *  Recorded messages must read back as the message callback saw them,
+ *  one for one: code, level, line, column and text. The records are
+ *  read both from a run that also has a callback and from one that
+ *  does not, in which nothing may be written to the error buffer.
+ *
+ *  With report-repeats set, a document repeating one warning must show
+ *  exactly that many of it, in the error buffer, to the callback and in
+ *  the records, followed by one line saying how many more there were,
+ *  while the warning count stays that of showing them all.
+ *
+ *  Usage: tidymessagecheck
+ *  Exits with 0 when all the checks pass, 1 otherwise.
+ *
+\*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tidy.h"
+#include "tidybuffio.h"
+
+#define MESSAGE_SIZE 2048  /* sizeMessageBuf in LibTidy */
+
+static const char* samples[] = {
+    "<title>t</title><p>Some <b>bold <i>and</b> italic</i> text"
+    "<table><tr><td>cell<td>cell</table><ul><li>one<li>two</ul>",
+
+    "<html><body><font face=Arial><p align=center>Centered&nbsp;"
+    "<img src=a.png><p>caf\xc3\xa9 \xff\xfe &ldquo;q&rdquo; &bogus; &#xD800;"
+    "</font><p unknown=1 id=x><p id=x>dup</p></body><body>",
+
+    "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\">"
+    "<title>t</title><a href=\"a b\"><div>block</div></a><table summary>"
+    "<caption><p>p</caption><tr><td>x</table><frameset><img src=x.gif>"
+    "<applet code=x></applet><blink>b</blink><my-widget>w</my-widget>",
+
+    "<o:p></o:p><p class=MsoNormal style='mso-x:1'>Word<span lang=EN>"
+    "text</span></p><![if !supportEmptyParas]>&nbsp;<![endif]><script>"
+    "x</script><style>p{}</style><form><input type=text></form>"
+};
+
+static const char* optionSets[] = {
+    "",
+    "accessibility-check|3|show-info|yes",
+    "output-xhtml|yes|clean|yes|word-2000|yes|drop-proprietary-attributes|yes",
+    "input-xml|yes"
+};
+
+#define SAMPLE_COUNT ( sizeof(samples) / sizeof(samples[0]) )
+#define OPTION_SET_COUNT ( sizeof(optionSets) / sizeof(optionSets[0]) )
+
+static void setOptions( TidyDoc tdoc, const char* optionSet )
+{
+    char options[256];
+    char *name, *value, *end;
+
+    if ( !*optionSet )
+        return;
+    strncpy( options, optionSet, sizeof(options) - 1 );
+    options[sizeof(options) - 1] = '\0';
+    for ( name = options; name; name = end )
+    {
+        value = strchr( name, '|' );
+        *value++ = '\0';
+        end = strchr( value, '|' );
+        if ( end )
+            *end++ = '\0';
+        tidyOptParseValue( tdoc, name, value );
+    }
+}
+
+/* Tidies html with tdoc, throwing the markup away. */
+static void tidyDocument( TidyDoc tdoc, const char* html )
+{
+    TidyBuffer out;
+
+    tidyBufInit( &out );
+    tidyOptSetBool( tdoc, TidyForceOutput, yes );
+    if ( tidyParseString(tdoc, html) >= 0 && tidyCleanAndRepair(tdoc) >= 0 )
+    {
+        tidyRunDiagnostics( tdoc );
+        tidySaveBuffer( tdoc, &out );
+    }
+    tidyErrorSummary( tdoc );
+    tidyBufFree( &out );
+}
+
+
+/*\
+ * Lazily formatted text against text formatted from the arguments
+\*/
+
+typedef struct {
+    Bool pending;                   /* The report callback just ran. */
+    uint code;
+    char eagerDefault[MESSAGE_SIZE];
+    char eager[MESSAGE_SIZE];
+    uint reports;                   /* Messages compared. */
+    uint failures;
+} LazyCheck;
+
+static LazyCheck lazy;
+
+static Bool TIDY_CALL lazyReport( TidyDoc ARG_UNUSED(tdoc), TidyReportLevel ARG_UNUSED(lvl),
+                                  uint ARG_UNUSED(line), uint ARG_UNUSED(col),
+                                  ctmbstr key, va_list args )
+{
+    va_list copy;
+
+    lazy.code = tidyErrorCodeFromKey( key );
+    va_copy( copy, args );
+    vsnprintf( lazy.eagerDefault, MESSAGE_SIZE, tidyDefaultString(lazy.code), copy );
+    va_end( copy );
+    va_copy( copy, args );
+    vsnprintf( lazy.eager, MESSAGE_SIZE, tidyLocalizedString(lazy.code), copy );
+    va_end( copy );
+    lazy.pending = yes;
+    return yes;
+}
+
+static Bool TIDY_CALL lazyMessage( TidyMessage tmessage )
+{
+    uint code = tidyGetMessageCode( tmessage );
+    const char* what = NULL;
+
+    /* dialogue doesn't go to the report callback */
+    if ( tidyGetMessageLevel(tmessage) > TidyFatal )
+        return yes;
+
+    if ( !lazy.pending || lazy.code != code )
+        what = "has no report callback";
+    else if ( strcmp(tidyGetMessageDefault(tmessage), lazy.eagerDefault) != 0 )
+        what = "has different text in English";
+    else if ( strcmp(tidyGetMessage(tmessage), lazy.eager) != 0 )
+        what = "has different localized text";
+    lazy.pending = no;
+    ++lazy.reports;
+
+    if ( what )
+    {
+        fprintf( stderr, "tidymessagecheck: %s, line %d column %d, %s:\n"
+                 "  lazy:  %s\n  eager: %s\n", tidyGetMessageKey(tmessage),
+                 tidyGetMessageLine(tmessage), tidyGetMessageColumn(tmessage),
+                 what, tidyGetMessage(tmessage), lazy.eager );
+        ++lazy.failures;
+    }
+    return yes;
+}
+
+static uint checkLazyText( void )
+{
+    static const char* languages[] = { "en", "fr", "es", "zh_cn" };
+    TidyBuffer err;
+    uint l, set, i;
+
+    tidyBufInit( &err );
+    memset( &lazy, 0, sizeof(lazy) );
+    for ( l = 0; l < sizeof(languages) / sizeof(languages[0]); ++l )
+    {
+        if ( !tidySetLanguage(languages[l]) )
+            continue;
+        for ( set = 0; set < OPTION_SET_COUNT; ++set )
+        {
+            for ( i = 0; i < SAMPLE_COUNT; ++i )
+            {
+                TidyDoc tdoc = tidyCreate();
+
+                tidySetErrorBuffer( tdoc, &err );
+                tidySetReportCallback( tdoc, lazyReport );
+                tidySetMessageCallback( tdoc, lazyMessage );
+                setOptions( tdoc, optionSets[set] );
+                tidyDocument( tdoc, samples[i] );
+                tidyRelease( tdoc );
+            }
+        }
+    }
+    tidySetLanguage( "en" );
+    tidyBufFree( &err );
+
+    printf( "tidymessagecheck: lazy text: %u reports: %s\n", lazy.reports,
+            lazy.failures ? "FAILED" : "ok" );
+    return lazy.failures;
+}
+
+
+/*\
+ * Muted reports
+\*/
+
+typedef struct {
+    const char* mute;
+    const char* options;
+} MuteSet;
+
+static const MuteSet muteSets[] = {
+    { "INSERTING_TAG,MISSING_ENDTAG_BEFORE,TRIM_EMPTY_ELEMENT", "" },
+    { "MISSING_DOCTYPE,UNKNOWN_ELEMENT", "show-warnings|no" },
+    { "INSERTING_TAG,DISCARDING_UNEXPECTED", "quiet|yes|show-errors|1" },
+    { "MISSING_DOCTYPE,NON_MATCHING_ENDTAG,TRIM_EMPTY_ELEMENT",
+      "accessibility-check|3|show-info|yes" }
+};
+
+#define MUTE_SET_COUNT ( sizeof(muteSets) / sizeof(muteSets[0]) )
+
+typedef struct {
+    const char* codes;              /* The codes muted in the set. */
+    Bool unmuted;                   /* This run mutes nothing. */
+    TidyBuffer output;              /* Output of the muted codes' reports. */
+    uint seen;                      /* Muted reports seen. */
+    uint failures;
+} MuteCheck;
+
+static MuteCheck muted;
+
+static Bool isMuted( const char* key )
+{
+    const char* p = muted.codes;
+    size_t len = strlen( key );
+
+    while ( (p = strstr(p, key)) != NULL )
+    {
+        if ( (p == muted.codes || p[-1] == ',') && (p[len] == ',' || !p[len]) )
+            return yes;
+        p += len;
+    }
+    return no;
+}
+
+static Bool TIDY_CALL muteMessage( TidyMessage tmessage )
+{
+    ctmbstr key = tidyGetMessageKey( tmessage );
+    ctmbstr output;
+
+    if ( !isMuted(key) )
+        return yes;
+    if ( muted.unmuted )
+    {
+        /* remember how the report reads when it isn't muted */
+        output = tidyGetMessageOutput( tmessage );
+        tidyBufAppend( &muted.output, (void*) output, strlen(output) + 1 );
+    }
+    else if ( !tidyGetMessageIsMuted(tmessage) )
+    {
+        fprintf( stderr, "tidymessagecheck: %s is muted but the callback "
+                 "is told it isn't\n", key );
+        ++muted.failures;
+    }
+    ++muted.seen;
+    return yes;
+}
+
+/* Tidies html into err with the options of set, muting mute if given. */
+static void tidyMuted( const MuteSet* set, const char* mute, const char* html,
+                       Bool callback, TidyBuffer* err, uint counts[2] )
+{
+    TidyDoc tdoc = tidyCreate();
+
+    tidyBufClear( err );
+    tidySetErrorBuffer( tdoc, err );
+    if ( callback )
+        tidySetMessageCallback( tdoc, muteMessage );
+    setOptions( tdoc, set->options );
+    if ( mute )
+        tidyOptParseValue( tdoc, "mute", mute );
+    tidyDocument( tdoc, html );
+    counts[0] = tidyErrorCount( tdoc );
+    counts[1] = tidyWarningCount( tdoc );
+    tidyRelease( tdoc );
+    tidyBufPutByte( err, '\0' );
+}
+
+static uint checkMutedCodes( void )
+{
+    TidyBuffer plain, called, unmuted;
+    uint plainCounts[2], calledCounts[2], unmutedCounts[2];
+    uint reports = 0, set, i;
+
+    tidyBufInit( &plain );
+    tidyBufInit( &called );
+    tidyBufInit( &unmuted );
+    tidyBufInit( &muted.output );
+    muted.failures = 0;
+    for ( set = 0; set < MUTE_SET_COUNT; ++set )
+    {
+        const MuteSet* ms = &muteSets[set];
+
+        for ( i = 0; i < SAMPLE_COUNT; ++i )
+        {
+            const char* what = NULL;
+            const char* output;
+
+            muted.codes = ms->mute;
+            muted.unmuted = yes;
+            tidyBufClear( &muted.output );
+            tidyMuted( ms, NULL, samples[i], yes, &unmuted, unmutedCounts );
+
+            muted.unmuted = no;
+            tidyMuted( ms, ms->mute, samples[i], no, &plain, plainCounts );
+
+            /* a callback makes every message be built */
+            muted.seen = 0;
+            tidyMuted( ms, ms->mute, samples[i], yes, &called, calledCounts );
+            reports += muted.seen;
+
+            if ( strcmp((const char*) plain.bp, (const char*) called.bp) != 0 )
+                what = "reports differ with a message callback";
+            else if ( memcmp(plainCounts, unmutedCounts, sizeof(plainCounts)) != 0
+                      || memcmp(calledCounts, unmutedCounts, sizeof(calledCounts)) != 0 )
+                what = "counts differ from those with nothing muted";
+            for ( output = (const char*) muted.output.bp;
+                  !what && output && output < (const char*) muted.output.bp + muted.output.size;
+                  output += strlen(output) + 1 )
+            {
+                if ( strstr((const char*) plain.bp, output) )
+                    what = "a muted report is written";
+            }
+            if ( what )
+            {
+                fprintf( stderr, "tidymessagecheck: mute \"%s\", options "
+                         "\"%s\", sample %u: %s\n", ms->mute, ms->options,
+                         i, what );
+                ++muted.failures;
+            }
+        }
+    }
+    tidyBufFree( &plain );
+    tidyBufFree( &called );
+    tidyBufFree( &unmuted );
+    tidyBufFree( &muted.output );
+
+    printf( "tidymessagecheck: muted codes: %u muted reports: %s\n", reports,
+            muted.failures ? "FAILED" : "ok" );
+    return muted.failures;
+}
+
+
+/*\
+ * Recorded messages against the message callback
+\*/
+
+typedef struct {
+    uint code;
+    TidyReportLevel level;
+    int line;
+    int column;
+    char* text;
+} Seen;
+
+typedef struct {
+    Seen* seen;                     /* Messages the callback saw. */
+    uint count;
+    uint capacity;
+    uint failures;
+} RecordCheck;
+
+static RecordCheck records;
+
+static Bool TIDY_CALL recordMessage( TidyMessage tmessage )
+{
+    Seen* m;
+
+    if ( records.count == records.capacity )
+    {
+        records.capacity = records.capacity ? 2 * records.capacity : 64;
+        records.seen = (Seen*) realloc( records.seen,
+                                        records.capacity * sizeof(Seen) );
+    }
+    m = &records.seen[records.count++];
+    m->code = tidyGetMessageCode( tmessage );
+    m->level = tidyGetMessageLevel( tmessage );
+    m->line = tidyGetMessageLine( tmessage );
+    m->column = tidyGetMessageColumn( tmessage );
+    m->text = (char*) malloc( strlen(tidyGetMessage(tmessage)) + 1 );
+    strcpy( m->text, tidyGetMessage(tmessage) );
+    return yes;
+}
+
+static void forgetMessages( void )
+{
+    while ( records.count > 0 )
+        free( records.seen[--records.count].text );
+}
+
+/* Compares the records of tdoc with the messages the callback saw. */
+static const char* compareRecords( TidyDoc tdoc, uint* index )
+{
+    TidyIterator it = tidyGetMessageRecords( tdoc );
+    uint i;
+
+    for ( i = 0; it; ++i )
+    {
+        TidyMessage tmessage = tidyGetNextMessageRecord( tdoc, &it );
+        const Seen* m = &records.seen[i];
+
+        *index = i;
+        if ( i >= records.count )
+            return "there are more records than messages";
+        if ( tidyGetMessageCode(tmessage) != m->code )
+            return "a code differs";
+        if ( tidyGetMessageLevel(tmessage) != m->level )
+            return "a level differs";
+        if ( tidyGetMessageLine(tmessage) != m->line
+             || tidyGetMessageColumn(tmessage) != m->column )
+            return "a position differs";
+        if ( strcmp(tidyGetMessage(tmessage), m->text) != 0 )
+            return "a text differs";
+    }
+    *index = i;
+    return i < records.count ? "there are fewer records than messages" : NULL;
+}
+
+static uint checkRecords( void )
+{
+    static const char* languages[] = { "en", "fr" };
+    TidyBuffer err;
+    uint messages = 0, l, set, i;
+
+    tidyBufInit( &err );
+    for ( l = 0; l < sizeof(languages) / sizeof(languages[0]); ++l )
+    {
+        if ( !tidySetLanguage(languages[l]) )
+            continue;
+        for ( set = 0; set < OPTION_SET_COUNT; ++set )
+        {
+            for ( i = 0; i < SAMPLE_COUNT; ++i )
+            {
+                const char* what = NULL;
+                uint index = 0;
+                uint callback;
+
+                /* first alongside the callback, then on their own */
+                for ( callback = 1; !what && callback <= 2; ++callback )
+                {
+                    TidyDoc tdoc = tidyCreate();
+
+                    tidyBufClear( &err );
+                    tidySetErrorBuffer( tdoc, &err );
+                    if ( callback == 1 )
+                        tidySetMessageCallback( tdoc, recordMessage );
+                    tidySetMessageRecording( tdoc, yes );
+                    setOptions( tdoc, optionSets[set] );
+                    tidyDocument( tdoc, samples[i] );
+
+                    what = compareRecords( tdoc, &index );
+                    if ( !what && err.size != 0 )
+                        what = "messages are written while recording";
+                    if ( what && callback == 2 )
+                        what = "without a callback, records differ";
+                    tidyRelease( tdoc );
+                }
+                messages += records.count;
+                forgetMessages();
+
+                if ( what )
+                {
+                    fprintf( stderr, "tidymessagecheck: language %s, options "
+                             "\"%s\", sample %u, message %u: %s\n",
+                             languages[l], optionSets[set], i, index, what );
+                    ++records.failures;
+                }
+            }
+        }
+    }
+    tidySetLanguage( "en" );
+    tidyBufFree( &err );
+    free( records.seen );
+
+    printf( "tidymessagecheck: records: %u messages: %s\n", messages,
+            records.failures ? "FAILED" : "ok" );
+    return records.failures;
+}
+
+
+/*\
+ * Repeated reports
+\*/
+
+#define REPEATS 40
+
+typedef struct {
+    uint repeated;                  /* Code of the repeated report. */
+    uint shown;                     /* Its reports the callback saw. */
+    uint summaries;                 /* Lines saying how many weren't. */
+    char summary[MESSAGE_SIZE];     /* The expected such line. */
+    uint failures;
+} RepeatCheck;
+
+static RepeatCheck repeats;
+
+static Bool TIDY_CALL repeatMessage( TidyMessage tmessage )
+{
+    uint code = tidyGetMessageCode( tmessage );
+
+    if ( code == repeats.repeated )
+        ++repeats.shown;
+    else if ( code == tidyErrorCodeFromKey("STRING_REPEATS_NOT_SHOWN") )
+    {
+        ++repeats.summaries;
+        if ( strcmp(tidyGetMessage(tmessage), repeats.summary) != 0 )
+        {
+            fprintf( stderr, "tidymessagecheck: expected \"%s\", got "
+                     "\"%s\"\n", repeats.summary, tidyGetMessage(tmessage) );
+            ++repeats.failures;
+        }
+    }
+    return yes;
+}
+
+/* Counts the occurrences of text in the nul terminated buf. */
+static uint occurrences( const TidyBuffer* buf, const char* text )
+{
+    const char* p = (const char*) buf->bp;
+    uint count = 0;
+
+    while ( p && (p = strstr(p, text)) != NULL )
+    {
+        ++count;
+        p += strlen( text );
+    }
+    return count;
+}
+
+static uint checkRepeats( void )
+{
+    static const uint limits[] = { 0, 1, 5, REPEATS - 1, REPEATS, REPEATS + 1 };
+    char html[64 + 4 * REPEATS];
+    TidyBuffer err;
+    uint allWarnings = 0, l, i;
+
+    strcpy( html, "<title>t</title><p>x" );
+    for ( i = 0; i < REPEATS; ++i )
+        strcat( html, "</b>" );
+    tidyBufInit( &err );
+    repeats.repeated = tidyErrorCodeFromKey( "DISCARDING_UNEXPECTED" );
+    repeats.failures = 0;
+
+    for ( l = 0; l < sizeof(limits) / sizeof(limits[0]); ++l )
+    {
+        uint limit = limits[l];
+        uint expected = limit && limit < REPEATS ? limit : REPEATS;
+        uint summaries = expected < REPEATS ? 1 : 0;
+        const char* what = NULL;
+        TidyIterator it;
+        uint recorded = 0, warnings;
+        char value[16];
+        TidyDoc tdoc;
+
+        snprintf( repeats.summary, MESSAGE_SIZE, "... and %u more "
+                  "DISCARDING_UNEXPECTED messages were not shown.",
+                  REPEATS - expected );
+        snprintf( value, sizeof(value), "%u", limit );
+        repeats.shown = repeats.summaries = 0;
+
+        /* written out, and seen by the callback */
+        tdoc = tidyCreate();
+        tidyBufClear( &err );
+        tidySetErrorBuffer( tdoc, &err );
+        tidySetMessageCallback( tdoc, repeatMessage );
+        tidyOptParseValue( tdoc, "report-repeats", value );
+        tidyDocument( tdoc, html );
+        tidyBufPutByte( &err, '\0' );
+        warnings = tidyWarningCount( tdoc );
+        tidyRelease( tdoc );
+        if ( limit == 0 )
+            allWarnings = warnings;
+
+        /* recorded */
+        tdoc = tidyCreate();
+        tidySetMessageRecording( tdoc, yes );
+        tidyOptParseValue( tdoc, "report-repeats", value );
+        tidyDocument( tdoc, html );
+        for ( it = tidyGetMessageRecords(tdoc); it; )
+        {
+            if ( tidyGetMessageCode(tidyGetNextMessageRecord(tdoc, &it))
+                 == repeats.repeated )
+                ++recorded;
+        }
+        tidyRelease( tdoc );
+
+        if ( occurrences(&err, "discarding unexpected </b>") != expected )
+            what = "the error buffer shows the wrong number of reports";
+        else if ( occurrences(&err, repeats.summary) != summaries
+                  || occurrences(&err, " more ") != summaries )
+            what = "the error buffer has the wrong summary";
+        else if ( repeats.shown != expected )
+            what = "the callback sees the wrong number of reports";
+        else if ( repeats.summaries != summaries )
+            what = "the callback sees the wrong summary";
+        else if ( recorded != expected )
+            what = "the wrong number of reports is recorded";
+        else if ( warnings != allWarnings )
+            what = "the warning count changes";
+        if ( what )
+        {
+            fprintf( stderr, "tidymessagecheck: report-repeats %u, %u "
+                     "repeats: %s\n", limit, REPEATS, what );
+            ++repeats.failures;
+        }
+    }
+    tidyBufFree( &err );
+
+    printf( "tidymessagecheck: report-repeats: %u limits: %s\n",
+            (uint) (sizeof(limits) / sizeof(limits[0])),
+            repeats.failures ? "FAILED" : "ok" );
+    return repeats.failures;
+}
+
+
+int main( void )
+{
+    uint failures = 0;
+
+    failures += checkLazyText();
+    failures += checkMutedCodes();
+    failures += checkRecords();
+    failures += checkRepeats();
+    return failures ? 1 : 0;
+}
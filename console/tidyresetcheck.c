@@ -0,0 +1,214 @@
+/*\
+ *  tidyresetcheck.c - checks that a reset document behaves like a new one
+ *
+ *  For each set of options, tidies every sample twice: with a document
+ *  created for it alone, and with one document that is reset between
+ *  samples and given its options only once. The markup, the reports,
+ *  the status and the error and warning counts must be the same. The
+ *  samples are then run again in reverse order on the same reused
+ *  document, so that each follows a different predecessor, and once
+ *  more with each following an XHTML document that was parsed but not
+ *  saved, whose DOCTYPE switches options on.
+ *
+ *  Usage: tidyresetcheck
+ *  Exits with 0 when all the results match, 1 otherwise.
+ *
+\*/
+
+#include <stdio.h>
+#include <string.h>
+#include "tidy.h"
+#include "tidybuffio.h"
+
+static const char* samples[] = {
+    "<title>t</title><p>Some <b>bold <i>and</b> italic</i> text"
+    "<table><tr><td>cell<td>cell</table><ul><li>one<li>two</ul>",
+
+    "<html><body><font face=Arial><p align=center>Centered&nbsp;"
+    "<img src=a.png><p>caf\xc3\xa9 &ldquo;quoted&rdquo; &bogus;</font>",
+
+    "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\">"
+    "<title>t</title><a href=#><div>block in a link</div></a><table>"
+    "<caption><p>para</p></caption><tr><td>x</table><button><div>b</div>"
+    "</button>",
+
+    "<o:p></o:p><p class=MsoNormal style='mso-x:1'>Word<span lang=EN>"
+    "text</span></p><![if !supportEmptyParas]>&nbsp;<![endif]>",
+
+    "<title>t</title><my-widget a=1>custom</my-widget><p id=x>one"
+    "<p id=x>dup<img src=x.gif><a href=#>here</a><frameset>",
+
+    "<?xml version='1.0'?><root><item a=1>x<item>y</root>",
+
+    ""
+};
+
+static const char* optionSets[] = {
+    "",
+    "indent|auto|wrap|40|quote-marks|yes",
+    "output-xhtml|yes|clean|yes|uppercase-tags|yes",
+    "word-2000|yes|bare|yes|show-body-only|yes",
+    "doctype|strict|accessibility-check|3",
+    "input-xml|yes|output-xml|yes",
+    "custom-tags|blocklevel|drop-empty-elements|no|enclose-text|yes"
+};
+
+/* Parsing this turns on output-xhtml and output-xml. */
+static const char* unsaved =
+    "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.0 Strict//EN\" "
+    "\"http://www.w3.org/TR/xhtml1/DTD/xhtml1-strict.dtd\">"
+    "<html xmlns=\"http://www.w3.org/1999/xhtml\"><title>x</title>"
+    "<p>unsaved";
+
+#define SAMPLE_COUNT ( sizeof(samples) / sizeof(samples[0]) )
+#define OPTION_SET_COUNT ( sizeof(optionSets) / sizeof(optionSets[0]) )
+
+typedef struct {
+    TidyBuffer out;
+    TidyBuffer err;
+    int status;
+    uint errors;
+    uint warnings;
+} Result;
+
+static void setOptions( TidyDoc tdoc, const char* optionSet )
+{
+    char options[256];
+    char *name, *value, *end;
+
+    if ( !*optionSet )
+        return;
+    strncpy( options, optionSet, sizeof(options) - 1 );
+    options[sizeof(options) - 1] = '\0';
+    for ( name = options; name; name = end )
+    {
+        value = strchr( name, '|' );
+        *value++ = '\0';
+        end = strchr( value, '|' );
+        if ( end )
+            *end++ = '\0';
+        tidyOptParseValue( tdoc, name, value );
+    }
+}
+
+/* Tidies html with tdoc, whose error buffer is r->err. */
+static void tidyInto( TidyDoc tdoc, const char* html, Result* r )
+{
+    int status;
+
+    tidyBufClear( &r->out );
+    tidyBufClear( &r->err );
+    status = tidyParseString( tdoc, html );
+    if ( status >= 0 )
+        status = tidyCleanAndRepair( tdoc );
+    if ( status >= 0 )
+        status = tidyRunDiagnostics( tdoc );
+    tidyErrorSummary( tdoc );
+    if ( status >= 0 )
+        status = tidySaveBuffer( tdoc, &r->out );
+    r->status = status;
+    r->errors = tidyErrorCount( tdoc );
+    r->warnings = tidyWarningCount( tdoc );
+}
+
+static void runFresh( const char* optionSet, const char* html, Result* r )
+{
+    TidyDoc tdoc = tidyCreate();
+
+    tidySetErrorBuffer( tdoc, &r->err );
+    setOptions( tdoc, optionSet );
+    tidyOptSetBool( tdoc, TidyForceOutput, yes );
+    tidyInto( tdoc, html, r );
+    tidyRelease( tdoc );
+}
+
+static Bool sameBuffer( const TidyBuffer* a, const TidyBuffer* b )
+{
+    return a->size == b->size &&
+           ( a->size == 0 || memcmp(a->bp, b->bp, a->size) == 0 );
+}
+
+static uint compare( uint set, uint sample, const char* pass,
+                     const Result* fresh, const Result* reused )
+{
+    const char* what = NULL;
+
+    if ( !sameBuffer(&fresh->out, &reused->out) )
+        what = "markup";
+    else if ( !sameBuffer(&fresh->err, &reused->err) )
+        what = "reports";
+    else if ( fresh->status != reused->status )
+        what = "status";
+    else if ( fresh->errors != reused->errors ||
+              fresh->warnings != reused->warnings )
+        what = "counts";
+    if ( !what )
+        return 0;
+
+    fprintf( stderr, "tidyresetcheck: options \"%s\", sample %u, %s: the "
+             "reset document gives different %s\n", optionSets[set], sample,
+             pass, what );
+    return 1;
+}
+
+int main( void )
+{
+    static Result fresh[SAMPLE_COUNT];
+    Result reused;
+    uint failures = 0, set, i;
+
+    tidyBufInit( &reused.out );
+    tidyBufInit( &reused.err );
+    for ( i = 0; i < SAMPLE_COUNT; ++i )
+    {
+        tidyBufInit( &fresh[i].out );
+        tidyBufInit( &fresh[i].err );
+    }
+
+    for ( set = 0; set < OPTION_SET_COUNT; ++set )
+    {
+        TidyDoc tdoc = tidyCreate();
+
+        tidySetErrorBuffer( tdoc, &reused.err );
+        setOptions( tdoc, optionSets[set] );
+        tidyOptSetBool( tdoc, TidyForceOutput, yes );
+
+        for ( i = 0; i < SAMPLE_COUNT; ++i )
+        {
+            runFresh( optionSets[set], samples[i], &fresh[i] );
+            if ( i > 0 )
+                tidyReset( tdoc );
+            tidyInto( tdoc, samples[i], &reused );
+            failures += compare( set, i, "in order", &fresh[i], &reused );
+        }
+        for ( i = SAMPLE_COUNT; i-- > 0; )
+        {
+            tidyReset( tdoc );
+            tidyInto( tdoc, samples[i], &reused );
+            failures += compare( set, i, "in reverse", &fresh[i], &reused );
+        }
+        for ( i = 0; i < SAMPLE_COUNT; ++i )
+        {
+            tidyReset( tdoc );
+            tidyParseString( tdoc, unsaved );
+            tidyReset( tdoc );
+            tidyInto( tdoc, samples[i], &reused );
+            failures += compare( set, i, "after an unsaved document",
+                                 &fresh[i], &reused );
+        }
+        tidyRelease( tdoc );
+    }
+
+    for ( i = 0; i < SAMPLE_COUNT; ++i )
+    {
+        tidyBufFree( &fresh[i].out );
+        tidyBufFree( &fresh[i].err );
+    }
+    tidyBufFree( &reused.out );
+    tidyBufFree( &reused.err );
+
+    printf( "tidyresetcheck: %u option sets, %u samples: %s\n",
+            (uint) OPTION_SET_COUNT, (uint) SAMPLE_COUNT,
+            failures ? "FAILED" : "ok" );
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,372 @@
+/*\
+ *  tidythreads.c - stress test for documents used on several threads
+ *
+ *  Starts a number of threads at once. Each creates its own documents,
+ *  without any document having been created beforehand, and tidies the
+ *  samples below over and over. Every round must give the same markup
+ *  and the same reports as the first, on every thread, and as the same
+ *  work done afterwards on the main thread alone. The threads start at
+ *  different samples, so HTML4 documents, whose <a>, <caption>, <object>
+ *  and <button> follow the older rules, are tidied alongside HTML5 ones.
+ *
+ *  Each sample's options are then compiled into a configuration that a
+ *  second set of threads all share. Documents using it must give the
+ *  same results as documents given the options one by one, and so must
+ *  documents that change some options after taking it up, which must
+ *  leave it as it was for the others.
+ *
+ *  Usage: tidythreads [threads [rounds]]
+ *  Exits with 0 when all the results match, 1 otherwise.
+ *
+\*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tidy.h"
+#include "tidybuffio.h"
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#endif
+
+#define MAX_THREADS 64
+
+typedef struct {
+    const char* html;     /* The document to tidy. */
+    const char* options;  /* Option names and values, separated by '|'. */
+} Sample;
+
+static const Sample samples[] = {
+    { "<title>t</title><p>Some <b>bold <i>and</b> italic</i> text"
+      "<table><tr><td>cell<td>cell</table><ul><li>one<li>two</ul>",
+      "indent|auto|wrap|40" },
+    { "<html><body><font face=Arial><p align=center>Centered&nbsp;"
+      "<img src=a.png><p>caf\xc3\xa9 &ldquo;quoted&rdquo; &bogus;</font>",
+      "output-xhtml|yes|clean|yes|uppercase-tags|yes|quote-marks|yes" },
+    { "<o:p></o:p><p class=MsoNormal style='mso-x:1'>Word<span lang=EN>"
+      "text</span></p><![if !supportEmptyParas]>&nbsp;<![endif]>",
+      "word-2000|yes|bare|yes|show-body-only|yes" },
+    { "<?xml version='1.0'?><root><item a=1>x<item>y</root>",
+      "input-xml|yes|output-xml|yes|indent|yes" },
+    { "<img src=x.gif><a href=#>here</a><table><td>1</table>"
+      "<frameset><frame src=a></frameset>",
+      "accessibility-check|3|show-warnings|yes" },
+    { "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\" "
+      "\"http://www.w3.org/TR/html4/loose.dtd\"><html><head><title>t</title>"
+      "<object data=h.svg></object></head><body><a href=#><div>block in a "
+      "link</div></a><table><caption><p>para in caption</p></caption><tr>"
+      "<td>x</table><p><button><div>in button</div></button>",
+      "indent|yes" },
+    { "<title>t</title><a href=#><div>block in a link</div></a><table>"
+      "<caption><p>para in caption</p></caption><tr><td>x</table><p>"
+      "<button><div>in button</div></button> <object data=o.svg>"
+      "<param name=p value=1>fallback</object>",
+      "doctype|transitional|output-xhtml|yes" },
+    { "<title>t</title><my-box class=c id=i>box<my-span>span</my-span>"
+      "</my-box><p>text</i>",
+      "new-blocklevel-tags|my-box|new-inline-tags|my-span|priority-attributes|"
+      "id|mute|DISCARDING_UNEXPECTED|indent|yes" }
+};
+
+/* Changed on some documents after they take up a shared configuration. */
+static const char* overrides = "wrap|20|uppercase-attributes|yes|indent|no";
+
+#define SAMPLE_COUNT ( sizeof(samples) / sizeof(samples[0]) )
+
+/* Each sample's options, compiled for all the threads to share. */
+static TidyCompiledConfig configs[SAMPLE_COUNT];
+
+typedef struct {
+    TidyBuffer out[SAMPLE_COUNT];  /* Markup from the first round. */
+    TidyBuffer err[SAMPLE_COUNT];  /* Reports from the first round. */
+    TidyBuffer outChanged[SAMPLE_COUNT];  /* The same, with overrides. */
+    TidyBuffer errChanged[SAMPLE_COUNT];
+    unsigned first;                /* The sample each round starts with. */
+    Bool shared;                   /* Also use the shared configurations. */
+    unsigned rounds;               /* How many rounds to run. */
+    unsigned mismatches;           /* Rounds that differed from the first. */
+} Worker;
+
+
+/* Sets options given as names and values, separated by '|'. */
+static void setOptions( TidyDoc tdoc, const char* optionSet )
+{
+    char options[256];
+    char *name, *value, *end;
+
+    strncpy( options, optionSet, sizeof(options) - 1 );
+    options[sizeof(options) - 1] = '\0';
+    for ( name = options; name; name = end )
+    {
+        /* strtok() would share its position with the other threads */
+        value = strchr( name, '|' );
+        *value++ = '\0';
+        end = strchr( value, '|' );
+        if ( end )
+            *end++ = '\0';
+        tidyOptParseValue( tdoc, name, value );
+    }
+}
+
+/* Tidies one sample, with a document of its own, into out and err. The
+** document takes up the shared configuration of the sample if shared
+** is set, and is given the overrides after that if changed is set.
+*/
+static void tidySample( unsigned i, Bool shared, Bool changed,
+                        TidyBuffer* out, TidyBuffer* err )
+{
+    TidyDoc tdoc = tidyCreate();
+    TidyBuffer said;
+
+    /* only setting options per document says anything about them */
+    tidyBufInit( &said );
+    tidySetErrorBuffer( tdoc, &said );
+    if ( shared )
+        tidyOptUseConfig( tdoc, configs[i] );
+    else
+    {
+        setOptions( tdoc, samples[i].options );
+        tidyOptSetBool( tdoc, TidyForceOutput, yes );
+    }
+    if ( changed )
+        setOptions( tdoc, overrides );
+    tidySetErrorBuffer( tdoc, err );
+
+    tidyParseString( tdoc, samples[i].html );
+    tidyCleanAndRepair( tdoc );
+    tidyRunDiagnostics( tdoc );
+    tidySaveBuffer( tdoc, out );
+    tidyRelease( tdoc );
+    tidyBufFree( &said );
+}
+
+static Bool sameBuffer( const TidyBuffer* a, const TidyBuffer* b )
+{
+    return a->size == b->size &&
+           ( a->size == 0 || memcmp(a->bp, b->bp, a->size) == 0 );
+}
+
+/* Tidies sample i the given way, counting a mismatch if the result
+** differs from wantOut and wantErr.
+*/
+static void checkSample( Worker* w, unsigned i, Bool shared, Bool changed,
+                         const TidyBuffer* wantOut, const TidyBuffer* wantErr,
+                         TidyBuffer* out, TidyBuffer* err )
+{
+    tidyBufClear( out );
+    tidyBufClear( err );
+    tidySample( i, shared, changed, out, err );
+    if ( !sameBuffer(out, wantOut) || !sameBuffer(err, wantErr) )
+        ++w->mismatches;
+}
+
+static void runWorker( Worker* w )
+{
+    TidyBuffer out, err;
+    unsigned round, n, i;
+
+    tidyBufInit( &out );
+    tidyBufInit( &err );
+    for ( round = 0; round < w->rounds; ++round )
+    {
+        for ( n = 0; n < SAMPLE_COUNT; ++n )
+        {
+            i = ( w->first + n ) % SAMPLE_COUNT;
+            if ( round == 0 )
+            {
+                tidySample( i, no, no, &w->out[i], &w->err[i] );
+                tidySample( i, no, yes, &w->outChanged[i], &w->errChanged[i] );
+            }
+            else
+            {
+                checkSample( w, i, no, no, &w->out[i], &w->err[i], &out, &err );
+                checkSample( w, i, no, yes, &w->outChanged[i],
+                             &w->errChanged[i], &out, &err );
+            }
+            if ( !w->shared )
+                continue;
+            checkSample( w, i, yes, no, &w->out[i], &w->err[i], &out, &err );
+            checkSample( w, i, yes, yes, &w->outChanged[i], &w->errChanged[i],
+                         &out, &err );
+        }
+    }
+    tidyBufFree( &out );
+    tidyBufFree( &err );
+}
+
+#if defined(_WIN32)
+typedef HANDLE Thread;
+
+static DWORD WINAPI workerThread( LPVOID arg )
+{
+    runWorker( (Worker*) arg );
+    return 0;
+}
+
+static Bool startThread( Thread* t, Worker* w )
+{
+    *t = CreateThread( NULL, 0, workerThread, w, 0, NULL );
+    return *t != NULL;
+}
+
+static void joinThread( Thread t )
+{
+    WaitForSingleObject( t, INFINITE );
+    CloseHandle( t );
+}
+#else
+typedef pthread_t Thread;
+
+static void* workerThread( void* arg )
+{
+    runWorker( (Worker*) arg );
+    return NULL;
+}
+
+static Bool startThread( Thread* t, Worker* w )
+{
+    return pthread_create( t, NULL, workerThread, w ) == 0;
+}
+
+static void joinThread( Thread t )
+{
+    pthread_join( t, NULL );
+}
+#endif
+
+/* Runs nthreads workers at once, returning how many could be started. */
+static unsigned runThreads( Worker* workers, unsigned nthreads,
+                            unsigned rounds, Bool shared )
+{
+    static Thread threads[MAX_THREADS];
+    unsigned started = 0, i;
+
+    for ( i = 0; i < nthreads; ++i )
+    {
+        memset( &workers[i], 0, sizeof(Worker) );
+        workers[i].first = i;
+        workers[i].shared = shared;
+        workers[i].rounds = rounds;
+    }
+    while ( started < nthreads && startThread(&threads[started], &workers[started]) )
+        ++started;
+    for ( i = 0; i < started; ++i )
+        joinThread( threads[i] );
+    return started;
+}
+
+/* Compares a worker's results with those of the main thread alone. */
+static unsigned checkWorker( Worker* w, const Worker* alone, const char* what,
+                             unsigned n )
+{
+    unsigned failures = 0, j;
+
+    if ( w->mismatches )
+    {
+        fprintf( stderr, "tidythreads: %s %u: %u results changed between "
+                 "rounds or with the shared configuration\n", what, n,
+                 w->mismatches );
+        ++failures;
+    }
+    for ( j = 0; j < SAMPLE_COUNT; ++j )
+    {
+        if ( !sameBuffer(&w->out[j], &alone->out[j]) ||
+             !sameBuffer(&w->err[j], &alone->err[j]) ||
+             !sameBuffer(&w->outChanged[j], &alone->outChanged[j]) ||
+             !sameBuffer(&w->errChanged[j], &alone->errChanged[j]) )
+        {
+            fprintf( stderr, "tidythreads: %s %u: sample %u differs from the "
+                     "single threaded result\n", what, n, j );
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+static void freeWorker( Worker* w )
+{
+    unsigned j;
+
+    for ( j = 0; j < SAMPLE_COUNT; ++j )
+    {
+        tidyBufFree( &w->out[j] );
+        tidyBufFree( &w->err[j] );
+        tidyBufFree( &w->outChanged[j] );
+        tidyBufFree( &w->errChanged[j] );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    static Worker workers[MAX_THREADS];
+    static Worker sharing[MAX_THREADS];
+    Worker alone;
+    unsigned nthreads = argc > 1 ? (unsigned) atoi( argv[1] ) : 8;
+    unsigned rounds = argc > 2 ? (unsigned) atoi( argv[2] ) : 20;
+    unsigned started, startedSharing, failures = 0, i;
+
+    if ( nthreads < 1 || nthreads > MAX_THREADS || rounds < 1 )
+    {
+        fprintf( stderr, "usage: tidythreads [threads (1-%d) [rounds]]\n",
+                 MAX_THREADS );
+        return 1;
+    }
+
+    /* no document exists before these threads start */
+    started = runThreads( workers, nthreads, rounds, no );
+
+    for ( i = 0; i < SAMPLE_COUNT; ++i )
+    {
+        TidyDoc tdoc = tidyCreate();
+        TidyBuffer said;
+
+        tidyBufInit( &said );
+        tidySetErrorBuffer( tdoc, &said );
+        setOptions( tdoc, samples[i].options );
+        tidyOptSetBool( tdoc, TidyForceOutput, yes );
+        configs[i] = tidyOptCompileConfig( tdoc );
+        tidyRelease( tdoc );
+        tidyBufFree( &said );
+        if ( !configs[i] )
+        {
+            fprintf( stderr, "tidythreads: sample %u: the options could not "
+                     "be compiled\n", i );
+            return 1;
+        }
+    }
+    startedSharing = runThreads( sharing, nthreads, rounds, yes );
+    if ( started < nthreads || startedSharing < nthreads )
+    {
+        fprintf( stderr, "tidythreads: started only %u threads\n",
+                 started < startedSharing ? started : startedSharing );
+        ++failures;
+    }
+
+    memset( &alone, 0, sizeof(alone) );
+    alone.shared = yes;
+    alone.rounds = 1;
+    runWorker( &alone );
+    failures += checkWorker( &alone, &alone, "main thread", 0 );
+
+    for ( i = 0; i < started; ++i )
+    {
+        failures += checkWorker( &workers[i], &alone, "thread", i );
+        freeWorker( &workers[i] );
+    }
+    for ( i = 0; i < startedSharing; ++i )
+    {
+        failures += checkWorker( &sharing[i], &alone, "sharing thread", i );
+        freeWorker( &sharing[i] );
+    }
+    freeWorker( &alone );
+    for ( i = 0; i < SAMPLE_COUNT; ++i )
+        tidyOptReleaseConfig( configs[i] );
+
+    printf( "tidythreads: %u threads, %u rounds, %u samples: %s\n",
+            started, rounds, (unsigned) SAMPLE_COUNT,
+            failures ? "FAILED" : "ok" );
+    return failures ? 1 : 0;
+}
@@ -148,6 +148,11 @@ extern "C" {
  ** information about them.
 */
 
+/** @struct TidyCompiledConfig
+ ** Instances of this type represent a configuration compiled by
+ ** tidyOptCompileConfig(), which any number of documents may use.
+*/
+
 /* Prevent Doxygen from listing these as functions. */
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
@@ -157,6 +162,7 @@ opaque_type( TidyNode );
 opaque_type( TidyAttr );
 opaque_type( TidyMessage );
 opaque_type( TidyMessageArgument );
+opaque_type( TidyCompiledConfig );
 
 #endif
 
@@ -306,7 +312,11 @@ typedef void  (TIDY_CALL *TidyFree)( void* buf );
 typedef void  (TIDY_CALL *TidyPanic)( ctmbstr mssg );
 
 
-/** Give Tidy a `malloc()` replacement */
+/** Give Tidy a `malloc()` replacement. This and the three calls below change
+ ** the default allocator for the whole process, so make them before any
+ ** thread uses Tidy; to use a different allocator for one document, see
+ ** tidyCreateWithAllocator().
+ */
 TIDY_EXPORT Bool TIDY_CALL tidySetMallocCall( TidyMalloc fmalloc );
 
 /** Give Tidy a `realloc()` replacement */
@@ -340,6 +350,11 @@ TIDY_EXPORT Bool TIDY_CALL tidySetPanicCall( TidyPanic fpanic );
  ** create at least one TidyDoc instance to initialize the library and begin
  ** interaction with the API. When done using a TidyDoc instance, be sure to
  ** `tidyRelease(myTidyDoc);` in order to free related memory.
+ **
+ ** Documents share no mutable state, so different threads may each create
+ ** and work on their own documents at the same time. Process-wide settings,
+ ** i.e., tidySetMallocCall() and its companions, and tidySetLanguage(),
+ ** should be made before any thread uses Tidy.
  ** @result Returns a TidyDoc instance.
  */
 TIDY_EXPORT TidyDoc TIDY_CALL     tidyCreate(void);
@@ -358,6 +373,19 @@ TIDY_EXPORT TidyDoc TIDY_CALL     tidyCreateWithAllocator(TidyAllocator *allocat
  */
 TIDY_EXPORT void TIDY_CALL        tidyRelease(TidyDoc tdoc);
 
+/** Forget the current document so that the TidyDoc can take another one,
+ ** as if it had just been created and given the same configuration. The
+ ** document tree, the counts of errors and warnings, and any recorded
+ ** messages are discarded; the options, callbacks, error sink, language
+ ** and application data are kept, and so is the memory the TidyDoc has
+ ** grown for its buffers and tables, so that processing many documents
+ ** with one TidyDoc allocates little more than each tree needs. Options
+ ** that processing the document changed are restored, whether or not the
+ ** document was saved.
+ ** @param tdoc The TidyDoc to reset.
+ */
+TIDY_EXPORT void TIDY_CALL        tidyReset(TidyDoc tdoc);
+
     
 /** @}
  ** @name Host Application Data
@@ -890,6 +918,35 @@ TIDY_EXPORT Bool TIDY_CALL          tidyOptCopyConfig(TidyDoc tdocTo,  /**< The
                                                       TidyDoc tdocFrom /**< The source tidy document. */
                                                       );
 
+/** Compile the current configuration settings of a document into a
+ ** TidyCompiledConfig. The result is read-only, with the tags, priority
+ ** attributes and muted messages that the options declare already
+ ** resolved, so that documents can use it without copying or parsing any
+ ** option. Documents on different threads may share it. The document's
+ ** settings are adjusted first, as parsing would adjust them.
+ ** @param tdoc The tidy document whose settings to compile.
+ ** @result Returns the TidyCompiledConfig, or NULL on error.
+ */
+TIDY_EXPORT TidyCompiledConfig TIDY_CALL tidyOptCompileConfig( TidyDoc tdoc );
+
+/** Give a document the settings of a TidyCompiledConfig, replacing its
+ ** own. The document reads them in place; when it changes an option, it
+ ** copies the settings for itself, until its snapshot is restored. The
+ ** settings become the document's snapshot, so each document that is
+ ** saved returns to them.
+ ** @param tdoc The tidy document.
+ ** @param tcfg The TidyCompiledConfig to use, or NULL to stop using one,
+ **        keeping the current settings as the document's own.
+ ** @result Returns a bool indicating success or failure.
+ */
+TIDY_EXPORT Bool TIDY_CALL          tidyOptUseConfig( TidyDoc tdoc, TidyCompiledConfig tcfg );
+
+/** Free a TidyCompiledConfig. No document may still be using it: release
+ ** them, or call tidyOptUseConfig() with NULL on them, first.
+ ** @param tcfg The TidyCompiledConfig to free.
+ */
+TIDY_EXPORT void TIDY_CALL          tidyOptReleaseConfig( TidyCompiledConfig tcfg );
+
 /** Get character encoding name. Used with @ref TidyCharEncoding,
  ** @ref TidyOutCharEncoding, and @ref TidyInCharEncoding.
  ** @result The encoding name as a string for the specified option.
@@ -1072,6 +1129,12 @@ typedef void (TIDY_CALL *TidyUngetByteFunc)( void* sourceData, byte bt );
 /** Input Callback: is end of input? */
 typedef Bool (TIDY_CALL *TidyEOFFunc)( void* sourceData );
 
+/** Input Callback: read up to `size` bytes of input into `buffer`.
+ ** Returns the number of bytes stored, or 0 at end of input. See
+ ** tidyInitSourceBytes().
+ */
+typedef uint (TIDY_CALL *TidyGetBytesFunc)( void* sourceData, byte* buffer, uint size );
+
 /** This type defines an input source capable of delivering raw bytes of input.
  */
 TIDY_STRUCT
@@ -1096,6 +1159,37 @@ TIDY_EXPORT Bool TIDY_CALL tidyInitSource(TidyInputSource*  source,  /**< The so
                                           TidyEOFFunc       endFunc  /**< Pointer to the "eof" callback. */
                                           );
 
+/** This type defines an input source that can also deliver its input in
+ ** blocks, which Tidy reads much faster than byte by byte. Set it up with
+ ** tidyInitSourceBytes() and give Tidy its `source`, which leads back to
+ ** the rest of the struct, so the struct must stay in place while Tidy
+ ** reads from it.
+ */
+TIDY_STRUCT
+typedef struct _TidyBlockInputSource
+{
+  TidyInputSource     source;      /**< The source to give Tidy. */
+
+  void*               sourceData;  /**< Input context. Passed to callbacks. */
+  TidyGetByteFunc     getByte;     /**< Pointer to "get byte" callback. */
+  TidyUngetByteFunc   ungetByte;   /**< Pointer to "unget" callback. */
+  TidyEOFFunc         eof;         /**< Pointer to "eof" callback. */
+  TidyGetBytesFunc    getBytes;    /**< Pointer to "get bytes" callback. */
+} TidyBlockInputSource;
+
+/** Sets up a block input source, as tidyInitSource() does a byte level one.
+ ** Tidy reads through `gbsFunc` only; the byte level callbacks serve
+ ** tidyGetByte() and its companions.
+ ** @result Returns a bool indicating success or failure.
+ */
+TIDY_EXPORT Bool TIDY_CALL tidyInitSourceBytes(TidyBlockInputSource* source,  /**< The source to populate with data. */
+                                               void*             srcData, /**< The input context. */
+                                               TidyGetByteFunc   gbFunc,  /**< Pointer to the "get byte" callback. */
+                                               TidyUngetByteFunc ugbFunc, /**< Pointer to the "unget" callback. */
+                                               TidyEOFFunc       endFunc, /**< Pointer to the "eof" callback. */
+                                               TidyGetBytesFunc  gbsFunc  /**< Pointer to the "get bytes" callback. */
+                                               );
+
 /** Helper: get next byte from input source.
  ** @param source A pointer to your input source.
  ** @result Returns a byte as an unsigned integer.
@@ -1121,6 +1215,10 @@ TIDY_EXPORT Bool TIDY_CALL tidyIsEOF( TidyInputSource* source );
 /** Output callback: send a byte to output */
 typedef void (TIDY_CALL *TidyPutByteFunc)( void* sinkData, byte bt );
 
+/** Output callback: send `count` bytes to output. See tidyInitSinkBytes().
+ */
+typedef void (TIDY_CALL *TidyPutBytesFunc)( void* sinkData, const byte* bytes, uint count );
+
 /** This type defines an output destination capable of accepting raw bytes
  ** of output
  */
@@ -1142,6 +1240,33 @@ TIDY_EXPORT Bool TIDY_CALL tidyInitSink(TidyOutputSink* sink,     /**< The sink
                                         TidyPutByteFunc pbFunc    /**< Pointer to the "put byte" callback function. */
                                         );
 
+/** This type defines an output destination that can also accept output in
+ ** blocks, which Tidy collects and passes on far less often than byte by
+ ** byte. Set it up with tidyInitSinkBytes() and give Tidy its `sink`,
+ ** which leads back to the rest of the struct, so the struct must stay in
+ ** place while Tidy writes to it.
+ */
+TIDY_STRUCT
+typedef struct _TidyBlockOutputSink
+{
+  TidyOutputSink      sink;      /**< The sink to give Tidy. */
+
+  void*               sinkData;  /**< Output context. Passed to callbacks. */
+  TidyPutByteFunc     putByte;   /**< Pointer to "put byte" callback. */
+  TidyPutBytesFunc    putBytes;  /**< Pointer to "put bytes" callback. */
+} TidyBlockOutputSink;
+
+/** Sets up a block output sink, as tidyInitSink() does a byte level one.
+ ** Tidy writes through `pbsFunc` only; the byte level callback serves
+ ** tidyPutByte().
+ ** @result Returns a bool indicating success or failure.
+ */
+TIDY_EXPORT Bool TIDY_CALL tidyInitSinkBytes(TidyBlockOutputSink* sink,   /**< The sink to populate with data. */
+                                             void*            snkData,  /**< The output context. */
+                                             TidyPutByteFunc  pbFunc,   /**< Pointer to the "put byte" callback. */
+                                             TidyPutBytesFunc pbsFunc   /**< Pointer to the "put bytes" callback. */
+                                             );
+
 /** Helper: send a byte to output. */
 TIDY_EXPORT void TIDY_CALL tidyPutByte(TidyOutputSink* sink, /**< The output sink to send a byte. */
                                        uint byteValue        /**< The byte to be sent. */
@@ -1514,6 +1639,54 @@ TIDY_EXPORT double TIDY_CALL tidyGetArgValueDouble(TidyMessage tmessage,    /**<
 
 /** @} end subgroup TidyMessageCallback Arguments API */
 
+/** @name Message Records
+ ** Instead of taking each message as it's emitted, an application can have
+ ** Tidy keep a compact record of every report and dialogue message, with its
+ ** code, level, position, and argument values, and read them back later,
+ ** for example after tidyParseBuffer() and tidyCleanAndRepair(). Each record
+ ** is read back as a TidyMessage that can be queried with the two APIs
+ ** above; its strings are only formatted if asked for. While recording,
+ ** messages aren't written to the error sink, and they're still counted
+ ** and passed to any callbacks. For example:
+ ** @code{.c}
+ **   TidyIterator itRec;
+ **   tidySetMessageRecording( tdoc, yes );
+ **   tidyParseBuffer( tdoc, &input );
+ **   itRec = tidyGetMessageRecords( tdoc );
+ **   while ( itRec ) {
+ **     TidyMessage msg = tidyGetNextMessageRecord( tdoc, &itRec );
+ **     // do something with tidyGetMessageCode( msg ), and so on
+ **   }
+ ** @endcode
+ ** @{
+ */
+
+/** Starts or stops recording the document's messages. Starting discards any
+ ** records that were kept before; stopping keeps them.
+ ** @result Returns `yes` upon success.
+ */
+TIDY_EXPORT Bool TIDY_CALL tidySetMessageRecording(TidyDoc tdoc, /**< The tidy document to record messages for. */
+                                                   Bool record   /**< Whether to record messages from now on. */
+                                                   );
+
+/** Initiates an iterator for the list of recorded messages.
+ ** @result Returns a TidyIterator, which is a token used to represent the
+ **         current position in a list within LibTidy.
+ */
+TIDY_EXPORT TidyIterator TIDY_CALL tidyGetMessageRecords( TidyDoc tdoc );
+
+/** Given a valid TidyIterator initiated with tidyGetMessageRecords(), returns
+ ** the next recorded message as a TidyMessage.
+ ** @remark The TidyMessage is only valid until the next call to this
+ **         function, so do not keep it around.
+ ** @result Returns an instance of TidyMessage.
+ */
+TIDY_EXPORT TidyMessage TIDY_CALL tidyGetNextMessageRecord(TidyDoc tdoc,       /**< The tidy document whose records you want to access. */
+                                                           TidyIterator* iter /**< The TidyIterator (initiated with tidyGetMessageRecords()) token. */
+                                                           );
+
+/** @} end subgroup Message Records */
+
 /** @name Printing
  ** LibTidy applications can somewhat track the progress of the tidying process
  ** by using this provided callback. It relates where something in the source
@@ -2031,7 +2204,9 @@ TIDY_EXPORT uint TIDY_CALL getNextErrorCode( TidyIterator* iter );
  ** @{
  */
 
-/** Tells Tidy to use a different language for output.
+/** Tells Tidy to use a different language for output. This is the language
+ ** for the whole process, so set it before any thread uses Tidy; to use a
+ ** different language for one document, see tidySetDocLanguage().
  ** @param  languageCode A Windows or POSIX language code, and must match
  **         a TIDY_LANGUAGE for an installed language.
  ** @result Indicates that a setting was applied, but not necessarily the
@@ -2048,6 +2223,16 @@ TIDY_EXPORT Bool TIDY_CALL tidySetLanguage( ctmbstr languageCode );
  */
 TIDY_EXPORT ctmbstr TIDY_CALL tidyGetLanguage(void);
 
+/** Tells Tidy to use a different language for one document's output. The
+ ** document's messages and option documentation use this language, and
+ ** other documents are unaffected.
+ ** @param  tdoc The tidy document.
+ ** @param  languageCode A Windows or POSIX language code, as for
+ **         tidySetLanguage().
+ ** @result Indicates that a setting was applied, as for tidySetLanguage().
+ */
+TIDY_EXPORT Bool TIDY_CALL tidySetDocLanguage( TidyDoc tdoc, ctmbstr languageCode );
+
 /** @}
  ** @name Locale Mappings
  ** @{
@@ -162,6 +162,7 @@ extern "C" {
 /* TidyDialogueSummary */  FN(STRING_NEEDS_INTERVENTION)   \
 /* TidyDialogueSummary */  FN(STRING_NO_ERRORS)            \
 /* TidyDialogueSummary */  FN(STRING_NOT_ALL_SHOWN)        \
+/* TidyDialogueSummary */  FN(STRING_REPEATS_NOT_SHOWN)    \
 /* TidyDialogueInfo */     FN(TEXT_GENERAL_INFO_PLEA)      \
 /* TidyDialogueInfo */     FN(TEXT_GENERAL_INFO)
 
@@ -432,6 +433,7 @@ extern "C" {
         FN(TC_LABEL_FILE)                   \
         FN(TC_LABEL_LANG)                   \
         FN(TC_LABEL_LEVL)                   \
+        FN(TC_LABEL_NUM)                    \
         FN(TC_LABEL_OPT)                    \
         FN(TC_MAIN_ERROR_LOAD_CONFIG)       \
         FN(TC_OPT_ACCESS)                   \
@@ -444,6 +446,7 @@ extern "C" {
         FN(TC_OPT_CONFIG)                   \
         FN(TC_OPT_ERRORS)                   \
         FN(TC_OPT_FILE)                     \
+        FN(TC_OPT_FILES0)                   \
         FN(TC_OPT_GDOC)                     \
         FN(TC_OPT_HELP)                     \
         FN(TC_OPT_HELPCFG)                  \
@@ -452,6 +455,7 @@ extern "C" {
         FN(TC_OPT_IBM858)                   \
         FN(TC_OPT_INDENT)                   \
         FN(TC_OPT_ISO2022)                  \
+        FN(TC_OPT_JOBS)                     \
         FN(TC_OPT_LANGUAGE)                 \
         FN(TC_OPT_LATIN0)                   \
         FN(TC_OPT_LATIN1)                   \
@@ -489,6 +493,7 @@ extern "C" {
         FN(TC_STRING_OUT_OF_MEMORY)         \
         FN(TC_STRING_FATAL_ERROR)           \
         FN(TC_STRING_FILE_MANIP)            \
+        FN(TC_STRING_JOBS_MUST_SPECIFY)     \
         FN(TC_STRING_LANG_MUST_SPECIFY)     \
         FN(TC_STRING_LANG_NOT_FOUND)        \
         FN(TC_STRING_MUST_SPECIFY)          \
@@ -561,6 +566,7 @@ typedef enum
     TidyAccessibilityCheckLevel, /**< Accessibility check level */
     TidyAltText,                 /**< Default text for alt attribute */
     TidyAnchorAsName,            /**< Define anchors as name attributes */
+    TidyArenaAllocation,         /**< Allocate the document tree from an arena */
     TidyAsciiChars,              /**< Convert quotes and dashes to nearest ASCII char */
     TidyBlockTags,               /**< Declared block tags */
     TidyBodyOnly,                /**< Output BODY content only */
@@ -636,6 +642,7 @@ typedef enum
     TidyQuoteMarks,              /**< Output " marks as &quot; */
     TidyQuoteNbsp,               /**< Output non-breaking space as entity */
     TidyReplaceColor,            /**< Replace hex color attribute values with names */
+    TidyReportRepeats,           /**< Number of times to report any one message */
     TidyShowErrors,              /**< Number of errors to put out */
     TidyShowFilename,            /**< If true, the input filename is displayed with the error messages */
     TidyShowInfo,                /**< If true, info-level messages are shown */
@@ -667,6 +674,7 @@ typedef enum
     TidyXmlPIs,                  /**< If set to yes PIs must end with ?> */
     TidyXmlSpace,                /**< If set to yes adds xml:space attr as needed */
     TidyXmlTags,                 /**< Treat input as XML */
+    TidyZeroCopyInput,           /**< Leave unmodified text in the caller's input buffer */
     N_TIDY_OPTIONS               /**< Must be last */
 } TidyOptionId;
 
@@ -400,7 +400,7 @@ static ctmbstr textFromOneNode( TidyDocImpl* doc, Node* node )
         /* Copy contents of a text node */
         for (i = node->start; i < node->end; ++i, ++x )
         {
-            txt[x] = doc->lexer->lexbuf[i];
+            txt[x] = NodeTextBuf(doc->lexer, node)[i];
 
             /* Check buffer overflow */
             if ( x >= sizeof(doc->access.text)-1 )
@@ -442,7 +442,7 @@ static void getTextNode( TidyDocImpl* doc, Node* node )
             if ( doc->access.counter >= TEXTBUF_SIZE-1 )
                 return;
 
-            txtnod[ doc->access.counter++ ] = doc->lexer->lexbuf[i];
+            txtnod[ doc->access.counter++ ] = NodeTextBuf(doc->lexer, node)[i];
         }
 
         /* Traverses through the contents within a container element */
@@ -1858,6 +1858,7 @@ static void CheckASCII( TidyDocImpl* doc, Node* node )
     int HasSkipOverLink = 0;
         
     uint i, x;
+    ctmbstr text;
     int newLines = -1;
     tmbchar compareLetter;
     int matchingCount = 0;
@@ -1869,22 +1870,24 @@ static void CheckASCII( TidyDocImpl* doc, Node* node )
            Checks the text within the PRE and XMP tags to see if ascii 
            art is present 
         */
+        text = NodeTextBuf( doc->lexer, node->content );
+
         for (i = node->content->start + 1; i < node->content->end; i++)
         {
             matchingCount = 0;
 
             /* Counts the number of lines of text */
-            if (doc->lexer->lexbuf[i] == '\n')
+            if (text[i] == '\n')
             {
                 newLines++;
             }
             
-            compareLetter = doc->lexer->lexbuf[i];
+            compareLetter = text[i];
 
-            /* Counts consecutive character matches */
-            for (x = i; x < i + 5; x++)
+            /* Counts consecutive character matches within the text */
+            for (x = i; x < i + 5 && x < node->content->end; x++)
             {
-                if (doc->lexer->lexbuf[x] == compareLetter)
+                if (text[x] == compareLetter)
                 {
                     matchingCount++;
                 }
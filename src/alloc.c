@@ -116,6 +116,158 @@ TidyAllocator TY_(g_default_allocator) = {
     &defaultVtbl
 };
 
+/* Arena allocator: blocks are carved from large chunks obtained from
+   another allocator. Freeing a block does nothing, the chunks are all
+   released together by FreeArena(). Blocks carry no size, so they can't
+   be resized; only alloc() is meant to be used on an arena. ResetArena()
+   drops every block at once but keeps the standard chunks for reuse.
+*/
+
+#define ARENA_CHUNK_SIZE  65536
+#define ARENA_ALIGN       16
+
+typedef struct _ArenaChunk
+{
+    struct _ArenaChunk* next;
+    size_t              size;  /* usable bytes after the header */
+} ArenaChunk;
+
+typedef struct _TidyArena
+{
+    TidyAllocator  base;       /* must be first */
+    TidyAllocator* allocator;  /* supplies the chunks */
+    ArenaChunk*    chunks;
+    ArenaChunk*    spare;      /* standard chunks kept by ResetArena() */
+    byte*          next;       /* free space of the current chunk */
+    byte*          limit;
+} TidyArena;
+
+#define ARENA_HEADER_SIZE \
+    ((sizeof(ArenaChunk) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+static void* TIDY_CALL arenaAlloc( TidyAllocator* base, size_t size )
+{
+    TidyArena* arena = (TidyArena*) base;
+    ArenaChunk* chunk;
+    byte* p;
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if ( size <= (size_t)(arena->limit - arena->next) )
+    {
+        p = arena->next;
+        arena->next += size;
+        return p;
+    }
+
+    /* Big blocks get a chunk of their own, so that the rest of the
+       current chunk isn't wasted */
+    if ( size > ARENA_CHUNK_SIZE / 4 )
+    {
+        chunk = (ArenaChunk*) TidyAlloc( arena->allocator,
+                                         ARENA_HEADER_SIZE + size );
+        chunk->size = size;
+        if ( arena->chunks )
+        {
+            chunk->next = arena->chunks->next;
+            arena->chunks->next = chunk;
+        }
+        else
+        {
+            chunk->next = NULL;
+            arena->chunks = chunk;
+        }
+        return (byte*) chunk + ARENA_HEADER_SIZE;
+    }
+
+    if ( arena->spare )
+    {
+        chunk = arena->spare;
+        arena->spare = chunk->next;
+    }
+    else
+    {
+        chunk = (ArenaChunk*) TidyAlloc( arena->allocator,
+                                         ARENA_HEADER_SIZE + ARENA_CHUNK_SIZE );
+        chunk->size = ARENA_CHUNK_SIZE;
+    }
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    p = (byte*) chunk + ARENA_HEADER_SIZE;
+    arena->next = p + size;
+    arena->limit = p + ARENA_CHUNK_SIZE;
+    return p;
+}
+
+static void* TIDY_CALL arenaRealloc( TidyAllocator* base, void* mem, size_t newsize )
+{
+    if ( mem == NULL )
+        return arenaAlloc( base, newsize );
+    TidyPanic( base, "Arena blocks can't be resized" );
+    return NULL;
+}
+
+static void TIDY_CALL arenaFree( TidyAllocator* ARG_UNUSED(base), void* ARG_UNUSED(mem) )
+{
+}
+
+static void TIDY_CALL arenaPanic( TidyAllocator* base, ctmbstr msg )
+{
+    TidyArena* arena = (TidyArena*) base;
+    TidyPanic( arena->allocator, msg );
+}
+
+static const TidyAllocatorVtbl arenaVtbl = {
+    arenaAlloc,
+    arenaRealloc,
+    arenaFree,
+    arenaPanic
+};
+
+TidyAllocator* TY_(NewArena)( TidyAllocator* allocator )
+{
+    TidyArena* arena = (TidyArena*) TidyAlloc( allocator, sizeof(TidyArena) );
+    TidyClearMemory( arena, sizeof(TidyArena) );
+    arena->base.vtbl = &arenaVtbl;
+    arena->allocator = allocator;
+    return &arena->base;
+}
+
+void TY_(ResetArena)( TidyAllocator* base )
+{
+    TidyArena* arena = (TidyArena*) base;
+
+    assert( base->vtbl == &arenaVtbl );
+    while ( arena->chunks )
+    {
+        ArenaChunk* next = arena->chunks->next;
+        if ( arena->chunks->size == ARENA_CHUNK_SIZE )
+        {
+            arena->chunks->next = arena->spare;
+            arena->spare = arena->chunks;
+        }
+        else
+            TidyFree( arena->allocator, arena->chunks );
+        arena->chunks = next;
+    }
+    arena->next = arena->limit = NULL;
+}
+
+void TY_(FreeArena)( TidyAllocator* base )
+{
+    TidyArena* arena = (TidyArena*) base;
+    TidyAllocator* allocator = arena->allocator;
+
+    assert( base->vtbl == &arenaVtbl );
+    TY_(ResetArena)( base );
+    while ( arena->spare )
+    {
+        ArenaChunk* next = arena->spare->next;
+        TidyFree( allocator, arena->spare );
+        arena->spare = next;
+    }
+    TidyFree( allocator, arena );
+}
+
 /*
  * local variables:
  * mode: c
@@ -10,6 +10,7 @@
 #include "message.h"
 #include "tmbstr.h"
 #include "utf8.h"
+#include "attrshash.h"
 
 /*
  Bind attribute types to procedures to check values.
@@ -582,93 +583,47 @@ static ctmbstr GetColorName(ctmbstr code)
     return NULL;
 }
 
+/* FNV-1a with ASCII letters folded to lower case. The tables in
+   attrshash.h were generated against this exact function, so keep it
+   in step with build/namehash/namehash.rb. */
 static uint attrsHash(ctmbstr s)
 {
-    uint hashval;
-
-    for (hashval = 0; *s != '\0'; s++)
-        hashval = *s + 31*hashval;
-
-    return hashval % ATTRIBUTE_HASH_SIZE;
-}
-
-static const Attribute *attrsInstall(TidyDocImpl* doc, TidyAttribImpl * attribs,
-                                const Attribute* old)
-{
-    AttrHash *np;
-    uint hashval;
+    uint hashval = ATTR_HASH_SEED;
+    uint c;
 
-    if (old)
+    for ( ; *s != '\0'; s++ )
     {
-        np = (AttrHash *)TidyDocAlloc(doc, sizeof(*np));
-        np->attr = old;
-
-        hashval = attrsHash(old->name);
-        np->next = attribs->hashtab[hashval];
-        attribs->hashtab[hashval] = np;
+        c = (byte)*s;
+        if ( c >= 'A' && c <= 'Z' )
+            c += 'a' - 'A';
+        hashval = (hashval ^ c) * 16777619u;
     }
 
-    return old;
-}
-
-static void attrsRemoveFromHash( TidyDocImpl* doc, TidyAttribImpl *attribs,
-                            ctmbstr s )
-{
-    uint h = attrsHash(s);
-    AttrHash *p, *prev = NULL;
-    for (p = attribs->hashtab[h]; p && p->attr; p = p->next)
-    {
-        if (TY_(tmbstrcmp)(s, p->attr->name) == 0)
-        {
-            AttrHash* next = p->next;
-            if ( prev )
-                prev->next = next; 
-            else
-                attribs->hashtab[h] = next;
-            TidyDocFree(doc, p);
-            return;
-        }
-        prev = p;
-    }
+    return hashval;
 }
 
-static void attrsEmptyHash( TidyDocImpl* doc, TidyAttribImpl * attribs )
-{
-    AttrHash *dict, *next;
-    uint i;
-
-    for (i = 0; i < ATTRIBUTE_HASH_SIZE; ++i)
-    {
-        dict = attribs->hashtab[i];
-
-        while(dict)
-        {
-            next = dict->next;
-            TidyDocFree(doc, dict);
-            dict = next;
-        }
-
-        attribs->hashtab[i] = NULL;
-    }
-}
-
-static const Attribute* attrsLookup(TidyDocImpl* doc,
+/* The built-in attributes sit in a static perfect hash over their
+   case folded names, so one probe and one comparison settle any name,
+   known or not. */
+static const Attribute* attrsLookup(TidyDocImpl* ARG_UNUSED(doc),
                                TidyAttribImpl* ARG_UNUSED(attribs),
                                ctmbstr atnam)
 {
     const Attribute *np;
-    const AttrHash *p;
+    uint hashval, ix;
 
     if (!atnam)
         return NULL;
 
-    for (p = attribs->hashtab[attrsHash(atnam)]; p && p->attr; p = p->next)
-        if (TY_(tmbstrcasecmp)(atnam, p->attr->name) == 0)
-            return p->attr;
+    hashval = attrsHash(atnam);
+    ix = attr_hash_slot[(hashval + attr_hash_disp[(hashval >> 16) & (ATTR_HASH_BUCKETS - 1)])
+                        & (ATTR_HASH_SLOTS - 1)];
+    if (ix == 0)
+        return NULL;
 
-    for (np = attribute_defs; np && np->name; ++np)
-        if (TY_(tmbstrcasecmp)(atnam, np->name) == 0)
-            return attrsInstall(doc, attribs, np);
+    np = &attribute_defs[ix - 1];
+    if (atnam == np->name || TY_(tmbstrcasecmp)(atnam, np->name) == 0)
+        return np;
 
     return NULL;
 }
@@ -694,6 +649,24 @@ const Attribute* TY_(FindAttribute)( TidyDocImpl* doc, AttVal *attval )
     return NULL;
 }
 
+const Attribute* TY_(LookupAttrDef)( TidyAttrId id )
+{
+    /* InitAttrs() checks that ids are indexes into attribute_defs[] */
+    if ( (uint) id < N_TIDY_ATTRIBS )
+        return &attribute_defs[id];
+    return NULL;
+}
+
+ctmbstr TY_(BuiltInAttrName)( TidyDocImpl* doc, ctmbstr name )
+{
+    const Attribute *np = attrsLookup( doc, &doc->attribs, name );
+
+    /* the lookup ignores case */
+    if ( np && TY_(tmbstrcmp)(np->name, name) == 0 )
+        return np->name;
+    return NULL;
+}
+
 AttVal* TY_(GetAttrByName)( Node *node, ctmbstr name )
 {
     AttVal *attr;
@@ -731,7 +704,7 @@ AttVal* TY_(AddAttribute)( TidyDocImpl* doc,
 {
     AttVal *av = TY_(NewAttribute)(doc);
     av->delim = '"';
-    av->attribute = TY_(tmbstrdup)(doc->allocator, name);
+    av->attribute = TY_(InternName)(doc, name);
 
     if (value)
         av->value = TY_(tmbstrdup)(doc->allocator, value);
@@ -779,6 +752,9 @@ void TY_(FreeAttrPriorityList)( TidyDocImpl* doc )
 
         TidyFree( doc->allocator, priorities->list );
     }
+    priorities->list = NULL;
+    priorities->count = 0;
+    priorities->capacity = 0;
 }
 
 
@@ -1113,7 +1089,6 @@ static void FreeDeclaredAttributes( TidyDocImpl* doc )
     while ( NULL != (dict = attribs->declared_attr_list) )
     {
         attribs->declared_attr_list = dict->next;
-        attrsRemoveFromHash( doc, &doc->attribs, dict->name );
         TidyDocFree( doc, dict->name );
         TidyDocFree( doc, dict );
     }
@@ -1121,7 +1096,6 @@ static void FreeDeclaredAttributes( TidyDocImpl* doc )
 
 void TY_(FreeAttrTable)( TidyDocImpl* doc )
 {
-    attrsEmptyHash( doc, &doc->attribs );
     TY_(FreeAnchors)( doc );
     FreeDeclaredAttributes( doc );
 }
@@ -1201,8 +1175,9 @@ static Bool AttrsHaveSameName( AttVal* av1, AttVal* av2)
         return AttrsHaveSameId(av1, av2);
     if (id1 != TidyAttr_UNKNOWN || id2 != TidyAttr_UNKNOWN)
         return no;
+    /* names are interned */
     if (av1->attribute && av2->attribute)
-        return TY_(tmbstrcmp)(av1->attribute, av2->attribute) == 0;
+        return av1->attribute == av2->attribute;
      return no;
 }
 
@@ -1215,7 +1190,7 @@ void TY_(RepairDuplicateAttributes)( TidyDocImpl* doc, Node *node, Bool isXml )
         AttVal *second;
         Bool firstRedefined = no;
 
-        if (!(first->asp == NULL && first->php == NULL))
+        if (first->script)
         {
             first = first->next;
             continue;
@@ -1225,8 +1200,7 @@ void TY_(RepairDuplicateAttributes)( TidyDocImpl* doc, Node *node, Bool isXml )
         {
             AttVal *temp;
 
-            if (!(second->asp == NULL && second->php == NULL
-                  && AttrsHaveSameName(first, second)))
+            if (second->script || !AttrsHaveSameName(first, second))
             {
                 second = second->next;
                 continue;
@@ -36,19 +36,6 @@ struct _Anchor
 
 typedef struct _Anchor Anchor;
 
-enum
-{
-    ATTRIBUTE_HASH_SIZE=178u
-};
-
-struct _AttrHash
-{
-    Attribute const*  attr;
-    struct _AttrHash* next;
-};
-
-typedef struct _AttrHash AttrHash;
-
 enum
 {
     ANCHOR_HASH_SIZE=1021u
@@ -71,8 +58,6 @@ struct _TidyAttribImpl
 
     /* Prioritized list of attributes to write */
     PriorityAttribs priorityAttribs;
-
-    AttrHash*  hashtab[ATTRIBUTE_HASH_SIZE];
 };
 
 typedef struct _TidyAttribImpl TidyAttribImpl;
@@ -86,6 +71,12 @@ const Attribute* TY_(CheckAttribute)( TidyDocImpl* doc, Node *node, AttVal *attv
 
 const Attribute* TY_(FindAttribute)( TidyDocImpl* doc, AttVal *attval );
 
+/* the built-in attribute with the given id, or NULL */
+const Attribute* TY_(LookupAttrDef)( TidyAttrId id );
+
+/* the static name of the built-in attribute spelled exactly like name */
+ctmbstr TY_(BuiltInAttrName)( TidyDocImpl* doc, ctmbstr name );
+
 AttVal* TY_(GetAttrByName)( Node *node, ctmbstr name );
 
 void TY_(DropAttrByName)( TidyDocImpl* doc, Node *node, ctmbstr name );
@@ -0,0 +1,68 @@
+#ifndef __ATTRSHASH_H__
+#define __ATTRSHASH_H__
+
+/* attrshash.h -- perfect hash over the names in attribute_defs
+
+  THIS FILE IS MACHINE GENERATED by build/namehash/namehash.rb from
+  src/attrs.c; do not edit it by hand. Regenerate it whenever a row
+  is added to, removed from or moved within attribute_defs.
+
+  (c) 2017 HTACG
+  See tidy.h for the copyright notice.
+*/
+
+#define ATTR_HASH_SEED     0x811c9dc5u
+#define ATTR_HASH_BUCKETS  128u
+#define ATTR_HASH_SLOTS    512u
+
+/* added to the hash before masking, indexed by bits 16 and up */
+static const unsigned short attr_hash_disp[ATTR_HASH_BUCKETS] =
+{
+      1,   4,   0,   2,   0,   0,   0,   1,   0,   0,   0,   0,   1,   2,   0,   4,
+      0,   0,   3,   2,   1,   4,   4,   0,   1,   2,   1,   0,   0,   1,  12,   0,
+      1,   0,   4,   0,   0,   3,   1,   1,   3,   0,   3,   1,   0,   1,   3,   5,
+      0,   0,   0,  18,   0,   3,   0,   0,   4,   0,   6,   1,   5,   1,   2,   3,
+     19,   7,   0,   6,   0,   3,   2,  11,   4,   5,   0,   0,   6,  19,   0,   1,
+      1,   5,   2,   0,   3,   1,   5,   1,   0,   5,   0,   0,   0,   3,   0,  20,
+      0,   0,   1,   2,   3,   1,   1,   3,   2,  16,   0,   1,   1,   0,   3,   3,
+      5,  10,   7,   1,   1,  12,   0,   7,   0,   0,   0,   1,   0,   0,   1,   0
+};
+
+/* attribute_defs index + 1 of the name in each slot; 0 marks a free slot */
+static const unsigned short attr_hash_slot[ATTR_HASH_SLOTS] =
+{
+    194,  27, 215, 195,  55, 277,  45,  69, 251, 323, 234,   0, 211, 109,   0, 273,
+    257, 123, 313,   0,   0, 217, 174,   0, 181, 128,   0,   0, 224,   0, 267,   0,
+    162, 264,   0,   0,   0,  29, 288,   0, 148,   3,  43, 158,  19, 319, 282, 236,
+    253, 216, 169, 190, 185,   0,   0, 227, 306,  17, 248, 164,   0,   0, 318, 150,
+     78, 178,   0, 130,   0, 197, 182, 268, 149, 177,  96,   1,   0,   0, 279,   0,
+      0,   0, 239,   0,   0,   0, 296,   0, 308,  33,   0,   0,   0,   0,  26,  11,
+      0,  92, 238,  23,   0, 201,   0,   0,   0,  79, 192,   4,   0,   0, 199, 139,
+      0,   0,   0, 111,   0,   5,   0,   0,  35, 168, 301,  56,  68, 226,  75,   0,
+    221, 272, 198, 103,  81,   0, 200,  70, 309, 117, 263,  24, 232, 209,   7,   0,
+    327,   0, 280, 305, 180,   0, 256,   0, 241,   0, 220,   0,   0, 160,  14, 167,
+    324, 159,  84, 316, 143, 163, 196, 100,   0,   0, 110,   0,  39,   0,   0, 237,
+      0,   0,   0,   0, 265,  82,   0,   0,   0,   0, 108,   0,  93, 326,   2, 328,
+      0,   0,  31, 152, 171, 141,  25, 307, 246, 206,   0, 274,  67, 325,   0, 115,
+     57, 249,   0, 126,   0, 213, 146, 290,  61, 113, 322,   0, 138,  83, 188,   0,
+    145, 247,   0, 262,  65,   0,  36, 304, 222, 298, 284,   0, 107,  99,  90, 121,
+      0, 311, 293,   0,  30, 310,   0, 289,   0,  76, 186, 228, 173,   0,   0, 281,
+    269,   0,   6,   0,  85,   0,  48,   0, 261, 294, 151, 244, 176,   0,   0,   0,
+      0,   0,   0, 147,  63,   0, 170, 271,   0,  66, 203, 155, 101, 202, 275, 144,
+    172, 240, 315,  22, 266, 317,  34, 300, 260,  98, 258, 102, 136,   0,   0,   0,
+    219,  41,  28,  86, 205, 116,   0,   0,   0,   0, 193, 245, 122,  58, 112,  46,
+      0,  95,   0,  60,  94,  62,   0, 187,   0, 243,   0,   0, 134, 137, 154, 283,
+     21, 212,   0,   0,  51,  74,   0,  10,  42,   0,  72, 204, 270, 140, 114,   0,
+      0,  32,   0, 207,   0, 286,   0,   0, 214, 250,   0,   0,   0,   0,   0,   0,
+    175,   0, 223,   0, 135, 125,   0,   0, 278,   0,   0, 218, 106, 314,   0, 255,
+      0, 229, 132, 235, 312, 231,  18,   0, 230,  15,   0,   0, 189,   0,  80, 184,
+     44,  53,   0,   0, 276,  47,   0,   0, 129,   0, 259, 127, 297,   0,   0, 104,
+      0, 166,   0, 120,   0,   0,  54,   0, 105,  64, 320, 191,  38,  20, 119,   0,
+      0,   0,   0, 242,   0,   0, 295, 292, 118,  16, 233,   0,  77, 161,   0,   0,
+      0, 287,  87,  71,  37,   0,  12,   0,   0,  97, 157, 321, 303,   0, 142,   0,
+      0,   0,   0,   0,   0, 153, 225,   0,   0,   0,   0,   0,   0,  52,   8, 183,
+      0, 131, 179, 156,   0,   0,  88,   0,   0,   0,  59, 254,   0,   0, 133, 291,
+    299,  50, 252, 208,  91,  13, 285, 124,  89,  49, 210,  40, 165,  73,   9, 302
+};
+
+#endif /* __ATTRSHASH_H__ */
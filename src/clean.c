@@ -57,9 +57,8 @@ static Node* CleanNode( TidyDocImpl* doc, Node *node );
 
 static void RenameElem( TidyDocImpl* doc, Node* node, TidyTagId tid )
 {
-    const Dict* dict = TY_(LookupTagDef)( tid );
-    TidyDocFree( doc, node->element );
-    node->element = TY_(tmbstrdup)( doc->allocator, dict->name );
+    const Dict* dict = TY_(LookupTagDef)( doc, tid );
+    node->element = TY_(InternName)( doc, dict->name );
     node->tag = dict;
 }
 
@@ -375,9 +374,8 @@ static void Style2Rule( TidyDocImpl* doc, Node *node)
         }
         else /* reuse style attribute for class attribute */
         {
-            TidyDocFree(doc, styleattr->attribute);
             TidyDocFree(doc, styleattr->value);
-            styleattr->attribute = TY_(tmbstrdup)(doc->allocator, "class");
+            styleattr->attribute = TY_(InternName)(doc, "class");
             styleattr->value = TY_(tmbstrdup)(doc->allocator, classname);
         }
     }
@@ -511,10 +509,10 @@ static void CreateStyleElement( TidyDocImpl* doc )
     if ( lexer->styles == NULL && NiceBody(doc) )
         return;
 
-    node = TY_(NewNode)( doc->allocator, lexer );
+    node = TY_(NewNode)( lexer->nodeAllocator, lexer );
     node->type = StartTag;
     node->implicit = yes;
-    node->element = TY_(tmbstrdup)(doc->allocator, "style");
+    node->element = TY_(InternName)(doc, "style");
     TY_(FindTag)( doc, node );
 
     /* insert type attribute */
@@ -846,8 +844,7 @@ static void AddFontSize( TidyDocImpl* doc, Node* node, ctmbstr size )
 
         if (value)
         {
-            TidyDocFree(doc, node->element);
-            node->element = TY_(tmbstrdup)(doc->allocator, value);
+            node->element = TY_(InternName)(doc, value);
             TY_(FindTag)(doc, node);
             return;
         }
@@ -987,9 +984,8 @@ static Bool Dir2Div( TidyDocImpl* doc, Node *node, Node **ARG_UNUSED(pnode))
             return no;
 
         /* coerce dir to div */
-        node->tag = TY_(LookupTagDef)( TidyTag_DIV );
-        TidyDocFree( doc, node->element );
-        node->element = TY_(tmbstrdup)(doc->allocator, "div");
+        node->tag = TY_(LookupTagDef)( doc, TidyTag_DIV );
+        node->element = TY_(InternName)(doc, "div");
         TY_(AddStyleProperty)( doc, node, "margin-left: 2em" );
         StripOnlyChild( doc, node );
         return yes;
@@ -1638,7 +1634,7 @@ static Node* PruneSection( TidyDocImpl* doc, Node *node )
 
     for (;;)
     {
-        ctmbstr lexbuf = lexer->lexbuf + node->start;
+        ctmbstr lexbuf = NodeTextBuf(lexer, node) + node->start;
         if ( TY_(tmbstrncmp)(lexbuf, "if !supportEmptyParas", 21) == 0 )
         {
           Node* cell = FindEnclosingCell( doc, node );
@@ -1789,6 +1785,33 @@ static Node* StripSpan( TidyDocImpl* doc, Node* span )
     return node;
 }
 
+/*
+  Text nodes are rewritten in place, a character at a time. An invalid
+  UTF-8 byte is rewritten as U+FFFD, which is longer, so text with one
+  is first moved to the end of lexbuf with room to grow, where it can't
+  run over the text of the nodes after it.
+*/
+static void PrepareTextRewrite( Lexer* lexer, Node* node )
+{
+    ctmbstr buf = NodeTextBuf( lexer, node );
+    uint i, c, n;
+
+    for ( i = node->start; i < node->end; ++i )
+    {
+        if ( (byte) buf[i] > 0x7F )
+        {
+            n = TY_(GetUTF8)( buf + i, &c );
+            if ( c == 0xFFFD && n < 2 )
+            {
+                TY_(MoveTextToEnd)( lexer, node, 2 * (node->end - node->start) );
+                return;
+            }
+            i += n;
+        }
+    }
+    TY_(MaterializeText)( lexer, node, 0 );
+}
+
 /* map non-breaking spaces to regular spaces */
 void TY_(NormalizeSpaces)(Lexer *lexer, Node *node)
 {
@@ -1800,7 +1823,10 @@ void TY_(NormalizeSpaces)(Lexer *lexer, Node *node)
         if (TY_(nodeIsText)(node))
         {
             uint i, c;
-            tmbstr p = lexer->lexbuf + node->start;
+            tmbstr p;
+
+            PrepareTextRewrite( lexer, node );
+            p = lexer->lexbuf + node->start;
 
             for (i = node->start; i < node->end; ++i)
             {
@@ -1855,13 +1881,13 @@ static Bool SingleSpace( Lexer* lexer, Node* node )
             return no;
 
         if ( (node->end - node->start) == 1 &&
-             lexer->lexbuf[node->start] == ' ' )
+             NodeTextBuf(lexer, node)[node->start] == ' ' )
             return yes;
 
         if ( (node->end - node->start) == 2 )
         {
             uint c = 0;
-            TY_(GetUTF8)( lexer->lexbuf + node->start, &c );
+            TY_(GetUTF8)( NodeTextBuf(lexer, node) + node->start, &c );
             if ( c == 160 )
                 return yes;
         }
@@ -2029,7 +2055,7 @@ void TY_(CleanWord2000)( TidyDocImpl* doc, Node *node)
 
                 if ( !list || TagId(list) != listType )
                 {
-                    const Dict* tag = TY_(LookupTagDef)( listType );
+                    const Dict* tag = TY_(LookupTagDef)( doc, listType );
                     list = TY_(InferredTag)(doc, tag->id);
                     TY_(InsertNodeBeforeElement)(node, list);
                 }
@@ -2484,7 +2510,10 @@ void TY_(DowngradeTypography)(TidyDocImpl* doc, Node* node)
         if (TY_(nodeIsText)(node))
         {
             uint i, c;
-            tmbstr p = lexer->lexbuf + node->start;
+            tmbstr p;
+
+            PrepareTextRewrite( lexer, node );
+            p = lexer->lexbuf + node->start;
 
             for (i = node->start; i < node->end; ++i)
             {
@@ -171,6 +171,7 @@ static const TidyOptionImpl option_defs[] =
     { TidyAccessibilityCheckLevel, DG, "accessibility-check",         IN, 0,               ParsePickList,     &accessPicks        },
     { TidyAltText,                 MR, "alt-text",                    ST, 0,               ParseString,       NULL                },
     { TidyAnchorAsName,            MR, "anchor-as-name",              BL, yes,             ParsePickList,     &boolPicks          },
+    { TidyArenaAllocation,         DT, "arena-allocation",            BL, no,              ParsePickList,     &boolPicks          },
     { TidyAsciiChars,              ME, "ascii-chars",                 BL, no,              ParsePickList,     &boolPicks          },
     { TidyBlockTags,               MT, "new-blocklevel-tags",         ST, 0,               ParseList,         NULL                },
     { TidyBodyOnly,                DD, "show-body-only",              IN, no,              ParsePickList,     &autoBoolPicks      },
@@ -244,6 +245,7 @@ static const TidyOptionImpl option_defs[] =
     { TidyQuoteMarks,              ME, "quote-marks",                 BL, no,              ParsePickList,     &boolPicks          },
     { TidyQuoteNbsp,               ME, "quote-nbsp",                  BL, yes,             ParsePickList,     &boolPicks          },
     { TidyReplaceColor,            MX, "replace-color",               BL, no,              ParsePickList,     &boolPicks          },
+    { TidyReportRepeats,           DD, "report-repeats",              IN, 0,               ParseInt,          NULL                },
     { TidyShowErrors,              DD, "show-errors",                 IN, 6,               ParseInt,          NULL                },
     { TidyShowFilename,            DD, "show-filename",               BL, no,              ParsePickList,     &boolPicks          },
     { TidyShowInfo,                DD, "show-info",                   BL, yes,             ParsePickList,     &boolPicks          },
@@ -275,6 +277,7 @@ static const TidyOptionImpl option_defs[] =
     { TidyXmlPIs,                  MR, "assume-xml-procins",          BL, no,              ParsePickList,     &boolPicks          },
     { TidyXmlSpace,                DT, "add-xml-space",               BL, no,              ParsePickList,     &boolPicks          },
     { TidyXmlTags,                 DT, "input-xml",                   BL, no,              ParsePickList,     &boolPicks          },
+    { TidyZeroCopyInput,           IO, "zero-copy-input",             BL, no,              ParsePickList,     &boolPicks          },
     { N_TIDY_OPTIONS,              XX, NULL,                          XY, 0,               NULL,              NULL                }
 };
 
@@ -311,6 +314,7 @@ static Bool GetPickListValue( ctmbstr value, PickListItems* pickList, uint *resu
 void TY_(InitConfig)( TidyDocImpl* doc )
 {
     TidyClearMemory( &doc->config, sizeof(TidyConfigImpl) );
+    doc->config.value = doc->config.own;
     TY_(ResetConfigToDefault)( doc );
 }
 
@@ -375,9 +379,34 @@ static void PerformOptionChangedCallback( TidyDocImpl* doc, const TidyOptionImpl
     }
 }
 
+/* Strings that are the default or the shared configuration's aren't the
+   document's to free. */
+static Bool OptionValueBorrowed( TidyDocImpl* doc, const TidyOptionImpl* option,
+                                 const TidyOptionValue* value )
+{
+    const TidySharedConfig* shared = doc->config.shared;
+
+    return ( value->p == option->pdflt ||
+             (shared && value->p == shared->value[ option->id ].p) );
+}
+
+/* The values to write to: a document that reads shared values gets a
+   copy of its own first, borrowing their strings. */
+static TidyOptionValue* OwnValues( TidyDocImpl* doc )
+{
+    TidyConfigImpl* config = &doc->config;
+
+    if ( config->value != config->own )
+    {
+        memcpy( config->own, config->value, sizeof(config->own) );
+        config->value = config->own;
+    }
+    return config->own;
+}
+
 static void FreeOptionValue( TidyDocImpl* doc, const TidyOptionImpl* option, TidyOptionValue* value )
 {
-    if ( option->type == TidyString && value->p && value->p != option->pdflt )
+    if ( option->type == TidyString && value->p && !OptionValueBorrowed(doc, option, value) )
         TidyDocFree( doc, value->p );
 }
 
@@ -401,7 +430,7 @@ static void CopyOptionValue( TidyDocImpl* doc, const TidyOptionImpl* option,
 
     if ( option->type == TidyString )
     {
-        if ( newval->p && newval->p != option->pdflt )
+        if ( newval->p && !OptionValueBorrowed(doc, option, newval) )
             oldval->p = TY_(tmbstrdup)( doc->allocator, newval->p );
         else
             oldval->p = newval->p;
@@ -417,25 +446,24 @@ static void CopyOptionValue( TidyDocImpl* doc, const TidyOptionImpl* option,
 static Bool SetOptionValue( TidyDocImpl* doc, TidyOptionId optId, ctmbstr val )
 {
     const TidyOptionImpl* option = &option_defs[ optId ];
+    TidyOptionValue* value;
     Bool fire_callback = no;
     Bool status = ( optId < N_TIDY_OPTIONS );
 
     if ( status )
     {
         assert( option->id == optId && option->type == TidyString );
+        value = &OwnValues( doc )[ optId ];
 
         /* Compare the old and new values. */
         if ( doc->pConfigChangeCallback )
-        {
-            TidyOptionValue* oldval = &(doc->config.value[ optId ]);
-            fire_callback = OptionChangedValuesDiffer( oldval->p, val );
-        }
+            fire_callback = OptionChangedValuesDiffer( value->p, val );
 
-        FreeOptionValue( doc, option, &doc->config.value[ optId ] );
+        FreeOptionValue( doc, option, value );
         if ( TY_(tmbstrlen)(val)) /* Issue #218 - ONLY if it has LENGTH! */
-            doc->config.value[ optId ].p = TY_(tmbstrdup)( doc->allocator, val );
+            value->p = TY_(tmbstrdup)( doc->allocator, val );
         else
-            doc->config.value[ optId ].p = 0; /* should already be zero, but to be sure... */
+            value->p = 0; /* should already be zero, but to be sure... */
     }
 
     if ( fire_callback )
@@ -470,12 +498,14 @@ ctmbstr TY_(GetPickListLabelForPick)( TidyOptionId optId, uint pick )
 static void SetOptionInteger( TidyDocImpl* doc, TidyOptionId optId, ulong val )
 {
     const TidyOptionImpl* option = &option_defs[ optId ];
-    ulong* optVal = &(doc->config.value[ optId ].v);
-    Bool fire_callback = doc->pConfigChangeCallback && *optVal != val;
 
-    *optVal = val;
+    /* setting the same value is common, and mustn't copy shared values */
+    if ( doc->config.value[ optId ].v == val )
+        return;
 
-    if ( fire_callback )
+    OwnValues( doc )[ optId ].v = val;
+
+    if ( doc->pConfigChangeCallback )
         PerformOptionChangedCallback( doc, option );
 }
 
@@ -529,7 +559,7 @@ Bool TY_(ResetOptionToDefault)( TidyDocImpl* doc, TidyOptionId optId )
     {
         TidyOptionValue dflt;
         const TidyOptionImpl* option = option_defs + optId;
-        TidyOptionValue* value = &doc->config.value[ optId ];
+        TidyOptionValue* value = &OwnValues( doc )[ optId ];
         assert( optId == option->id );
         GetOptionDefault( option, &dflt );
         CopyOptionValue( doc, option, value, &dflt );
@@ -614,6 +644,42 @@ static void ReparseTagDecls( TidyDocImpl* doc, uint changedUserTags  )
 }
 
 
+/* Tags can also be declared while a document is processed: autonomous
+   custom tags as they are met, and o:p for Word 2000. This drops all of
+   them and declares again only those that the options list. o:p comes
+   back with the next parse, so it alone is no reason to do this.
+*/
+void TY_(ResetDeclaredTags)( TidyDocImpl* doc )
+{
+    static const TidyOptionId tagOptions[] = {
+        TidyInlineTags, TidyBlockTags, TidyEmptyTags, TidyPreTags,
+        TidyCustomTags
+    };
+    const TidySharedConfig* shared = doc->config.shared;
+    TidyConfigChangeCallback callback = doc->pConfigChangeCallback;
+    uint i;
+
+    if ( !doc->tags.declaredCustom )
+        return;
+    doc->tags.declaredCustom = no;
+
+    TY_(FreeDeclaredTags)( doc, tagtype_null );
+    if ( shared && doc->config.value == shared->value )
+    {
+        TY_(DeclareTagCopies)( doc, shared->tags, shared->tagcount, tagtype_null );
+        return;
+    }
+
+    doc->pConfigChangeCallback = NULL;
+    for ( i = 0; i < sizeof(tagOptions)/sizeof(tagOptions[0]); ++i )
+    {
+        if ( cfgStr(doc, tagOptions[i]) )
+            ReparseTagType( doc, tagOptions[i] );
+    }
+    doc->pConfigChangeCallback = callback;
+}
+
+
 /*  Returns the option id of the replacement Tidy option for optName. Because
  ** an option might not have a replacement (0, TidyUnknownOption), a return
  ** value of N_TIDY_OPTIONS indicates an error, i.e., that the option isn't
@@ -694,7 +760,7 @@ void TY_(ResetConfigToDefault)( TidyDocImpl* doc )
 {
     uint ixVal;
     const TidyOptionImpl* option = option_defs;
-    TidyOptionValue* value = &doc->config.value[ 0 ];
+    TidyOptionValue* value = OwnValues( doc );
     for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
     {
         TidyOptionValue dflt;
@@ -706,14 +772,89 @@ void TY_(ResetConfigToDefault)( TidyDocImpl* doc )
 }
 
 
+/* Frees the strings of values that aren't the current ones */
+static void FreeValues( TidyDocImpl* doc, TidyOptionValue* values )
+{
+    uint ixVal;
+    const TidyOptionImpl* option = option_defs;
+
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
+        FreeOptionValue( doc, option, &values[ixVal] );
+    TidyClearMemory( values, sizeof(TidyOptionValue) * (N_TIDY_OPTIONS + 1) );
+}
+
+
+/* Brings back the tags that the shared configuration declares, for the
+   user tag types whose options had been changed */
+static void RedeclareSharedTags( TidyDocImpl* doc, uint changedUserTags )
+{
+    const TidySharedConfig* shared = doc->config.shared;
+
+#define REDECLARE_USERTAGS(USERTAGTYPE) \
+    if ( changedUserTags & USERTAGTYPE ) \
+    { \
+        TY_(FreeDeclaredTags)( doc, USERTAGTYPE ); \
+        TY_(DeclareTagCopies)( doc, shared->tags, shared->tagcount, USERTAGTYPE ); \
+    }
+    REDECLARE_USERTAGS(tagtype_inline);
+    REDECLARE_USERTAGS(tagtype_block);
+    REDECLARE_USERTAGS(tagtype_empty);
+    REDECLARE_USERTAGS(tagtype_pre);
+}
+
+
+/* Switches the document back from its own values to the shared ones */
+static void ReadSharedValues( TidyDocImpl* doc )
+{
+    TidyConfigImpl* config = &doc->config;
+    const TidyOptionValue* shared = config->shared->value;
+    const TidyOptionImpl* option = option_defs;
+    Bool changed[ N_TIDY_OPTIONS ];
+    uint ixVal;
+    uint changedUserTags;
+    Bool needReparseTagsDecls;
+
+    if ( config->value == shared )
+        return;
+
+    needReparseTagsDecls = NeedReparseTagDecls( doc, config->own, shared,
+                                                &changedUserTags );
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
+        changed[ixVal] = !OptionValueIdentical( option, &config->own[ixVal],
+                                                &shared[ixVal] );
+    FreeValues( doc, config->own );
+    config->value = shared;
+
+    if ( needReparseTagsDecls )
+        RedeclareSharedTags( doc, changedUserTags );
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++ixVal )
+    {
+        if ( changed[ixVal] )
+            PerformOptionChangedCallback( doc, option_defs + ixVal );
+    }
+}
+
+
 void TY_(TakeConfigSnapshot)( TidyDocImpl* doc )
 {
     uint ixVal;
     const TidyOptionImpl* option = option_defs;
-    const TidyOptionValue* value = &doc->config.value[ 0 ];
+    const TidyOptionValue* value;
     TidyOptionValue* snap  = &doc->config.snapshot[ 0 ];
 
     AdjustConfig( doc );  /* Make sure it's consistent */
+
+    /* the shared values are a snapshot already */
+    value = doc->config.value;
+    if ( doc->config.shared && value == doc->config.shared->value )
+    {
+        if ( !doc->config.snapshotShared )
+            FreeValues( doc, snap );
+        doc->config.snapshotShared = yes;
+        return;
+    }
+
+    doc->config.snapshotShared = no;
     for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
     {
         assert( ixVal == (uint) option->id );
@@ -726,12 +867,20 @@ void TY_(ResetConfigToSnapshot)( TidyDocImpl* doc )
 {
     uint ixVal;
     const TidyOptionImpl* option = option_defs;
-    TidyOptionValue* value = &doc->config.value[ 0 ];
+    TidyOptionValue* value;
     const TidyOptionValue* snap  = &doc->config.snapshot[ 0 ];
     uint changedUserTags;
-    Bool needReparseTagsDecls = NeedReparseTagDecls( doc, value, snap,
-                                                     &changedUserTags );
-    
+    Bool needReparseTagsDecls;
+
+    if ( doc->config.snapshotShared )
+    {
+        ReadSharedValues( doc );
+        return;
+    }
+
+    value = OwnValues( doc );
+    needReparseTagsDecls = NeedReparseTagDecls( doc, value, snap,
+                                                &changedUserTags );
     for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
     {
         assert( ixVal == (uint) option->id );
@@ -748,13 +897,14 @@ void TY_(CopyConfig)( TidyDocImpl* docTo, TidyDocImpl* docFrom )
     {
         uint ixVal;
         const TidyOptionImpl* option = option_defs;
-        const TidyOptionValue* from = &docFrom->config.value[ 0 ];
-        TidyOptionValue* to   = &docTo->config.value[ 0 ];
+        const TidyOptionValue* from = docFrom->config.value;
+        TidyOptionValue* to;
         uint changedUserTags;
-        Bool needReparseTagsDecls = NeedReparseTagDecls( docTo, to, from,
-                                                         &changedUserTags );
+        Bool needReparseTagsDecls = NeedReparseTagDecls( docTo, docTo->config.value,
+                                                         from, &changedUserTags );
 
         TY_(TakeConfigSnapshot)( docTo );
+        to = OwnValues( docTo );
         for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
         {
             assert( ixVal == (uint) option->id );
@@ -767,6 +917,146 @@ void TY_(CopyConfig)( TidyDocImpl* docTo, TidyDocImpl* docFrom )
 }
 
 
+
+TidySharedConfig* TY_(CompileConfig)( TidyDocImpl* doc )
+{
+    TidySharedConfig* shared;
+    const TidyOptionImpl* option = option_defs;
+    const TidyOptionValue* value;
+    const PriorityAttribs* priorities = &doc->attribs.priorityAttribs;
+    uint ixVal;
+
+    AdjustConfig( doc );  /* as parsing would */
+    TY_(ResetDeclaredTags)( doc );
+
+    shared = (TidySharedConfig*) TidyDocAlloc( doc, sizeof(TidySharedConfig) );
+    TidyClearMemory( shared, sizeof(TidySharedConfig) );
+    shared->allocator = doc->allocator;
+
+    value = doc->config.value;
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
+    {
+        assert( ixVal == (uint) option->id );
+        shared->value[ixVal] = value[ixVal];
+        if ( option->type == TidyString && value[ixVal].p
+             && value[ixVal].p != option->pdflt )
+            shared->value[ixVal].p = TY_(tmbstrdup)( doc->allocator, value[ixVal].p );
+    }
+
+    shared->defined_tags = doc->config.defined_tags;
+    shared->tags = TY_(CopyDeclaredTags)( doc, &shared->tagcount );
+
+    if ( priorities->count > 0 )
+    {
+        shared->priorities = (tmbstr*) TidyDocAlloc( doc, priorities->count * sizeof(tmbstr) );
+        for ( ixVal = 0; ixVal < priorities->count; ++ixVal )
+            shared->priorities[ixVal] = TY_(tmbstrdup)( doc->allocator, priorities->list[ixVal] );
+        shared->prioritycount = priorities->count;
+    }
+
+    if ( doc->muted.count > 0 )
+    {
+        shared->muted = (tidyStrings*) TidyDocAlloc( doc, doc->muted.count * sizeof(tidyStrings) );
+        memcpy( shared->muted, doc->muted.list, doc->muted.count * sizeof(tidyStrings) );
+        shared->mutedcount = doc->muted.count;
+    }
+    return shared;
+}
+
+
+void TY_(FreeSharedConfig)( TidySharedConfig* shared )
+{
+    TidyAllocator* allocator = shared->allocator;
+    const TidyOptionImpl* option = option_defs;
+    uint ixVal;
+
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
+    {
+        if ( option->type == TidyString && shared->value[ixVal].p
+             && shared->value[ixVal].p != option->pdflt )
+            TidyFree( allocator, shared->value[ixVal].p );
+    }
+
+    if ( shared->tags )
+        TY_(FreeTagCopies)( allocator, shared->tags, shared->tagcount );
+    if ( shared->priorities )
+    {
+        for ( ixVal = 0; ixVal < shared->prioritycount; ++ixVal )
+            TidyFree( allocator, shared->priorities[ixVal] );
+        TidyFree( allocator, shared->priorities );
+    }
+    if ( shared->muted )
+        TidyFree( allocator, shared->muted );
+    TidyFree( allocator, shared );
+}
+
+
+/* Makes the strings that the values borrow from the shared configuration
+   the document's own */
+static void OwnBorrowedValues( TidyDocImpl* doc, TidyOptionValue* values )
+{
+    const TidySharedConfig* shared = doc->config.shared;
+    const TidyOptionImpl* option = option_defs;
+    uint ixVal;
+
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
+    {
+        if ( option->type == TidyString && values[ixVal].p
+             && values[ixVal].p != option->pdflt
+             && values[ixVal].p == shared->value[ixVal].p )
+            values[ixVal].p = TY_(tmbstrdup)( doc->allocator, values[ixVal].p );
+    }
+}
+
+
+void TY_(UseSharedConfig)( TidyDocImpl* doc, const TidySharedConfig* shared )
+{
+    TidyConfigImpl* config = &doc->config;
+    const TidyOptionImpl* option = option_defs;
+    Bool changed[ N_TIDY_OPTIONS ];
+    uint ixVal;
+
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++option, ++ixVal )
+        changed[ixVal] = shared && !OptionValueIdentical( option, &config->value[ixVal],
+                                                          &shared->value[ixVal] );
+
+    /* Stop using the current one */
+    if ( config->shared )
+    {
+        OwnBorrowedValues( doc, OwnValues(doc) );
+        if ( config->snapshotShared )
+            memcpy( config->snapshot, config->shared->value, sizeof(config->snapshot) );
+        OwnBorrowedValues( doc, config->snapshot );
+        config->snapshotShared = no;
+        config->shared = NULL;
+    }
+
+    if ( !shared )
+        return;
+
+    FreeValues( doc, config->own );
+    FreeValues( doc, config->snapshot );
+    config->shared = shared;
+    config->value = shared->value;
+    config->snapshotShared = yes;
+    config->defined_tags = shared->defined_tags;
+
+    TY_(FreeDeclaredTags)( doc, tagtype_null );
+    TY_(DeclareTagCopies)( doc, shared->tags, shared->tagcount, tagtype_null );
+    doc->tags.declaredCustom = no;
+
+    TY_(FreeAttrPriorityList)( doc );
+    for ( ixVal = 0; ixVal < shared->prioritycount; ++ixVal )
+        TY_(DefinePriorityAttribute)( doc, shared->priorities[ixVal] );
+    TY_(SetMutedMessages)( doc, shared->muted, shared->mutedcount );
+
+    for ( ixVal=0; ixVal < N_TIDY_OPTIONS; ++ixVal )
+    {
+        if ( changed[ixVal] )
+            PerformOptionChangedCallback( doc, option_defs + ixVal );
+    }
+}
+
 #ifdef _DEBUG
 
 /* Debug accessor functions will be type-safe and assert option type match */
@@ -1345,7 +1635,7 @@ Bool ParseList( TidyDocImpl* doc, const TidyOptionImpl* option )
     doc->pConfigChangeCallback = NULL;
     if ( callback )
     {
-        TidyOptionValue* oldval = &(doc->config.value[ option->id ]);
+        const TidyOptionValue* oldval = &(doc->config.value[ option->id ]);
         oldbuff = TY_(tmbstrdup)( doc->allocator, oldval->p );
     }
 
@@ -1407,7 +1697,7 @@ Bool ParseList( TidyDocImpl* doc, const TidyOptionImpl* option )
        the callback appropriately. */
     if ( callback )
     {
-        TidyOptionValue* val = &(doc->config.value[ option->id ]);
+        const TidyOptionValue* val = &(doc->config.value[ option->id ]);
         Bool fire_callback = OptionChangedValuesDiffer( val->p, oldbuff);
 
         doc->pConfigChangeCallback = callback;
@@ -1880,7 +2170,9 @@ static int  WriteOptionPick( const TidyOptionImpl* option, uint ival, StreamOut*
 
 Bool  TY_(ConfigDiffThanSnapshot)( TidyDocImpl* doc )
 {
-  int diff = memcmp( &doc->config.value, &doc->config.snapshot,
+  const TidyOptionValue* snap = doc->config.snapshotShared ?
+      doc->config.shared->value : doc->config.snapshot;
+  int diff = memcmp( doc->config.value, snap,
                      N_TIDY_OPTIONS * sizeof(uint) );
   return ( diff != 0 );
 }
@@ -1968,6 +2260,7 @@ int  TY_(SaveConfigFile)( TidyDocImpl* doc, ctmbstr cfgfil )
     {
         out = TY_(FileOutput)( doc, fout, outenc, nl );
         status = SaveConfigToStream( doc, out );
+        TY_(FlushStreamOut)( out );
         fclose( fout );
         TidyDocFree( doc, out );
     }
@@ -1981,6 +2274,7 @@ int  TY_(SaveConfigSink)( TidyDocImpl* doc, TidyOutputSink* sink )
     uint nl = cfg( doc, TidyNewline );
     StreamOut* out = TY_(UserOutput)( doc, sink, outenc, nl );
     int status = SaveConfigToStream( doc, out );
+    TY_(FlushStreamOut)( out );
     TidyDocFree( doc, out );
     return status;
 }
@@ -115,13 +115,38 @@ typedef union
 } TidyOptionValue;
 
 
+/** A configuration compiled by tidyOptCompileConfig(), for any number of
+ ** documents to read in place. Besides the option values, it keeps the
+ ** lists that the options declare, already resolved. It doesn't change
+ ** once built, so documents on different threads may share it.
+ */
+typedef struct _TidySharedConfig
+{
+    TidyAllocator*  allocator;                       /**< Owns everything below. */
+    TidyOptionValue value[ N_TIDY_OPTIONS + 1 ];     /**< Option values, already adjusted. */
+    uint            defined_tags;                    /**< As in TidyConfigImpl. */
+    Dict*           tags;                            /**< Copies of the declared tags. */
+    uint            tagcount;
+    tmbstr*         priorities;                      /**< The priority attributes. */
+    uint            prioritycount;
+    tidyStrings*    muted;                           /**< The muted message codes. */
+    uint            mutedcount;
+} TidySharedConfig;
+
+
 /** This type is used to define a structure for keeping track of the values
- ** for each option.
+ ** for each option. A document using a shared configuration reads its
+ ** values until one of them is changed; it then copies them to `own`, with
+ ** the strings still borrowed, and switches back when the snapshot is
+ ** restored.
  */
 typedef struct _tidy_config
 {
-    TidyOptionValue value[ N_TIDY_OPTIONS + 1 ];     /**< Current config values. */
+    const TidyOptionValue* value;                    /**< Current config values, `own` or the shared ones. */
+    TidyOptionValue own[ N_TIDY_OPTIONS + 1 ];       /**< The document's own values. */
     TidyOptionValue snapshot[ N_TIDY_OPTIONS + 1 ];  /**< Snapshot of values to be restored later. */
+    const TidySharedConfig* shared;                  /**< Shared configuration in use, or NULL. */
+    Bool  snapshotShared;                            /**< The snapshot is the shared values, not `snapshot`. */
     uint  defined_tags;                              /**< Tracks user-defined tags. */
     uint c;                                          /**< Current char in input stream for reading options. */
     StreamIn* cfgIn;                                 /**< Current input source for reading options.*/
@@ -261,6 +286,35 @@ void TY_(TakeConfigSnapshot)( TidyDocImpl* doc );
 void TY_(ResetConfigToSnapshot)( TidyDocImpl* doc );
 
 
+/** Compiles the document's configuration into a new shared configuration.
+ ** The document's options are adjusted first, as parsing would.
+ ** @param doc The Tidy document.
+ ** @returns The new configuration.
+ */
+TidySharedConfig* TY_(CompileConfig)( TidyDocImpl* doc );
+
+
+/** Frees a shared configuration. No document may be using it.
+ ** @param shared The configuration to free.
+ */
+void TY_(FreeSharedConfig)( TidySharedConfig* shared );
+
+
+/** Gives the document the options of a shared configuration, which it
+ ** then reads in place, or with NULL makes its current options its own.
+ ** @param doc The Tidy document.
+ ** @param shared The configuration to use, or NULL.
+ */
+void TY_(UseSharedConfig)( TidyDocImpl* doc, const TidySharedConfig* shared );
+
+
+/** Drops the tags declared while processing a document, keeping only
+ ** those declared by the tag options.
+ ** @param doc The Tidy document.
+ */
+void TY_(ResetDeclaredTags)( TidyDocImpl* doc );
+
+
 /** Copies the configuration from one document to another.
  ** @param docTo The destination Tidy document.
  ** @param docFrom The source Tidy document.
@@ -9,10 +9,11 @@
 
 */
 
-#include <stdio.h>
 #include "entities.h"
 #include "tidy-int.h"
 #include "tmbstr.h"
+#include "entitytrie.h"
+#include "entitycodes.h"
 
 struct _entity;
 typedef struct _entity entity;
@@ -2077,44 +2078,93 @@ static const entity entities[] =
     { NULL, VERS_UNKNOWN, 0 },
 };
 
-/* 
-** Pure static implementation.  Trades off lookup speed
-** for faster setup time (well, none actually).
-** Optimization of comparing 1st character buys enough
-** speed that hash doesn't improve things without > 500
-** items in list.
-** Issue #643 - Keep list fully alphabetic for more 
-** optimization, now that the list has grown to 2031
-** entries. Perhaps hashing setup should be now considered.
-**
+/*
+** Issue #643 - the list has grown to 2032 entries, so names are
+** matched through a trie generated from the table above (see
+** entitytrie.h). A state is a trie node index + 1, and 0 means no
+** name can match any more. Each character costs a binary search
+** among the children of one node, whatever the size of the table.
 */
-static const entity* entitiesLookup( ctmbstr s )
+uint TY_(EntityNext)( uint state, uint c )
 {
-    tmbchar ch = (tmbchar)( s ? *s : 0 );
-    const entity *np = entities;
-    if (ch == 0)
-        return NULL;
-    while (np->name)
+    const EntityTrieNode *np;
+    uint lo, hi, mid;
+
+    if ( state == 0 || state > ENTITY_TRIE_NODES )
+        return 0;
+
+    np = &entity_trie[ state - 1 ];
+    lo = np->child;
+    hi = lo + np->count;
+    while ( lo < hi )
     {
-        if (ch == *np->name)
-            break;  /* stop when first letter matches */
-        np++;
+        mid = (lo + hi) / 2;
+        if ( entity_trie[mid].ch == c )
+            return mid + 1;
+        if ( entity_trie[mid].ch < c )
+            lo = mid + 1;
+        else
+            hi = mid;
     }
-    while (np->name)
+    return 0;
+}
+
+Bool TY_(EntityStateInfo)( uint state, Bool isXml, uint* code, uint* versions )
+{
+    const entity* np;
+    assert( code != NULL );
+    assert( versions != NULL );
+
+    if ( state != 0 && state <= ENTITY_TRIE_NODES
+         && entity_trie[state - 1].entity != 0 )
     {
-        if (ch != *np->name)
-            break;  /* stop when first letter does not match */
-        if (TY_(tmbstrcmp)(s, np->name) == 0)
-            return np;
-        np++;
+        np = &entities[ entity_trie[state - 1].entity - 1 ];
+        *code = np->code;
+        *versions = np->versions;
+        return yes;
     }
-    return NULL;
+
+    *code = 0;
+    *versions = ( isXml ? VERS_XML : VERS_PROPRIETARY );
+    return no;
+}
+
+/*
+** Reads the digits of a numeric character reference, stopping at
+** the first character that isn't one, as sscanf() did here before.
+** Values that don't fit saturate to 0xFFFFFFFF, which is no character.
+*/
+Bool TY_(EntityNumber)( ctmbstr digits, Bool hex, uint* code )
+{
+    uint c = 0, d, base = hex ? 16 : 10;
+    Bool any = no, big = no;
+
+    for ( ;; ++digits )
+    {
+        d = (byte) *digits;
+        if ( d >= '0' && d <= '9' )
+            d -= '0';
+        else if ( hex && d >= 'a' && d <= 'f' )
+            d -= 'a' - 10;
+        else if ( hex && d >= 'A' && d <= 'F' )
+            d -= 'A' - 10;
+        else
+            break;
+
+        any = yes;
+        if ( c > (0xFFFFFFFFu - d) / base )
+            big = yes;
+        else
+            c = c * base + d;
+    }
+
+    *code = ( big ? 0xFFFFFFFFu : c );
+    return any;
 }
 
 Bool TY_(EntityInfo)( ctmbstr name, Bool isXml, uint* code, uint* versions )
 {
-    const entity* np;
-    int res;
+    uint state = ENTITY_START;
     assert( name && name[0] == '&' );
     assert( code != NULL );
     assert( versions != NULL );
@@ -2122,18 +2172,17 @@ Bool TY_(EntityInfo)( ctmbstr name, Bool isXml, uint* code, uint* versions )
     /* numeric entitity: name = "&#" followed by number */
     if ( name[1] == '#' )
     {
-        uint c = 0;  /* zero on missing/bad number */
+        Bool ok;
 
         /* 'x' prefix denotes hexadecimal number format */
         if ( name[2] == 'x' || (!isXml && name[2] == 'X') )
-            res = sscanf( name+3, "%x", &c );
+            ok = TY_(EntityNumber)( name+3, yes, code );
         else
-            res = sscanf( name+2, "%u", &c );
+            ok = TY_(EntityNumber)( name+2, no, code );
 
         /*  Issue #373 - Null Char in XML result doc - sf905 2009 */
-        if ( res == 1 )
+        if ( ok )
         {
-            *code = c;
             *versions = VERS_ALL;
             return yes;
         }
@@ -2146,16 +2195,10 @@ Bool TY_(EntityInfo)( ctmbstr name, Bool isXml, uint* code, uint* versions )
     }
 
     /* Named entity: name ="&" followed by a name */
-    if ( NULL != (np = entitiesLookup(name+1)) )
-    {
-        *code = np->code;
-        *versions = np->versions;
-        return yes;
-    }
+    for ( ++name; *name && state; ++name )
+        state = TY_(EntityNext)( state, (byte)*name );
 
-    *code = 0;
-    *versions = ( isXml ? VERS_XML : VERS_PROPRIETARY );
-    return no;
+    return TY_(EntityStateInfo)( state, isXml, code, versions );
 }
 
 /*
@@ -2168,21 +2211,29 @@ Bool TY_(EntityInfo)( ctmbstr name, Bool isXml, uint* code, uint* versions )
 */
 ctmbstr TY_(EntityName)( uint ch, uint versions )
 {
-    ctmbstr entnam = NULL;
     const entity *ep;
+    uint lo = 0, hi = ENTITY_CODES, mid, i;
 
-    for ( ep = entities; ep->name != NULL; ++ep )
+    /* the rows naming each code point are indexed in entitycodes.h */
+    while ( lo < hi )
     {
-        if ( ep->code == ch )
-        {
-            if (ep->versions & versions)
-            {
-                entnam = ep->name;
-                break; /* Issue #643 - Found code and version. Stop search? */
-            }
-        }
+        mid = (lo + hi) / 2;
+        if ( entity_code[mid] < ch )
+            lo = mid + 1;
+        else
+            hi = mid;
     }
-    return entnam;
+
+    if ( lo == ENTITY_CODES || entity_code[lo] != ch )
+        return NULL;
+
+    for ( i = entity_code_first[lo]; i < entity_code_first[lo + 1]; ++i )
+    {
+        ep = &entities[ entity_code_row[i] ];
+        if ( ep->versions & versions )
+            return ep->name; /* Issue #643 - Found code and version. Stop search? */
+    }
+    return NULL;
 }
 
 /*
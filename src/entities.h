@@ -15,4 +15,14 @@
 ctmbstr TY_(EntityName)( uint charCode, uint versions );
 Bool    TY_(EntityInfo)( ctmbstr name, Bool isXml, uint* code, uint* versions );
 
+/* Named entities can also be matched as they are read: start from
+   ENTITY_START, feed each character after the "&" to EntityNext()
+   and pass the final state to EntityStateInfo(). */
+#define ENTITY_START 1u
+uint    TY_(EntityNext)( uint state, uint c );
+Bool    TY_(EntityStateInfo)( uint state, Bool isXml, uint* code, uint* versions );
+
+/* digits of a numeric character reference; no if there are none */
+Bool    TY_(EntityNumber)( ctmbstr digits, Bool hex, uint* code );
+
 #endif /* __ENTITIES_H__ */
@@ -0,0 +1,444 @@
+#ifndef __ENTITYCODES_H__
+#define __ENTITYCODES_H__
+
+/* entitycodes.h -- index from code point to the entities table
+
+  THIS FILE IS MACHINE GENERATED by build/namehash/entitytrie.rb from
+  src/entities.c; do not edit it by hand. Regenerate it whenever a row
+  is added to, removed from or moved within the entities table.
+
+  (c) 2017 HTACG
+  See tidy.h for the copyright notice.
+*/
+
+#define ENTITY_CODES  1446u
+
+/* every code point that has a name, ascending */
+static const unsigned int entity_code[ENTITY_CODES] =
+{
+         9,     10,     33,     34,     35,     36,     37,     38,     39,     40,     41,     42,
+        43,     44,     46,     47,     58,     59,     60,     61,     62,     63,     64,     91,
+        92,     93,     94,     95,     96,    123,    124,    125,    160,    161,    162,    163,
+       164,    165,    166,    167,    168,    169,    170,    171,    172,    173,    174,    175,
+       176,    177,    178,    179,    180,    181,    182,    183,    184,    185,    186,    187,
+       188,    189,    190,    191,    192,    193,    194,    195,    196,    197,    198,    199,
+       200,    201,    202,    203,    204,    205,    206,    207,    208,    209,    210,    211,
+       212,    213,    214,    215,    216,    217,    218,    219,    220,    221,    222,    223,
+       224,    225,    226,    227,    228,    229,    230,    231,    232,    233,    234,    235,
+       236,    237,    238,    239,    240,    241,    242,    243,    244,    245,    246,    247,
+       248,    249,    250,    251,    252,    253,    254,    255,    256,    257,    258,    259,
+       260,    261,    262,    263,    264,    265,    266,    267,    268,    269,    270,    271,
+       272,    273,    274,    275,    278,    279,    280,    281,    282,    283,    284,    285,
+       286,    287,    288,    289,    290,    292,    293,    294,    295,    296,    297,    298,
+       299,    302,    303,    304,    305,    306,    307,    308,    309,    310,    311,    312,
+       313,    314,    315,    316,    317,    318,    319,    320,    321,    322,    323,    324,
+       325,    326,    327,    328,    329,    330,    331,    332,    333,    336,    337,    338,
+       339,    340,    341,    342,    343,    344,    345,    346,    347,    348,    349,    350,
+       351,    352,    353,    354,    355,    356,    357,    358,    359,    360,    361,    362,
+       363,    364,    365,    366,    367,    368,    369,    370,    371,    372,    373,    374,
+       375,    376,    377,    378,    379,    380,    381,    382,    402,    437,    501,    567,
+       710,    711,    728,    729,    730,    731,    732,    733,    785,    913,    914,    915,
+       916,    917,    918,    919,    920,    921,    922,    923,    924,    925,    926,    927,
+       928,    929,    931,    932,    933,    934,    935,    936,    937,    945,    946,    947,
+       948,    949,    950,    951,    952,    953,    954,    955,    956,    957,    958,    959,
+       960,    961,    962,    963,    964,    965,    966,    967,    968,    969,    977,    978,
+       981,    982,    988,    989,   1008,   1009,   1013,   1014,   1025,   1026,   1027,   1028,
+      1029,   1030,   1031,   1032,   1033,   1034,   1035,   1036,   1038,   1039,   1040,   1041,
+      1042,   1043,   1044,   1045,   1046,   1047,   1048,   1049,   1050,   1051,   1052,   1053,
+      1054,   1055,   1056,   1057,   1058,   1059,   1060,   1061,   1062,   1063,   1064,   1065,
+      1066,   1067,   1068,   1069,   1070,   1071,   1072,   1073,   1074,   1075,   1076,   1077,
+      1078,   1079,   1080,   1081,   1082,   1083,   1084,   1085,   1086,   1087,   1088,   1089,
+      1090,   1091,   1092,   1093,   1094,   1095,   1096,   1097,   1098,   1099,   1100,   1101,
+      1102,   1103,   1105,   1106,   1107,   1108,   1109,   1110,   1111,   1112,   1113,   1114,
+      1115,   1116,   1118,   1119,   8194,   8195,   8196,   8197,   8199,   8200,   8201,   8202,
+      8203,   8204,   8205,   8206,   8207,   8208,   8211,   8212,   8213,   8214,   8216,   8217,
+      8218,   8220,   8221,   8222,   8224,   8225,   8226,   8229,   8230,   8240,   8241,   8242,
+      8243,   8244,   8245,   8249,   8250,   8254,   8257,   8259,   8260,   8271,   8279,   8287,
+      8288,   8289,   8290,   8291,   8364,   8411,   8412,   8450,   8453,   8458,   8459,   8460,
+      8461,   8462,   8463,   8464,   8465,   8466,   8467,   8469,   8470,   8471,   8472,   8473,
+      8474,   8475,   8476,   8477,   8478,   8482,   8484,   8487,   8488,   8489,   8492,   8493,
+      8495,   8496,   8497,   8499,   8500,   8501,   8502,   8503,   8504,   8517,   8518,   8519,
+      8520,   8531,   8532,   8533,   8534,   8535,   8536,   8537,   8538,   8539,   8540,   8541,
+      8542,   8592,   8593,   8594,   8595,   8596,   8597,   8598,   8599,   8600,   8601,   8602,
+      8603,   8605,   8606,   8607,   8608,   8609,   8610,   8611,   8612,   8613,   8614,   8615,
+      8617,   8618,   8619,   8620,   8621,   8622,   8624,   8625,   8626,   8627,   8629,   8630,
+      8631,   8634,   8635,   8636,   8637,   8638,   8639,   8640,   8641,   8642,   8643,   8644,
+      8645,   8646,   8647,   8648,   8649,   8650,   8651,   8652,   8653,   8654,   8655,   8656,
+      8657,   8658,   8659,   8660,   8661,   8662,   8663,   8664,   8665,   8666,   8667,   8669,
+      8676,   8677,   8693,   8701,   8702,   8703,   8704,   8705,   8706,   8707,   8708,   8709,
+      8711,   8712,   8713,   8715,   8716,   8719,   8720,   8721,   8722,   8723,   8724,   8726,
+      8727,   8728,   8730,   8733,   8734,   8735,   8736,   8737,   8738,   8739,   8740,   8741,
+      8742,   8743,   8744,   8745,   8746,   8747,   8748,   8749,   8750,   8751,   8752,   8753,
+      8754,   8755,   8756,   8757,   8758,   8759,   8760,   8762,   8763,   8764,   8765,   8766,
+      8767,   8768,   8769,   8770,   8771,   8772,   8773,   8774,   8775,   8776,   8777,   8778,
+      8779,   8780,   8781,   8782,   8783,   8784,   8785,   8786,   8787,   8788,   8789,   8790,
+      8791,   8793,   8794,   8796,   8799,   8800,   8801,   8802,   8804,   8805,   8806,   8807,
+      8808,   8809,   8810,   8811,   8812,   8813,   8814,   8815,   8816,   8817,   8818,   8819,
+      8820,   8821,   8822,   8823,   8824,   8825,   8826,   8827,   8828,   8829,   8830,   8831,
+      8832,   8833,   8834,   8835,   8836,   8837,   8838,   8839,   8840,   8841,   8842,   8843,
+      8845,   8846,   8847,   8848,   8849,   8850,   8851,   8852,   8853,   8854,   8855,   8856,
+      8857,   8858,   8859,   8861,   8862,   8863,   8864,   8865,   8866,   8867,   8868,   8869,
+      8871,   8872,   8873,   8874,   8875,   8876,   8877,   8878,   8879,   8880,   8882,   8883,
+      8884,   8885,   8886,   8887,   8888,   8889,   8890,   8891,   8893,   8894,   8895,   8896,
+      8897,   8898,   8899,   8900,   8901,   8902,   8903,   8904,   8905,   8906,   8907,   8908,
+      8909,   8910,   8911,   8912,   8913,   8914,   8915,   8916,   8917,   8918,   8919,   8920,
+      8921,   8922,   8923,   8926,   8927,   8928,   8929,   8930,   8931,   8934,   8935,   8936,
+      8937,   8938,   8939,   8940,   8941,   8942,   8943,   8944,   8945,   8946,   8947,   8948,
+      8949,   8950,   8951,   8953,   8954,   8955,   8956,   8957,   8958,   8965,   8966,   8968,
+      8969,   8970,   8971,   8972,   8973,   8974,   8975,   8976,   8978,   8979,   8981,   8982,
+      8988,   8989,   8990,   8991,   8994,   8995,   9005,   9006,   9014,   9021,   9023,   9084,
+      9136,   9137,   9140,   9141,   9142,   9180,   9181,   9182,   9183,   9186,   9191,   9251,
+      9416,   9472,   9474,   9484,   9488,   9492,   9496,   9500,   9508,   9516,   9524,   9532,
+      9552,   9553,   9554,   9555,   9556,   9557,   9558,   9559,   9560,   9561,   9562,   9563,
+      9564,   9565,   9566,   9567,   9568,   9569,   9570,   9571,   9572,   9573,   9574,   9575,
+      9576,   9577,   9578,   9579,   9580,   9600,   9604,   9608,   9617,   9618,   9619,   9633,
+      9642,   9643,   9645,   9646,   9649,   9651,   9652,   9653,   9656,   9657,   9661,   9662,
+      9663,   9666,   9667,   9674,   9675,   9708,   9711,   9720,   9721,   9722,   9723,   9724,
+      9733,   9734,   9742,   9792,   9794,   9824,   9827,   9829,   9830,   9834,   9837,   9838,
+      9839,  10003,  10007,  10016,  10038,  10072,  10098,  10099,  10184,  10185,  10214,  10215,
+     10216,  10217,  10218,  10219,  10220,  10221,  10229,  10230,  10231,  10232,  10233,  10234,
+     10236,  10239,  10498,  10499,  10500,  10501,  10508,  10509,  10510,  10511,  10512,  10513,
+     10514,  10515,  10518,  10521,  10522,  10523,  10524,  10525,  10526,  10527,  10528,  10531,
+     10532,  10533,  10534,  10535,  10536,  10537,  10538,  10547,  10549,  10550,  10551,  10552,
+     10553,  10556,  10557,  10565,  10568,  10569,  10570,  10571,  10574,  10575,  10576,  10577,
+     10578,  10579,  10580,  10581,  10582,  10583,  10584,  10585,  10586,  10587,  10588,  10589,
+     10590,  10591,  10592,  10593,  10594,  10595,  10596,  10597,  10598,  10599,  10600,  10601,
+     10602,  10603,  10604,  10605,  10606,  10607,  10608,  10609,  10610,  10611,  10612,  10613,
+     10614,  10616,  10617,  10619,  10620,  10621,  10622,  10623,  10629,  10630,  10635,  10636,
+     10637,  10638,  10639,  10640,  10641,  10642,  10643,  10644,  10645,  10646,  10650,  10652,
+     10653,  10660,  10661,  10662,  10663,  10664,  10665,  10666,  10667,  10668,  10669,  10670,
+     10671,  10672,  10673,  10674,  10675,  10676,  10677,  10678,  10679,  10681,  10683,  10684,
+     10686,  10687,  10688,  10689,  10690,  10691,  10692,  10693,  10697,  10701,  10702,  10703,
+     10704,  10716,  10717,  10718,  10723,  10724,  10725,  10731,  10740,  10742,  10752,  10753,
+     10754,  10756,  10758,  10764,  10765,  10768,  10769,  10770,  10771,  10772,  10773,  10774,
+     10775,  10786,  10787,  10788,  10789,  10790,  10791,  10793,  10794,  10797,  10798,  10799,
+     10800,  10801,  10803,  10804,  10805,  10806,  10807,  10808,  10809,  10810,  10811,  10812,
+     10815,  10816,  10818,  10819,  10820,  10821,  10822,  10823,  10824,  10825,  10826,  10827,
+     10828,  10829,  10832,  10835,  10836,  10837,  10838,  10839,  10840,  10842,  10843,  10844,
+     10845,  10847,  10854,  10858,  10861,  10862,  10863,  10864,  10865,  10866,  10867,  10868,
+     10869,  10871,  10872,  10873,  10874,  10875,  10876,  10877,  10878,  10879,  10880,  10881,
+     10882,  10883,  10884,  10885,  10886,  10887,  10888,  10889,  10890,  10891,  10892,  10893,
+     10894,  10895,  10896,  10897,  10898,  10899,  10900,  10901,  10902,  10903,  10904,  10905,
+     10906,  10909,  10910,  10911,  10912,  10913,  10914,  10916,  10917,  10918,  10919,  10920,
+     10921,  10922,  10923,  10924,  10925,  10926,  10927,  10928,  10931,  10932,  10933,  10934,
+     10935,  10936,  10937,  10938,  10939,  10940,  10941,  10942,  10943,  10944,  10945,  10946,
+     10947,  10948,  10949,  10950,  10951,  10952,  10955,  10956,  10959,  10960,  10961,  10962,
+     10963,  10964,  10965,  10966,  10967,  10968,  10969,  10970,  10971,  10980,  10982,  10983,
+     10984,  10985,  10987,  10988,  10989,  10990,  10991,  10992,  10993,  10994,  10995,  11005,
+     64256,  64257,  64258,  64259,  64260, 119964, 119966, 119967, 119970, 119973, 119974, 119977,
+    119978, 119979, 119980, 119982, 119983, 119984, 119985, 119986, 119987, 119988, 119989, 119990,
+    119991, 119992, 119993, 119995, 119997, 119998, 119999, 120000, 120001, 120002, 120003, 120005,
+    120006, 120007, 120008, 120009, 120010, 120011, 120012, 120013, 120014, 120015, 120068, 120069,
+    120071, 120072, 120073, 120074, 120077, 120078, 120079, 120080, 120081, 120082, 120083, 120084,
+    120086, 120087, 120088, 120089, 120090, 120091, 120092, 120094, 120095, 120096, 120097, 120098,
+    120099, 120100, 120101, 120102, 120103, 120104, 120105, 120106, 120107, 120108, 120109, 120110,
+    120111, 120112, 120113, 120114, 120115, 120116, 120117, 120118, 120119, 120120, 120121, 120123,
+    120124, 120125, 120126, 120128, 120129, 120130, 120131, 120132, 120134, 120138, 120139, 120140,
+    120141, 120142, 120143, 120144, 120146, 120147, 120148, 120149, 120150, 120151, 120152, 120153,
+    120154, 120155, 120156, 120157, 120158, 120159, 120160, 120161, 120162, 120163, 120164, 120165,
+    120166, 120167, 120168, 120169, 120170, 120171
+};
+
+/* entity_code_row[entity_code_first[i] .. entity_code_first[i+1]-1]
+   are the rows for entity_code[i] */
+static const unsigned short entity_code_first[ENTITY_CODES + 1] =
+{
+       0,    1,    2,    3,    5,    6,    7,    8,   10,   11,   12,   13,
+      15,   16,   17,   18,   19,   20,   21,   23,   24,   26,   27,   28,
+      30,   31,   33,   34,   36,   38,   40,   43,   45,   47,   48,   49,
+      50,   51,   52,   53,   54,   58,   60,   61,   62,   63,   64,   67,
+      69,   70,   73,   74,   75,   77,   78,   79,   82,   84,   85,   86,
+      87,   88,   90,   91,   92,   93,   94,   95,   96,   97,   99,  100,
+     101,  102,  103,  104,  105,  106,  107,  108,  109,  110,  111,  112,
+     113,  114,  115,  116,  117,  118,  119,  120,  121,  122,  123,  124,
+     125,  126,  127,  128,  129,  130,  131,  132,  133,  134,  135,  136,
+     137,  138,  139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+     150,  151,  152,  153,  154,  155,  156,  157,  158,  159,  160,  161,
+     162,  163,  164,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+     174,  175,  176,  177,  178,  179,  180,  181,  182,  183,  184,  185,
+     186,  187,  188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+     198,  199,  200,  201,  202,  204,  205,  206,  207,  208,  209,  210,
+     211,  212,  213,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+     223,  224,  225,  226,  227,  228,  229,  230,  231,  232,  233,  234,
+     235,  236,  237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+     247,  248,  249,  250,  251,  252,  253,  254,  255,  256,  257,  258,
+     259,  260,  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+     271,  272,  273,  274,  275,  276,  277,  278,  279,  280,  281,  282,
+     283,  284,  286,  288,  290,  291,  292,  294,  296,  297,  298,  299,
+     300,  301,  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+     312,  313,  314,  315,  316,  317,  318,  319,  320,  322,  323,  324,
+     325,  326,  328,  329,  330,  331,  332,  333,  334,  335,  336,  337,
+     338,  339,  340,  343,  344,  345,  347,  348,  349,  350,  351,  354,
+     356,  359,  361,  362,  364,  366,  368,  371,  373,  374,  375,  376,
+     377,  378,  379,  380,  381,  382,  383,  384,  385,  386,  387,  388,
+     389,  390,  391,  392,  393,  394,  395,  396,  397,  398,  399,  400,
+     401,  402,  403,  404,  405,  406,  407,  408,  409,  410,  411,  412,
+     413,  414,  415,  416,  417,  418,  419,  420,  421,  422,  423,  424,
+     425,  426,  427,  428,  429,  430,  431,  432,  433,  434,  435,  436,
+     437,  438,  439,  440,  441,  442,  443,  444,  445,  446,  447,  448,
+     449,  450,  451,  452,  453,  454,  455,  456,  457,  458,  459,  460,
+     461,  462,  463,  464,  465,  466,  467,  468,  469,  470,  471,  473,
+     475,  480,  481,  482,  483,  484,  486,  487,  488,  489,  491,  493,
+     496,  498,  500,  503,  505,  506,  508,  510,  511,  513,  514,  515,
+     516,  517,  518,  520,  521,  522,  524,  525,  526,  527,  528,  529,
+     530,  531,  533,  535,  537,  538,  540,  541,  543,  544,  545,  548,
+     550,  552,  553,  557,  559,  563,  566,  567,  569,  570,  571,  573,
+     575,  577,  579,  583,  585,  586,  588,  590,  591,  593,  594,  597,
+     599,  600,  602,  604,  607,  610,  612,  613,  614,  615,  617,  619,
+     622,  624,  625,  626,  627,  628,  629,  630,  631,  632,  633,  634,
+     635,  636,  641,  645,  650,  654,  657,  660,  663,  666,  669,  672,
+     674,  676,  678,  680,  681,  683,  684,  686,  688,  690,  692,  695,
+     697,  699,  701,  703,  705,  707,  709,  711,  713,  714,  715,  716,
+     718,  720,  722,  724,  727,  730,  733,  736,  739,  742,  745,  748,
+     751,  753,  756,  758,  760,  762,  764,  767,  770,  772,  774,  776,
+     779,  782,  786,  789,  793,  796,  797,  798,  799,  800,  802,  804,
+     805,  807,  809,  811,  812,  813,  814,  816,  818,  820,  822,  825,
+     829,  831,  835,  838,  842,  845,  847,  849,  851,  852,  855,  857,
+     862,  863,  865,  867,  872,  873,  874,  876,  878,  879,  883,  887,
+     892,  897,  899,  901,  902,  903,  905,  906,  908,  911,  913,  914,
+     915,  917,  919,  922,  925,  926,  928,  930,  931,  932,  936,  938,
+     940,  941,  944,  946,  949,  952,  955,  957,  958,  960,  966,  969,
+     971,  972,  974,  976,  979,  982,  985,  987,  989,  991,  994,  996,
+     998, 1000, 1001, 1002, 1004, 1006, 1008, 1010, 1012, 1014, 1017, 1020,
+    1023, 1025, 1027, 1030, 1033, 1035, 1036, 1039, 1042, 1045, 1048, 1051,
+    1054, 1056, 1058, 1061, 1064, 1066, 1068, 1071, 1074, 1077, 1080, 1083,
+    1086, 1089, 1092, 1094, 1097, 1098, 1099, 1102, 1105, 1108, 1111, 1113,
+    1115, 1116, 1118, 1121, 1124, 1127, 1130, 1132, 1134, 1136, 1138, 1140,
+    1141, 1143, 1145, 1147, 1149, 1151, 1153, 1155, 1157, 1159, 1161, 1163,
+    1167, 1168, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1181,
+    1184, 1187, 1190, 1191, 1192, 1194, 1195, 1197, 1198, 1199, 1200, 1201,
+    1204, 1207, 1210, 1213, 1216, 1217, 1219, 1221, 1222, 1223, 1224, 1226,
+    1228, 1230, 1232, 1234, 1236, 1238, 1239, 1240, 1242, 1243, 1245, 1247,
+    1248, 1250, 1253, 1256, 1258, 1260, 1262, 1264, 1266, 1268, 1269, 1270,
+    1272, 1274, 1277, 1280, 1283, 1286, 1287, 1288, 1289, 1290, 1291, 1292,
+    1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1304, 1306,
+    1308, 1310, 1312, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322,
+    1323, 1325, 1327, 1329, 1331, 1333, 1335, 1336, 1337, 1338, 1339, 1340,
+    1341, 1343, 1345, 1347, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356,
+    1357, 1359, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
+    1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382,
+    1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+    1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406,
+    1409, 1413, 1414, 1415, 1416, 1417, 1419, 1421, 1423, 1425, 1427, 1429,
+    1431, 1433, 1435, 1437, 1439, 1440, 1441, 1443, 1444, 1445, 1446, 1447,
+    1448, 1450, 1451, 1452, 1453, 1454, 1456, 1458, 1460, 1462, 1463, 1464,
+    1466, 1467, 1469, 1470, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1480,
+    1482, 1485, 1488, 1489, 1490, 1491, 1492, 1495, 1498, 1501, 1504, 1507,
+    1510, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1520, 1521, 1523, 1525,
+    1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537,
+    1538, 1539, 1541, 1543, 1544, 1546, 1548, 1549, 1550, 1551, 1552, 1553,
+    1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565,
+    1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577,
+    1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589,
+    1590, 1591, 1592, 1593, 1594, 1596, 1598, 1599, 1600, 1601, 1602, 1603,
+    1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+    1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627,
+    1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639,
+    1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651,
+    1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+    1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1673, 1674, 1675, 1677,
+    1679, 1681, 1683, 1685, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694,
+    1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706,
+    1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718,
+    1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731,
+    1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+    1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755,
+    1756, 1757, 1759, 1760, 1761, 1762, 1763, 1764, 1767, 1770, 1771, 1772,
+    1773, 1774, 1775, 1776, 1778, 1780, 1782, 1784, 1786, 1788, 1790, 1792,
+    1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1802, 1804, 1805, 1806,
+    1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818,
+    1819, 1820, 1821, 1822, 1823, 1824, 1825, 1828, 1831, 1832, 1833, 1835,
+    1837, 1839, 1841, 1843, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852,
+    1853, 1854, 1855, 1857, 1859, 1860, 1861, 1863, 1865, 1866, 1867, 1868,
+    1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1880, 1881,
+    1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
+    1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905,
+    1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917,
+    1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+    1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941,
+    1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953,
+    1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965,
+    1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+    1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989,
+    1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001,
+    2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+    2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
+    2026, 2027, 2028, 2029, 2030, 2031, 2032
+};
+
+/* entities indices, in table order for each code point */
+static const unsigned short entity_code_row[2032] =
+{
+     479,  304,  964,  387, 1587, 1445,  878, 1519,    1,  594,  625, 1271,
+    1671,  630, 1322, 1535,  795, 1520, 1749,  792, 1713,  226, 1289,  950,
+     153, 1046, 1585,  796, 1186, 1285,  741, 1619, 1678,  175,  507, 1267,
+      81, 1041, 1185, 1193,  541, 1964, 1965, 1618, 1626,  307, 1353, 1092,
+     768, 1548,  834, 2012,  736, 1712,   86,   90,  868, 1916,   32,  806,
+    1498, 1170, 1398, 1725,  392,  781, 1638, 1304, 1779,  857,  373, 1542,
+    1545, 1810, 1811,   78,  583, 1320, 1513,   43,  769, 1324,   42,  766,
+    1809, 1499, 1600,  987,  985, 1061,  993, 1125,    7,    2,    4,   17,
+      18,   14,  616,    0,   38,  127,  121,  123,  141,  193,  188,  189,
+     209,  120,  343,  351,  346,  347,  361,  363, 1859,  360,  505,  496,
+     501,  531,  561,  475, 1837,  588,  578,  582,  633,  634,  628,  585,
+     761,  920,  908,  912,  962, 1095, 1087, 1089, 1136,  961, 1438, 1474,
+    1460, 1463, 1507, 1510,  871,  872, 1505, 1907, 1896, 1900, 1939, 2008,
+    1857, 2018,    9,  592,    3,  579,   11,  618,   33,  750,   39,  762,
+      41,  765,   37,  760,   73,  851,  118,  897,  129,  928,  125,  915,
+     132,  937,  122,  910,  158, 1010,  156, 1009,  160, 1012,  157,  176,
+    1068,  182, 1084,  207, 1134,  195, 1102,  203, 1121,  191, 1106, 1113,
+     186, 1101,  210, 1137,  220, 1147, 1150,  227, 1162,  233, 1191,  232,
+    1190,  270, 1243,  282, 1288,  294, 1346,  296, 1356,  295, 1355, 1348,
+     119,  935,  352, 1484,  349, 1466,  345, 1470,  393, 1593,  398, 1624,
+     397, 1623,  438, 1689,  442, 1698,  441, 1697,  440, 1694,  482, 1842,
+     481, 1841,  495, 1890,  530, 1935,  506, 1915,  500, 1899,  528, 1931,
+     503, 1903,  513, 1917,  549, 1973,  562, 2010,  567,  569, 2019,  572,
+    2022,  570, 2020,  979, 1108, 1005, 1140,  777,  174,  758,   28,  735,
+      79,  880, 1656, 1473,   82, 1858,   80,  850,  106,    8,   25,  154,
+      76,  134,  574,  140,  486,  205,  219,  228,  292,  344,  555,  354,
+     372,  405,  449,  480,  527,  371,   45,  386,  353, 1477,  591,  656,
+    1006,  858,  942,  943, 2024,  960, 1849, 1123, 1145, 1165, 1337, 1444,
+    1991, 1486, 1529, 1645, 1727, 1728, 1954, 1726, 1839, 1924, 1926, 1525,
+     774, 1576, 1485, 1850, 1851, 1955,  526, 1925, 1526, 1778, 1949, 1531,
+    1950,  155,  869, 1007, 1146, 1947, 1646, 1953,  944, 1777, 1946,  639,
+     654,  187,   67,  152,  216,   68,  208,  559,  215,  225,  293,  477,
+     218,  499,   69,    5,   22,  534,  159,   74,  185,  568,  571,  190,
+     211,  221,  234,  285,  297,  348,  369,  399,  443,  483,  502,  144,
+     217,  478,   31,  436,  435,  173,  563,  437,  124,  560,  558,  584,
+     649, 1958, 1011,  852, 1091, 2026, 2021, 1090, 1138, 1148, 1194, 1315,
+    1359, 1464, 1518, 1627, 1704, 1843, 1901,  969, 1151, 1888,  771, 1722,
+    1721, 1063, 2011, 1748,  914, 2017, 2009, 1120,  875, 1028, 1144,  895,
+    1135, 2014, 1143, 1237, 1383, 1889, 1152, 1898,  904,  936,  932,  933,
+     934, 1447, 1577,  487, 1854,  544, 1060,  298,  299,  300,  301,  573,
+    2031, 2030, 1277, 1660,  847, 1086, 1360, 1316, 1081,  538,  539,  357,
+    1286,   52, 1679, 1680, 1287, 1690,  356, 1196,   51, 1630, 1631,  650,
+    1197,  844,   70,  854,  744,  745, 1386, 1071, 1330, 1521, 1523, 1562,
+     381, 1871,  640,  734, 1279, 1675,  364, 1482,  757, 1085, 1000,  738,
+    1581,  286,  306,   13,  586,  202, 1133,  201, 1088,  963,  493, 1844,
+      87,   58,  800, 1110, 1042,  178,  181, 1062,  177,  374,  179, 1583,
+    1533, 1067, 1083, 1532, 1534,  206, 1104,  192,  194, 1103, 1105,  230,
+     280, 1164,  925,  308, 1352, 1446,  807, 1977, 1980,  375, 1563,  389,
+    1615,  432, 1634,  400,  404, 1633, 1635,  429, 1636, 1688,  476, 1872,
+     576, 1116, 1319,  575, 2023, 1100,   24,   29,  655,   36,   44,  957,
+     138,  966,  150,  151,  287,  291, 1527, 1496, 1497, 1504,  589,  590,
+     657, 1027,  845,   35,   65,   84,  853,  143,  916,  967,  196, 1096,
+     986,  991,  988,  992,  994,  996,  989,  997,  990,  995,  998,  999,
+     236,  446, 1171, 1202, 1740,  448,  515, 1897, 1919,  407,  447, 1601,
+    1647, 1770,  103,  445,  846,  887,  245, 1064, 1207,  518, 1920, 1952,
+     524, 1456, 1457,  525, 1364, 1365,  279, 1710, 1711,  278, 1834, 1835,
+    1385, 1388, 1414, 1415, 1612, 1654,  231, 1892,  497,  395, 1893,   71,
+    1179, 1203, 1611, 1648,  248, 1311,  521, 1312,  417, 1308, 1309,  115,
+    1310, 1078, 1175, 1079, 1607, 1176, 1260, 1261, 1608, 1066, 1210, 1377,
+    1389,  281, 1281,  433, 1677, 1200, 1632,  808,  820,  835,  828,  836,
+     779, 1479,  780, 1494,  257, 1205, 1234,  109, 1204, 1233,  424, 1909,
+    1922,  255, 1908, 1921,  426, 1643, 1650,  112, 1642, 1649,  413,  863,
+     890,  242,  862,  889,  409, 1651, 1658,  517, 1902,  238, 1208, 1273,
+    1206, 1239, 1927, 1938, 1653, 1674,  855,  888,  402, 1209, 1275,  137,
+    1652, 1659, 1340, 1384, 1341, 1376, 1342, 1413,   92,  259, 1156,  100,
+     522, 1894,   98,  197,  428, 1589,   91,  116,  842,   93,  260, 1059,
+    1093,  101,  523, 1941, 1454, 1362, 1708, 1832,  269, 1155,  431, 1588,
+    2027,  237, 1172,  408, 1603,  105,  901, 1254, 1665, 1076,  149,  981,
+     797,  799,  368, 1517,  142,  965,  315, 1368, 1369,  929,  930,  931,
+    1948,   75, 1345,  128, 1109, 1127, 1132,  313, 1399, 1400,  401,  469,
+    1379, 1382,  328, 1403, 1404,  382, 1567,   59,  805,  470, 1806, 1325,
+     289, 1331, 1334,  884, 1539,   19, 1715, 1716, 1741, 1772, 1266,  450,
+     798,  452, 1594,  384, 1571, 1572, 1951, 1969, 1111,  612,  600,  602,
+     603, 1317,  615,  540, 1321, 1723, 1744,  341, 1396, 1421, 1426,  102,
+    1512, 1514, 1724, 1755,  312, 1407, 1408, 1422, 1427,  595, 1975, 1493,
+    1960,  751,  822,  199, 1114,  198, 1098, 1863,   57,  803, 1478,   56,
+      89,   40,  840,   50,  839,   60,  635,  485, 1847, 1848,   23,  651,
+     652, 1614,   53,  383,  883, 1327, 1303, 1077,  488, 1729, 1853, 1856,
+     641,  739,  580, 1336,  581,  543, 1981, 1982,  337, 1423,  136,  947,
+     959,  489, 1731, 1732,  338, 1424, 1425,  490,  801, 1737,  339, 1357,
+     491,  620,  626,  631, 1852, 1855,  340, 1347, 1349,  623,  627,  624,
+     638,  648,   64,  632,   30,  183,  746,  184,  748,  749,   88,  881,
+     958,  882,  907,  917,  968,  955, 1657,   16,  793,  794,  913,  946,
+     911,  945,  778,  786, 1976, 1962, 1877, 1881,  951, 1586,  314, 1361,
+      55,  952,  310, 1366, 1201, 1213,  164, 1013, 1015,  262, 1159, 1214,
+     166, 1003, 1016, 1246, 1251, 1033, 1038,  283,  303, 1238,  172,  302,
+    1025,  658, 1891,  311,  322, 1391, 1393,  316, 1374, 1375,  323, 1387,
+    1390,  317, 1371, 1372,  266, 1227, 1282,  170, 1043, 1058,  325, 1392,
+     319, 1373,  263, 1226, 1231,  168, 1029, 1057,  324, 1439,  318, 1437,
+     377, 1549, 1554,  465, 1691, 1798,  379, 1552, 1556,  467, 1695, 1800,
+     380, 1561, 1573,  468, 1703, 1805,  326, 1410, 1412,  334, 1418, 1433,
+    1780, 1790,  472, 1808, 1824, 1430, 1434,  464, 1783, 1791,  473, 1815,
+    1825,  333, 1431, 1432,  336, 1435, 1436, 1787, 1793, 1822, 1827,  826,
+     512, 1923,  455, 1758, 1760,  457, 1762, 1764,  456, 1759, 1761,  458,
+    1763, 1765,  454, 1756,  459, 1757,   48, 1492,   47, 1488,   49, 1508,
+    1506,   46, 1468,  784, 1462,  783, 1461,  785, 1465,  721, 1537,  720,
+    1326,  722, 1860,  885, 1706,  416, 1959,  247,  848,  114, 1865,  520,
+     687,  688, 1522, 1332,   99, 1944,  535,  548,  532, 1450, 1448, 1344,
+    1343, 1574,  250, 1956, 1967,  419, 1957, 1970,  252, 1299, 1876,  421,
+    1684, 1879, 1500, 1107, 1338, 1339, 1072, 1115, 1117, 1961,  643,  613,
+    1278,  550,  672, 2007,  537,  671, 2006,  200,  660, 1984,  511,  662,
+    1986,   83,  864,  865, 1705,  461, 1774,  873,  874,  689, 1294, 1682,
+    1211, 1293, 1655, 1681,  642,  740,  832,  837,  833,  838,  462,  463,
+     471,  474,   34,   63,  982, 1530,  939, 1223, 1292, 1049, 1054,  268,
+     162, 1026,  261, 1212, 1224,  165, 1014, 1055,  818,  830,  819,  831,
+     327, 1411,  335, 1419,  331, 1428,  332, 1429, 1252, 1039, 1560, 1566,
+    1701, 1804,  320, 1394, 1440,  329, 1416, 1442,  321, 1395, 1441,  330,
+    1417, 1443, 1963,  815, 1934,  898,  870, 1131, 1130, 1129, 1402, 1401,
+    1128, 1381, 1995, 1380, 1406, 1405,  644,  645,   21,  886,  239, 1192,
+     410, 1625,  244, 1229,  415, 1640,  893,  877, 1930, 1913,  685, 1569,
+    1570, 1845, 1838, 1911, 1912, 1928, 1929,  876, 1240,  892, 1274, 1001,
+    1719, 1745, 1773,  841, 1568, 1866, 1511, 1751,  617, 1244, 1245, 1661,
+    1662,  366, 1840,  509,  646,  647,  367,  510,  365,  508, 1886,  924,
+     680,  782, 1459,  180,  715,  727,  714,  713,  726,  725,  733,  732,
+     718,  719,  731,  694,  703,  712,  693,  691,  711,  692,  690,  724,
+     702,  700,  723,  701,  699,  730,  709,  706,  729,  708,  705,  697,
+     716,  695,  698,  717,  696,  728,  707,  704, 1910, 1236,  684,  682,
+     681,  683,  453, 1766, 1767,  147,  675, 1768, 1769,  131, 1637, 1313,
+     978,  669, 2005,  676, 1937, 1873, 1936,  679, 1685, 1683, 1878,  668,
+    1987,  677,  900,  899, 1874,  678, 1300, 1298, 1875, 1268, 1269,  775,
+    1880,  661, 1985, 1914, 1932, 1242,  130,  146,  667, 1776, 1775, 1528,
+     970, 1305, 1753, 1754,  790,  791, 1069, 1070,  866,  867, 1807,  976,
+    1350, 1351, 1720,  772,  773,  809, 1306, 1307, 1717,  542, 1184, 1617,
+     743, 1817,  240, 1255,  411, 1666,  235, 1166, 1168,  406, 1596, 1599,
+     229,  394, 1253, 1664,  271, 1256, 1993,  273, 1259, 2001,  272, 1257,
+    1990,   95,  274, 1992,   97,  276, 2000,   96,  275, 1989, 1258, 1994,
+     905, 1452, 1453, 1449,  284, 1183,  673, 1616, 1158,  849, 1591,  391,
+     891,   66,  516,  104,  396, 1181, 1613, 1157, 1590, 1174, 1606, 1173,
+    1604, 1455, 1363, 1074, 1709, 1075, 1833, 1458, 1367, 1864, 1714, 1870,
+    1836, 1605,  817, 1195, 1628,  816, 1177,  829,  821, 1609, 1065,  498,
+    1301, 1199,  246,  422,  107,  253,  258,  427,  425,  414,  110,  113,
+     256,  243,  249,  418,  423,  412,  108,  111,  254,  241, 1161, 1895,
+    1592,  843, 1302, 1198, 1687, 1629, 1235, 1241, 1644, 1276,  519, 1904,
+     403,  902,  430,  956, 1739, 1178, 1610, 1602, 1295, 1053, 1789, 1819,
+    1228, 1639, 1905,  860, 1262, 1667, 1187, 1620, 1189, 1621, 1188, 1622,
+    1167, 1597, 1272, 1672, 1050, 1297, 1972, 1945,  614,  601, 1598,  903,
+    1940,  604,  605,  606,  607,  608,  609,  610,  611,  653,  859,  767,
+    1595, 1163, 1476, 1487, 1490, 1491, 1481, 1469, 1480, 1471, 1483, 1475,
+     789,  776, 1750,  742,  710, 1884, 1686,  251,  420, 1099, 1112, 1451,
+     940, 1743,  954,  674, 1270,  434,  896,  663, 1996,  664, 1998,  665,
+    1999,  670, 2004,  666, 2003, 1097, 1579,  984,  787,  636, 1673, 1702,
+    1409, 1546, 1584, 1118, 1538, 1536, 1738, 1540, 1543, 1544, 1314, 1328,
+    1264, 1669,   61, 1862, 1861, 1742, 1265, 1670, 1509,  362, 1467, 1883,
+    1882, 1885, 1119, 1124,  593,  756, 1358, 1354,  752,  827,  824,  755,
+     823,  753,  825,  754,  763,  759,  764,   10,  358,  596, 1501, 1502,
+     598,  599, 1503,  597, 1495, 1974, 1707, 1730,  802,  909,  622,  621,
+     941, 1541,  139,   54,  135,  856,  906,  953, 1291, 1048, 1296, 1051,
+     265, 1215, 1216,  169, 1017, 1018, 1218, 1020, 1219, 1021, 1220, 1022,
+    1169, 1222, 1008, 1052, 1249, 1250, 1036, 1037, 1247, 1248, 1034, 1035,
+    1160, 1225, 1004, 1056, 1283, 1044, 1284, 1045, 1232, 1030, 1221, 1023,
+     926,  949,  921,  948,  927,  922,  923,  919, 1735, 1733, 1736, 1734,
+     264,  167, 1032, 1031, 1290, 1047, 1217, 1019, 1746, 1180, 1747, 1182,
+     747,  378, 1553, 1557,  466, 1696, 1801, 1550, 1692, 1559, 1564, 1699,
+    1803, 1551, 1555, 1693, 1799, 1558, 1565, 1700, 1802,  376,  439, 1782,
+    1813, 1788, 1823, 1785, 1820, 1784, 1816, 1781, 1792, 1812, 1826, 1795,
+    1829, 1786, 1794, 1821, 1828,  811,  813,  812,  814, 1797, 1830, 1796,
+    1831, 1818, 1814,  983, 1869, 1329,   72,   94,  536,   20, 1942, 1943,
+     533,  309,  637, 1663,  788, 1323, 1867, 1378, 1515, 1516,  972,  975,
+     977,  971,  973,   15,   62,  117,  171,  214,  224,  342,  359,  385,
+     390,  460,  494,  529,  547,  553,  557,  566,  577,  629,  737,  810,
+     894, 1002, 1082, 1126, 1142, 1154, 1280, 1335, 1420, 1575, 1582, 1676,
+    1771, 1887, 1933, 1971, 1983, 2002, 2016, 2029,    6,   26,   77,  126,
+     145,  161,  212,  222,  267,  288,  305,  350,  370,  388,  444,  484,
+     504,  545,  551,  554,  564,  587,  659,  770,  861,  918,  974, 1024,
+    1073, 1094, 1139, 1149, 1230, 1318, 1370, 1472, 1524, 1578, 1641, 1718,
+    1846, 1906, 1966, 1978, 1988, 2013, 2025,   12,   27,   85,  133,  148,
+     163,  204,  213,  223,  277,  290,  355,  451,  492,  514,  546,  552,
+     556,  565,  619,  686,  804,  879,  938,  980, 1040, 1080, 1122, 1141,
+    1153, 1263, 1333, 1397, 1489, 1547, 1580, 1668, 1752, 1868, 1918, 1968,
+    1979, 1997, 2015, 2028
+};
+
+#endif /* __ENTITYCODES_H__ */
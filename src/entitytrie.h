@@ -0,0 +1,1896 @@
+#ifndef __ENTITYTRIE_H__
+#define __ENTITYTRIE_H__
+
+/* entitytrie.h -- trie over the names in the entities table
+
+  THIS FILE IS MACHINE GENERATED by build/namehash/entitytrie.rb from
+  src/entities.c; do not edit it by hand. Regenerate it whenever a row
+  is added to, removed from or moved within the entities table.
+
+  (c) 2017 HTACG
+  See tidy.h for the copyright notice.
+*/
+
+typedef struct _EntityTrieNode
+{
+    unsigned char  ch;      /* character leading to this node */
+    unsigned char  count;   /* number of children */
+    unsigned short child;   /* index of the first child */
+    unsigned short entity;  /* entities index + 1, 0 if no name ends here */
+} EntityTrieNode;
+
+#define ENTITY_TRIE_NODES  7469u
+
+static const EntityTrieNode entity_trie[ENTITY_TRIE_NODES] =
+{
+    {   0, 52,    1,    0 }, { 'A', 16,   53,    0 }, { 'B',  8,   69,    0 }, { 'C', 14,   77,    0 },
+    { 'D', 11,   91,    0 }, { 'E', 16,  102,    0 }, { 'F',  5,  118,    0 }, { 'G', 12,  123,    0 },
+    { 'H',  8,  135,    0 }, { 'I', 14,  143,    0 }, { 'J',  5,  157,    0 }, { 'K',  7,  162,    0 },
+    { 'L', 11,  169,    0 }, { 'M',  8,  180,    0 }, { 'N',  9,  188,    0 }, { 'O', 14,  197,    0 },
+    { 'P',  9,  211,    0 }, { 'Q',  4,  220,    0 }, { 'R', 12,  224,    0 }, { 'S', 13,  236,    0 },
+    { 'T', 11,  249,    0 }, { 'U', 14,  260,    0 }, { 'V',  9,  274,    0 }, { 'W',  5,  283,    0 },
+    { 'X',  4,  288,    0 }, { 'Y',  9,  292,    0 }, { 'Z',  8,  301,    0 }, { 'a', 16,  309,    0 },
+    { 'b', 16,  325,    0 }, { 'c', 15,  341,    0 }, { 'd', 19,  356,    0 }, { 'e', 18,  375,    0 },
+    { 'f', 11,  393,    0 }, { 'g', 16,  404,    0 }, { 'h', 10,  420,    0 }, { 'i', 15,  430,    0 },
+    { 'j',  6,  445,    0 }, { 'k',  8,  451,    0 }, { 'l', 22,  459,    0 }, { 'm', 14,  481,    0 },
+    { 'n', 23,  495,    0 }, { 'o', 18,  518,    0 }, { 'p', 12,  536,    0 }, { 'q',  6,  548,    0 },
+    { 'r', 21,  554,    0 }, { 's', 19,  575,    0 }, { 't', 13,  594,    0 }, { 'u', 18,  607,    0 },
+    { 'v', 14,  625,    0 }, { 'w',  7,  639,    0 }, { 'x', 14,  646,    0 }, { 'y',  8,  660,    0 },
+    { 'z', 10,  668,    0 }, { 'E',  1,  678,    0 }, { 'M',  1,  679,    0 }, { 'a',  1,  680,    0 },
+    { 'b',  1,  681,    0 }, { 'c',  2,  682,    0 }, { 'f',  1,  684,    0 }, { 'g',  1,  685,    0 },
+    { 'l',  1,  686,    0 }, { 'm',  1,  687,    0 }, { 'n',  1,  688,    0 }, { 'o',  2,  689,    0 },
+    { 'p',  1,  691,    0 }, { 'r',  1,  692,    0 }, { 's',  2,  693,    0 }, { 't',  1,  695,    0 },
+    { 'u',  1,  696,    0 }, { 'a',  2,  697,    0 }, { 'c',  1,  699,    0 }, { 'e',  3,  700,    0 },
+    { 'f',  1,  703,    0 }, { 'o',  1,  704,    0 }, { 'r',  1,  705,    0 }, { 's',  1,  706,    0 },
+    { 'u',  1,  707,    0 }, { 'H',  1,  708,    0 }, { 'O',  1,  709,    0 }, { 'a',  3,  710,    0 },
+    { 'c',  4,  713,    0 }, { 'd',  1,  717,    0 }, { 'e',  2,  718,    0 }, { 'f',  1,  720,    0 },
+    { 'h',  1,  721,    0 }, { 'i',  1,  722,    0 }, { 'l',  1,  723,    0 }, { 'o',  4,  724,    0 },
+    { 'r',  1,  728,    0 }, { 's',  1,  729,    0 }, { 'u',  1,  730,    0 }, { 'D',  1,  731,   66 },
+    { 'J',  1,  732,    0 }, { 'S',  1,  733,    0 }, { 'Z',  1,  734,    0 }, { 'a',  3,  735,    0 },
+    { 'c',  2,  738,    0 }, { 'e',  1,  740,    0 }, { 'f',  1,  741,    0 }, { 'i',  2,  742,    0 },
+    { 'o',  4,  744,    0 }, { 's',  2,  748,    0 }, { 'N',  1,  750,    0 }, { 'T',  1,  751,    0 },
+    { 'a',  1,  752,    0 }, { 'c',  3,  753,    0 }, { 'd',  1,  756,    0 }, { 'f',  1,  757,    0 },
+    { 'g',  1,  758,    0 }, { 'l',  1,  759,    0 }, { 'm',  2,  760,    0 }, { 'o',  2,  762,    0 },
+    { 'p',  1,  764,    0 }, { 'q',  1,  765,    0 }, { 's',  2,  766,    0 }, { 't',  1,  768,    0 },
+    { 'u',  1,  769,    0 }, { 'x',  2,  770,    0 }, { 'c',  1,  772,    0 }, { 'f',  1,  773,    0 },
+    { 'i',  1,  774,    0 }, { 'o',  3,  775,    0 }, { 's',  1,  778,    0 }, { 'J',  1,  779,    0 },
+    { 'T',  0,  780,  154 }, { 'a',  1,  780,    0 }, { 'b',  1,  781,    0 }, { 'c',  3,  782,    0 },
+    { 'd',  1,  785,    0 }, { 'f',  1,  786,    0 }, { 'g',  0,  787,  163 }, { 'o',  1,  787,    0 },
+    { 'r',  1,  788,    0 }, { 's',  1,  789,    0 }, { 't',  0,  790,  173 }, { 'A',  1,  790,    0 },
+    { 'a',  2,  791,    0 }, { 'c',  1,  793,    0 }, { 'f',  1,  794,    0 }, { 'i',  1,  795,    0 },
+    { 'o',  2,  796,    0 }, { 's',  2,  798,    0 }, { 'u',  1,  800,    0 }, { 'E',  1,  801,    0 },
+    { 'J',  1,  802,    0 }, { 'O',  1,  803,    0 }, { 'a',  1,  804,    0 }, { 'c',  2,  805,    0 },
+    { 'd',  1,  807,    0 }, { 'f',  1,  808,    0 }, { 'g',  1,  809,    0 }, { 'm',  2,  810,  195 },
+    { 'n',  2,  812,    0 }, { 'o',  3,  814,    0 }, { 's',  1,  817,    0 }, { 't',  1,  818,    0 },
+    { 'u',  2,  819,    0 }, { 'c',  2,  821,    0 }, { 'f',  1,  823,    0 }, { 'o',  1,  824,    0 },
+    { 's',  2,  825,    0 }, { 'u',  1,  827,    0 }, { 'H',  1,  828,    0 }, { 'J',  1,  829,    0 },
+    { 'a',  1,  830,    0 }, { 'c',  2,  831,    0 }, { 'f',  1,  833,    0 }, { 'o',  1,  834,    0 },
+    { 's',  1,  835,    0 }, { 'J',  1,  836,    0 }, { 'T',  0,  837,  227 }, { 'a',  5,  837,    0 },
+    { 'c',  3,  842,    0 }, { 'e',  2,  845,    0 }, { 'f',  1,  847,    0 }, { 'l',  1,  848,  269 },
+    { 'm',  1,  849,    0 }, { 'o',  3,  850,    0 }, { 's',  3,  853,    0 }, { 't',  0,  856,  284 },
+    { 'a',  1,  856,    0 }, { 'c',  1,  857,    0 }, { 'e',  2,  858,    0 }, { 'f',  1,  860,    0 },
+    { 'i',  1,  861,    0 }, { 'o',  1,  862,    0 }, { 's',  1,  863,    0 }, { 'u',  0,  864,  293 },
+    { 'J',  1,  864,    0 }, { 'a',  1,  865,    0 }, { 'c',  3,  866,    0 }, { 'e',  3,  869,    0 },
+    { 'f',  1,  872,    0 }, { 'o',  4,  873,    0 }, { 's',  1,  877,    0 }, { 't',  1,  878,    0 },
+    { 'u',  0,  879,  345 }, { 'E',  1,  879,    0 }, { 'a',  1,  880,    0 }, { 'c',  2,  881,    0 },
+    { 'd',  1,  883,    0 }, { 'f',  1,  884,    0 }, { 'g',  1,  885,    0 }, { 'm',  3,  886,    0 },
+    { 'o',  1,  889,    0 }, { 'p',  1,  890,    0 }, { 'r',  0,  891,  359 }, { 's',  2,  891,    0 },
+    { 't',  1,  893,    0 }, { 'u',  1,  894,    0 }, { 'v',  1,  895,    0 }, { 'a',  1,  896,    0 },
+    { 'c',  1,  897,    0 }, { 'f',  1,  898,    0 }, { 'h',  1,  899,    0 }, { 'i',  0,  900,  373 },
+    { 'l',  1,  900,    0 }, { 'o',  2,  901,    0 }, { 'r',  3,  903,  377 }, { 's',  2,  906,    0 },
+    { 'U',  1,  908,    0 }, { 'f',  1,  909,    0 }, { 'o',  1,  910,    0 }, { 's',  1,  911,    0 },
+    { 'B',  1,  912,    0 }, { 'E',  1,  913,    0 }, { 'a',  3,  914,    0 }, { 'c',  3,  917,    0 },
+    { 'e',  1,  920,  401 }, { 'f',  1,  921,    0 }, { 'h',  1,  922,    0 }, { 'i',  1,  923,    0 },
+    { 'o',  2,  924,    0 }, { 'r',  1,  926,    0 }, { 's',  2,  927,    0 }, { 'u',  1,  929,    0 },
+    { 'H',  2,  930,    0 }, { 'O',  1,  932,    0 }, { 'a',  1,  933,    0 }, { 'c',  4,  934,  440 },
+    { 'f',  1,  938,    0 }, { 'h',  1,  939,    0 }, { 'i',  1,  940,    0 }, { 'm',  1,  941,    0 },
+    { 'o',  1,  942,    0 }, { 'q',  2,  943,    0 }, { 's',  1,  945,    0 }, { 't',  1,  946,    0 },
+    { 'u',  4,  947,    0 }, { 'H',  1,  951,    0 }, { 'R',  1,  952,    0 }, { 'S',  2,  953,    0 },
+    { 'a',  2,  955,    0 }, { 'c',  3,  957,    0 }, { 'f',  1,  960,    0 }, { 'h',  2,  961,    0 },
+    { 'i',  1,  963,    0 }, { 'o',  1,  964,    0 }, { 'r',  1,  965,    0 }, { 's',  2,  966,    0 },
+    { 'a',  2,  968,    0 }, { 'b',  1,  970,    0 }, { 'c',  2,  971,    0 }, { 'd',  1,  973,    0 },
+    { 'f',  1,  974,    0 }, { 'g',  1,  975,    0 }, { 'm',  1,  976,    0 }, { 'n',  2,  977,    0 },
+    { 'o',  2,  979,    0 }, { 'p',  8,  981,    0 }, { 'r',  1,  989,    0 }, { 's',  1,  990,    0 },
+    { 't',  1,  991,    0 }, { 'u',  1,  992,    0 }, { 'D',  1,  993,    0 }, { 'b',  1,  994,    0 },
+    { 'c',  1,  995,    0 }, { 'd',  1,  996,    0 }, { 'e',  2,  997,    0 }, { 'f',  1,  999,    0 },
+    { 'o',  1, 1000,    0 }, { 's',  1, 1001,    0 }, { 'v',  1, 1002,    0 }, { 'c',  1, 1003,    0 },
+    { 'e',  1, 1004,    0 }, { 'f',  1, 1005,    0 }, { 'o',  1, 1006,    0 }, { 's',  1, 1007,    0 },
+    { 'f',  1, 1008,    0 }, { 'i',  0, 1009,  556 }, { 'o',  1, 1009,    0 }, { 's',  1, 1010,    0 },
+    { 'A',  1, 1011,    0 }, { 'I',  1, 1012,    0 }, { 'U',  1, 1013,    0 }, { 'a',  1, 1014,    0 },
+    { 'c',  2, 1015,    0 }, { 'f',  1, 1017,    0 }, { 'o',  1, 1018,    0 }, { 's',  1, 1019,    0 },
+    { 'u',  1, 1020,    0 }, { 'H',  1, 1021,    0 }, { 'a',  1, 1022,    0 }, { 'c',  2, 1023,    0 },
+    { 'd',  1, 1025,    0 }, { 'e',  2, 1026,    0 }, { 'f',  1, 1028,    0 }, { 'o',  1, 1029,    0 },
+    { 's',  1, 1030,    0 }, { 'a',  1, 1031,    0 }, { 'b',  1, 1032,    0 }, { 'c',  4, 1033,  581 },
+    { 'e',  1, 1037,    0 }, { 'f',  1, 1038,  587 }, { 'g',  1, 1039,    0 }, { 'l',  2, 1040,    0 },
+    { 'm',  2, 1042,    0 }, { 'n',  2, 1044,    0 }, { 'o',  2, 1046,    0 }, { 'p',  6, 1048,  621 },
+    { 'r',  1, 1054,    0 }, { 's',  3, 1055,    0 }, { 't',  1, 1058,    0 }, { 'u',  1, 1059,    0 },
+    { 'w',  2, 1060,    0 }, { 'N',  1, 1062,    0 }, { 'a',  2, 1063,    0 }, { 'b',  1, 1065,    0 },
+    { 'c',  2, 1066,    0 }, { 'd',  1, 1068,    0 }, { 'e',  5, 1069,    0 }, { 'f',  1, 1074,    0 },
+    { 'i',  1, 1075,    0 }, { 'k',  1, 1076,    0 }, { 'l',  3, 1077,    0 }, { 'n',  1, 1080,    0 },
+    { 'o',  4, 1081,    0 }, { 'p',  1, 1085,    0 }, { 'r',  2, 1086,    0 }, { 's',  4, 1088,    0 },
+    { 'u',  2, 1092,    0 }, { 'a',  3, 1094,    0 }, { 'c',  4, 1097,    0 }, { 'd',  1, 1101,    0 },
+    { 'e',  3, 1102,    0 }, { 'f',  1, 1105,    0 }, { 'h',  3, 1106,    0 }, { 'i',  1, 1109,    0 },
+    { 'l',  1, 1110,    0 }, { 'o',  4, 1111,    0 }, { 'r',  2, 1115,    0 }, { 's',  2, 1117,    0 },
+    { 't',  1, 1119,    0 }, { 'u',  7, 1120,    0 }, { 'w',  2, 1127,    0 }, { 'y',  1, 1129,    0 },
+    { 'A',  1, 1130,    0 }, { 'H',  1, 1131,    0 }, { 'a',  4, 1132,    0 }, { 'b',  2, 1136,    0 },
+    { 'c',  2, 1138,    0 }, { 'd',  2, 1140,  854 }, { 'e',  3, 1142,    0 }, { 'f',  2, 1145,    0 },
+    { 'h',  1, 1147,    0 }, { 'i',  5, 1148,    0 }, { 'j',  1, 1153,    0 }, { 'l',  1, 1154,    0 },
+    { 'o',  5, 1155,    0 }, { 'r',  2, 1160,    0 }, { 's',  3, 1162,    0 }, { 't',  2, 1165,    0 },
+    { 'u',  2, 1167,    0 }, { 'w',  1, 1169,    0 }, { 'z',  2, 1170,    0 }, { 'D',  2, 1172,    0 },
+    { 'a',  2, 1174,    0 }, { 'c',  4, 1176,    0 }, { 'd',  1, 1180,    0 }, { 'e',  0, 1181,  917 },
+    { 'f',  2, 1181,    0 }, { 'g',  2, 1183,  920 }, { 'l',  3, 1185,  924 }, { 'm',  3, 1188,    0 },
+    { 'n',  2, 1191,    0 }, { 'o',  2, 1193,    0 }, { 'p',  3, 1195,    0 }, { 'q',  4, 1198,    0 },
+    { 'r',  2, 1202,    0 }, { 's',  3, 1204,    0 }, { 't',  2, 1207,    0 }, { 'u',  2, 1209,    0 },
+    { 'x',  3, 1211,    0 }, { 'a',  1, 1214,    0 }, { 'c',  1, 1215,    0 }, { 'e',  1, 1216,    0 },
+    { 'f',  3, 1217,    0 }, { 'i',  1, 1220,    0 }, { 'l',  3, 1221,    0 }, { 'n',  1, 1224,    0 },
+    { 'o',  2, 1225,    0 }, { 'p',  1, 1227,    0 }, { 'r',  2, 1228,    0 }, { 's',  1, 1230,    0 },
+    { 'E',  1, 1231, 1004 }, { 'a',  3, 1232,    0 }, { 'b',  1, 1235,    0 }, { 'c',  2, 1236,    0 },
+    { 'd',  1, 1238,    0 }, { 'e',  3, 1239, 1014 }, { 'f',  1, 1242,    0 }, { 'g',  1, 1243, 1026 },
+    { 'i',  1, 1244,    0 }, { 'j',  1, 1245,    0 }, { 'l',  3, 1246, 1030 }, { 'n',  4, 1249,    0 },
+    { 'o',  1, 1253,    0 }, { 'r',  1, 1254,    0 }, { 's',  2, 1255,    0 }, { 't',  5, 1257, 1047 },
+    { 'A',  1, 1262,    0 }, { 'a',  4, 1263,    0 }, { 'b',  1, 1267,    0 }, { 'c',  1, 1268,    0 },
+    { 'e',  3, 1269,    0 }, { 'f',  1, 1272,    0 }, { 'k',  1, 1273,    0 }, { 'o',  5, 1274,    0 },
+    { 's',  3, 1279,    0 }, { 'y',  2, 1282,    0 }, { 'a',  1, 1284,    0 }, { 'c',  2, 1285, 1089 },
+    { 'e',  2, 1287,    0 }, { 'f',  2, 1289,    0 }, { 'g',  1, 1291,    0 }, { 'i',  3, 1292, 1097 },
+    { 'j',  1, 1295,    0 }, { 'm',  3, 1296,    0 }, { 'n',  4, 1299, 1110 }, { 'o',  4, 1303,    0 },
+    { 'p',  1, 1307,    0 }, { 'q',  1, 1308,    0 }, { 's',  2, 1309,    0 }, { 't',  1, 1311, 1134 },
+    { 'u',  2, 1312,    0 }, { 'c',  2, 1314,    0 }, { 'f',  1, 1316,    0 }, { 'm',  1, 1317,    0 },
+    { 'o',  1, 1318,    0 }, { 's',  2, 1319,    0 }, { 'u',  1, 1321,    0 }, { 'a',  1, 1322,    0 },
+    { 'c',  2, 1323,    0 }, { 'f',  1, 1325,    0 }, { 'g',  1, 1326,    0 }, { 'h',  1, 1327,    0 },
+    { 'j',  1, 1328,    0 }, { 'o',  1, 1329,    0 }, { 's',  1, 1330,    0 }, { 'A',  3, 1331,    0 },
+    { 'B',  1, 1334,    0 }, { 'E',  1, 1335, 1160 }, { 'H',  1, 1336,    0 }, { 'a',  9, 1337,    0 },
+    { 'b',  3, 1346,    0 }, { 'c',  4, 1349,    0 }, { 'd',  4, 1353,    0 }, { 'e',  4, 1357, 1202 },
+    { 'f',  3, 1361,    0 }, { 'g',  1, 1364, 1232 }, { 'h',  2, 1365,    0 }, { 'j',  1, 1367,    0 },
+    { 'l',  4, 1368, 1239 }, { 'm',  2, 1372,    0 }, { 'n',  4, 1374,    0 }, { 'o',  8, 1378,    0 },
+    { 'p',  1, 1386,    0 }, { 'r',  5, 1387,    0 }, { 's',  6, 1392,    0 }, { 't',  7, 1398, 1290 },
+    { 'u',  1, 1405,    0 }, { 'D',  1, 1406,    0 }, { 'a',  4, 1407,    0 }, { 'c',  2, 1411,    0 },
+    { 'd',  1, 1413,    0 }, { 'e',  1, 1414,    0 }, { 'f',  1, 1415,    0 }, { 'h',  1, 1416,    0 },
+    { 'i',  3, 1417,    0 }, { 'l',  2, 1420,    0 }, { 'n',  1, 1422,    0 }, { 'o',  2, 1423,    0 },
+    { 'p',  0, 1425, 1335 }, { 's',  2, 1425,    0 }, { 'u',  2, 1427, 1338 }, { 'L',  1, 1429,    0 },
+    { 'R',  1, 1430,    0 }, { 'V',  2, 1431,    0 }, { 'a',  4, 1433,    0 }, { 'b',  1, 1437,    0 },
+    { 'c',  5, 1438,    0 }, { 'd',  1, 1443,    0 }, { 'e',  5, 1444, 1362 }, { 'f',  1, 1449,    0 },
+    { 'g',  3, 1450,    0 }, { 'h',  3, 1453,    0 }, { 'i',  2, 1456, 1380 }, { 'j',  1, 1458,    0 },
+    { 'l',  6, 1459,    0 }, { 'm',  1, 1465,    0 }, { 'o',  2, 1466,    0 }, { 'p',  3, 1468,    0 },
+    { 'r',  4, 1471,    0 }, { 's',  7, 1475,    0 }, { 't',  4, 1482,    0 }, { 'u',  1, 1486, 1445 },
+    { 'v',  6, 1487,    0 }, { 'w',  3, 1493,    0 }, { 'S',  0, 1496, 1460 }, { 'a',  2, 1496,    0 },
+    { 'c',  2, 1498,    0 }, { 'd',  5, 1500,    0 }, { 'e',  1, 1505,    0 }, { 'f',  2, 1506,    0 },
+    { 'g',  3, 1508,    0 }, { 'h',  2, 1511,    0 }, { 'i',  1, 1513,    0 }, { 'l',  4, 1514,    0 },
+    { 'm',  3, 1518,    0 }, { 'o',  1, 1521,    0 }, { 'p',  3, 1522,    0 }, { 'r',  6, 1525, 1494 },
+    { 's',  3, 1531,    0 }, { 't',  1, 1534,    0 }, { 'u',  1, 1535,    0 }, { 'v',  1, 1536,    0 },
+    { 'a',  1, 1537,    0 }, { 'c',  1, 1538,    0 }, { 'e',  1, 1539,    0 }, { 'f',  1, 1540,    0 },
+    { 'h',  3, 1541,    0 }, { 'i',  2, 1544, 1530 }, { 'l',  2, 1546,    0 }, { 'm',  0, 1548, 1546 },
+    { 'o',  3, 1548,    0 }, { 'r',  9, 1551, 1550 }, { 's',  2, 1560,    0 }, { 'u',  1, 1562,    0 },
+    { 'f',  1, 1563,    0 }, { 'i',  1, 1564,    0 }, { 'o',  1, 1565,    0 }, { 'p',  1, 1566,    0 },
+    { 's',  1, 1567,    0 }, { 'u',  3, 1568,    0 }, { 'A',  3, 1571,    0 }, { 'B',  1, 1574,    0 },
+    { 'H',  1, 1575,    0 }, { 'a',  7, 1576,    0 }, { 'b',  3, 1583,    0 }, { 'c',  4, 1586,    0 },
+    { 'd',  4, 1590,    0 }, { 'e',  3, 1594,    0 }, { 'f',  3, 1597,    0 }, { 'h',  2, 1600,    0 },
+    { 'i',  3, 1602,    0 }, { 'l',  3, 1605,    0 }, { 'm',  1, 1608,    0 }, { 'n',  1, 1609,    0 },
+    { 'o',  4, 1610,    0 }, { 'p',  2, 1614,    0 }, { 'r',  1, 1616,    0 }, { 's',  4, 1617,    0 },
+    { 't',  3, 1621,    0 }, { 'u',  1, 1624,    0 }, { 'x',  0, 1625, 1689 }, { 'a',  1, 1625,    0 },
+    { 'b',  1, 1626,    0 }, { 'c',  9, 1627, 1692 }, { 'd',  1, 1636,    0 }, { 'e',  7, 1637,    0 },
+    { 'f',  1, 1644,    0 }, { 'h',  4, 1645,    0 }, { 'i',  2, 1649,    0 }, { 'l',  1, 1651,    0 },
+    { 'm',  4, 1652,    0 }, { 'o',  3, 1656,    0 }, { 'p',  1, 1659,    0 }, { 'q',  3, 1660,    0 },
+    { 'r',  1, 1663,    0 }, { 's',  4, 1664,    0 }, { 't',  2, 1668,    0 }, { 'u',  5, 1670,    0 },
+    { 'w',  3, 1675,    0 }, { 'z',  1, 1678,    0 }, { 'a',  2, 1679,    0 }, { 'b',  1, 1681,    0 },
+    { 'c',  3, 1682,    0 }, { 'd',  1, 1685,    0 }, { 'e',  1, 1686,    0 }, { 'f',  1, 1687,    0 },
+    { 'h',  4, 1688,    0 }, { 'i',  3, 1692,    0 }, { 'o',  3, 1695,    0 }, { 'p',  1, 1698,    0 },
+    { 'r',  3, 1699,    0 }, { 's',  3, 1702,    0 }, { 'w',  2, 1705,    0 }, { 'A',  1, 1707,    0 },
+    { 'H',  1, 1708,    0 }, { 'a',  2, 1709,    0 }, { 'b',  1, 1711,    0 }, { 'c',  2, 1712,    0 },
+    { 'd',  3, 1714,    0 }, { 'f',  2, 1717,    0 }, { 'g',  1, 1719,    0 }, { 'h',  2, 1720,    0 },
+    { 'l',  2, 1722,    0 }, { 'm',  2, 1724,    0 }, { 'o',  2, 1726,    0 }, { 'p',  6, 1728,    0 },
+    { 'r',  3, 1734,    0 }, { 's',  1, 1737,    0 }, { 't',  3, 1738,    0 }, { 'u',  2, 1741,    0 },
+    { 'w',  1, 1743,    0 }, { 'A',  1, 1744,    0 }, { 'B',  1, 1745,    0 }, { 'D',  1, 1746,    0 },
+    { 'a',  2, 1747,    0 }, { 'c',  1, 1749,    0 }, { 'd',  1, 1750,    0 }, { 'e',  3, 1751,    0 },
+    { 'f',  1, 1754,    0 }, { 'l',  1, 1755,    0 }, { 'o',  1, 1756,    0 }, { 'p',  1, 1757,    0 },
+    { 'r',  1, 1758,    0 }, { 's',  1, 1759,    0 }, { 'z',  1, 1760,    0 }, { 'c',  1, 1761,    0 },
+    { 'e',  2, 1762,    0 }, { 'f',  1, 1764,    0 }, { 'o',  1, 1765,    0 }, { 'p',  0, 1766, 1981 },
+    { 'r',  1, 1766, 1982 }, { 's',  1, 1767,    0 }, { 'c',  3, 1768,    0 }, { 'd',  1, 1771,    0 },
+    { 'f',  1, 1772,    0 }, { 'h',  2, 1773,    0 }, { 'i',  0, 1775, 1992 }, { 'l',  2, 1775,    0 },
+    { 'm',  1, 1777,    0 }, { 'n',  1, 1778,    0 }, { 'o',  3, 1779,    0 }, { 'r',  2, 1782,    0 },
+    { 's',  2, 1784,    0 }, { 'u',  2, 1786,    0 }, { 'v',  1, 1788,    0 }, { 'w',  1, 1789,    0 },
+    { 'a',  1, 1790,    0 }, { 'c',  2, 1791,    0 }, { 'e',  1, 1793,    0 }, { 'f',  1, 1794,    0 },
+    { 'i',  1, 1795,    0 }, { 'o',  1, 1796,    0 }, { 's',  1, 1797,    0 }, { 'u',  2, 1798,    0 },
+    { 'a',  1, 1800,    0 }, { 'c',  2, 1801,    0 }, { 'd',  1, 1803,    0 }, { 'e',  2, 1804,    0 },
+    { 'f',  1, 1806,    0 }, { 'h',  1, 1807,    0 }, { 'i',  1, 1808,    0 }, { 'o',  1, 1809,    0 },
+    { 's',  1, 1810,    0 }, { 'w',  2, 1811,    0 }, { 'l',  1, 1813,    0 }, { 'P',  0, 1814,    2 },
+    { 'c',  1, 1814,    0 }, { 'r',  1, 1815,    0 }, { 'i',  1, 1816,    0 }, { 'y',  0, 1817,    6 },
+    { 'r',  0, 1817,    7 }, { 'r',  1, 1817,    0 }, { 'p',  1, 1818,    0 }, { 'a',  1, 1819,    0 },
+    { 'd',  0, 1820,   11 }, { 'g',  1, 1820,    0 }, { 'p',  1, 1821,    0 }, { 'p',  1, 1822,    0 },
+    { 'i',  1, 1823,    0 }, { 'c',  1, 1824,    0 }, { 's',  1, 1825,    0 }, { 'i',  1, 1826,    0 },
+    { 'm',  1, 1827,    0 }, { 'c',  1, 1828,    0 }, { 'r',  2, 1829,    0 }, { 'y',  0, 1831,   23 },
+    { 'c',  1, 1831,    0 }, { 'r',  1, 1832,    0 }, { 't',  1, 1833,    0 }, { 'r',  0, 1834,   27 },
+    { 'p',  1, 1834,    0 }, { 'e',  1, 1835,    0 }, { 'c',  1, 1836,    0 }, { 'm',  1, 1837,    0 },
+    { 'c',  1, 1838,    0 }, { 'P',  1, 1839,    0 }, { 'c',  1, 1840,    0 }, { 'p',  1, 1841,   35 },
+    { 'y',  1, 1842,    0 }, { 'a',  1, 1843,    0 }, { 'e',  1, 1844,    0 }, { 'i',  1, 1845,    0 },
+    { 'o',  1, 1846,    0 }, { 'o',  1, 1847,    0 }, { 'd',  1, 1848,    0 }, { 'n',  1, 1849,    0 },
+    { 'r',  0, 1850,   45 }, { 'i',  0, 1850,   46 }, { 'r',  1, 1850,    0 }, { 'o',  2, 1851,    0 },
+    { 'l',  1, 1853,    0 }, { 'n',  3, 1854,    0 }, { 'p',  2, 1857,    0 }, { 'u',  1, 1859,    0 },
+    { 'o',  1, 1860,    0 }, { 'c',  1, 1861,    0 }, { 'p',  1, 1862,   64 }, { 'o',  1, 1863,    0 },
+    { 'c',  1, 1864,    0 }, { 'c',  1, 1865,    0 }, { 'c',  1, 1866,    0 }, { 'g',  1, 1867,    0 },
+    { 'r',  1, 1868,    0 }, { 's',  1, 1869,    0 }, { 'a',  1, 1870,    0 }, { 'y',  0, 1871,   75 },
+    { 'l',  1, 1871,   76 }, { 'r',  0, 1872,   78 }, { 'a',  2, 1872,    0 }, { 'f',  1, 1874,    0 },
+    { 'p',  1, 1875,    0 }, { 't',  2, 1876,   87 }, { 'u',  1, 1878,    0 }, { 'w',  1, 1879,    0 },
+    { 'c',  1, 1880,    0 }, { 't',  1, 1881,    0 }, { 'G',  0, 1882,  120 }, { 'H',  0, 1882,  121 },
+    { 'c',  1, 1882,    0 }, { 'a',  1, 1883,    0 }, { 'i',  1, 1884,    0 }, { 'y',  0, 1885,  125 },
+    { 'o',  1, 1885,    0 }, { 'r',  0, 1886,  127 }, { 'r',  1, 1886,    0 }, { 'e',  1, 1887,    0 },
+    { 'a',  1, 1888,    0 }, { 'p',  1, 1889,    0 }, { 'g',  1, 1890,    0 }, { 'p',  1, 1891,    0 },
+    { 's',  1, 1892,    0 }, { 'u',  2, 1893,    0 }, { 'c',  1, 1895,    0 }, { 'i',  1, 1896,    0 },
+    { 'a',  0, 1897,  141 }, { 'm',  1, 1897,    0 }, { 'i',  1, 1898,    0 }, { 'p',  1, 1899,    0 },
+    { 'y',  0, 1900,  145 }, { 'r',  0, 1900,  146 }, { 'l',  1, 1900,    0 }, { 'p',  1, 1901,    0 },
+    { 'r',  1, 1902,    0 }, { 'u',  1, 1903,    0 }, { 'c',  1, 1904,    0 }, { 'c',  1, 1905,    0 },
+    { 'm',  1, 1906,    0 }, { 'r',  1, 1907,    0 }, { 'e',  1, 1908,    0 }, { 'i',  1, 1909,    0 },
+    { 'y',  0, 1910,  160 }, { 'o',  1, 1910,    0 }, { 'r',  0, 1911,  162 }, { 'p',  1, 1911,    0 },
+    { 'e',  1, 1912,    0 }, { 'c',  1, 1913,    0 }, { 'R',  1, 1914,    0 }, { 'c',  1, 1915,    0 },
+    { 't',  0, 1916,  176 }, { 'i',  1, 1916,    0 }, { 'r',  0, 1917,  178 }, { 'l',  1, 1917,    0 },
+    { 'p',  1, 1918,    0 }, { 'r',  1, 1919,    0 }, { 'c',  1, 1920,    0 }, { 't',  1, 1921,    0 },
+    { 'm',  1, 1922,    0 }, { 'c',  1, 1923,    0 }, { 'l',  1, 1924,    0 }, { 'c',  1, 1925,    0 },
+    { 'c',  1, 1926,    0 }, { 'i',  1, 1927,    0 }, { 'y',  0, 1928,  191 }, { 'o',  1, 1928,    0 },
+    { 'r',  0, 1929,  193 }, { 'r',  1, 1929,    0 }, { 'a',  2, 1930,    0 }, { 'p',  1, 1932,    0 },
+    { 't',  1, 1933,  199 }, { 'v',  1, 1934,    0 }, { 'g',  1, 1935,    0 }, { 'p',  1, 1936,    0 },
+    { 't',  1, 1937,    0 }, { 'c',  1, 1938,    0 }, { 'i',  1, 1939,    0 }, { 'k',  1, 1940,    0 },
+    { 'm',  1, 1941,    0 }, { 'i',  1, 1942,    0 }, { 'y',  0, 1943,  212 }, { 'r',  0, 1943,  213 },
+    { 'p',  1, 1943,    0 }, { 'c',  1, 1944,    0 }, { 'e',  1, 1945,    0 }, { 'k',  1, 1946,    0 },
+    { 'c',  1, 1947,    0 }, { 'c',  1, 1948,    0 }, { 'p',  1, 1949,    0 }, { 'e',  1, 1950,    0 },
+    { 'y',  0, 1951,  222 }, { 'r',  0, 1951,  223 }, { 'p',  1, 1951,    0 }, { 'c',  1, 1952,    0 },
+    { 'c',  1, 1953,    0 }, { 'c',  1, 1954,    0 }, { 'm',  1, 1955,    0 }, { 'n',  1, 1956,    0 },
+    { 'p',  1, 1957,    0 }, { 'r',  1, 1958,    0 }, { 'a',  1, 1959,    0 }, { 'e',  1, 1960,    0 },
+    { 'y',  0, 1961,  235 }, { 'f',  1, 1961,    0 }, { 's',  1, 1962,    0 }, { 'r',  0, 1963,  268 },
+    { 'e',  1, 1963,    0 }, { 'i',  1, 1964,    0 }, { 'n',  1, 1965,    0 }, { 'p',  1, 1966,    0 },
+    { 'w',  1, 1967,    0 }, { 'c',  1, 1968,    0 }, { 'h',  0, 1969,  282 }, { 't',  1, 1969,    0 },
+    { 'p',  0, 1970,  285 }, { 'y',  0, 1970,  286 }, { 'd',  1, 1970,    0 }, { 'l',  1, 1971,    0 },
+    { 'r',  0, 1972,  289 }, { 'n',  1, 1972,    0 }, { 'p',  1, 1973,    0 }, { 'c',  1, 1974,    0 },
+    { 'c',  1, 1975,    0 }, { 'c',  1, 1976,    0 }, { 'a',  1, 1977,    0 }, { 'e',  1, 1978,    0 },
+    { 'y',  0, 1979,  298 }, { 'g',  1, 1979,    0 }, { 's',  1, 1980,    0 }, { 'w',  1, 1981,    0 },
+    { 'r',  0, 1982,  306 }, { 'B',  1, 1982,    0 }, { 'n',  1, 1983,    0 }, { 'p',  1, 1984,    0 },
+    { 't', 10, 1985,  310 }, { 'c',  1, 1995,    0 }, { 'i',  1, 1996,    0 }, { 'l',  1, 1997,    0 },
+    { 'c',  1, 1998,    0 }, { 'i',  1, 1999,    0 }, { 'y',  0, 2000,  349 }, { 'b',  1, 2000,    0 },
+    { 'r',  0, 2001,  351 }, { 'r',  1, 2001,    0 }, { 'a',  1, 2002,    0 }, { 'e',  1, 2003,    0 },
+    { 'i',  1, 2004,    0 }, { 'p',  1, 2005,    0 }, { 'e',  1, 2006,    0 }, { 'c',  1, 2007,    0 },
+    { 'l',  1, 2008,    0 }, { 'i',  2, 2009,    0 }, { 'm',  1, 2011,    0 }, { 'e',  1, 2012,    0 },
+    { 'r',  1, 2013,    0 }, { 'y',  0, 2014,  370 }, { 'r',  0, 2014,  371 }, { 'i',  0, 2014,  372 },
+    { 'u',  1, 2014,    0 }, { 'i',  1, 2015,    0 }, { 'p',  1, 2016,    0 }, { 'e',  1, 2017,    0 },
+    { 'i',  1, 2018,    0 }, { 'o',  2, 2019,    0 }, { 'c',  1, 2021,    0 }, { 'i',  0, 2022,  387 },
+    { 'O',  1, 2022,    0 }, { 'r',  0, 2023,  389 }, { 'p',  1, 2023,    0 }, { 'c',  1, 2024,    0 },
+    { 'a',  1, 2025,    0 }, { 'G',  0, 2026,  393 }, { 'c',  1, 2026,    0 }, { 'n',  1, 2027,    0 },
+    { 'r',  1, 2028,    0 }, { 'a',  1, 2029,    0 }, { 'e',  1, 2030,    0 }, { 'y',  0, 2031,  400 },
+    { 'v',  1, 2031,    0 }, { 'r',  0, 2032,  405 }, { 'o',  0, 2032,  406 }, { 'g',  1, 2032,    0 },
+    { 'p',  1, 2033,    0 }, { 'u',  1, 2034,    0 }, { 'i',  1, 2035,    0 }, { 'c',  1, 2036,    0 },
+    { 'h',  0, 2037,  434 }, { 'l',  1, 2037,    0 }, { 'C',  1, 2038,    0 }, { 'c',  1, 2039,    0 },
+    { 'F',  1, 2040,    0 }, { 'c',  1, 2041,    0 }, { 'a',  1, 2042,    0 }, { 'e',  1, 2043,    0 },
+    { 'i',  1, 2044,    0 }, { 'y',  0, 2045,  444 }, { 'r',  0, 2045,  445 }, { 'o',  1, 2045,    0 },
+    { 'g',  1, 2046,    0 }, { 'a',  1, 2047,    0 }, { 'p',  1, 2048,    0 }, { 'r',  1, 2049,    0 },
+    { 'u',  1, 2050,    0 }, { 'c',  1, 2051,    0 }, { 'a',  1, 2052,    0 }, { 'b',  1, 2053,  463 },
+    { 'c',  2, 2054,    0 }, { 'm',  0, 2056,  471 }, { 'p',  2, 2056,  472 }, { 'O',  1, 2058,    0 },
+    { 'A',  1, 2059,    0 }, { 'H',  1, 2060,    0 }, { 'c',  1, 2061,    0 }, { 'b',  0, 2062,  480 },
+    { 'u',  0, 2062,  481 }, { 'a',  1, 2062,    0 }, { 'e',  1, 2063,    0 }, { 'y',  0, 2064,  484 },
+    { 'r',  0, 2064,  485 }, { 'e',  2, 2064,    0 }, { 'i',  1, 2066,    0 }, { 'l',  1, 2067,    0 },
+    { 'p',  1, 2068,    0 }, { 'i',  1, 2069,    0 }, { 'c',  1, 2070,    0 }, { 't',  1, 2071,    0 },
+    { 'c',  1, 2072,    0 }, { 'r',  1, 2073,    0 }, { 'r',  2, 2074,    0 }, { 'i',  1, 2076,    0 },
+    { 'y',  0, 2077,  503 }, { 'b',  1, 2077,    0 }, { 'r',  0, 2078,  505 }, { 'r',  1, 2078,    0 },
+    { 'a',  1, 2079,    0 }, { 'd',  1, 2080,    0 }, { 'i',  1, 2081,    0 }, { 'g',  1, 2082,    0 },
+    { 'p',  1, 2083,    0 }, { 'A',  1, 2084,    0 }, { 'D',  1, 2085,    0 }, { 'E',  1, 2086,    0 },
+    { 'T',  1, 2087,    0 }, { 'a',  1, 2088,    0 }, { 'd',  1, 2089,    0 }, { 'p',  1, 2090,    0 },
+    { 's',  1, 2091,    0 }, { 'i',  1, 2092,    0 }, { 'c',  1, 2093,    0 }, { 'i',  1, 2094,    0 },
+    { 'm',  1, 2095,    0 }, { 'a',  1, 2096,    0 }, { 'a',  1, 2097,    0 }, { 'y',  0, 2098,  535 },
+    { 'a',  1, 2098,    0 }, { 'e',  0, 2099,  538 }, { 'r',  3, 2099,    0 }, { 'r',  0, 2102,  546 },
+    { 'p',  1, 2102,    0 }, { 'c',  1, 2103,    0 }, { 'd',  1, 2104,    0 }, { 'i',  1, 2105,    0 },
+    { 'd',  1, 2106,    0 }, { 'r',  0, 2107,  552 }, { 'p',  1, 2107,    0 }, { 'c',  1, 2108,    0 },
+    { 'r',  0, 2109,  555 }, { 'p',  1, 2109,    0 }, { 'c',  1, 2110,    0 }, { 'c',  1, 2111,    0 },
+    { 'c',  1, 2112,    0 }, { 'c',  1, 2113,    0 }, { 'c',  1, 2114,    0 }, { 'i',  1, 2115,    0 },
+    { 'y',  0, 2116,  564 }, { 'r',  0, 2116,  565 }, { 'p',  1, 2116,    0 }, { 'c',  1, 2117,    0 },
+    { 'm',  1, 2118,    0 }, { 'c',  1, 2119,    0 }, { 'c',  1, 2120,    0 }, { 'a',  1, 2121,    0 },
+    { 'y',  0, 2122,  572 }, { 'o',  1, 2122,    0 }, { 'r',  1, 2123,    0 }, { 't',  1, 2124,    0 },
+    { 'r',  0, 2125,  576 }, { 'p',  1, 2125,    0 }, { 'c',  1, 2126,    0 }, { 'c',  1, 2127,    0 },
+    { 'r',  1, 2128,    0 }, { 'd',  0, 2129,  582 }, { 'i',  1, 2129,    0 }, { 'u',  1, 2130,    0 },
+    { 'y',  0, 2131,  585 }, { 'l',  1, 2131,    0 }, { 'r',  0, 2132,  588 }, { 'r',  1, 2132,    0 },
+    { 'e',  2, 2133,    0 }, { 'p',  1, 2135,    0 }, { 'a',  2, 2136,    0 }, { 'p',  0, 2138,  595 },
+    { 'd',  4, 2138,  596 }, { 'g',  6, 2142,  601 }, { 'g',  1, 2148,    0 }, { 'p',  1, 2149,    0 },
+    { 'E',  0, 2150,  622 }, { 'a',  1, 2150,    0 }, { 'e',  0, 2151,  624 }, { 'i',  1, 2151,    0 },
+    { 'o',  1, 2152,    0 }, { 'p',  1, 2153,    0 }, { 'i',  1, 2154,    0 }, { 'c',  1, 2155,    0 },
+    { 't',  0, 2156,  631 }, { 'y',  1, 2156,    0 }, { 'i',  1, 2157,    0 }, { 'm',  1, 2158,    0 },
+    { 'c',  1, 2159,    0 }, { 'i',  1, 2160,    0 }, { 'o',  1, 2161,    0 }, { 'c',  1, 2162,    0 },
+    { 'r',  2, 2163,    0 }, { 'r',  1, 2165,    0 }, { 'o',  1, 2166,    0 }, { 'y',  0, 2167,  650 },
+    { 'q',  1, 2167,    0 }, { 'c',  1, 2168,    0 }, { 'm',  1, 2169,    0 }, { 'p',  1, 2170,    0 },
+    { 'r',  1, 2171,    0 }, { 't',  3, 2172,    0 }, { 'r',  0, 2175,  660 }, { 'g',  7, 2175,    0 },
+    { 'a',  1, 2182,    0 }, { 'a',  2, 2183,    0 }, { 'k',  2, 2185,    0 }, { 'o',  1, 2187,    0 },
+    { 'o',  1, 2188,    0 }, { 'p',  1, 2189,    0 }, { 't',  1, 2190,  688 }, { 'w',  1, 2191,    0 },
+    { 'x', 12, 2192,    0 }, { 'r',  1, 2204,    0 }, { 'e',  1, 2205,    0 }, { 'v',  1, 2206,    0 },
+    { 'c',  1, 2207,    0 }, { 'e',  1, 2208,    0 }, { 'i',  1, 2209,    0 }, { 'o',  1, 2210,    0 },
+    { 'l',  1, 2211,    0 }, { 'm',  1, 2212,    0 }, { 'c',  1, 2213,    0 }, { 'p',  4, 2214,  752 },
+    { 'r',  2, 2218,    0 }, { 'a',  2, 2220,    0 }, { 'e',  1, 2222,    0 }, { 'i',  1, 2223,    0 },
+    { 'u',  1, 2224,    0 }, { 'o',  1, 2225,    0 }, { 'd',  1, 2226,    0 }, { 'm',  1, 2227,    0 },
+    { 'n',  1, 2228,    0 }, { 'r',  0, 2229,  771 }, { 'c',  1, 2229,    0 }, { 'e',  1, 2230,    0 },
+    { 'i',  0, 2231,  775 }, { 'r',  6, 2231,  776 }, { 'u',  1, 2237,    0 }, { 'l',  1, 2238,    0 },
+    { 'm',  2, 2239,    0 }, { 'n',  2, 2241,    0 }, { 'p',  3, 2243,    0 }, { 'a',  1, 2246,    0 },
+    { 'o',  1, 2247,    0 }, { 'c',  1, 2248,    0 }, { 'u',  2, 2249,    0 }, { 'd',  1, 2251,    0 },
+    { 'd',  1, 2252,    0 }, { 'e',  2, 2253,    0 }, { 'l',  1, 2255,    0 }, { 'p',  4, 2256,  823 },
+    { 'r',  4, 2260,    0 }, { 'v',  1, 2264,    0 }, { 'w',  1, 2265,    0 }, { 'c',  1, 2266,    0 },
+    { 'i',  1, 2267,    0 }, { 'l',  1, 2268,    0 }, { 'r',  1, 2269,    0 }, { 'a',  1, 2270,    0 },
+    { 'g',  1, 2271,    0 }, { 'l',  1, 2272,    0 }, { 'r',  1, 2273,    0 }, { 's',  1, 2274,    0 },
+    { 'k',  1, 2275,    0 }, { 'l',  1, 2276,    0 }, { 'a',  1, 2277,    0 }, { 'y',  0, 2278,  853 },
+    { 'a',  2, 2278,    0 }, { 'o',  1, 2280,    0 }, { 'g',  0, 2281,  858 }, { 'l',  1, 2281,    0 },
+    { 'm',  1, 2282,    0 }, { 'i',  1, 2283,    0 }, { 'r',  0, 2284,  862 }, { 'a',  1, 2284,    0 },
+    { 'a',  1, 2285,    0 }, { 'e',  0, 2286,  869 }, { 'g',  1, 2286,    0 }, { 's',  1, 2287,    0 },
+    { 'v',  2, 2288,  872 }, { 'c',  1, 2290,    0 }, { 'c',  2, 2291,    0 }, { 'l',  1, 2293,    0 },
+    { 'p',  1, 2294,    0 }, { 't',  4, 2295,  881 }, { 'u',  1, 2299,    0 }, { 'w',  1, 2300,    0 },
+    { 'b',  1, 2301,    0 }, { 'c',  2, 2302,    0 }, { 'c',  2, 2304,    0 }, { 'o',  1, 2306,    0 },
+    { 't',  1, 2307,    0 }, { 'd',  1, 2308,    0 }, { 'r',  1, 2309,    0 }, { 'a',  1, 2310,    0 },
+    { 'h',  1, 2311,    0 }, { 'a',  1, 2312,    0 }, { 'c',  1, 2313,    0 }, { 'i',  1, 2314,    0 },
+    { 'D',  1, 2315,    0 }, { 'o',  1, 2316,    0 }, { 'c',  1, 2317,    0 }, { 's',  1, 2318,    0 },
+    { 'a',  1, 2319,    0 }, { 'i',  1, 2320,    0 }, { 'o',  1, 2321,    0 }, { 'y',  0, 2322,  915 },
+    { 'o',  1, 2322,    0 }, { 'D',  1, 2323,    0 }, { 'r',  0, 2324,  919 }, { 'r',  1, 2324,    0 },
+    { 's',  1, 2325,  922 }, { 'i',  1, 2326,    0 }, { 'l',  0, 2327,  926 }, { 's',  1, 2327,  927 },
+    { 'a',  1, 2328,    0 }, { 'p',  1, 2329,    0 }, { 's',  1, 2330,    0 }, { 'g',  0, 2331,  936 },
+    { 's',  1, 2331,    0 }, { 'g',  1, 2332,    0 }, { 'p',  1, 2333,    0 }, { 'a',  1, 2334,    0 },
+    { 'l',  1, 2335,    0 }, { 's',  1, 2336,    0 }, { 'c',  2, 2337,    0 }, { 's',  2, 2339,    0 },
+    { 'u',  3, 2341,    0 }, { 'v',  1, 2344,    0 }, { 'D',  1, 2345,    0 }, { 'a',  1, 2346,    0 },
+    { 'c',  1, 2347,    0 }, { 'd',  1, 2348,    0 }, { 'i',  1, 2349,    0 }, { 'a',  0, 2350,  961 },
+    { 'h',  0, 2350,  962 }, { 'm',  1, 2350,    0 }, { 'r',  1, 2351,    0 }, { 'c',  1, 2352,    0 },
+    { 'i',  1, 2353,    0 }, { 'p',  2, 2354,    0 }, { 'l',  1, 2356,    0 }, { 'y',  0, 2357,  970 },
+    { 'm',  1, 2357,    0 }, { 'i',  1, 2358,    0 }, { 'l',  2, 2359,    0 }, { 'r',  0, 2361,  975 },
+    { 'l',  1, 2361,    0 }, { 'a',  1, 2362,    0 }, { 'l',  1, 2363,    0 }, { 't',  1, 2364,    0 },
+    { 'o',  1, 2365,    0 }, { 'p',  1, 2366,    0 }, { 'r',  2, 2367,    0 }, { 'a',  1, 2369,    0 },
+    { 'a',  2, 2370,    0 }, { 'o',  1, 2372,    0 }, { 'c',  1, 2373,    0 }, { 'l',  0, 2374, 1005 },
+    { 'c',  1, 2374,    0 }, { 'm',  1, 2375,    0 }, { 'p',  0, 2376, 1009 }, { 'r',  1, 2376,    0 },
+    { 'i',  1, 2377,    0 }, { 'y',  0, 2378, 1012 }, { 'o',  1, 2378,    0 }, { 'l',  0, 2379, 1015 },
+    { 'q',  2, 2379, 1016 }, { 's',  3, 2381, 1019 }, { 'r',  0, 2384, 1025 }, { 'g',  0, 2384, 1027 },
+    { 'm',  1, 2384,    0 }, { 'c',  1, 2385,    0 }, { 'E',  0, 2386, 1031 }, { 'a',  0, 2386, 1032 },
+    { 'j',  0, 2386, 1033 }, { 'E',  0, 2386, 1034 }, { 'a',  1, 2386,    0 }, { 'e',  1, 2387, 1037 },
+    { 's',  1, 2388,    0 }, { 'p',  1, 2389,    0 }, { 'a',  1, 2390,    0 }, { 'c',  1, 2391,    0 },
+    { 'i',  1, 2392,    0 }, { 'c',  2, 2393,    0 }, { 'd',  1, 2395,    0 }, { 'l',  1, 2396,    0 },
+    { 'q',  1, 2397,    0 }, { 'r',  5, 2398,    0 }, { 'r',  1, 2403,    0 }, { 'i',  1, 2404,    0 },
+    { 'l',  1, 2405,    0 }, { 'm',  1, 2406,    0 }, { 'r',  2, 2407,    0 }, { 'a',  1, 2409,    0 },
+    { 'i',  1, 2410,    0 }, { 'a',  1, 2411,    0 }, { 'l',  1, 2412,    0 }, { 'r',  1, 2413,    0 },
+    { 'r',  0, 2414, 1074 }, { 's',  2, 2414,    0 }, { 'a',  1, 2416,    0 }, { 'm',  1, 2417,    0 },
+    { 'o',  1, 2418,    0 }, { 'p',  1, 2419,    0 }, { 'r',  1, 2420,    0 }, { 'c',  1, 2421,    0 },
+    { 'l',  1, 2422,    0 }, { 't',  1, 2423,    0 }, { 'b',  1, 2424,    0 }, { 'p',  1, 2425,    0 },
+    { 'c',  1, 2426,    0 }, { 'i',  1, 2427,    0 }, { 'y',  0, 2428, 1091 }, { 'c',  1, 2428,    0 },
+    { 'x',  1, 2429,    0 }, { 'f',  0, 2430, 1094 }, { 'r',  0, 2430, 1095 }, { 'r',  1, 2430,    0 },
+    { 'i',  2, 2431,    0 }, { 'n',  1, 2433,    0 }, { 'o',  1, 2434,    0 }, { 'l',  1, 2435,    0 },
+    { 'a',  3, 2436,    0 }, { 'o',  1, 2439,    0 }, { 'p',  1, 2440,    0 }, { 'c',  1, 2441,    0 },
+    { 'f',  1, 2442,    0 }, { 'o',  1, 2443,    0 }, { 't',  4, 2444, 1115 }, { 'c',  1, 2448,    0 },
+    { 'g',  1, 2449,    0 }, { 'p',  1, 2450,    0 }, { 't',  1, 2451,    0 }, { 'r',  1, 2452,    0 },
+    { 'u',  1, 2453,    0 }, { 'c',  1, 2454,    0 }, { 'i',  1, 2455,    0 }, { 'i',  1, 2456,    0 },
+    { 'k',  1, 2457,    0 }, { 'm',  1, 2458,    0 }, { 'i',  1, 2459,    0 }, { 'y',  0, 2460, 1139 },
+    { 'r',  0, 2460, 1140 }, { 'a',  1, 2460,    0 }, { 'p',  1, 2461,    0 }, { 'c',  1, 2462,    0 },
+    { 'e',  1, 2463,    0 }, { 'k',  1, 2464,    0 }, { 'p',  1, 2465,    0 }, { 'e',  1, 2466,    0 },
+    { 'y',  0, 2467, 1149 }, { 'r',  0, 2467, 1150 }, { 'r',  1, 2467,    0 }, { 'c',  1, 2468,    0 },
+    { 'c',  1, 2469,    0 }, { 'p',  1, 2470,    0 }, { 'c',  1, 2471,    0 }, { 'a',  1, 2472,    0 },
+    { 'r',  1, 2473,    0 }, { 't',  1, 2474,    0 }, { 'a',  1, 2475,    0 }, { 'g',  0, 2476, 1161 },
+    { 'a',  1, 2476,    0 }, { 'c',  1, 2477,    0 }, { 'e',  1, 2478,    0 }, { 'g',  1, 2479,    0 },
+    { 'm',  1, 2480,    0 }, { 'n',  1, 2481,    0 }, { 'p',  0, 2482, 1170 }, { 'q',  1, 2482,    0 },
+    { 'r',  1, 2483,    0 }, { 't',  2, 2484, 1181 }, { 'a',  1, 2486,    0 }, { 'b',  1, 2487,    0 },
+    { 'r',  2, 2488,    0 }, { 'a',  1, 2490,    0 }, { 'e',  2, 2491,    0 }, { 'u',  1, 2493,    0 },
+    { 'y',  0, 2494, 1195 }, { 'c',  1, 2494,    0 }, { 'q',  1, 2495,    0 }, { 'r',  2, 2496,    0 },
+    { 's',  1, 2498,    0 }, { 'f',  1, 2499,    0 }, { 'g',  0, 2500, 1213 }, { 'q',  2, 2500, 1214 },
+    { 's',  4, 2502, 1217 }, { 'i',  1, 2506,    0 }, { 'l',  1, 2507,    0 }, { 'r',  0, 2508, 1231 },
+    { 'E',  0, 2508, 1233 }, { 'a',  1, 2508,    0 }, { 'b',  1, 2509,    0 }, { 'c',  1, 2510,    0 },
+    { 'a',  1, 2511,    0 }, { 'c',  1, 2512,    0 }, { 'h',  1, 2513,    0 }, { 't',  1, 2514,    0 },
+    { 'i',  1, 2515,    0 }, { 'o',  1, 2516,    0 }, { 'E',  0, 2517, 1247 }, { 'a',  1, 2517,    0 },
+    { 'e',  1, 2518, 1250 }, { 's',  1, 2519,    0 }, { 'a',  2, 2520,    0 }, { 'b',  1, 2522,    0 },
+    { 'n',  1, 2523,    0 }, { 'o',  1, 2524,    0 }, { 'p',  3, 2525,    0 }, { 't',  1, 2528,    0 },
+    { 'w',  2, 2529,    0 }, { 'z',  2, 2531, 1269 }, { 'a',  1, 2533,    0 }, { 'a',  1, 2534,    0 },
+    { 'c',  1, 2535,    0 }, { 'h',  1, 2536,    0 }, { 'm',  0, 2537, 1278 }, { 't',  1, 2537,    0 },
+    { 'a',  1, 2538,    0 }, { 'c',  1, 2539,    0 }, { 'h',  0, 2540, 1282 }, { 'i',  1, 2540,    0 },
+    { 'q',  2, 2541,    0 }, { 't',  1, 2543,    0 }, { 'c',  2, 2544,    0 }, { 'd',  1, 2546,    0 },
+    { 'h',  1, 2547,    0 }, { 'i',  1, 2548,    0 }, { 'l',  1, 2549,    0 }, { 'q',  1, 2550,    0 },
+    { 'r',  2, 2551,    0 }, { 'r',  2, 2553,    0 }, { 'D',  1, 2555,    0 }, { 'c',  1, 2556,    0 },
+    { 'l',  2, 2557,    0 }, { 'p',  1, 2559, 1309 }, { 'r',  1, 2560,    0 }, { 'o',  1, 2561,    0 },
+    { 'y',  0, 2562, 1316 }, { 'a',  1, 2562,    0 }, { 'a',  1, 2563,    0 }, { 'r',  0, 2564, 1319 },
+    { 'o',  0, 2564, 1320 }, { 'c',  1, 2564,    0 }, { 'd',  3, 2565, 1322 }, { 'n',  1, 2568,    0 },
+    { 'c',  1, 2569,    0 }, { 'd',  1, 2570,    0 }, { 'p',  1, 2571,    0 }, { 'd',  1, 2572,    0 },
+    { 'p',  1, 2573,    0 }, { 'c',  1, 2574,    0 }, { 't',  1, 2575,    0 }, { 'l',  1, 2576,    0 },
+    { 'm',  1, 2577,    0 }, { 'e',  1, 2578,    0 }, { 'i',  1, 2579,    0 }, { 'D',  1, 2580,    0 },
+    { 'd',  1, 2581,    0 }, { 'b',  1, 2582,    0 }, { 'c',  1, 2583,    0 }, { 'p',  2, 2584, 1348 },
+    { 't',  1, 2586,    0 }, { 's',  1, 2587,    0 }, { 'a',  2, 2588,    0 }, { 'e',  1, 2590,    0 },
+    { 'o',  1, 2591,    0 }, { 'u',  1, 2592,    0 }, { 'y',  0, 2593, 1360 }, { 'a',  1, 2593,    0 },
+    { 'A',  1, 2594,    0 }, { 'a',  1, 2595,    0 }, { 'q',  1, 2596,    0 }, { 's',  1, 2597,    0 },
+    { 'x',  1, 2598,    0 }, { 'r',  0, 2599, 1371 }, { 'e',  1, 2599, 1372 }, { 's',  1, 2600,    0 },
+    { 't',  1, 2601, 1375 }, { 'A',  1, 2602,    0 }, { 'a',  1, 2603,    0 }, { 'p',  1, 2604,    0 },
+    { 's',  1, 2605, 1381 }, { 'v',  0, 2606, 1383 }, { 'c',  1, 2606,    0 }, { 'A',  1, 2607,    0 },
+    { 'a',  1, 2608,    0 }, { 'd',  1, 2609,    0 }, { 'e',  3, 2610, 1388 }, { 's',  1, 2613,    0 },
+    { 't',  1, 2614, 1394 }, { 'i',  1, 2615,    0 }, { 'p',  1, 2616,    0 }, { 't',  2, 2617, 1399 },
+    { 'a',  1, 2619,    0 }, { 'o',  1, 2620,    0 }, { 'r',  2, 2621, 1411 }, { 'A',  1, 2623,    0 },
+    { 'a',  1, 2624,    0 }, { 'i',  1, 2625,    0 }, { 't',  1, 2626,    0 }, { 'c',  2, 2627, 1419 },
+    { 'h',  1, 2629,    0 }, { 'i',  1, 2630,    0 }, { 'm',  1, 2631,    0 }, { 'p',  1, 2632,    0 },
+    { 'q',  1, 2633,    0 }, { 'u',  3, 2634,    0 }, { 'g',  1, 2637,    0 }, { 'i',  1, 2638,    0 },
+    { 'l',  1, 2639,    0 }, { 'r',  1, 2640,    0 }, { 'm',  2, 2641, 1446 }, { 'D',  1, 2643,    0 },
+    { 'H',  1, 2644,    0 }, { 'd',  1, 2645,    0 }, { 'i',  1, 2646,    0 }, { 'l',  1, 2647,    0 },
+    { 'r',  1, 2648,    0 }, { 'A',  1, 2649,    0 }, { 'a',  1, 2650,    0 }, { 'n',  1, 2651,    0 },
+    { 'c',  1, 2652,    0 }, { 's',  1, 2653,    0 }, { 'i',  1, 2654,    0 }, { 'y',  0, 2655, 1465 },
+    { 'a',  1, 2655,    0 }, { 'b',  1, 2656,    0 }, { 'i',  1, 2657,    0 }, { 'o',  1, 2658,    0 },
+    { 's',  1, 2659,    0 }, { 'l',  1, 2660,    0 }, { 'c',  1, 2661,    0 }, { 'r',  0, 2662, 1473 },
+    { 'o',  1, 2662,    0 }, { 'r',  1, 2663,    0 }, { 't',  0, 2664, 1476 }, { 'b',  1, 2664,    0 },
+    { 'm',  0, 2665, 1478 }, { 'n',  1, 2665,    0 }, { 'a',  1, 2666,    0 }, { 'c',  2, 2667,    0 },
+    { 'i',  1, 2669,    0 }, { 't',  0, 2670, 1484 }, { 'a',  1, 2670,    0 }, { 'e',  1, 2671,    0 },
+    { 'i',  3, 2672,    0 }, { 'p',  1, 2675,    0 }, { 'a',  1, 2676,    0 }, { 'e',  1, 2677,    0 },
+    { 'l',  1, 2678,    0 }, { 'a',  1, 2679,    0 }, { 'd',  3, 2680, 1496 }, { 'i',  1, 2683,    0 },
+    { 'o',  1, 2684,    0 }, { 's',  1, 2685,    0 }, { 'v',  0, 2686, 1504 }, { 'c',  1, 2686,    0 },
+    { 'l',  1, 2687,    0 }, { 'o',  1, 2688,    0 }, { 'i',  2, 2689,    0 }, { 'm',  1, 2691,    0 },
+    { 'b',  1, 2692,    0 }, { 'r',  3, 2693, 1513 }, { 'y',  0, 2696, 1519 }, { 'r',  5, 2696,    0 },
+    { 'r',  0, 2701, 1525 }, { 'i',  1, 2701, 1526 }, { 'm',  1, 2702,    0 }, { 'o',  1, 2703,    0 },
+    { 't',  1, 2704,    0 }, { 'v',  0, 2705, 1532 }, { 'a',  1, 2705,    0 }, { 'u',  1, 2706,    0 },
+    { 'i',  1, 2707,    0 }, { 'p',  1, 2708,    0 }, { 'u',  1, 2709,    0 }, { 'E',  0, 2710, 1551 },
+    { 'a',  1, 2710,    0 }, { 'c',  1, 2711,    0 }, { 'e',  1, 2712, 1554 }, { 'i',  1, 2713,    0 },
+    { 'n',  3, 2714,    0 }, { 'o',  3, 2717,    0 }, { 's',  1, 2720,    0 }, { 'u',  1, 2721,    0 },
+    { 'c',  1, 2722,    0 }, { 'i',  0, 2723, 1577 }, { 'n',  1, 2723,    0 }, { 'r',  0, 2724, 1579 },
+    { 'n',  1, 2724,    0 }, { 'p',  1, 2725,    0 }, { 'r',  1, 2726,    0 }, { 'c',  1, 2727,    0 },
+    { 'a',  1, 2728,    0 }, { 'e',  1, 2729,    0 }, { 'o',  1, 2730,    0 }, { 'a',  1, 2731,    0 },
+    { 'r',  1, 2732,    0 }, { 't',  1, 2733,    0 }, { 'a',  1, 2734,    0 }, { 'a',  1, 2735,    0 },
+    { 'c',  1, 2736,    0 }, { 'd',  1, 2737,    0 }, { 'e',  1, 2738,    0 }, { 'n',  1, 2739,    0 },
+    { 'q',  1, 2740,    0 }, { 'r',  1, 2741,    0 }, { 't',  2, 2742,    0 }, { 'a',  1, 2744,    0 },
+    { 'b',  1, 2745,    0 }, { 'r',  2, 2746,    0 }, { 'a',  1, 2748,    0 }, { 'e',  2, 2749,    0 },
+    { 'u',  1, 2751,    0 }, { 'y',  0, 2752, 1628 }, { 'c',  1, 2752,    0 }, { 'l',  1, 2753,    0 },
+    { 'q',  1, 2754,    0 }, { 's',  1, 2755,    0 }, { 'a',  1, 2756,    0 }, { 'c',  1, 2757,    0 },
+    { 'g',  0, 2758, 1639 }, { 'i',  1, 2758,    0 }, { 'l',  1, 2759,    0 }, { 'r',  0, 2760, 1642 },
+    { 'a',  1, 2760,    0 }, { 'o',  1, 2761, 1646 }, { 'g',  1, 2762,    0 }, { 'n',  1, 2763,    0 },
+    { 's',  1, 2764,    0 }, { 'a',  1, 2765,    0 }, { 'h',  1, 2766,    0 }, { 'm',  0, 2767, 1661 },
+    { 'o',  1, 2767,    0 }, { 'm',  1, 2768,    0 }, { 'a',  2, 2769,    0 }, { 'b',  1, 2771,    0 },
+    { 'p',  3, 2772,    0 }, { 't',  1, 2775,    0 }, { 'a',  1, 2776,    0 }, { 'p',  1, 2777,    0 },
+    { 'a',  1, 2778,    0 }, { 'a',  1, 2779,    0 }, { 'c',  1, 2780,    0 }, { 'h',  0, 2781, 1678 },
+    { 'q',  2, 2781,    0 }, { 'h',  1, 2783,    0 }, { 'i',  1, 2784,    0 }, { 'r',  1, 2785,    0 },
+    { 'l',  1, 2786,    0 }, { 'c',  1, 2787,    0 }, { 'q',  1, 2788,    0 }, { 'E',  0, 2789, 1693 },
+    { 'a',  2, 2789,    0 }, { 'c',  1, 2791,    0 }, { 'e',  1, 2792, 1697 }, { 'i',  1, 2793,    0 },
+    { 'n',  3, 2794,    0 }, { 'p',  1, 2797,    0 }, { 's',  1, 2798,    0 }, { 'y',  0, 2799, 1705 },
+    { 'o',  1, 2799,    0 }, { 'A',  1, 2800,    0 }, { 'a',  1, 2801,    0 }, { 'c',  1, 2802,    0 },
+    { 'm',  1, 2803,    0 }, { 's',  1, 2804,    0 }, { 't',  1, 2805,    0 }, { 'x',  1, 2806,    0 },
+    { 'r',  1, 2807, 1719 }, { 'a',  1, 2808,    0 }, { 'c',  2, 2809,    0 }, { 'o',  1, 2811,    0 },
+    { 'y',  0, 2812, 1726 }, { 'g',  1, 2812,    0 }, { 'm',  7, 2813, 1730 }, { 'a',  1, 2820,    0 },
+    { 'a',  2, 2821,    0 }, { 'e',  1, 2823,    0 }, { 'i',  2, 2824,    0 }, { 't',  1, 2826, 1747 },
+    { 'f',  1, 2827,    0 }, { 'l',  1, 2828, 1750 }, { 'p',  1, 2829,    0 }, { 'a',  2, 2830,    0 },
+    { 'c',  2, 2832,    0 }, { 's',  1, 2834,    0 }, { 'u',  2, 2835, 1767 }, { 'a',  1, 2837,    0 },
+    { 'c',  1, 2838,    0 }, { 'e',  1, 2839,    0 }, { 'm',  1, 2840,    0 }, { 't',  1, 2841,    0 },
+    { 'a',  1, 2842,    0 }, { 'r',  2, 2843,    0 }, { 'b',  8, 2845, 1781 }, { 'c',  1, 2853,    0 },
+    { 'm',  0, 2854, 1807 }, { 'n',  1, 2854,    0 }, { 'p', 12, 2855, 1809 }, { 'A',  1, 2867,    0 },
+    { 'a',  1, 2868,    0 }, { 'n',  1, 2869,    0 }, { 'l',  1, 2870,    0 }, { 'r',  1, 2871,    0 },
+    { 'u',  0, 2872, 1840 }, { 'r',  1, 2872,    0 }, { 'a',  1, 2873,    0 }, { 'e',  1, 2874,    0 },
+    { 'y',  0, 2875, 1844 }, { 'o',  1, 2875,    0 }, { 'l',  1, 2876,    0 }, { 'r',  0, 2877, 1847 },
+    { 'e',  2, 2877,    0 }, { 'i',  2, 2879,    0 }, { 'k',  2, 2881,    0 }, { 'o',  1, 2883,    0 },
+    { 'l',  1, 2884,    0 }, { 'm',  1, 2885,    0 }, { 'n',  1, 2886,    0 }, { 'e',  1, 2887,    0 },
+    { 'p',  3, 2888, 1866 }, { 's',  1, 2891,    0 }, { 'r',  1, 2892,    0 }, { 'a',  1, 2893,    0 },
+    { 'i',  7, 2894,    0 }, { 'p',  1, 2901,    0 }, { 'c',  2, 2902,    0 }, { 'h',  1, 2904,    0 },
+    { 't',  1, 2905,    0 }, { 'i',  1, 2906,    0 }, { 'o',  1, 2907,    0 }, { 'r',  1, 2908,    0 },
+    { 'a',  1, 2909,    0 }, { 'c',  1, 2910,    0 }, { 'r',  1, 2911,    0 }, { 'r',  2, 2912,    0 },
+    { 'i',  1, 2914,    0 }, { 'y',  0, 2915, 1902 }, { 'a',  1, 2915,    0 }, { 'b',  1, 2916,    0 },
+    { 'h',  1, 2917,    0 }, { 'i',  1, 2918,    0 }, { 'r',  0, 2919, 1907 }, { 'r',  1, 2919,    0 },
+    { 'a',  1, 2920,    0 }, { 'b',  1, 2921,    0 }, { 'c',  2, 2922,    0 }, { 't',  1, 2924,    0 },
+    { 'a',  1, 2925,    0 }, { 'l',  0, 2926, 1917 }, { 'g',  1, 2926,    0 }, { 'p',  1, 2927,    0 },
+    { 'a',  1, 2928,    0 }, { 'd',  1, 2929,    0 }, { 'h',  1, 2930,    0 }, { 'l',  1, 2931,    0 },
+    { 's',  1, 2932,    0 }, { 'u',  1, 2933,    0 }, { 'c',  2, 2934,    0 }, { 'i',  1, 2936,    0 },
+    { 't',  1, 2937,    0 }, { 'c',  1, 2938,    0 }, { 'd',  1, 2939,    0 }, { 'i',  1, 2940,    0 },
+    { 'r',  1, 2941,    0 }, { 'a',  1, 2942,    0 }, { 'm',  1, 2943,    0 }, { 'a',  1, 2944,    0 },
+    { 'r',  1, 2945,    0 }, { 'a',  1, 2946,    0 }, { 'a',  1, 2947,    0 }, { 'n',  1, 2948,    0 },
+    { 'r',  7, 2949,    0 }, { 'y',  0, 2956, 1959 }, { 'a',  1, 2956,    0 }, { 'e',  2, 2957, 1961 },
+    { 'l',  1, 2959,    0 }, { 'r',  2, 2960,    0 }, { 'r',  0, 2962, 1967 }, { 't',  1, 2962,    0 },
+    { 'p',  1, 2963,    0 }, { 'r',  1, 2964,    0 }, { 't',  1, 2965,    0 }, { 'c',  1, 2966,    0 },
+    { 'i',  1, 2967,    0 }, { 'i',  1, 2968,    0 }, { 'd',  2, 2969,    0 }, { 'i',  1, 2971,    0 },
+    { 'r',  0, 2972, 1979 }, { 'p',  1, 2972,    0 }, { 'e',  1, 2973,    0 }, { 'c',  1, 2974,    0 },
+    { 'a',  1, 2975,    0 }, { 'i',  1, 2976,    0 }, { 'u',  1, 2977,    0 }, { 't',  1, 2978,    0 },
+    { 'r',  0, 2979, 1989 }, { 'A',  1, 2979,    0 }, { 'a',  1, 2980,    0 }, { 'A',  1, 2981,    0 },
+    { 'a',  1, 2982,    0 }, { 'a',  1, 2983,    0 }, { 'i',  1, 2984,    0 }, { 'd',  1, 2985,    0 },
+    { 'p',  2, 2986,    0 }, { 't',  1, 2988,    0 }, { 'A',  1, 2989,    0 }, { 'a',  1, 2990,    0 },
+    { 'c',  1, 2991,    0 }, { 'q',  1, 2992,    0 }, { 'p',  1, 2993,    0 }, { 't',  1, 2994,    0 },
+    { 'e',  1, 2995,    0 }, { 'e',  1, 2996,    0 }, { 'c',  2, 2997,    0 }, { 'i',  1, 2999,    0 },
+    { 'y',  0, 3000, 2012 }, { 'n',  0, 3000, 2013 }, { 'r',  0, 3000, 2014 }, { 'c',  1, 3000,    0 },
+    { 'p',  1, 3001,    0 }, { 'c',  1, 3002,    0 }, { 'c',  1, 3003,    0 }, { 'm',  1, 3004,    0 },
+    { 'c',  1, 3005,    0 }, { 'a',  1, 3006,    0 }, { 'y',  0, 3007, 2022 }, { 'o',  1, 3007,    0 },
+    { 'e',  1, 3008,    0 }, { 't',  1, 3009,    0 }, { 'r',  0, 3010, 2026 }, { 'c',  1, 3010,    0 },
+    { 'g',  1, 3011,    0 }, { 'p',  1, 3012,    0 }, { 'c',  1, 3013,    0 }, { 'j',  0, 3014, 2031 },
+    { 'n',  1, 3014,    0 }, { 'i',  1, 3015,    0 }, { 'u',  1, 3016,    0 }, { 'e',  1, 3017,    0 },
+    { 'r',  1, 3018,    0 }, { 'a',  1, 3019,    0 }, { 'h',  1, 3020,    0 }, { 'c',  1, 3021,    0 },
+    { 'o',  1, 3022,    0 }, { 'f',  0, 3023,   13 }, { 'l',  1, 3023,    0 }, { 'n',  1, 3024,    0 },
+    { 'r',  0, 3025,   16 }, { 'i',  1, 3025,    0 }, { 'l',  1, 3026,    0 }, { 'l',  0, 3027,   19 },
+    { 'k',  1, 3027,    0 }, { 'v',  0, 3028,   21 }, { 'w',  1, 3028,    0 }, { 'a',  1, 3029,    0 },
+    { 'n',  1, 3030,    0 }, { 'a',  0, 3031,   26 }, { 'f',  0, 3031,   28 }, { 'v',  1, 3031,    0 },
+    { 'r',  0, 3032,   30 }, { 'p',  1, 3032,    0 }, { 'y',  0, 3033,   32 }, { 'Y',  0, 3033,   33 },
+    { 'u',  1, 3033,    0 }, { 'i',  1, 3034,    0 }, { 'l',  1, 3035,    0 }, { 'r',  1, 3036,    0 },
+    { 'd',  1, 3037,    0 }, { 'r',  1, 3038,    0 }, { 'n',  1, 3039,    0 }, { 't',  0, 3040,   42 },
+    { 'i',  1, 3040,    0 }, { 't',  1, 3041,    0 }, { 'c',  1, 3042,    0 }, { 'c',  1, 3043,    0 },
+    { 's',  1, 3044,    0 }, { 'o',  1, 3045,    0 }, { 'g',  1, 3046,    0 }, { 'i',  1, 3047,    0 },
+    { 't',  1, 3048,    0 }, { 'f',  0, 3049,   59 }, { 'r',  1, 3049,    0 }, { 'n',  1, 3050,    0 },
+    { 's',  1, 3051,    0 }, { 'r',  0, 3052,   63 }, { 'C',  1, 3052,    0 }, { 't',  1, 3053,    0 },
+    { 'y',  0, 3054,   68 }, { 'y',  0, 3054,   69 }, { 'y',  0, 3054,   70 }, { 'g',  1, 3054,    0 },
+    { 'r',  0, 3055,   72 }, { 'h',  1, 3055,    0 }, { 'r',  1, 3056,    0 }, { 't',  1, 3057,    0 },
+    { 'c',  1, 3058,    0 }, { 'm',  1, 3059,    0 }, { 'f',  1, 3060,    0 }, { 'f',  0, 3061,   86 },
+    { 'D',  1, 3061,    0 }, { 'E',  1, 3062,    0 }, { 'b',  1, 3063,    0 }, { 'n',  6, 3064,    0 },
+    { 'r',  0, 3070,  118 }, { 'r',  1, 3070,    0 }, { 'u',  1, 3071,    0 }, { 'r',  1, 3072,    0 },
+    { 'r',  1, 3073,    0 }, { 't',  0, 3074,  126 }, { 'a',  1, 3074,    0 }, { 'm',  1, 3075,    0 },
+    { 'c',  1, 3076,    0 }, { 't',  1, 3077,    0 }, { 'o',  1, 3078,    0 }, { 'f',  0, 3079,  134 },
+    { 'i',  1, 3079,    0 }, { 'a',  1, 3080,    0 }, { 'i',  1, 3081,    0 }, { 'r',  0, 3082,  139 },
+    { 'm',  0, 3082,  140 }, { 'l',  0, 3082,  142 }, { 's',  1, 3082,    0 }, { 'o',  1, 3083,    0 },
+    { 'l',  1, 3084,    0 }, { 'f',  0, 3085,  149 }, { 'A',  1, 3085,    0 }, { 'r',  1, 3086,    0 },
+    { 'r',  0, 3087,  152 }, { 'y',  0, 3087,  153 }, { 'm',  1, 3087,    0 }, { 'e',  1, 3088,    0 },
+    { 'd',  1, 3089,    0 }, { 'r',  1, 3090,    0 }, { 't',  0, 3091,  161 }, { 'f',  0, 3091,  164 },
+    { 'a',  1, 3091,    0 }, { 'r',  0, 3092,  172 }, { 'D',  1, 3092,    0 }, { 'e',  1, 3093,    0 },
+    { 'r',  1, 3094,    0 }, { 'b',  1, 3095,    0 }, { 'f',  0, 3096,  180 }, { 'i',  1, 3096,    0 },
+    { 'r',  0, 3097,  182 }, { 'r',  1, 3097,    0 }, { 'p',  2, 3098,    0 }, { 'y',  0, 3100,  186 },
+    { 'i',  1, 3100,    0 }, { 'y',  0, 3101,  188 }, { 'u',  1, 3101,    0 }, { 'r',  1, 3102,    0 },
+    { 't',  0, 3103,  192 }, { 'a',  1, 3103,    0 }, { 'c',  1, 3104,    0 }, { 'g',  1, 3105,    0 },
+    { 'l',  1, 3106,    0 }, { 'e',  2, 3107,    0 }, { 'i',  1, 3109,    0 }, { 'o',  1, 3110,    0 },
+    { 'f',  0, 3111,  205 }, { 'a',  0, 3111,  206 }, { 'r',  0, 3111,  207 }, { 'l',  1, 3111,    0 },
+    { 'c',  1, 3112,    0 }, { 'l',  0, 3113,  210 }, { 'r',  1, 3113,    0 }, { 'f',  0, 3114,  214 },
+    { 'r',  0, 3114,  215 }, { 'r',  1, 3114,    0 }, { 'c',  1, 3115,    0 }, { 'y',  0, 3116,  218 },
+    { 'y',  0, 3116,  219 }, { 'p',  1, 3116,    0 }, { 'd',  1, 3117,    0 }, { 'f',  0, 3118,  224 },
+    { 'r',  0, 3118,  225 }, { 'y',  0, 3118,  226 }, { 'u',  1, 3118,    0 }, { 'b',  1, 3119,    0 },
+    { 'g',  0, 3120,  230 }, { 'l',  1, 3120,    0 }, { 'r',  0, 3121,  232 }, { 'r',  1, 3121,    0 },
+    { 'd',  1, 3122,    0 }, { 't', 10, 3123,    0 }, { 's',  6, 3133,    0 }, { 'f',  1, 3139,    0 },
+    { 'd',  1, 3140,    0 }, { 'g',  4, 3141,    0 }, { 'f',  0, 3145,  278 }, { 'e',  1, 3145,    0 },
+    { 'r',  0, 3146,  281 }, { 'r',  1, 3146,    0 }, { 'i',  1, 3147,    0 }, { 'l',  1, 3148,    0 },
+    { 'u',  1, 3149,    0 }, { 'f',  0, 3150,  291 }, { 'r',  0, 3150,  292 }, { 'y',  0, 3150,  294 },
+    { 'u',  1, 3150,    0 }, { 'r',  1, 3151,    0 }, { 'd',  1, 3152,    0 }, { 'a',  1, 3153,    0 },
+    { 't',  1, 3154,    0 }, { 'L',  1, 3155,    0 }, { 'r',  1, 3156,    0 }, { 'B',  1, 3157,    0 },
+    { 'f',  0, 3158,  309 }, { 'C',  2, 3158,    0 }, { 'D',  1, 3160,    0 }, { 'E',  3, 3161,    0 },
+    { 'G',  1, 3164,    0 }, { 'L',  1, 3165,    0 }, { 'P',  1, 3166,    0 }, { 'R',  2, 3167,    0 },
+    { 'S',  2, 3169,    0 }, { 'T',  1, 3171,    0 }, { 'V',  1, 3172,    0 }, { 'r',  0, 3173,  343 },
+    { 'l',  1, 3173,    0 }, { 'i',  1, 3174,    0 }, { 'u',  1, 3175,    0 }, { 'r',  1, 3176,    0 },
+    { 'l',  1, 3177,    0 }, { 'a',  1, 3178,    0 }, { 'c',  1, 3179,    0 }, { 'g',  1, 3180,    0 },
+    { 'c',  1, 3181,    0 }, { 'f',  0, 3182,  356 }, { 'n',  1, 3182,    0 }, { 'r',  0, 3183,  360 },
+    { 'a',  1, 3183,    0 }, { 'l',  1, 3184,    0 }, { 'm',  1, 3185,    0 }, { 'l',  0, 3186,  364 },
+    { 'r',  2, 3186,    0 }, { 't',  1, 3188,    0 }, { 's',  1, 3189,    0 }, { 'n',  1, 3190,    0 },
+    { 'f',  0, 3191,  376 }, { 'c',  1, 3191,    0 }, { 'm',  1, 3192,    0 }, { 'd',  1, 3193,    0 },
+    { 'p',  1, 3194,    0 }, { 'r',  0, 3195,  386 }, { 'T',  0, 3195,  388 }, { 'f',  0, 3195,  390 },
+    { 'r',  0, 3195,  391 }, { 'r',  1, 3195,    0 }, { 'u',  1, 3196,    0 }, { 'g',  0, 3197,  395 },
+    { 'r',  1, 3197,  396 }, { 'r',  1, 3198,    0 }, { 'd',  1, 3199,    0 }, { 'e',  1, 3200,    0 },
+    { 'h',  1, 3201,    0 }, { 'f',  0, 3202,  430 }, { 'n',  1, 3202,    0 }, { 'g',  1, 3203,    0 },
+    { 'r',  0, 3204,  433 }, { 'e',  1, 3204,    0 }, { 'H',  1, 3205,    0 }, { 'y',  0, 3206,  437 },
+    { 'T',  1, 3206,    0 }, { 'u',  1, 3207,    0 }, { 'r',  1, 3208,    0 }, { 'd',  1, 3209,    0 },
+    { 'r',  1, 3210,    0 }, { 'r',  1, 3211,    0 }, { 'm',  1, 3212,    0 }, { 'l',  1, 3213,    0 },
+    { 'f',  0, 3214,  452 }, { 't',  0, 3214,  453 }, { 'a',  1, 3214,    0 }, { 'r',  0, 3215,  461 },
+    { 'r',  0, 3215,  462 }, { 's',  1, 3215,    0 }, { 'c',  1, 3216,    0 }, { 'h',  1, 3217,    0 },
+    { 'e',  1, 3218,    0 }, { 's',  1, 3219,    0 }, { 'R',  1, 3220,    0 }, { 'D',  1, 3221,    0 },
+    { 'c',  1, 3222,    0 }, { 'y',  0, 3223,  479 }, { 'r',  1, 3223,    0 }, { 'd',  1, 3224,    0 },
+    { 'r',  1, 3225,    0 }, { 't',  1, 3226,    0 }, { 'n',  1, 3227,    0 }, { 'd',  1, 3228,    0 },
+    { 'f',  0, 3229,  493 }, { 'p',  1, 3229,    0 }, { 'r',  0, 3230,  495 }, { 'r',  1, 3230,    0 },
+    { 'u',  1, 3231,    0 }, { 'r',  1, 3232,  498 }, { 'c',  1, 3233,    0 }, { 'e',  1, 3234,    0 },
+    { 'r',  1, 3235,    0 }, { 'l',  1, 3236,    0 }, { 'a',  1, 3237,    0 }, { 'c',  1, 3238,    0 },
+    { 'e',  1, 3239,    0 }, { 'o',  1, 3240,    0 }, { 'o',  1, 3241,    0 }, { 'f',  0, 3242,  515 },
+    { 'r',  1, 3242,    0 }, { 'o',  1, 3243,    0 }, { 'q',  1, 3244,    0 }, { 'e',  1, 3245,    0 },
+    { 'r',  1, 3246,    0 }, { 'o',  1, 3247,    0 }, { 'e',  1, 3248,    0 }, { 'i',  1, 3249,  527 },
+    { 'n',  1, 3250,    0 }, { 'r',  0, 3251,  530 }, { 'l',  1, 3251,    0 }, { 'l',  0, 3252,  532 },
+    { 's',  1, 3252,    0 }, { 'r',  0, 3253,  534 }, { 's',  1, 3253,    0 }, { 'b',  1, 3254,    0 },
+    { 't',  1, 3255,  540 }, { 'y',  1, 3256,    0 }, { 'f',  0, 3257,  547 }, { 'r',  0, 3257,  548 },
+    { 'a',  1, 3257,    0 }, { 'r',  1, 3258,    0 }, { 'g',  1, 3259,    0 }, { 'f',  0, 3260,  553 },
+    { 'r',  0, 3260,  554 }, { 'f',  0, 3260,  557 }, { 'r',  0, 3260,  558 }, { 'y',  0, 3260,  559 },
+    { 'y',  0, 3260,  560 }, { 'y',  0, 3260,  561 }, { 'u',  1, 3260,    0 }, { 'r',  1, 3261,    0 },
+    { 'f',  0, 3262,  566 }, { 'r',  0, 3262,  567 }, { 'l',  0, 3262,  568 }, { 'y',  0, 3262,  569 },
+    { 'u',  1, 3262,    0 }, { 'r',  1, 3263,    0 }, { 't',  0, 3264,  573 }, { 'o',  1, 3264,    0 },
+    { 'a',  0, 3265,  575 }, { 'f',  0, 3265,  577 }, { 'r',  0, 3265,  578 }, { 'u',  1, 3265,    0 },
+    { 'e',  1, 3266,    0 }, { 'r',  1, 3267,    0 }, { 't',  1, 3268,    0 }, { 'i',  1, 3269,    0 },
+    { 'a',  1, 3270,    0 }, { 'f',  1, 3271,    0 }, { 'p',  1, 3272,    0 }, { 'h',  1, 3273,    0 },
+    { 'c',  1, 3274,    0 }, { 'l',  1, 3275,    0 }, { 'a',  1, 3276,    0 }, { 'd',  0, 3277,  598 },
+    { 's',  1, 3277,    0 }, { 'v',  0, 3278,  600 }, { 'e',  0, 3278,  602 }, { 'l',  1, 3278,    0 },
+    { 'm',  1, 3279,    0 }, { 'r',  1, 3280,    0 }, { 's',  2, 3281,    0 }, { 'z',  1, 3283,    0 },
+    { 'o',  1, 3284,    0 }, { 'f',  0, 3285,  620 }, { 'c',  1, 3285,    0 }, { 'd',  0, 3286,  625 },
+    { 's',  0, 3286,  626 }, { 'r',  1, 3286,    0 }, { 'n',  1, 3287,    0 }, { 'r',  0, 3288,  630 },
+    { 'm',  1, 3288,    0 }, { 'l',  1, 3289,    0 }, { 'l',  0, 3290,  635 }, { 'o',  1, 3290,    0 },
+    { 'n',  1, 3291,    0 }, { 't',  0, 3292,  638 }, { 'k',  4, 3292,    0 }, { 'v',  1, 3296,    0 },
+    { 'w',  1, 3297,    0 }, { 'k',  1, 3298,  647 }, { 'n',  1, 3299,    0 }, { 'u',  1, 3300,    0 },
+    { 'a',  1, 3301,    0 }, { 'p',  1, 3302,    0 }, { 's',  1, 3303,    0 }, { 'n',  1, 3304,    0 },
+    { 'a',  0, 3305,  657 }, { 'h',  0, 3305,  658 }, { 'w',  1, 3305,    0 }, { 'c',  3, 3306,    0 },
+    { 'o',  3, 3309,    0 }, { 's',  2, 3312,    0 }, { 't',  1, 3314,    0 }, { 'u',  1, 3315,    0 },
+    { 'v',  1, 3316,    0 }, { 'w',  1, 3317,    0 }, { 'r',  1, 3318,    0 }, { 'c',  1, 3319,    0 },
+    { 'n',  1, 3320,    0 }, { '1',  2, 3321,    0 }, { '3',  1, 3323,    0 }, { 'c',  1, 3324,    0 },
+    { 't',  0, 3325,  686 }, { 'f',  0, 3325,  687 }, { 't',  1, 3325,    0 }, { 't',  1, 3326,    0 },
+    { 'D',  4, 3327,    0 }, { 'H',  4, 3331,  695 }, { 'U',  4, 3335,    0 }, { 'V',  6, 3339,  704 },
+    { 'b',  1, 3345,    0 }, { 'd',  4, 3346,    0 }, { 'h',  4, 3350,  716 }, { 'm',  1, 3354,    0 },
+    { 'p',  1, 3355,    0 }, { 't',  1, 3356,    0 }, { 'u',  4, 3357,    0 }, { 'v',  6, 3361,  728 },
+    { 'i',  1, 3367,    0 }, { 'v',  1, 3368,    0 }, { 'b',  1, 3369,    0 }, { 'r',  0, 3370,  738 },
+    { 'm',  1, 3370,    0 }, { 'm',  1, 3371,  740 }, { 'l',  2, 3372,  742 }, { 'l',  1, 3374,  745 },
+    { 'p',  2, 3375,  747 }, { 'u',  1, 3377,    0 }, { 'a',  1, 3378,    0 }, { 'b',  1, 3379,    0 },
+    { 'c',  2, 3380,    0 }, { 'd',  1, 3382,    0 }, { 'e',  1, 3383,    0 }, { 'o',  1, 3384,    0 },
+    { 'p',  1, 3385,    0 }, { 'r',  1, 3386,    0 }, { 'd',  1, 3387,    0 }, { 'r',  1, 3388,    0 },
+    { 'p',  1, 3389,    0 }, { 't',  0, 3390,  766 }, { 'i',  1, 3390,    0 }, { 'p',  1, 3391,    0 },
+    { 't',  1, 3392,  769 }, { 'y',  0, 3393,  772 }, { 'c',  1, 3393,    0 }, { 'E',  0, 3394,  777 },
+    { 'c',  2, 3394,  778 }, { 'e',  0, 3396,  787 }, { 'f',  1, 3396,    0 }, { 'm',  1, 3397,    0 },
+    { 's',  1, 3398,    0 }, { 'b',  1, 3399,    0 }, { 'o',  1, 3400,    0 }, { 'm',  1, 3401,    0 },
+    { 'p',  2, 3402,  798 }, { 'g',  1, 3404,  802 }, { 'i',  1, 3405,    0 }, { 'f',  0, 3406,  805 },
+    { 'r',  1, 3406,    0 }, { 'y',  1, 3407,  807 }, { 'r',  1, 3408,    0 }, { 's',  1, 3409,    0 },
+    { 'r',  0, 3410,  811 }, { 'b',  1, 3410,  812 }, { 'p',  1, 3411,  814 }, { 'o',  1, 3412,    0 },
+    { 'a',  1, 3413,    0 }, { 'p',  1, 3414,    0 }, { 's',  1, 3415,    0 }, { 'a',  1, 3416,    0 },
+    { 'b',  1, 3417,    0 }, { 'c',  2, 3418,    0 }, { 'd',  1, 3420,    0 }, { 'o',  1, 3421,    0 },
+    { 'a',  1, 3422,    0 }, { 'l',  1, 3423,    0 }, { 'r',  1, 3424,    0 }, { 'v',  1, 3425,    0 },
+    { 'e',  1, 3426,    0 }, { 'e',  1, 3427,    0 }, { 'o',  1, 3428,    0 }, { 'n',  1, 3429,    0 },
+    { 'c',  1, 3430,    0 }, { 'r',  0, 3431,  843 }, { 'r',  0, 3431,  844 }, { 'g',  1, 3431,    0 },
+    { 'e',  1, 3432,    0 }, { 'r',  0, 3433,  847 }, { 'h',  1, 3433,  848 }, { 'a',  1, 3434,    0 },
+    { 'a',  1, 3435,    0 }, { 'r',  1, 3436,    0 }, { 'g',  1, 3437,    0 }, { 'r',  1, 3438,    0 },
+    { 't',  1, 3439,    0 }, { 't',  1, 3440,    0 }, { 'p',  1, 3441,    0 }, { 's',  1, 3442,    0 },
+    { 'r',  2, 3443,    0 }, { 'm',  2, 3445,  865 }, { 'a',  1, 3447,    0 }, { 'i',  1, 3448,    0 },
+    { 'i',  1, 3449,    0 }, { 'o',  1, 3450,    0 }, { 'y',  0, 3451,  876 }, { 'o',  1, 3451,    0 },
+    { 'r',  1, 3452,    0 }, { 'l',  1, 3453,    0 }, { 'f',  0, 3454,  880 }, { 'e',  1, 3454,    0 },
+    { 'm',  1, 3455,    0 }, { 'p',  1, 3456,    0 }, { 's',  1, 3457,    0 }, { 'b',  1, 3458,    0 },
+    { 'n',  3, 3459,    0 }, { 'k',  1, 3462,    0 }, { 'o',  1, 3463,    0 }, { 'r',  1, 3464,    0 },
+    { 'r',  0, 3465,  895 }, { 'y',  0, 3465,  896 }, { 'l',  0, 3465,  897 }, { 'r',  1, 3465,    0 },
+    { 'o',  1, 3466,    0 }, { 'i',  1, 3467,  900 }, { 'r',  1, 3468,    0 }, { 'a',  1, 3469,    0 },
+    { 'n',  1, 3470,    0 }, { 'y',  0, 3471,  905 }, { 'g',  1, 3471,    0 }, { 'o',  1, 3472,    0 },
+    { 't',  0, 3473,  908 }, { 'u',  1, 3473,    0 }, { 't',  1, 3474,    0 }, { 'r',  1, 3475,    0 },
+    { 'r',  1, 3476,  912 }, { 'l',  1, 3477,    0 }, { 't',  0, 3478,  916 }, { 'o',  1, 3478,    0 },
+    { 'a',  1, 3479,    0 }, { 'd',  1, 3480,    0 }, { 'n',  1, 3481,    0 }, { 'd',  1, 3482,    0 },
+    { 'c',  1, 3483,    0 }, { 't',  1, 3484,    0 }, { 'p',  1, 3485,  933 }, { 'p',  0, 3486,  937 },
+    { 'o',  1, 3486,    0 }, { 'f',  0, 3487,  939 }, { 'r',  1, 3487,  940 }, { 'u',  1, 3488,    0 },
+    { 'i',  2, 3489,  943 }, { 'i',  1, 3491,    0 }, { 'o',  1, 3492,    0 }, { 'i',  1, 3493,    0 },
+    { 'l',  1, 3494,    0 }, { 'a',  1, 3495,    0 }, { 'e',  1, 3496,    0 }, { 'i',  1, 3497,    0 },
+    { 'p',  1, 3498,    0 }, { 'o',  1, 3499,    0 }, { 'r',  1, 3500,    0 }, { 'r',  0, 3501,  958 },
+    { 'o',  1, 3501,    0 }, { 'm',  0, 3502,  960 }, { 'l',  0, 3502,  963 }, { 'o',  0, 3502,  964 },
+    { 'l',  0, 3502,  965 }, { 's',  1, 3502,    0 }, { 'e',  1, 3503,    0 }, { 'o',  1, 3504,    0 },
+    { 'l',  1, 3505,    0 }, { 'a',  1, 3506,    0 }, { 'l',  1, 3507,    0 }, { 'i',  1, 3508,    0 },
+    { 'l',  1, 3509,    0 }, { 'i',  1, 3510,    0 }, { 't',  0, 3511,  977 }, { 'i',  1, 3511,    0 },
+    { 'n',  1, 3512,    0 }, { 'f',  0, 3513,  980 }, { 'f',  0, 3513,  981 }, { 'a',  1, 3513,    0 },
+    { 'k',  1, 3514,  983 }, { 'r',  1, 3515,    0 }, { 'c',  6, 3516,    0 }, { 's',  1, 3522,    0 },
+    { 'w',  1, 3523,    0 }, { 'r',  0, 3524, 1003 }, { 'u',  1, 3524,    0 }, { 'm',  1, 3525,    0 },
+    { 'e',  1, 3526,    0 }, { 'r',  1, 3527,    0 }, { 't',  0, 3528, 1013 }, { 'q',  0, 3528, 1017 },
+    { 's',  1, 3528,    0 }, { 'c',  1, 3529,    0 }, { 'd',  1, 3530,    0 }, { 'l',  1, 3531,    0 },
+    { 'e',  1, 3532,    0 }, { 'y',  0, 3533, 1029 }, { 'p',  1, 3533, 1035 }, { 'q',  1, 3534, 1038 },
+    { 'i',  1, 3535,    0 }, { 'f',  0, 3536, 1041 }, { 'v',  1, 3536,    0 }, { 'r',  0, 3537, 1043 },
+    { 'm',  2, 3537, 1044 }, { 'c',  0, 3539, 1048 }, { 'i',  1, 3539,    0 }, { 'o',  1, 3540,    0 },
+    { 'P',  1, 3541,    0 }, { 'u',  1, 3542,    0 }, { 'a',  2, 3543,    0 }, { 'd',  1, 3545,    0 },
+    { 'e',  1, 3546,    0 }, { 'l',  1, 3547,    0 }, { 's',  1, 3548,    0 }, { 'r',  0, 3549, 1060 },
+    { 'r',  1, 3549,    0 }, { 'f',  0, 3550, 1062 }, { 'i',  1, 3550,    0 }, { 'd',  1, 3551,    0 },
+    { 'r',  2, 3552, 1065 }, { 'r',  0, 3554, 1068 }, { 'r',  1, 3554,    0 }, { 'r',  1, 3555,    0 },
+    { 'l',  1, 3556,    0 }, { 'c',  1, 3557,    0 }, { 'e',  1, 3558,    0 }, { 'w',  1, 3559,    0 },
+    { 'r',  1, 3560,    0 }, { 't',  1, 3561,    0 }, { 'k',  2, 3562,    0 }, { 'f',  0, 3564, 1081 },
+    { 'b',  1, 3564,    0 }, { 'r',  0, 3565, 1083 }, { 'a',  1, 3565,    0 }, { 'r',  1, 3566,    0 },
+    { 'u',  1, 3567,    0 }, { 'h',  1, 3568,    0 }, { 'u',  1, 3569,    0 }, { 'r',  1, 3570,    0 },
+    { 'y',  0, 3571, 1092 }, { 'c',  1, 3571,    0 }, { 'a',  1, 3572,    0 }, { 'i',  1, 3573,    0 },
+    { 'n',  1, 3574,    0 }, { 'f',  1, 3575,    0 }, { 't',  1, 3576,    0 }, { 'i',  1, 3577,    0 },
+    { 'c',  1, 3578,    0 }, { 'g',  3, 3579,    0 }, { 't',  1, 3582,    0 }, { 'f',  0, 3583, 1108 },
+    { 'e',  1, 3583,    0 }, { 'a',  1, 3584,    0 }, { 'i',  1, 3585,    0 }, { 'd',  1, 3586,    0 },
+    { 'c',  1, 3587,    0 }, { 'e',  2, 3588,    0 }, { 'l',  1, 3590,    0 }, { 'p',  1, 3591,    0 },
+    { 'y',  0, 3592, 1121 }, { 'o',  1, 3592,    0 }, { 'f',  0, 3593, 1123 }, { 'a',  0, 3593, 1124 },
+    { 'o',  1, 3593,    0 }, { 'e',  1, 3594,    0 }, { 'r',  0, 3595, 1127 }, { 'n',  4, 3595, 1128 },
+    { 'l',  1, 3599,    0 }, { 'c',  1, 3600,    0 }, { 'l',  0, 3601, 1137 }, { 'r',  1, 3601,    0 },
+    { 't',  1, 3602,    0 }, { 'f',  0, 3603, 1142 }, { 'r',  0, 3603, 1143 }, { 'r',  1, 3603,    0 },
+    { 'c',  1, 3604,    0 }, { 'p',  1, 3605,    0 }, { 'd',  1, 3606,    0 }, { 'e',  1, 3607,    0 },
+    { 'y',  0, 3608, 1152 }, { 'y',  0, 3608, 1153 }, { 'f',  0, 3608, 1154 }, { 'r',  0, 3608, 1155 },
+    { 'r',  1, 3608,    0 }, { 'r',  0, 3609, 1157 }, { 'a',  1, 3609,    0 }, { 'r',  1, 3610,    0 },
+    { 'r',  0, 3611, 1162 }, { 'u',  1, 3611,    0 }, { 'm',  1, 3612,    0 }, { 'r',  1, 3613,    0 },
+    { 'b',  1, 3614,    0 }, { 'g',  2, 3615, 1167 }, { 'u',  1, 3617,    0 }, { 'r',  7, 3618, 1172 },
+    { 'a',  1, 3625,    0 }, { 'e',  0, 3626, 1183 }, { 'r',  1, 3626,    0 }, { 'r',  1, 3627,    0 },
+    { 'a',  1, 3628,    0 }, { 'k',  2, 3629,    0 }, { 'r',  1, 3631,    0 }, { 'd',  1, 3632,    0 },
+    { 'i',  1, 3633,    0 }, { 'b',  0, 3634, 1194 }, { 'a',  0, 3634, 1196 }, { 'u',  1, 3634,    0 },
+    { 'd',  1, 3635,    0 }, { 'u',  1, 3636,    0 }, { 'h',  0, 3637, 1201 }, { 't',  5, 3637,    0 },
+    { 'q',  0, 3642, 1215 }, { 's',  1, 3642,    0 }, { 'c',  1, 3643,    0 }, { 'd',  1, 3644,    0 },
+    { 'g',  1, 3645,    0 }, { 's',  5, 3646,    0 }, { 's',  1, 3651,    0 }, { 'o',  1, 3652,    0 },
+    { 'r',  2, 3653,    0 }, { 'l',  1, 3655,    0 }, { 'y',  0, 3656, 1238 }, { 'r',  1, 3656,    0 },
+    { 'o',  1, 3657,    0 }, { 'a',  1, 3658,    0 }, { 'r',  1, 3659,    0 }, { 'd',  1, 3660,    0 },
+    { 'u',  1, 3661,    0 }, { 'p',  1, 3662, 1248 }, { 'q',  1, 3663, 1251 }, { 'i',  1, 3664,    0 },
+    { 'n',  1, 3665,    0 }, { 'r',  1, 3666,    0 }, { 'r',  1, 3667,    0 }, { 'g',  3, 3668,    0 },
+    { 'p',  1, 3671,    0 }, { 'a',  1, 3672,    0 }, { 'f',  0, 3673, 1264 }, { 'l',  1, 3673,    0 },
+    { 'i',  1, 3674,    0 }, { 'a',  1, 3675,    0 }, { 'b',  1, 3676,    0 }, { 'e',  1, 3677,    0 },
+    { 'f',  0, 3678, 1271 }, { 'r',  1, 3678, 1272 }, { 'r',  1, 3679,    0 }, { 'o',  1, 3680,    0 },
+    { 'a',  1, 3681,    0 }, { 'r',  1, 3682,    0 }, { 'q',  1, 3683,    0 }, { 'r',  0, 3684, 1281 },
+    { 'm',  2, 3684, 1283 }, { 'b',  0, 3686, 1286 }, { 'u',  1, 3686,    0 }, { 'r',  1, 3687,    0 },
+    { 'c',  0, 3688, 1291 }, { 'i',  1, 3688,    0 }, { 'o',  1, 3689,    0 }, { 'r',  1, 3690,    0 },
+    { 'm',  1, 3691,    0 }, { 'a',  1, 3692,    0 }, { 'u',  1, 3693,    0 }, { 'P',  1, 3694,    0 },
+    { 'i',  2, 3695, 1299 }, { 'd',  1, 3697,    0 }, { 'u',  1, 3698,    0 }, { 'o',  1, 3699,    0 },
+    { 'r',  0, 3700, 1305 }, { 'e',  0, 3700, 1306 }, { 't',  1, 3700, 1307 }, { 's',  1, 3701,    0 },
+    { 'k',  1, 3702,    0 }, { 'm',  1, 3703,    0 }, { 's',  1, 3704,    0 }, { 's',  1, 3705,    0 },
+    { 'r',  1, 3706,    0 }, { 'a',  1, 3707,    0 }, { 'c',  1, 3708,    0 }, { 'd',  1, 3709,    0 },
+    { 'u',  1, 3710,    0 }, { 'p',  0, 3711, 1330 }, { 'r',  0, 3711, 1331 }, { 'l',  1, 3711,    0 },
+    { 'e',  1, 3712,    0 }, { 'f',  0, 3713, 1334 }, { 'r',  0, 3713, 1336 }, { 'p',  1, 3713,    0 },
+    { 't',  1, 3714,    0 }, { 'a',  1, 3715,    0 }, { 'f',  1, 3716,    0 }, { 'g',  1, 3717,    0 },
+    { 'a',  1, 3718,    0 }, { 'a',  1, 3719,    0 }, { 'l',  1, 3720,    0 }, { 'u',  1, 3721,    0 },
+    { 'o',  1, 3722,    0 }, { 'p',  1, 3723,    0 }, { 'u',  1, 3724,    0 }, { 'p',  0, 3725, 1354 },
+    { 'p',  0, 3725, 1355 }, { 'r',  1, 3725,    0 }, { 'd',  1, 3726,    0 }, { 'n',  1, 3727,    0 },
+    { 'p',  0, 3728, 1359 }, { 's',  1, 3728,    0 }, { 'r',  1, 3729,    0 }, { 'r',  2, 3730,    0 },
+    { 'u',  1, 3732,    0 }, { 'e',  1, 3733,    0 }, { 'i',  1, 3734,    0 }, { 'q',  0, 3735, 1373 },
+    { 'i',  1, 3735,    0 }, { 'r',  0, 3736, 1376 }, { 'r',  1, 3736,    0 }, { 'r',  1, 3737,    0 },
+    { 'a',  1, 3738,    0 }, { 'd',  0, 3739, 1382 }, { 'y',  0, 3739, 1384 }, { 'r',  1, 3739,    0 },
+    { 'r',  1, 3740,    0 }, { 'r',  0, 3741, 1387 }, { 'f',  1, 3741,    0 }, { 'q',  0, 3742, 1391 },
+    { 's',  1, 3742,    0 }, { 'i',  1, 3743,    0 }, { 'r',  1, 3744,    0 }, { 'd',  0, 3745, 1397 },
+    { 'f',  0, 3745, 1398 }, { 'i',  1, 3745,    0 }, { 'n',  1, 3746,    0 }, { 'r',  1, 3747, 1408 },
+    { 'l',  1, 3748,    0 }, { 'c',  1, 3749,    0 }, { 'e',  1, 3750,    0 }, { 'r',  1, 3751,    0 },
+    { 'r',  1, 3752,    0 }, { 'g',  1, 3753,    0 }, { 'r',  1, 3754,    0 }, { 'c',  1, 3755,    0 },
+    { 'r',  0, 3756, 1421 }, { 'o',  1, 3756,    0 }, { 'm',  1, 3757, 1424 }, { 'i',  1, 3758,    0 },
+    { 'a',  1, 3759,    0 }, { 's',  1, 3760,    0 }, { 'b',  2, 3761, 1431 }, { 'c',  1, 3763,    0 },
+    { 'p',  2, 3764, 1435 }, { 'l',  0, 3766, 1438 }, { 'l',  1, 3766,    0 }, { 'g',  0, 3767, 1440 },
+    { 'i',  1, 3767,    0 }, { 'e',  1, 3768,    0 }, { 's',  1, 3769,    0 }, { 'a',  1, 3770,    0 },
+    { 'a',  1, 3771,    0 }, { 'a',  1, 3772,    0 }, { 'n',  1, 3773,    0 }, { 'A',  1, 3774,    0 },
+    { 'A',  1, 3775,    0 }, { 'r',  1, 3776,    0 }, { 'r',  2, 3777,    0 }, { 'e',  1, 3779,    0 },
+    { 'u',  1, 3780,    0 }, { 't',  0, 3781, 1462 }, { 'r',  1, 3781, 1463 }, { 's',  1, 3782,    0 },
+    { 'l',  1, 3783,    0 }, { 'v',  0, 3784, 1468 }, { 't',  0, 3784, 1469 }, { 'o',  1, 3784,    0 },
+    { 'i',  1, 3785,    0 }, { 'i',  1, 3786,    0 }, { 'n',  0, 3787, 1474 }, { 'a',  1, 3787,    0 },
+    { 'a',  1, 3788,    0 }, { 't',  0, 3789, 1479 }, { 'r',  1, 3789,    0 }, { 'i',  1, 3790,    0 },
+    { 'r',  1, 3791,    0 }, { 'n',  1, 3792,    0 }, { 'c',  1, 3793,    0 }, { 'g',  1, 3794,    0 },
+    { 'c',  1, 3795,    0 }, { 'd',  0, 3796, 1488 }, { 'n',  1, 3796,    0 }, { 'f',  0, 3797, 1490 },
+    { 'r',  0, 3797, 1491 }, { 'r',  1, 3797,    0 }, { 'u',  1, 3798,    0 }, { 'r',  1, 3799,    0 },
+    { 'e',  1, 3800,    0 }, { 'f',  0, 3801, 1499 }, { 'm',  0, 3801, 1500 }, { 'g',  1, 3801,    0 },
+    { 'r',  0, 3802, 1502 }, { 'l',  1, 3802,    0 }, { 'r',  0, 3803, 1505 }, { 'a',  1, 3803,    0 },
+    { 'l',  0, 3804, 1507 }, { 'l',  1, 3804,    0 }, { 'm',  1, 3805,    0 }, { 'l',  0, 3806, 1511 },
+    { 'a',  1, 3806,    0 }, { 'a',  1, 3807, 1514 }, { 's',  2, 3808,    0 }, { 't',  0, 3810, 1518 },
+    { 'c',  1, 3810,    0 }, { 'i',  1, 3811,    0 }, { 'm',  1, 3812,    0 }, { 'p',  0, 3813, 1523 },
+    { 't',  1, 3813,    0 }, { 'v',  0, 3814, 1527 }, { 'm',  1, 3814,    0 }, { 'n',  1, 3815,    0 },
+    { 'c',  1, 3816,    0 }, { 'n',  2, 3817,    0 }, { 's',  8, 3819, 1536 }, { 'n',  1, 3827,    0 },
+    { 'f',  0, 3828, 1548 }, { 'n',  1, 3828,    0 }, { 'p',  0, 3829, 1552 }, { 'u',  1, 3829,    0 },
+    { 'c',  5, 3830, 1555 }, { 'm',  1, 3835,    0 }, { 'E',  0, 3836, 1565 }, { 'a',  1, 3836,    0 },
+    { 's',  1, 3837,    0 }, { 'd',  0, 3838, 1568 }, { 'f',  3, 3838,    0 }, { 'p',  1, 3841, 1572 },
+    { 'i',  1, 3842,    0 }, { 'r',  1, 3843,    0 }, { 'r',  0, 3844, 1576 }, { 'c',  1, 3844,    0 },
+    { 't',  0, 3845, 1580 }, { 'f',  0, 3845, 1581 }, { 'i',  1, 3845,    0 }, { 'r',  0, 3846, 1583 },
+    { 't',  2, 3846,    0 }, { 's',  1, 3848,    0 }, { 't',  0, 3849, 1588 }, { 'r',  1, 3849,    0 },
+    { 'r',  0, 3850, 1590 }, { 'a',  1, 3850,    0 }, { 'r',  1, 3851,    0 }, { 'r',  0, 3852, 1593 },
+    { 'u',  1, 3852,    0 }, { 'i',  1, 3853,    0 }, { 'm',  1, 3854,    0 }, { 'g',  3, 3855, 1597 },
+    { 'u',  1, 3858,    0 }, { 'r', 10, 3859, 1602 }, { 'a',  1, 3869,    0 }, { 'i',  1, 3870,    0 },
+    { 'r',  1, 3871,    0 }, { 'r',  1, 3872,    0 }, { 'a',  1, 3873,    0 }, { 'k',  2, 3874,    0 },
+    { 'r',  1, 3876,    0 }, { 'd',  1, 3877,    0 }, { 'i',  1, 3878,    0 }, { 'b',  0, 3879, 1627 },
+    { 'a',  0, 3879, 1629 }, { 'd',  1, 3879,    0 }, { 'u',  1, 3880,    0 }, { 'h',  0, 3881, 1633 },
+    { 'l',  3, 3881, 1634 }, { 't',  0, 3884, 1638 }, { 's',  1, 3884,    0 }, { 'o',  1, 3885,    0 },
+    { 'r',  2, 3886,    0 }, { 'v',  0, 3888, 1647 }, { 'h',  1, 3888,    0 }, { 'g',  0, 3889, 1657 },
+    { 'i',  1, 3889,    0 }, { 'r',  1, 3890,    0 }, { 'a',  1, 3891,    0 }, { 'u',  1, 3892,    0 },
+    { 'i',  1, 3893,    0 }, { 'n',  1, 3894,    0 }, { 'r',  1, 3895,    0 }, { 'r',  1, 3896,    0 },
+    { 'a',  1, 3897,    0 }, { 'f',  0, 3898, 1669 }, { 'l',  1, 3898,    0 }, { 'i',  1, 3899,    0 },
+    { 'r',  1, 3900, 1672 }, { 'o',  1, 3901,    0 }, { 'r',  1, 3902,    0 }, { 'q',  1, 3903,    0 },
+    { 'r',  0, 3904, 1677 }, { 'b',  0, 3904, 1679 }, { 'u',  1, 3904,    0 }, { 'r',  1, 3905,    0 },
+    { 'm',  1, 3906,    0 }, { 'i',  3, 3907, 1684 }, { 'u',  1, 3910,    0 }, { 'u',  1, 3911,    0 },
+    { 'u',  1, 3912,    0 }, { 'p',  0, 3913, 1694 }, { 'r',  1, 3913,    0 }, { 'u',  1, 3914,    0 },
+    { 'd',  1, 3915,    0 }, { 'r',  1, 3916,    0 }, { 'E',  0, 3917, 1700 }, { 'a',  1, 3917,    0 },
+    { 's',  1, 3918,    0 }, { 'o',  1, 3919,    0 }, { 'i',  1, 3920,    0 }, { 't',  2, 3921, 1706 },
+    { 'r',  1, 3923,    0 }, { 'r',  2, 3924,    0 }, { 't',  0, 3926, 1713 }, { 'i',  0, 3926, 1714 },
+    { 'w',  1, 3926,    0 }, { 'm',  2, 3927,    0 }, { 't',  0, 3929, 1718 }, { 'o',  1, 3929,    0 },
+    { 'r',  1, 3930,    0 }, { 'h',  1, 3931,    0 }, { 'y',  0, 3932, 1723 }, { 'r',  1, 3932,    0 },
+    { 'm',  1, 3933,    0 }, { 'd',  1, 3934,    0 }, { 'e',  1, 3935, 1732 }, { 'g',  1, 3936, 1734 },
+    { 'l',  1, 3937, 1736 }, { 'n',  1, 3938,    0 }, { 'p',  1, 3939,    0 }, { 'r',  1, 3940,    0 },
+    { 'r',  1, 3941,    0 }, { 'l',  1, 3942,    0 }, { 's',  1, 3943,    0 }, { 'p',  1, 3944,    0 },
+    { 'd',  0, 3945, 1745 }, { 'l',  1, 3945,    0 }, { 'e',  0, 3946, 1748 }, { 't',  1, 3946,    0 },
+    { 'b',  1, 3947, 1751 }, { 'f',  0, 3948, 1753 }, { 'd',  1, 3948,    0 }, { 'r',  0, 3949, 1756 },
+    { 'a',  1, 3949,    0 }, { 'u',  1, 3950,    0 }, { 'u',  2, 3951,    0 }, { 'a',  1, 3953,    0 },
+    { 'f',  0, 3954, 1770 }, { 'r',  1, 3954,    0 }, { 'r',  0, 3955, 1772 }, { 't',  1, 3955,    0 },
+    { 'i',  1, 3956,    0 }, { 'a',  1, 3957,    0 }, { 'r',  1, 3958, 1776 }, { 'a',  1, 3959,    0 },
+    { 'n',  1, 3960,    0 }, { 'E',  0, 3961, 1782 }, { 'd',  1, 3961,    0 }, { 'e',  1, 3962, 1784 },
+    { 'm',  1, 3963,    0 }, { 'n',  2, 3964,    0 }, { 'p',  1, 3966,    0 }, { 'r',  1, 3967,    0 },
+    { 's',  3, 3968,    0 }, { 'c',  5, 3971, 1799 }, { 'g',  0, 3976, 1808 }, { '1',  0, 3976, 1810 },
+    { '2',  0, 3976, 1811 }, { '3',  0, 3976, 1812 }, { 'E',  0, 3976, 1813 }, { 'd',  2, 3976,    0 },
+    { 'e',  1, 3978, 1816 }, { 'h',  1, 3979,    0 }, { 'l',  1, 3980,    0 }, { 'm',  1, 3981,    0 },
+    { 'n',  2, 3982,    0 }, { 'p',  1, 3984,    0 }, { 's',  3, 3985,    0 }, { 'r',  1, 3988,    0 },
+    { 'r',  2, 3989,    0 }, { 'w',  1, 3991,    0 }, { 'i',  1, 3992,    0 }, { 'g',  1, 3993,    0 },
+    { 'k',  0, 3994, 1841 }, { 'r',  1, 3994,    0 }, { 'd',  1, 3995,    0 }, { 't',  0, 3996, 1845 },
+    { 'r',  1, 3996,    0 }, { 'r',  1, 3997,    0 }, { 't',  1, 3998,    0 }, { 'c',  1, 3999,    0 },
+    { 'n',  1, 4000,    0 }, { 'a',  1, 4001,    0 }, { 's',  1, 4002,    0 }, { 'r',  1, 4003,    0 },
+    { 'd',  1, 4004,    0 }, { 'e',  1, 4005,    0 }, { 't',  0, 4006, 1864 }, { 'a',  0, 4006, 1865 },
+    { 'b',  1, 4006,    0 }, { 'c',  1, 4007,    0 }, { 'f',  1, 4008, 1869 }, { 'a',  0, 4009, 1871 },
+    { 'i',  1, 4009,    0 }, { 'd',  1, 4010,    0 }, { 'a',  1, 4011,    0 }, { 'd',  1, 4012,    0 },
+    { 'e',  0, 4013, 1882 }, { 'm',  1, 4013,    0 }, { 'p',  1, 4014,    0 }, { 's',  1, 4015,    0 },
+    { 't',  1, 4016,    0 }, { 'e',  1, 4017,    0 }, { 'r',  0, 4018, 1888 }, { 'y',  0, 4018, 1889 },
+    { 'c',  1, 4018,    0 }, { 'r',  1, 4019,    0 }, { 'x',  1, 4020,    0 }, { 'h',  1, 4021,    0 },
+    { 'r',  0, 4022, 1895 }, { 'r',  0, 4022, 1896 }, { 'u',  1, 4022,    0 }, { 'r',  0, 4023, 1898 },
+    { 'c',  1, 4023,    0 }, { 'e',  1, 4024,    0 }, { 'r',  1, 4025,    0 }, { 'r',  1, 4026,    0 },
+    { 'l',  1, 4027,    0 }, { 'a',  1, 4028,    0 }, { 's',  1, 4029,    0 }, { 'a',  1, 4030,    0 },
+    { 'r',  2, 4031,    0 }, { 'l',  1, 4033,    0 }, { 'o',  1, 4034,    0 }, { 'r',  1, 4035,    0 },
+    { 'r',  1, 4036,    0 }, { 'c',  1, 4037,    0 }, { 'o',  1, 4038,    0 }, { 'f',  0, 4039, 1919 },
+    { 'r',  1, 4039,    0 }, { 'o',  1, 4040,    0 }, { 'a',  1, 4041,    0 }, { 'u',  1, 4042,    0 },
+    { 'i',  2, 4043, 1925 }, { 'p',  1, 4045,    0 }, { 'o',  1, 4046,    0 }, { 'r',  1, 4047,    0 },
+    { 'n',  1, 4048,    0 }, { 'r',  1, 4049,    0 }, { 'r',  0, 4050, 1934 }, { 'o',  1, 4050,    0 },
+    { 'l',  1, 4051,    0 }, { 'i',  1, 4052, 1937 }, { 'r',  1, 4053,    0 }, { 'l',  0, 4054, 1940 },
+    { 'n',  1, 4054,    0 }, { 'r',  0, 4055, 1942 }, { 'r',  1, 4055, 1943 }, { 's',  1, 4056,    0 },
+    { 'g',  1, 4057,    0 }, { 'e',  1, 4058,    0 }, { 'k',  1, 4059,    0 }, { 'n',  1, 4060,    0 },
+    { 'p',  3, 4061,    0 }, { 'r',  1, 4064, 1953 }, { 's',  1, 4065,    0 }, { 't',  2, 4066,    0 },
+    { 's',  1, 4068,    0 }, { 'b',  1, 4069,    0 }, { 'e',  1, 4070,    0 }, { 'l',  1, 4071,    0 },
+    { 'b',  1, 4072,    0 }, { 't',  0, 4073, 1966 }, { 'r',  1, 4073,    0 }, { 'f',  0, 4074, 1969 },
+    { 'o',  1, 4074,    0 }, { 'r',  1, 4075,    0 }, { 'r',  0, 4076, 1972 }, { 'g',  1, 4076,    0 },
+    { 'r',  1, 4077,    0 }, { 'b',  1, 4078,    0 }, { 'g',  1, 4079,    0 }, { 'e',  1, 4080,    0 },
+    { 'f',  0, 4081, 1980 }, { 'a',  1, 4081,    0 }, { 'r',  0, 4082, 1984 }, { 'p',  0, 4082, 1985 },
+    { 'r',  1, 4082,    0 }, { 'p',  0, 4083, 1987 }, { 'r',  1, 4083,    0 }, { 'r',  1, 4084,    0 },
+    { 'r',  1, 4085,    0 }, { 'r',  1, 4086,    0 }, { 'r',  1, 4087,    0 }, { 'p',  0, 4088, 1995 },
+    { 's',  0, 4088, 1996 }, { 'o',  1, 4088,    0 }, { 'f',  0, 4089, 1998 }, { 'l',  1, 4089,    0 },
+    { 'i',  1, 4090,    0 }, { 'r',  1, 4091,    0 }, { 'r',  1, 4092,    0 }, { 'r',  0, 4093, 2003 },
+    { 'c',  1, 4093,    0 }, { 'l',  1, 4094,    0 }, { 'r',  1, 4095,    0 }, { 'e',  0, 4096, 2007 },
+    { 'd',  1, 4096,    0 }, { 'u',  1, 4097,    0 }, { 'y',  0, 4098, 2010 }, { 'r',  1, 4098,    0 },
+    { 'y',  0, 4099, 2015 }, { 'f',  0, 4099, 2016 }, { 'r',  0, 4099, 2017 }, { 'y',  0, 4099, 2018 },
+    { 'l',  0, 4099, 2019 }, { 'u',  1, 4099,    0 }, { 'r',  1, 4100,    0 }, { 't',  0, 4101, 2023 },
+    { 't',  1, 4101,    0 }, { 'a',  0, 4102, 2025 }, { 'y',  0, 4102, 2027 }, { 'r',  1, 4102,    0 },
+    { 'f',  0, 4103, 2029 }, { 'r',  0, 4103, 2030 }, { 'j',  0, 4103, 2032 }, { 'g',  0, 4103,    1 },
+    { 't',  1, 4103,    0 }, { 'v',  1, 4104,    0 }, { 'c',  0, 4105,    5 }, { 'v',  1, 4105,    0 },
+    { 'a',  0, 4106,    9 }, { 'r',  0, 4106,   10 }, { 'n',  0, 4106,   12 }, { 'y',  1, 4106,    0 },
+    { 'g',  0, 4107,   15 }, { 'g',  1, 4107,    0 }, { 'd',  1, 4108,    0 }, { 's',  1, 4109,    0 },
+    { 'e',  1, 4110,    0 }, { 'u',  1, 4111,    0 }, { 'o',  1, 4112,    0 }, { 'e',  0, 4113,   29 },
+    { 'e',  1, 4113,    0 }, { 't',  1, 4114,    0 }, { 't',  1, 4115,    0 }, { 'e',  1, 4116,    0 },
+    { 'o',  1, 4117,    0 }, { 'i',  1, 4118,    0 }, { 'c',  0, 4119,   40 }, { 'i',  1, 4119,    0 },
+    { 'l',  1, 4120,    0 }, { 'e',  1, 4121,    0 }, { 'l',  1, 4122,    0 }, { 'k',  1, 4123,    0 },
+    { 'e',  1, 4124,    0 }, { 'n',  1, 4125,   54 }, { 'r',  1, 4126,    0 }, { 'n',  1, 4127,    0 },
+    { 'o',  1, 4128,    0 }, { 'o',  1, 4129,    0 }, { 't',  1, 4130,    0 }, { 's',  0, 4131,   62 },
+    { 'a',  1, 4131,    0 }, { 'r',  1, 4132,    0 }, { 'e',  1, 4133,    0 }, { 'v',  0, 4134,   73 },
+    { 'o',  1, 4134,    0 }, { 'a',  0, 4135,   77 }, { 'r',  1, 4135,    0 }, { 'o',  1, 4136,    0 },
+    { 'e',  1, 4137,    0 }, { 'o',  1, 4138,    0 }, { 'q',  1, 4139,    0 }, { 'l',  1, 4140,    0 },
+    { 'A',  1, 4141,    0 }, { 'B',  1, 4142,    0 }, { 'L',  1, 4143,    0 }, { 'R',  1, 4144,    0 },
+    { 'T',  1, 4145,    0 }, { 'a',  1, 4146,    0 }, { 'o',  1, 4147,    0 }, { 't',  1, 4148,    0 },
+    { 'o',  1, 4149,    0 }, { 'c',  0, 4150,  124 }, { 'v',  1, 4150,    0 }, { 'e',  1, 4151,    0 },
+    { 'r',  0, 4152,  130 }, { 'y',  2, 4152,    0 }, { 'n',  0, 4154,  133 }, { 'l',  1, 4154,    0 },
+    { 'l',  1, 4155,  136 }, { 'l',  1, 4156,    0 }, { 't',  1, 4157,    0 }, { 'n',  1, 4158,    0 },
+    { 'e',  1, 4159,    0 }, { 'l',  1, 4160,    0 }, { 'i',  1, 4161,    0 }, { 'a',  1, 4162,  155 },
+    { 'v',  1, 4163,    0 }, { 'i',  1, 4164,    0 }, { 'c',  0, 4165,  159 }, { 't',  1, 4165,    0 },
+    { 'c',  1, 4166,    0 }, { 'k',  0, 4167,  175 }, { 'c',  0, 4167,  177 }, { 'e',  1, 4167,    0 },
+    { 'z',  1, 4168,    0 }, { 'o',  1, 4169,    0 }, { 'D',  1, 4170,    0 }, { 'E',  1, 4171,    0 },
+    { 'g',  0, 4172,  187 }, { 't',  1, 4172,    0 }, { 'c',  0, 4173,  190 }, { 'v',  1, 4173,    0 },
+    { 'r',  0, 4174,  196 }, { 'i',  1, 4174,    0 }, { 'i',  1, 4175,    0 }, { 'g',  1, 4176,    0 },
+    { 'r',  1, 4177,    0 }, { 's',  1, 4178,    0 }, { 'n',  0, 4179,  204 }, { 'd',  1, 4179,    0 },
+    { 'y',  0, 4180,  209 }, { 'c',  0, 4180,  211 }, { 'c',  1, 4180,    0 }, { 'y',  0, 4181,  217 },
+    { 'a',  0, 4181,  220 }, { 'i',  1, 4181,    0 }, { 't',  1, 4182,    0 }, { 'd',  1, 4183,    0 },
+    { 'a',  1, 4184,    0 }, { 'o',  1, 4185,    0 }, { 'i',  1, 4186,    0 }, { 'A',  2, 4187,    0 },
+    { 'C',  1, 4189,    0 }, { 'D',  1, 4190,    0 }, { 'F',  1, 4191,    0 }, { 'R',  1, 4192,    0 },
+    { 'T',  2, 4193,    0 }, { 'U',  1, 4195,    0 }, { 'V',  1, 4196,    0 }, { 'a',  1, 4197,    0 },
+    { 'r',  1, 4198,    0 }, { 'E',  1, 4199,    0 }, { 'F',  1, 4200,    0 }, { 'G',  1, 4201,    0 },
+    { 'L',  1, 4202,    0 }, { 'S',  1, 4203,    0 }, { 'T',  1, 4204,    0 }, { 't',  1, 4205,    0 },
+    { 'o',  1, 4206,    0 }, { 'L',  1, 4207,    0 }, { 'R',  1, 4208,    0 }, { 'l',  1, 4209,    0 },
+    { 'r',  1, 4210,    0 }, { 'r',  2, 4211,    0 }, { 'o',  1, 4213,    0 }, { 'u',  1, 4214,    0 },
+    { 'i',  1, 4215,    0 }, { 's',  1, 4216,    0 }, { 't',  1, 4217,    0 }, { 'o',  1, 4218,    0 },
+    { 'i',  1, 4219,    0 }, { 't',  1, 4220,    0 }, { 'e',  1, 4221,    0 }, { 'i',  1, 4222,    0 },
+    { 'e',  1, 4223,    0 }, { 'r',  1, 4224,    0 }, { 'o',  1, 4225,    0 }, { 'u',  1, 4226,    0 },
+    { 'o',  1, 4227,    0 }, { 'l',  1, 4228,    0 }, { 'q',  1, 4229,    0 }, { 'x',  1, 4230,    0 },
+    { 'r',  1, 4231,    0 }, { 'e',  2, 4232,    0 }, { 'r',  1, 4234,    0 }, { 'e',  1, 4235,    0 },
+    { 'i',  1, 4236,    0 }, { 'q',  1, 4237,    0 }, { 'u',  3, 4238,    0 }, { 'i',  1, 4241,    0 },
+    { 'e',  1, 4242,    0 }, { 'd',  1, 4243,    0 }, { 'g',  0, 4244,  346 }, { 't',  1, 4244,    0 },
+    { 'c',  0, 4245,  348 }, { 'a',  1, 4245,    0 }, { 'v',  1, 4246,    0 }, { 'r',  0, 4247,  353 },
+    { 'a',  0, 4247,  354 }, { 'r',  1, 4247,    0 }, { 'C',  1, 4248,    0 }, { 's',  1, 4249,    0 },
+    { 'd',  1, 4250,    0 }, { 'e',  1, 4251,    0 }, { 'B',  2, 4252,    0 }, { 'P',  1, 4254,    0 },
+    { 'i',  1, 4255,    0 }, { 'M',  1, 4256,    0 }, { 'c',  1, 4257,    0 }, { 'e',  1, 4258,    0 },
+    { 'e',  0, 4259,  382 }, { 'u',  1, 4259,    0 }, { 'o',  1, 4260,    0 }, { 'r',  0, 4261,  392 },
+    { 't',  1, 4261,    0 }, { 't',  1, 4262,    0 }, { 'o',  1, 4263,    0 }, { 'i',  1, 4264,    0 },
+    { 'r',  1, 4265,    0 }, { 't',  8, 4266,    0 }, { 'd',  1, 4274,    0 }, { 'h',  1, 4275,    0 },
+    { 'D',  1, 4276,    0 }, { 'c',  1, 4277,    0 }, { 'c',  1, 4278,    0 }, { 't',  1, 4279,    0 },
+    { 'o',  1, 4280,    0 }, { 'i',  1, 4281,    0 }, { 'c',  0, 4282,  443 }, { 't',  4, 4282,    0 },
+    { 'a',  0, 4286,  450 }, { 'l',  1, 4286,    0 }, { 'r',  1, 4287,    0 }, { 'e',  1, 4288,    0 },
+    { 'e',  1, 4289,    0 }, { 'T',  1, 4290,    0 }, { 'r',  1, 4291,    0 }, { 'e',  1, 4292,    0 },
+    { 'N',  0, 4293,  476 }, { 'E',  0, 4293,  477 }, { 'y',  0, 4293,  478 }, { 'o',  1, 4293,    0 },
+    { 'i',  1, 4294,    0 }, { 'e',  1, 4295,    0 }, { 'a',  0, 4296,  487 }, { 'S',  1, 4296,    0 },
+    { 'e',  3, 4297,  489 }, { 'l',  1, 4300,    0 }, { 'o',  1, 4301,    0 }, { 't',  1, 4302,    0 },
+    { 'o',  1, 4303,    0 }, { 'y',  0, 4304,  500 }, { 'v',  1, 4304,    0 }, { 'c',  0, 4305,  502 },
+    { 'a',  1, 4305,    0 }, { 'v',  1, 4306,    0 }, { 'r',  0, 4307,  507 }, { 'r',  2, 4307,    0 },
+    { 'n',  1, 4309,  512 }, { 'n',  0, 4310,  514 }, { 'r',  1, 4310,    0 }, { 'w',  1, 4311,    0 },
+    { 'u',  1, 4312,    0 }, { 'e',  1, 4313,  521 }, { 'r',  1, 4314,    0 }, { 'w',  1, 4315,    0 },
+    { 'r',  2, 4316,    0 }, { 'l',  1, 4318,    0 }, { 'g',  0, 4319,  529 }, { 'd',  1, 4319,    0 },
+    { 'h',  0, 4320,  533 }, { 'h',  1, 4320,  536 }, { 'a',  1, 4321,    0 }, { 'i',  1, 4322,    0 },
+    { 'T',  1, 4323,    0 }, { 's',  1, 4324,    0 }, { 'c',  0, 4325,  550 }, { 'e',  0, 4325,  551 },
+    { 't',  1, 4325,    0 }, { 'c',  0, 4326,  563 }, { 't',  1, 4326,    0 }, { 'o',  1, 4327,    0 },
+    { 'W',  1, 4328,    0 }, { 't',  1, 4329,    0 }, { 'v',  1, 4330,    0 }, { 'c',  0, 4331,  583 },
+    { 'e',  0, 4331,  584 }, { 'g',  0, 4331,  586 }, { 'v',  1, 4331,    0 }, { 's',  1, 4332,    0 },
+    { 'h',  0, 4333,  591 }, { 'a',  0, 4333,  592 }, { 'r',  0, 4333,  593 }, { 'g',  0, 4333,  594 },
+    { 'n',  1, 4333,    0 }, { 'l',  1, 4334,    0 }, { 'e',  0, 4335,  603 }, { 's',  1, 4335,    0 },
+    { 't',  1, 4336,  613 }, { 'p',  1, 4337,    0 }, { 't',  0, 4338,  617 }, { 'a',  1, 4338,    0 },
+    { 'n',  0, 4339,  619 }, { 'i',  1, 4339,    0 }, { 'o',  1, 4340,    0 }, { 'g',  0, 4341,  629 },
+    { 'p',  1, 4341,  632 }, { 'd',  1, 4342,    0 }, { 'n',  1, 4343,    0 }, { 't',  0, 4344,  637 },
+    { 'c',  1, 4344,    0 }, { 'e',  1, 4345,    0 }, { 'p',  1, 4346,    0 }, { 's',  1, 4347,    0 },
+    { 'e',  1, 4348,    0 }, { 'e',  1, 4349,    0 }, { 't',  1, 4350,    0 }, { 'g',  0, 4351,  649 },
+    { 'o',  0, 4351,  651 }, { 'u',  1, 4351,    0 }, { 't',  1, 4352,    0 }, { 'i',  0, 4353,  655 },
+    { 'o',  1, 4353,    0 }, { 'e',  1, 4354,    0 }, { 'a',  1, 4355,    0 }, { 'i',  1, 4356,    0 },
+    { 'u',  1, 4357,    0 }, { 'd',  1, 4358,    0 }, { 'p',  1, 4359,    0 }, { 't',  1, 4360,    0 },
+    { 'q',  1, 4361,    0 }, { 't',  1, 4362,    0 }, { 'r',  1, 4363,    0 }, { 'p',  1, 4364,    0 },
+    { 'e',  1, 4365,    0 }, { 'e',  1, 4366,    0 }, { 'o',  1, 4367,    0 }, { 'k',  3, 4368,    0 },
+    { 'k',  0, 4371,  681 }, { '2',  0, 4371,  682 }, { '4',  0, 4371,  683 }, { '4',  0, 4371,  684 },
+    { 'k',  0, 4371,  685 }, { 'o',  1, 4371,    0 }, { 'i',  1, 4372,    0 }, { 'L',  0, 4373,  691 },
+    { 'R',  0, 4373,  692 }, { 'l',  0, 4373,  693 }, { 'r',  0, 4373,  694 }, { 'D',  0, 4373,  696 },
+    { 'U',  0, 4373,  697 }, { 'd',  0, 4373,  698 }, { 'u',  0, 4373,  699 }, { 'L',  0, 4373,  700 },
+    { 'R',  0, 4373,  701 }, { 'l',  0, 4373,  702 }, { 'r',  0, 4373,  703 }, { 'H',  0, 4373,  705 },
+    { 'L',  0, 4373,  706 }, { 'R',  0, 4373,  707 }, { 'h',  0, 4373,  708 }, { 'l',  0, 4373,  709 },
+    { 'r',  0, 4373,  710 }, { 'o',  1, 4373,    0 }, { 'L',  0, 4374,  712 }, { 'R',  0, 4374,  713 },
+    { 'l',  0, 4374,  714 }, { 'r',  0, 4374,  715 }, { 'D',  0, 4374,  717 }, { 'U',  0, 4374,  718 },
+    { 'd',  0, 4374,  719 }, { 'u',  0, 4374,  720 }, { 'i',  1, 4374,    0 }, { 'l',  1, 4375,    0 },
+    { 'i',  1, 4376,    0 }, { 'L',  0, 4377,  724 }, { 'R',  0, 4377,  725 }, { 'l',  0, 4377,  726 },
+    { 'r',  0, 4377,  727 }, { 'H',  0, 4377,  729 }, { 'L',  0, 4377,  730 }, { 'R',  0, 4377,  731 },
+    { 'h',  0, 4377,  732 }, { 'l',  0, 4377,  733 }, { 'r',  0, 4377,  734 }, { 'm',  1, 4377,    0 },
+    { 'e',  0, 4378,  736 }, { 'a',  1, 4378,    0 }, { 'i',  0, 4379,  739 }, { 'e',  0, 4379,  741 },
+    { 'b',  0, 4379,  743 }, { 'h',  1, 4379,    0 }, { 'e',  1, 4380,    0 }, { 'E',  0, 4381,  748 },
+    { 'e',  1, 4381,  749 }, { 't',  1, 4382,    0 }, { 'n',  1, 4383,    0 }, { 'r',  1, 4384,    0 },
+    { 'a',  1, 4385,    0 }, { 'u',  1, 4386,    0 }, { 'o',  1, 4387,    0 }, { 't',  0, 4388,  758 },
+    { 'n',  0, 4388,  759 }, { 's',  0, 4388,  760 }, { 'o',  1, 4388,    0 }, { 'i',  1, 4389,    0 },
+    { 'c',  0, 4390,  763 }, { 's',  1, 4390,  764 }, { 'l',  0, 4391,  767 }, { 't',  1, 4391,    0 },
+    { 'e',  1, 4392,    0 }, { 'k',  1, 4393,  773 }, { 'e',  1, 4394,    0 }, { 'l',  1, 4395,    0 },
+    { 'n',  1, 4396,    0 }, { 'i',  1, 4397,    0 }, { 'c',  1, 4398,    0 }, { 's',  1, 4399,  791 },
+    { 'n',  1, 4400,  793 }, { 'a',  1, 4401,  796 }, { 'f',  1, 4402,    0 }, { 'l',  1, 4403,    0 },
+    { 'd',  1, 4404,    0 }, { 'n',  1, 4405,    0 }, { 'o',  1, 4406,    0 }, { 's',  1, 4407,    0 },
+    { 'r',  0, 4408,  809 }, { 's',  0, 4408,  810 }, { 'e',  0, 4408,  813 }, { 'e',  0, 4408,  815 },
+    { 't',  0, 4408,  816 }, { 'r',  1, 4408,    0 }, { 'r',  0, 4409,  819 }, { 'c',  0, 4409,  820 },
+    { 'r',  1, 4409,    0 }, { 'r',  1, 4410,    0 }, { 'a',  1, 4411,    0 }, { 'u',  1, 4412,    0 },
+    { 'o',  1, 4413,    0 }, { 'r',  0, 4414,  828 }, { 'r',  1, 4414,    0 }, { 'y',  3, 4415,    0 },
+    { 'e',  1, 4418,    0 }, { 'e',  1, 4419,    0 }, { 'e',  0, 4420,  838 }, { 'd',  0, 4420,  839 },
+    { 'n',  1, 4420,    0 }, { 't',  0, 4421,  841 }, { 't',  1, 4421,    0 }, { 'e',  1, 4422,    0 },
+    { 't',  1, 4423,    0 }, { 'v',  0, 4424,  849 }, { 'r',  1, 4424,    0 }, { 'c',  0, 4425,  851 },
+    { 'o',  1, 4425,    0 }, { 'g',  1, 4426,    0 }, { 'r',  0, 4427,  856 }, { 's',  1, 4427,    0 },
+    { 'a',  0, 4428,  859 }, { 't',  1, 4428,    0 }, { 'h',  1, 4429,    0 }, { 'l',  0, 4430,  863 },
+    { 'r',  0, 4430,  864 }, { 'o',  1, 4430,    0 }, { 's',  0, 4431,  868 }, { 'm',  1, 4431,    0 },
+    { 'n',  0, 4432,  871 }, { 'd',  1, 4432,    0 }, { 'n',  1, 4433,    0 }, { 'r',  1, 4434,    0 },
+    { 'o',  1, 4435,    0 }, { 'a',  1, 4436,    0 }, { 'q',  1, 4437,  882 }, { 'i',  1, 4438,    0 },
+    { 'l',  1, 4439,    0 }, { 'q',  1, 4440,    0 }, { 'l',  1, 4441,    0 }, { 'a',  1, 4442,    0 },
+    { 'd',  1, 4443,    0 }, { 'h',  1, 4444,    0 }, { 'a',  1, 4445,    0 }, { 'r',  1, 4446,    0 },
+    { 'o',  1, 4447,    0 }, { 'o',  1, 4448,    0 }, { 't',  0, 4449,  899 }, { 'f',  0, 4449,  901 },
+    { 'r',  0, 4449,  902 }, { 'r',  0, 4449,  903 }, { 'g',  1, 4449,    0 }, { 'r',  1, 4450,    0 },
+    { 't',  0, 4451,  907 }, { 't',  1, 4451,    0 }, { 'e',  1, 4452,    0 }, { 'o',  1, 4453,    0 },
+    { 'c',  0, 4454,  913 }, { 'o',  1, 4454,    0 }, { 't',  0, 4455,  918 }, { 'v',  1, 4455,    0 },
+    { 'o',  1, 4456,    0 }, { 't',  1, 4457,    0 }, { 'o',  1, 4458,    0 }, { 'r',  0, 4459,  929 },
+    { 'y',  2, 4459,  930 }, { '1',  2, 4461,    0 }, { 'n',  0, 4463,  938 }, { 's',  1, 4463,    0 },
+    { 's',  0, 4464,  942 }, { 'l',  1, 4464,    0 }, { 'v',  0, 4465,  945 }, { 'r',  1, 4465,    0 },
+    { 'l',  1, 4466,    0 }, { 'm',  0, 4467,  948 }, { 'a',  1, 4467,    0 }, { 'l',  1, 4468,    0 },
+    { 's',  1, 4469,    0 }, { 'v',  1, 4470,  953 }, { 'a',  1, 4471,    0 }, { 't',  0, 4472,  956 },
+    { 'r',  0, 4472,  957 }, { 't',  0, 4472,  959 }, { 't',  0, 4472,  966 }, { 'c',  1, 4472,    0 },
+    { 'n',  1, 4473,    0 }, { 'i',  1, 4474,    0 }, { 'l',  1, 4475,    0 }, { 'i',  1, 4476,    0 },
+    { 'g',  0, 4477,  973 }, { 'i',  1, 4477,    0 }, { 'g',  0, 4478,  976 }, { 'g',  0, 4478,  978 },
+    { 's',  0, 4478,  979 }, { 'l',  1, 4478,    0 }, { 'v',  0, 4479,  984 }, { 't',  1, 4479,    0 },
+    { '1',  6, 4480,    0 }, { '2',  2, 4486,    0 }, { '3',  3, 4488,    0 }, { '4',  1, 4491,    0 },
+    { '5',  2, 4492,    0 }, { '7',  1, 4494,    0 }, { 'l',  0, 4495, 1001 }, { 'n',  0, 4495, 1002 },
+    { 't',  1, 4495,    0 }, { 'a',  1, 4496, 1007 }, { 'v',  1, 4497,    0 }, { 'c',  0, 4498, 1011 },
+    { 'l',  1, 4498,    0 }, { 'c',  0, 4499, 1020 }, { 'o',  1, 4499,    0 }, { 'e',  1, 4500,    0 },
+    { 'l',  0, 4501, 1028 }, { 'p',  1, 4501,    0 }, { 'q',  0, 4502, 1039 }, { 'm',  0, 4502, 1040 },
+    { 'e',  0, 4502, 1042 }, { 'e',  0, 4502, 1045 }, { 'l',  0, 4502, 1046 }, { 'r',  0, 4502, 1049 },
+    { 't',  0, 4502, 1050 }, { 'a',  1, 4502,    0 }, { 'e',  1, 4503,    0 }, { 'p',  1, 4504,    0 },
+    { 'r',  1, 4505,    0 }, { 'o',  1, 4506,    0 }, { 'q',  2, 4507,    0 }, { 'e',  1, 4509,    0 },
+    { 'i',  1, 4510,    0 }, { 's',  1, 4511,    0 }, { 'l',  1, 4512,    0 }, { 'c',  1, 4513,    0 },
+    { 'c',  1, 4514,    0 }, { 'w',  0, 4515, 1067 }, { 'c',  0, 4515, 1069 }, { 't',  1, 4515,    0 },
+    { 'i',  1, 4516,    0 }, { 'o',  1, 4517,    0 }, { 'a',  1, 4518,    0 }, { 'a',  1, 4519,    0 },
+    { 'r',  0, 4520, 1077 }, { 'h',  1, 4520,    0 }, { 'l',  1, 4521,    0 }, { 'r',  1, 4522,    0 },
+    { 'a',  1, 4523,    0 }, { 's',  1, 4524,    0 }, { 'o',  1, 4525,    0 }, { 'l',  1, 4526,    0 },
+    { 'e',  1, 4527,    0 }, { 't',  1, 4528,    0 }, { 'c',  0, 4529, 1090 }, { 'l',  0, 4529, 1093 },
+    { 'v',  1, 4529,    0 }, { 'n',  1, 4530,    0 }, { 't',  0, 4531, 1099 }, { 'i',  1, 4531,    0 },
+    { 'a',  0, 4532, 1101 }, { 'g',  0, 4532, 1102 }, { 'r',  0, 4532, 1103 }, { 'e',  0, 4532, 1104 },
+    { 'l',  1, 4532,    0 }, { 'p',  1, 4533,    0 }, { 'h',  0, 4534, 1107 }, { 'd',  0, 4534, 1109 },
+    { 'r',  1, 4534,    0 }, { 'n',  1, 4535, 1112 }, { 'o',  1, 4536,    0 }, { 'a',  1, 4537,    0 },
+    { 'g',  1, 4538,    0 }, { 'r',  1, 4539,    0 }, { 'a',  1, 4540,    0 }, { 'r',  1, 4541,    0 },
+    { 'n',  0, 4542, 1122 }, { 'd',  0, 4542, 1125 }, { 's',  1, 4542,    0 }, { 'E',  0, 4543, 1129 },
+    { 'd',  1, 4543,    0 }, { 's',  1, 4544, 1131 }, { 'v',  0, 4545, 1133 }, { 'd',  1, 4545,    0 },
+    { 'y',  0, 4546, 1136 }, { 'c',  0, 4546, 1138 }, { 'h',  0, 4546, 1141 }, { 'c',  1, 4546,    0 },
+    { 'y',  0, 4547, 1145 }, { 'a',  1, 4547, 1146 }, { 'i',  1, 4548,    0 }, { 'e',  1, 4549,    0 },
+    { 'r',  0, 4550, 1156 }, { 'i',  1, 4550,    0 }, { 'r',  0, 4551, 1159 }, { 't',  1, 4551,    0 },
+    { 'p',  1, 4552,    0 }, { 'a',  1, 4553,    0 }, { 'd',  1, 4554,    0 }, { 'd',  0, 4555, 1168 },
+    { 'l',  1, 4555,    0 }, { 'o',  0, 4556, 1171 }, { 'b',  1, 4556, 1173 }, { 'f',  1, 4557,    0 },
+    { 'h',  1, 4558,    0 }, { 'l',  1, 4559,    0 }, { 'p',  1, 4560,    0 }, { 's',  1, 4561,    0 },
+    { 't',  1, 4562,    0 }, { 'i',  1, 4563,    0 }, { 'r',  0, 4564, 1184 }, { 'k',  0, 4564, 1185 },
+    { 'c',  2, 4564,    0 }, { 'e',  0, 4566, 1188 }, { 's',  1, 4566,    0 }, { 'o',  1, 4567,    0 },
+    { 'i',  1, 4568,    0 }, { 'l',  0, 4569, 1193 }, { 'o',  1, 4569, 1197 }, { 'h',  1, 4570,    0 },
+    { 's',  1, 4571,    0 }, { 'a',  1, 4572,    0 }, { 'h',  1, 4573,    0 }, { 'l',  1, 4574,    0 },
+    { 'r',  1, 4575,    0 }, { 't',  1, 4576,    0 }, { 'l',  1, 4577,    0 }, { 'c',  0, 4578, 1218 },
+    { 'o',  1, 4578,    0 }, { 'e',  1, 4579,    0 }, { 'a',  1, 4580,    0 }, { 'd',  1, 4581,    0 },
+    { 'e',  1, 4582,    0 }, { 'g',  1, 4583,    0 }, { 's',  1, 4584,    0 }, { 'h',  1, 4585,    0 },
+    { 'o',  1, 4586,    0 }, { 'd',  0, 4587, 1234 }, { 'u',  1, 4587, 1235 }, { 'k',  0, 4588, 1237 },
+    { 'r',  0, 4588, 1240 }, { 'r',  1, 4588,    0 }, { 'r',  1, 4589,    0 }, { 'i',  0, 4590, 1243 },
+    { 'o',  1, 4590,    0 }, { 's',  1, 4591,    0 }, { 'p',  1, 4592,    0 }, { 'q',  0, 4593, 1252 },
+    { 'm',  0, 4593, 1253 }, { 'g',  0, 4593, 1254 }, { 'r',  0, 4593, 1255 }, { 'k',  0, 4593, 1256 },
+    { 'l',  1, 4593,    0 }, { 'm',  1, 4594,    0 }, { 'r',  1, 4595,    0 }, { 'a',  1, 4596,    0 },
+    { 'r',  0, 4597, 1263 }, { 'u',  1, 4597,    0 }, { 'm',  1, 4598,    0 }, { 's',  1, 4599,    0 },
+    { 'a',  1, 4600,    0 }, { 'n',  1, 4601,    0 }, { 'l',  1, 4602,    0 }, { 'r',  0, 4603, 1274 },
+    { 'r',  1, 4603,    0 }, { 'r',  1, 4604, 1276 }, { 'i',  0, 4605, 1279 }, { 'u',  1, 4605,    0 },
+    { 'e',  0, 4606, 1284 }, { 'g',  0, 4606, 1285 }, { 'o',  1, 4606, 1287 }, { 'o',  1, 4607,    0 },
+    { 'r',  0, 4608, 1292 }, { 't',  0, 4608, 1293 }, { 'e',  1, 4608,    0 }, { 'e',  1, 4609,    0 },
+    { 'r',  1, 4610,    0 }, { 'e',  1, 4611,    0 }, { 'a',  1, 4612,    0 }, { 'e',  0, 4613, 1300 },
+    { 'f',  0, 4613, 1301 }, { 's',  1, 4613,    0 }, { 'h',  1, 4614,    0 }, { 't',  0, 4615, 1304 },
+    { 'e',  1, 4615,    0 }, { 't',  1, 4616,    0 }, { 'e',  1, 4617,    0 }, { 'm',  1, 4618,    0 },
+    { 'h',  0, 4619, 1317 }, { 'u',  1, 4619,    0 }, { 'o',  0, 4620, 1321 }, { 's',  1, 4620,    0 },
+    { 'i',  1, 4621,    0 }, { 'o',  1, 4622,    0 }, { 's',  2, 4623, 1326 }, { 'u',  1, 4625,    0 },
+    { 'l',  1, 4626,    0 }, { 'o',  1, 4627,    0 }, { 'i',  1, 4628,    0 }, { 'p',  0, 4629, 1340 },
+    { 't',  2, 4629,    0 }, { 'h',  1, 4631,    0 }, { 's',  1, 4632,    0 }, { 's',  1, 4633,    0 },
+    { 'a',  0, 4634, 1346 }, { 't',  1, 4634,    0 }, { 's',  0, 4635, 1349 }, { 'r',  1, 4635,    0 },
+    { 'r',  1, 4636, 1351 }, { 'o',  1, 4637,    0 }, { 'i',  1, 4638,    0 }, { 'g',  0, 4639, 1358 },
+    { 'h',  0, 4639, 1361 }, { 'r',  0, 4639, 1363 }, { 'h',  1, 4639,    0 }, { 'r',  1, 4640, 1365 },
+    { 'i',  1, 4641,    0 }, { 'a',  1, 4642,    0 }, { 's',  1, 4643,    0 }, { 'm',  0, 4644, 1374 },
+    { 'r',  0, 4644, 1377 }, { 'r',  0, 4644, 1378 }, { 'r',  0, 4644, 1379 }, { 'r',  0, 4644, 1385 },
+    { 'r',  0, 4644, 1386 }, { 't',  2, 4644,    0 }, { 's',  0, 4646, 1392 }, { 'm',  0, 4646, 1393 },
+    { 'i',  1, 4646, 1395 }, { 'n',  1, 4647, 1400 }, { 'i',  1, 4648, 1404 }, { 'a',  1, 4649,    0 },
+    { 'i',  1, 4650,    0 }, { 'u',  1, 4651,    0 }, { 'c',  0, 4652, 1413 }, { 'r',  0, 4652, 1414 },
+    { 'r',  0, 4652, 1415 }, { 'h',  1, 4652,    0 }, { 'i',  1, 4653, 1417 }, { 'u',  1, 4654,    0 },
+    { 'r',  1, 4655,    0 }, { 'e',  1, 4656, 1425 }, { 'd',  0, 4657, 1427 }, { 'r',  0, 4657, 1428 },
+    { 'u',  2, 4657,    0 }, { 'e',  0, 4659, 1432 }, { 's',  1, 4659,    0 }, { 'c',  0, 4660, 1434 },
+    { 'e',  0, 4660, 1436 }, { 's',  1, 4660,    0 }, { 'd',  1, 4661,    0 }, { 'a',  1, 4662,    0 },
+    { 'r',  1, 4663,    0 }, { 'p',  0, 4664, 1448 }, { 's',  1, 4664,    0 }, { 'r',  1, 4665,    0 },
+    { 's',  1, 4666,    0 }, { 'f',  1, 4667,    0 }, { 'r',  1, 4668,    0 }, { 'r',  1, 4669,    0 },
+    { 'r',  0, 4670, 1455 }, { 'h',  1, 4670,    0 }, { 'r',  1, 4671, 1457 }, { 'a',  1, 4672,    0 },
+    { 't',  1, 4673,    0 }, { 'c',  0, 4674, 1464 }, { 'h',  0, 4674, 1466 }, { 'a',  1, 4674,    0 },
+    { 'l',  1, 4675,    0 }, { 'g',  0, 4676, 1471 }, { 'r',  0, 4676, 1472 }, { 'v',  1, 4676,    0 },
+    { 'r',  0, 4677, 1477 }, { 'r',  0, 4677, 1480 }, { 'r',  0, 4677, 1481 }, { 'o',  1, 4677,    0 },
+    { 'e',  0, 4678, 1483 }, { 'r',  0, 4678, 1485 }, { 'a',  0, 4678, 1486 }, { 'r',  1, 4678,    0 },
+    { 'u',  1, 4679,    0 }, { 'p',  0, 4680, 1492 }, { 's',  0, 4680, 1493 }, { 'r',  0, 4680, 1495 },
+    { 'r',  1, 4680, 1497 }, { 'o',  1, 4681,    0 }, { 'o',  1, 4682,    0 }, { 's',  1, 4683,    0 },
+    { 'd',  1, 4684,    0 }, { 'e',  1, 4685,    0 }, { 'r',  0, 4686, 1512 }, { 'l',  1, 4686,    0 },
+    { 'i',  1, 4687,    0 }, { 'l',  0, 4688, 1517 }, { 'n',  1, 4688,    0 }, { 'o',  1, 4689,    0 },
+    { 'i',  1, 4690,    0 }, { 'e',  1, 4691,    0 }, { 'a',  1, 4692,    0 }, { 'e',  0, 4693, 1529 },
+    { 'h',  1, 4693,    0 }, { 'c',  1, 4694,    0 }, { 'k',  1, 4695,    0 }, { 'a',  1, 4696,    0 },
+    { 'b',  0, 4697, 1538 }, { 'c',  1, 4697,    0 }, { 'd',  2, 4698,    0 }, { 'e',  0, 4700, 1542 },
+    { 'm',  1, 4700,    0 }, { 's',  1, 4701,    0 }, { 't',  1, 4702,    0 }, { 't',  1, 4703,    0 },
+    { 'd',  0, 4704, 1549 }, { 'e',  0, 4704, 1553 }, { 'a',  1, 4704,    0 }, { 'c',  1, 4705,    0 },
+    { 'e',  1, 4706,    0 }, { 'n',  3, 4707,    0 }, { 's',  1, 4710,    0 }, { 'e',  1, 4711, 1563 },
+    { 'p',  0, 4712, 1566 }, { 'i',  1, 4712,    0 }, { 'a',  1, 4713,    0 }, { 'l',  1, 4714,    0 },
+    { 's',  1, 4715,    0 }, { 't',  1, 4716,    0 }, { 'm',  0, 4717, 1574 }, { 'e',  1, 4717,    0 },
+    { 's',  1, 4718,    0 }, { 'm',  1, 4719,    0 }, { 'e',  1, 4720,    0 }, { 'i',  1, 4721,    0 },
+    { 't',  1, 4722, 1586 }, { 'r',  0, 4723, 1589 }, { 'i',  1, 4723,    0 }, { 'r',  0, 4724, 1592 },
+    { 't',  1, 4724,    0 }, { 'c',  0, 4725, 1595 }, { 'p',  1, 4725,    0 }, { 'd',  0, 4726, 1598 },
+    { 'e',  0, 4726, 1599 }, { 'l',  1, 4726,    0 }, { 'o',  0, 4727, 1601 }, { 'a',  1, 4727,    0 },
+    { 'b',  1, 4728, 1604 }, { 'c',  0, 4729, 1606 }, { 'f',  1, 4729,    0 }, { 'h',  1, 4730,    0 },
+    { 'l',  1, 4731,    0 }, { 'p',  1, 4732,    0 }, { 's',  1, 4733,    0 }, { 't',  1, 4734,    0 },
+    { 'w',  0, 4735, 1613 }, { 'i',  1, 4735,    0 }, { 'o',  1, 4736, 1615 }, { 'r',  0, 4737, 1617 },
+    { 'k',  0, 4737, 1618 }, { 'c',  2, 4737,    0 }, { 'e',  0, 4739, 1621 }, { 's',  1, 4739,    0 },
+    { 'o',  1, 4740,    0 }, { 'i',  1, 4741,    0 }, { 'l',  0, 4742, 1626 }, { 'h',  1, 4742,    0 },
+    { 'o',  1, 4743, 1631 }, { 'i',  1, 4744,    0 }, { 'p',  1, 4745,    0 }, { 's',  0, 4746, 1637 },
+    { 'h',  1, 4746,    0 }, { 'o',  1, 4747,    0 }, { 'd',  0, 4748, 1643 }, { 'u',  1, 4748, 1644 },
+    { 't',  6, 4749,    0 }, { 'n',  1, 4755,    0 }, { 'r',  0, 4756, 1659 }, { 'r',  0, 4756, 1660 },
+    { 's',  1, 4756,    0 }, { 'd',  0, 4757, 1664 }, { 'g',  0, 4757, 1665 }, { 'r',  0, 4757, 1666 },
+    { 'k',  0, 4757, 1667 }, { 'r',  0, 4757, 1668 }, { 'u',  1, 4757,    0 }, { 'm',  1, 4758,    0 },
+    { 'g',  1, 4759,    0 }, { 'l',  1, 4760,    0 }, { 'r',  0, 4761, 1675 }, { 'u',  1, 4761,    0 },
+    { 'o',  1, 4762, 1680 }, { 'e',  1, 4763,    0 }, { 'e',  1, 4764,    0 }, { 'e',  0, 4765, 1685 },
+    { 'f',  0, 4765, 1686 }, { 'l',  1, 4765,    0 }, { 'h',  1, 4766,    0 }, { 't',  1, 4767,    0 },
+    { 'o',  0, 4768, 1691 }, { 'o',  1, 4768,    0 }, { 'e',  0, 4769, 1696 }, { 'i',  1, 4769,    0 },
+    { 'c',  0, 4770, 1699 }, { 'p',  0, 4770, 1701 }, { 'i',  1, 4770,    0 }, { 'l',  1, 4771,    0 },
+    { 'm',  0, 4772, 1704 }, { 'b',  0, 4772, 1707 }, { 'e',  0, 4772, 1708 }, { 'r',  0, 4772, 1709 },
+    { 'h',  1, 4772,    0 }, { 'r',  1, 4773, 1711 }, { 'a',  1, 4774,    0 }, { 'i',  1, 4775,    0 },
+    { 'n',  0, 4776, 1717 }, { 'w',  1, 4776,    0 }, { 'p',  0, 4777, 1721 }, { 'c',  1, 4777,    0 },
+    { 't',  2, 4778,    0 }, { 'a',  2, 4780, 1727 }, { 'o',  1, 4782,    0 }, { 'q',  0, 4783, 1733 },
+    { 'E',  0, 4783, 1735 }, { 'E',  0, 4783, 1737 }, { 'e',  0, 4783, 1738 }, { 'l',  1, 4783,    0 },
+    { 'a',  1, 4784,    0 }, { 'r',  0, 4785, 1741 }, { 'l',  1, 4785,    0 }, { 'h',  1, 4786,    0 },
+    { 'a',  1, 4787,    0 }, { 'e',  0, 4788, 1746 }, { 'c',  1, 4788,    0 }, { 'a',  1, 4789,    0 },
+    { 'e',  1, 4790,    0 }, { 'p',  0, 4791, 1757 }, { 'p',  0, 4791, 1758 }, { 'b',  2, 4791, 1759 },
+    { 'p',  2, 4793, 1763 }, { 'r',  2, 4795,    0 }, { 'r',  0, 4797, 1771 }, { 'm',  1, 4797,    0 },
+    { 'l',  1, 4798,    0 }, { 'r',  1, 4799,    0 }, { 'f',  0, 4800, 1777 }, { 'i',  1, 4800,    0 },
+    { 's',  0, 4801, 1780 }, { 'o',  1, 4801,    0 }, { 'd',  1, 4802,    0 }, { 'u',  1, 4803,    0 },
+    { 'E',  0, 4804, 1787 }, { 'e',  0, 4804, 1788 }, { 'l',  1, 4804,    0 }, { 'a',  1, 4805,    0 },
+    { 'e',  1, 4806,    0 }, { 'i',  1, 4807,    0 }, { 'u',  2, 4808,    0 }, { 'a',  1, 4810,    0 },
+    { 'c',  1, 4811,    0 }, { 'e',  1, 4812,    0 }, { 'n',  3, 4813,    0 }, { 's',  1, 4816,    0 },
+    { 'o',  1, 4817,    0 }, { 's',  1, 4818,    0 }, { 'd',  1, 4819,    0 }, { 's',  2, 4820,    0 },
+    { 'a',  1, 4822,    0 }, { 'u',  1, 4823,    0 }, { 'E',  0, 4824, 1822 }, { 'e',  0, 4824, 1823 },
+    { 'l',  1, 4824,    0 }, { 'e',  1, 4825,    0 }, { 'i',  1, 4826,    0 }, { 'u',  2, 4827,    0 },
+    { 'r',  0, 4829, 1833 }, { 'h',  1, 4829,    0 }, { 'r',  1, 4830, 1835 }, { 'a',  1, 4831,    0 },
+    { 'g',  0, 4832, 1838 }, { 'e',  1, 4832,    0 }, { 'o',  1, 4833,    0 }, { 'i',  1, 4834,    0 },
+    { 'e',  1, 4835,    0 }, { 'e',  2, 4836,    0 }, { 'a',  2, 4838, 1850 }, { 'k',  2, 4840,    0 },
+    { 's',  1, 4842,    0 }, { 'p',  0, 4843, 1856 }, { 'i',  1, 4843,    0 }, { 'n',  0, 4844, 1858 },
+    { 'e',  0, 4844, 1859 }, { 's',  2, 4844, 1860 }, { 'o',  1, 4846,    0 }, { 'i',  1, 4847,    0 },
+    { 'o',  1, 4848,    0 }, { 'm',  1, 4849,    0 }, { 'e',  0, 4850, 1873 }, { 'n',  1, 4850,    0 },
+    { 'o',  1, 4851,    0 }, { 'i',  1, 4852,    0 }, { 'l',  1, 4853,    0 }, { 'b',  0, 4854, 1885 },
+    { 'i',  1, 4854,    0 }, { 'z',  1, 4855,    0 }, { 'y',  0, 4856, 1890 }, { 'o',  1, 4856,    0 },
+    { 't',  0, 4857, 1892 }, { 'e',  1, 4857,    0 }, { 't',  1, 4858,    0 }, { 'y',  0, 4859, 1899 },
+    { 'v',  1, 4859,    0 }, { 'c',  0, 4860, 1901 }, { 'r',  0, 4860, 1903 }, { 'a',  1, 4860,    0 },
+    { 'r',  0, 4861, 1905 }, { 'h',  1, 4861,    0 }, { 'v',  1, 4862,    0 }, { 'l',  0, 4863, 1909 },
+    { 'r',  0, 4863, 1910 }, { 'k',  0, 4863, 1911 }, { 'r',  1, 4863,    0 }, { 'o',  1, 4864,    0 },
+    { 'i',  0, 4865, 1915 }, { 'r',  0, 4865, 1916 }, { 'n',  0, 4865, 1918 }, { 'r',  1, 4865,    0 },
+    { 'w',  1, 4866,    0 }, { 'r',  1, 4867,    0 }, { 's',  0, 4868, 1924 }, { 'h',  0, 4868, 1926 },
+    { 'l',  1, 4868,    0 }, { 'a',  1, 4869,    0 }, { 'r',  1, 4870,    0 }, { 'o',  1, 4871,    0 },
+    { 'g',  0, 4872, 1932 }, { 'i',  0, 4872, 1933 }, { 't',  0, 4872, 1935 }, { 'd',  1, 4872,    0 },
+    { 'f',  0, 4873, 1938 }, { 'r',  0, 4873, 1939 }, { 'g',  1, 4873,    0 }, { 'v',  0, 4874, 1944 },
+    { 'h',  0, 4874, 1945 }, { 'r',  1, 4874,    0 }, { 'p',  1, 4875,    0 }, { 'a',  1, 4876,    0 },
+    { 'o',  1, 4877,    0 }, { 'h',  1, 4878,    0 }, { 'i',  0, 4879, 1951 }, { 'r',  1, 4879,    0 },
+    { 'h',  1, 4880,    0 }, { 'i',  1, 4881,    0 }, { 'h',  1, 4882,    0 }, { 'r',  1, 4883,    0 },
+    { 'h',  0, 4884, 1960 }, { 'a',  1, 4884,    0 }, { 'q',  0, 4885, 1963 }, { 'i',  1, 4885,    0 },
+    { 'a',  1, 4886,    0 }, { 'i',  0, 4887, 1968 }, { 'p',  0, 4887, 1970 }, { 'i',  0, 4887, 1971 },
+    { 'z',  1, 4887,    0 }, { 'c',  0, 4888, 1974 }, { 'a',  1, 4888,    0 }, { 'e',  1, 4889, 1976 },
+    { 'r',  1, 4890,    0 }, { 't',  1, 4891,    0 }, { 'c',  0, 4892, 1986 }, { 'i',  0, 4892, 1988 },
+    { 'r',  0, 4892, 1990 }, { 'r',  0, 4892, 1991 }, { 'r',  0, 4892, 1993 }, { 'r',  0, 4892, 1994 },
+    { 't',  0, 4892, 1997 }, { 'u',  1, 4892,    0 }, { 'm',  1, 4893,    0 }, { 'r',  0, 4894, 2001 },
+    { 'r',  0, 4894, 2002 }, { 'u',  1, 4894,    0 }, { 'u',  1, 4895,    0 }, { 'i',  0, 4896, 2006 },
+    { 'g',  1, 4896,    0 }, { 't',  1, 4897,    0 }, { 'c',  0, 4898, 2011 }, { 't',  1, 4898,    0 },
+    { 'o',  1, 4899,    0 }, { 'r',  1, 4900,    0 }, { 'a',  1, 4901,    0 }, { 'e',  0, 4902,    3 },
+    { 'e',  0, 4902,    4 }, { 'e',  0, 4902,    8 }, { 'F',  1, 4902,    0 }, { 'n',  0, 4903,   17 },
+    { 'e',  0, 4903,   18 }, { 'l',  1, 4903,    0 }, { 'd',  0, 4904,   22 }, { 's',  1, 4904,    0 },
+    { 'u',  1, 4905,    0 }, { 'q',  0, 4906,   31 }, { 'e',  0, 4906,   34 }, { 'a',  1, 4906,    0 },
+    { 'y',  1, 4907,    0 }, { 'n',  0, 4908,   38 }, { 'l',  0, 4908,   39 }, { 'n',  1, 4908,    0 },
+    { 'l',  1, 4909,    0 }, { 'r',  1, 4910,    0 }, { 'e',  4, 4911,    0 }, { 'w',  1, 4915,    0 },
+    { 'C',  1, 4916,    0 }, { 'e',  0, 4917,   55 }, { 'u',  1, 4917,    0 }, { 't',  0, 4918,   57 },
+    { 'u',  1, 4918,    0 }, { 'd',  1, 4919,    0 }, { 'e',  1, 4920,    0 }, { 'p',  0, 4921,   65 },
+    { 'a',  1, 4921,    0 }, { 'r',  0, 4922,   71 }, { 'n',  0, 4922,   74 }, { 'i',  1, 4922,    0 },
+    { 'n',  1, 4923,    0 }, { 'r',  1, 4924,    0 }, { 't',  0, 4925,   88 }, { 'u',  1, 4925,    0 },
+    { 'e',  6, 4926,    0 }, { 'r',  1, 4932,    0 }, { 'r',  1, 4933,    0 }, { 'e',  1, 4934,    0 },
+    { 'i',  1, 4935,    0 }, { 'e',  1, 4936,    0 }, { 'r',  1, 4937,    0 }, { 'k',  0, 4938,  119 },
+    { 'e',  0, 4938,  122 }, { 'n',  0, 4938,  123 }, { 'e',  0, 4938,  128 }, { 'n',  1, 4938,    0 },
+    { 'S',  1, 4939,    0 }, { 'V',  1, 4940,    0 }, { 'o',  1, 4941,    0 }, { 'T',  1, 4942,    0 },
+    { 'i',  1, 4943,    0 }, { 's',  0, 4944,  143 }, { 'e',  1, 4944,    0 }, { 'd',  2, 4945,    0 },
+    { 'l',  0, 4947,  150 }, { 'e',  1, 4947,    0 }, { 'd',  0, 4948,  156 }, { 'e',  0, 4948,  157 },
+    { 'l',  0, 4948,  158 }, { 'e',  1, 4948,    0 }, { 'y',  0, 4949,  174 }, { 'r',  1, 4949,    0 },
+    { 'o',  1, 4950,    0 }, { 'k',  0, 4951,  183 }, { 'o',  1, 4951,    0 }, { 'q',  1, 4952,    0 },
+    { 'e',  0, 4953,  189 }, { 'e',  0, 4953,  194 }, { 'n',  1, 4953,    0 }, { 'e',  1, 4954,    0 },
+    { 'r',  1, 4955,    0 }, { 's',  1, 4956,    0 }, { 'i',  1, 4957,    0 }, { 'e',  0, 4958,  208 },
+    { 'y',  0, 4958,  216 }, { 'l',  0, 4958,  221 }, { 'e',  0, 4958,  228 }, { 'a',  0, 4958,  229 },
+    { 'c',  1, 4958,    0 }, { 'n',  0, 4959,  233 }, { 'l',  0, 4959,  234 }, { 'n',  1, 4959,    0 },
+    { 'r',  1, 4960,    0 }, { 'e',  1, 4961,    0 }, { 'o',  2, 4962,    0 }, { 'l',  1, 4964,    0 },
+    { 'i',  1, 4965,    0 }, { 'e',  1, 4966,    0 }, { 'r',  1, 4967,    0 }, { 'p',  3, 4968,    0 },
+    { 'e',  1, 4971,    0 }, { 'r',  1, 4972,    0 }, { 'i',  1, 4973,    0 }, { 'q',  1, 4974,    0 },
+    { 'u',  1, 4975,    0 }, { 'r',  1, 4976,    0 }, { 'e',  1, 4977,    0 }, { 'l',  1, 4978,    0 },
+    { 'i',  1, 4979,    0 }, { 'a',  1, 4980,    0 }, { 't',  0, 4981,  271 }, { 'e',  1, 4981,    0 },
+    { 'i',  1, 4982,    0 }, { 'e',  1, 4983,    0 }, { 'i',  1, 4984,    0 }, { 'L',  1, 4985,    0 },
+    { 'R',  1, 4986,    0 }, { 'k',  0, 4987,  283 }, { 'm',  1, 4987,    0 }, { 'n',  1, 4988,    0 },
+    { 'P',  1, 4989,    0 }, { 'e',  0, 4990,  295 }, { 'n',  0, 4990,  296 }, { 'l',  0, 4990,  297 },
+    { 'i',  1, 4990,    0 }, { 'd',  2, 4991,    0 }, { 'n',  1, 4993,    0 }, { 'a',  1, 4994,    0 },
+    { 'e',  1, 4995,    0 }, { 'n',  1, 4996,    0 }, { 'p',  1, 4997,    0 }, { 'u',  1, 4998,    0 },
+    { 'e',  1, 4999,    0 }, { 'u',  1, 5000,    0 }, { 'i',  1, 5001,    0 }, { 'e',  1, 5002,    0 },
+    { 'f',  1, 5003,    0 }, { 's',  1, 5004,    0 }, { 'e',  1, 5005,    0 }, { 'v',  1, 5006,    0 },
+    { 'g',  1, 5007,    0 }, { 'u',  1, 5008,    0 }, { 'b',  1, 5009,    0 }, { 'c',  1, 5010,    0 },
+    { 'p',  1, 5011,    0 }, { 'l',  1, 5012,    0 }, { 'r',  1, 5013,    0 }, { 'e',  0, 5014,  344 },
+    { 'e',  0, 5014,  347 }, { 'c',  0, 5014,  350 }, { 'e',  0, 5014,  352 }, { 'o',  1, 5014,    0 },
+    { 'u',  1, 5015,    0 }, { 'h',  0, 5016,  361 }, { 'e',  0, 5016,  362 }, { 's',  0, 5016,  363 },
+    { 'a',  1, 5016,    0 }, { 'r',  1, 5017,    0 }, { 'a',  1, 5018,    0 }, { 'a',  1, 5019,    0 },
+    { 'i',  1, 5020,    0 }, { 'a',  1, 5021,    0 }, { 'd',  1, 5022,    0 }, { 'c',  1, 5023,    0 },
+    { 'r',  1, 5024,    0 }, { 'e',  0, 5025,  394 }, { 'l',  0, 5025,  397 }, { 'n',  0, 5025,  398 },
+    { 'l',  0, 5025,  399 }, { 's',  1, 5025,    0 }, { 'A',  2, 5026,    0 }, { 'C',  1, 5028,    0 },
+    { 'D',  1, 5029,    0 }, { 'F',  1, 5030,    0 }, { 'T',  2, 5031,    0 }, { 'U',  1, 5033,    0 },
+    { 'V',  1, 5034,    0 }, { 'a',  1, 5035,    0 }, { 'I',  1, 5036,    0 }, { 't',  1, 5037,    0 },
+    { 'e',  1, 5038,    0 }, { 'y',  0, 5039,  436 }, { 'y',  0, 5039,  438 }, { 'e',  0, 5039,  439 },
+    { 'n',  0, 5039,  441 }, { 'l',  0, 5039,  442 }, { 'D',  1, 5039,    0 }, { 'L',  1, 5040,    0 },
+    { 'R',  1, 5041,    0 }, { 'U',  1, 5042,    0 }, { 'C',  1, 5043,    0 }, { 'e',  3, 5044,  454 },
+    { 't',  1, 5047,  464 }, { 'e',  1, 5048,    0 }, { 'h',  1, 5049,    0 }, { 's',  1, 5050,    0 },
+    { 't',  0, 5051,  475 }, { 'n',  0, 5051,  482 }, { 'l',  0, 5051,  483 }, { 'f',  1, 5051,    0 },
+    { 'p',  1, 5052,    0 }, { 'E',  1, 5053,    0 }, { 'F',  1, 5054,    0 }, { 'T',  1, 5055,    0 },
+    { 'e',  1, 5056,    0 }, { 'k',  0, 5057,  496 }, { 'e',  0, 5057,  497 }, { 'c',  1, 5057,    0 },
+    { 'e',  0, 5058,  501 }, { 'c',  0, 5058,  504 }, { 'e',  0, 5058,  506 }, { 'B',  2, 5058,    0 },
+    { 'P',  1, 5060,    0 }, { 'P',  1, 5061,    0 }, { 'o',  1, 5062,    0 }, { 'n',  1, 5063,    0 },
+    { 'i',  1, 5064,    0 }, { 'A',  1, 5065,    0 }, { 'o',  1, 5066,    0 }, { 'n',  1, 5067,    0 },
+    { 'L',  1, 5068,    0 }, { 'R',  1, 5069,    0 }, { 'o',  1, 5070,    0 }, { 'e',  0, 5071,  531 },
+    { 'l',  0, 5071,  537 }, { 'r',  0, 5071,  539 }, { 'c',  1, 5071,    0 }, { 'h',  1, 5072,    0 },
+    { 'h',  0, 5073,  549 }, { 'e',  0, 5073,  562 }, { 'e',  0, 5073,  570 }, { 'n',  0, 5073,  571 },
+    { 'i',  1, 5073,    0 }, { 'e',  0, 5074,  579 }, { 'e',  0, 5074,  580 }, { 'e',  0, 5074,  589 },
+    { 'y',  1, 5074,    0 }, { 'd',  0, 5075,  597 }, { 'o',  1, 5075,    0 }, { 'd',  1, 5076,  604 },
+    { 'v',  1, 5077,    0 }, { 'h',  0, 5078,  616 }, { 'r',  1, 5078,    0 }, { 'r',  0, 5079,  623 },
+    { 'x',  1, 5079,  627 }, { 'e',  1, 5080,    0 }, { 'e',  0, 5081,  634 }, { 'i',  1, 5081,    0 },
+    { 'o',  1, 5082,    0 }, { 'p',  1, 5083,    0 }, { 'r',  1, 5084,    0 }, { 'i',  1, 5085,    0 },
+    { 'e',  0, 5086,  644 }, { 'd',  1, 5086,  645 }, { 'b',  1, 5087,    0 }, { 's',  1, 5088,  652 },
+    { 'y',  1, 5089,    0 }, { 'u',  0, 5090,  656 }, { 'e',  1, 5090,    0 }, { 'p',  0, 5091,  661 },
+    { 'r',  1, 5091,    0 }, { 'p',  0, 5092,  663 }, { 'o',  1, 5092,    0 }, { 'l',  1, 5093,    0 },
+    { 'i',  1, 5094,    0 }, { 'c',  1, 5095,    0 }, { 'a',  1, 5096,    0 }, { 'i',  1, 5097,    0 },
+    { 'l',  1, 5098,    0 }, { 'e',  0, 5099,  672 }, { 'd',  1, 5099,    0 }, { 'w',  0, 5100,  674 },
+    { 'l',  1, 5100,    0 }, { 's',  1, 5101,    0 }, { 't',  1, 5102,    0 }, { 'm',  0, 5103,  689 },
+    { 'e',  0, 5103,  690 }, { 'x',  0, 5103,  711 }, { 'n',  1, 5103,    0 }, { 'u',  1, 5104,    0 },
+    { 'm',  1, 5105,    0 }, { 'e',  0, 5106,  735 }, { 'r',  0, 5106,  737 }, { 's',  1, 5106,    0 },
+    { 't',  0, 5107,  746 }, { 'q',  0, 5107,  750 }, { 'e',  0, 5107,  751 }, { 'd',  0, 5107,  753 },
+    { 'c',  1, 5107,    0 }, { 'p',  0, 5108,  755 }, { 'p',  0, 5108,  756 }, { 't',  0, 5108,  757 },
+    { 'n',  0, 5108,  761 }, { 'l',  0, 5108,  762 }, { 's',  1, 5108,    0 }, { 'y',  1, 5109,    0 },
+    { 'r',  1, 5110,    0 }, { 'm',  1, 5111,    0 }, { 'q',  0, 5112,  779 }, { 'e',  2, 5112,    0 },
+    { 'i',  1, 5114,    0 }, { 'd',  0, 5115,  789 }, { 'i',  1, 5115,    0 }, { 'u',  1, 5116,    0 },
+    { 'e',  1, 5117,  794 }, { 't',  0, 5118,  797 }, { 'n',  0, 5118,  799 }, { 'e',  2, 5118,    0 },
+    { 'o',  1, 5120,    0 }, { 't',  0, 5121,  804 }, { 'd',  0, 5121,  806 }, { 'r',  0, 5121,  808 },
+    { 'r',  2, 5121,    0 }, { 'r',  1, 5123,  821 }, { 'c',  1, 5124,    0 }, { 'p',  0, 5125,  825 },
+    { 'p',  0, 5125,  826 }, { 't',  0, 5125,  827 }, { 'r',  1, 5125,  829 }, { 'e',  1, 5126,    0 },
+    { 'v',  1, 5127,    0 }, { 'w',  1, 5128,    0 }, { 'n',  0, 5129,  835 }, { 'a',  1, 5129,    0 },
+    { 'i',  1, 5130,    0 }, { 'y',  0, 5131,  842 }, { 'r',  0, 5131,  845 }, { 'h',  0, 5131,  846 },
+    { 'o',  1, 5131,    0 }, { 'n',  0, 5132,  852 }, { 'e',  1, 5132,    0 }, { 'e',  1, 5133,    0 },
+    { 'y',  1, 5134,    0 }, { 't',  0, 5135,  861 }, { 'n',  1, 5135,    0 }, { 'm',  1, 5136,    0 },
+    { 'e',  1, 5137,  873 }, { 'x',  0, 5138,  875 }, { 'n',  0, 5138,  877 }, { 'p',  0, 5138,  878 },
+    { 'r',  0, 5138,  879 }, { 'd',  1, 5138,    0 }, { 'n',  1, 5139,    0 }, { 'u',  1, 5140,    0 },
+    { 'u',  1, 5141,    0 }, { 'e',  1, 5142,    0 }, { 'r',  1, 5143,    0 }, { 'o',  1, 5144,    0 },
+    { 'a',  1, 5145,    0 }, { 'r',  1, 5146,    0 }, { 'n',  0, 5147,  893 }, { 'p',  0, 5147,  894 },
+    { 'k',  0, 5147,  898 }, { 'l',  1, 5147,    0 }, { 'a',  1, 5148,    0 }, { 'e',  0, 5149,  909 },
+    { 'r',  0, 5149,  910 }, { 'n',  0, 5149,  911 }, { 'n',  0, 5149,  914 }, { 'e',  0, 5149,  921 },
+    { 't',  0, 5149,  923 }, { 'e',  1, 5149,    0 }, { 't',  0, 5150,  928 }, { 's',  1, 5150,    0 },
+    { 'v',  0, 5151,  932 }, { '3',  0, 5151,  934 }, { '4',  0, 5151,  935 }, { 'l',  0, 5151,  941 },
+    { 'o',  1, 5151,    0 }, { 'c',  0, 5152,  946 }, { 'o',  1, 5152,    0 }, { 'n',  1, 5153,    0 },
+    { 's',  0, 5154,  951 }, { 't',  0, 5154,  952 }, { 'D',  1, 5154,    0 }, { 'r',  1, 5155,    0 },
+    { 't',  1, 5156,    0 }, { 'e',  1, 5157,    0 }, { 'n',  1, 5158,    0 }, { 'e',  0, 5159,  971 },
+    { 'g',  0, 5159,  972 }, { 'g',  0, 5159,  974 }, { 'l',  0, 5159,  982 }, { 'i',  1, 5159,    0 },
+    { '2',  0, 5160,  986 }, { '3',  0, 5160,  987 }, { '4',  0, 5160,  988 }, { '5',  0, 5160,  989 },
+    { '6',  0, 5160,  990 }, { '8',  0, 5160,  991 }, { '3',  0, 5160,  992 }, { '5',  0, 5160,  993 },
+    { '4',  0, 5160,  994 }, { '5',  0, 5160,  995 }, { '8',  0, 5160,  996 }, { '5',  0, 5160,  997 },
+    { '6',  0, 5160,  998 }, { '8',  0, 5160,  999 }, { '8',  0, 5160, 1000 }, { 'e',  0, 5160, 1006 },
+    { 'd',  0, 5160, 1008 }, { 'e',  0, 5160, 1010 }, { 'a',  1, 5160,    0 }, { 't',  1, 5161, 1021 },
+    { 's',  0, 5162, 1024 }, { 'r',  1, 5162,    0 }, { 'r',  0, 5163, 1051 }, { 's',  1, 5163,    0 },
+    { 'p',  1, 5164,    0 }, { 'r',  0, 5165, 1054 }, { 't',  0, 5165, 1055 }, { 'l',  1, 5165,    0 },
+    { 'q',  1, 5166,    0 }, { 's',  1, 5167,    0 }, { 'm',  0, 5168, 1059 }, { 'p',  0, 5168, 1061 },
+    { 't',  0, 5168, 1063 }, { 'y',  0, 5168, 1064 }, { 'i',  1, 5168,    0 }, { 's',  1, 5169, 1070 },
+    { 'p',  0, 5170, 1072 }, { 'n',  0, 5170, 1073 }, { 'r',  1, 5170,    0 }, { 'r',  1, 5171,    0 },
+    { 't',  0, 5172, 1078 }, { 'e',  1, 5172,    0 }, { 'i',  1, 5173,    0 }, { 'r',  0, 5174, 1082 },
+    { 'h',  0, 5174, 1084 }, { 'k',  0, 5174, 1085 }, { 'l',  0, 5174, 1086 }, { 'n',  0, 5174, 1087 },
+    { 'e',  0, 5174, 1088 }, { 'e',  0, 5174, 1096 }, { 't',  0, 5174, 1098 }, { 'n',  0, 5174, 1100 },
+    { 'i',  1, 5174,    0 }, { 'a',  1, 5175,    0 }, { 'e',  0, 5176, 1111 }, { 't',  1, 5176,    0 },
+    { 't',  0, 5177, 1114 }, { 'l',  0, 5177, 1116 }, { 'e',  1, 5177,    0 }, { 'c',  1, 5178,    0 },
+    { 'r',  1, 5179,    0 }, { 'o',  1, 5180,    0 }, { 't',  0, 5181, 1126 }, { 'o',  1, 5181,    0 },
+    { 'v',  0, 5182, 1132 }, { 'e',  0, 5182, 1135 }, { 'y',  0, 5182, 1144 }, { 'v',  0, 5182, 1147 },
+    { 'l',  0, 5182, 1148 }, { 'n',  0, 5182, 1151 }, { 'l',  0, 5182, 1158 }, { 'e',  0, 5182, 1163 },
+    { 't',  1, 5182,    0 }, { 'n',  0, 5183, 1165 }, { 'a',  0, 5183, 1166 }, { 'e',  0, 5183, 1169 },
+    { 'f',  1, 5183,    0 }, { 's',  0, 5184, 1175 }, { 'k',  0, 5184, 1176 }, { 'p',  0, 5184, 1177 },
+    { 'l',  0, 5184, 1178 }, { 'i',  1, 5184,    0 }, { 'l',  0, 5185, 1180 }, { 'l',  0, 5185, 1182 },
+    { 'e',  0, 5185, 1186 }, { 'k',  0, 5185, 1187 }, { 'l',  2, 5185,    0 }, { 'n',  0, 5187, 1191 },
+    { 'l',  0, 5187, 1192 }, { 'r',  0, 5187, 1198 }, { 'a',  1, 5187,    0 }, { 'h',  1, 5188,    0 },
+    { 'r',  1, 5189,    0 }, { 'a',  1, 5190,    0 }, { 'e',  1, 5191,    0 }, { 'i',  1, 5192,    0 },
+    { 'h',  1, 5193,    0 }, { 'a',  1, 5194,    0 }, { 't',  1, 5195, 1219 }, { 's',  0, 5196, 1222 },
+    { 'p',  1, 5196,    0 }, { 'o',  1, 5197,    0 }, { 'q',  2, 5198,    0 }, { 't',  1, 5200,    0 },
+    { 'i',  1, 5201,    0 }, { 't',  0, 5202, 1229 }, { 'r',  0, 5202, 1230 }, { 'l',  0, 5202, 1236 },
+    { 'n',  1, 5202,    0 }, { 'd',  0, 5203, 1242 }, { 't',  0, 5203, 1244 }, { 't',  1, 5203, 1245 },
+    { 'r',  1, 5204,    0 }, { 'e',  1, 5205,    0 }, { 'a',  1, 5206,    0 }, { 'i',  1, 5207,    0 },
+    { 'r',  1, 5208,    0 }, { 's',  0, 5209, 1265 }, { 'e',  1, 5209,    0 }, { 't',  0, 5210, 1267 },
+    { 'r',  0, 5210, 1268 }, { 'g',  1, 5210,    0 }, { 't',  0, 5211, 1273 }, { 'n',  1, 5211,    0 },
+    { 'd',  0, 5212, 1277 }, { 'o',  0, 5212, 1280 }, { 'r',  0, 5212, 1288 }, { 'k',  0, 5212, 1289 },
+    { 'e',  0, 5212, 1294 }, { 's',  0, 5212, 1295 }, { 'r',  0, 5212, 1296 }, { 's',  1, 5212,    0 },
+    { 'r',  0, 5213, 1298 }, { 'h',  1, 5213,    0 }, { 'a',  1, 5214,    0 }, { 's',  1, 5215,    0 },
+    { 'o',  3, 5216, 1310 }, { 'r',  0, 5219, 1314 }, { 'a',  0, 5219, 1315 }, { 'r',  1, 5219,    0 },
+    { 't',  0, 5220, 1323 }, { 'r',  0, 5220, 1324 }, { 't',  0, 5220, 1325 }, { 'b',  0, 5220, 1327 },
+    { 'd',  1, 5220, 1328 }, { 's',  0, 5221, 1332 }, { 's',  0, 5221, 1333 }, { 's',  0, 5221, 1337 },
+    { 'm',  1, 5221,    0 }, { 'a',  1, 5222,    0 }, { 'r',  1, 5223,    0 }, { 't',  1, 5224,    0 },
+    { 'h',  0, 5225, 1344 }, { 'h',  0, 5225, 1345 }, { 'e',  0, 5225, 1347 }, { 'o',  1, 5225,    0 },
+    { 'a',  1, 5226,    0 }, { 'n',  0, 5227, 1356 }, { 'l',  0, 5227, 1357 }, { 'k',  0, 5227, 1364 },
+    { 'o',  1, 5227,    0 }, { 'v',  0, 5228, 1367 }, { 'r',  0, 5228, 1368 }, { 't',  1, 5228, 1369 },
+    { 'a',  1, 5229,    0 }, { 'r',  1, 5230,    0 }, { 'e',  0, 5231, 1396 }, { 'v',  3, 5231,    0 },
+    { 'v',  3, 5234,    0 }, { 'l',  1, 5237,    0 }, { 'n',  1, 5238,    0 }, { 'e',  0, 5239, 1412 },
+    { 't',  1, 5239,    0 }, { 'e',  0, 5240, 1418 }, { 'e',  0, 5240, 1420 }, { 't',  2, 5240,    0 },
+    { 'q',  0, 5242, 1426 }, { 'b',  1, 5242,    0 }, { 'p',  1, 5243,    0 }, { 'e',  1, 5244,    0 },
+    { 'e',  1, 5245,    0 }, { 'e',  0, 5246, 1439 }, { 'n',  1, 5246,    0 }, { 'o',  0, 5247, 1447 },
+    { 'h',  0, 5247, 1449 }, { 'r',  0, 5247, 1450 }, { 'h',  0, 5247, 1451 }, { 'i',  1, 5247,    0 },
+    { 'r',  0, 5248, 1453 }, { 'r',  0, 5248, 1454 }, { 'k',  0, 5248, 1456 }, { 'o',  1, 5248,    0 },
+    { 'r',  0, 5249, 1459 }, { 'e',  0, 5249, 1461 }, { 'c',  0, 5249, 1467 }, { 'd',  0, 5249, 1470 },
+    { 'e',  0, 5249, 1475 }, { 's',  1, 5249,    0 }, { 'o',  1, 5250,    0 }, { 's',  0, 5251, 1489 },
+    { 'o',  1, 5251,    0 }, { 'f',  0, 5252, 1501 }, { 'p',  1, 5252,    0 }, { 'h',  0, 5253, 1506 },
+    { 'e',  0, 5253, 1508 }, { 's',  1, 5253, 1509 }, { 'l',  1, 5254,    0 }, { 'm',  0, 5255, 1516 },
+    { 't',  0, 5255, 1520 }, { 'd',  0, 5255, 1521 }, { 'l',  0, 5255, 1522 }, { 'n',  1, 5255,    0 },
+    { 't',  0, 5256, 1528 }, { 'f',  1, 5256,    0 }, { 'k',  1, 5257, 1533 }, { 'v',  0, 5258, 1535 },
+    { 'c',  1, 5258,    0 }, { 'i',  1, 5259,    0 }, { 'o',  0, 5260, 1540 }, { 'u',  0, 5260, 1541 },
+    { 'n',  0, 5260, 1543 }, { 'i',  1, 5260,    0 }, { 'w',  1, 5261,    0 }, { 'i',  1, 5262,    0 },
+    { 'p',  1, 5263,    0 }, { 'u',  1, 5264,    0 }, { 'q',  0, 5265, 1558 }, { 'a',  1, 5265,    0 },
+    { 'e',  1, 5266,    0 }, { 's',  1, 5267,    0 }, { 'i',  1, 5268,    0 }, { 's',  0, 5269, 1564 },
+    { 'm',  0, 5269, 1567 }, { 'l',  1, 5269,    0 }, { 'i',  1, 5270,    0 }, { 'u',  1, 5271,    0 },
+    { 'o',  0, 5272, 1573 }, { 'l',  0, 5272, 1575 }, { 'p',  0, 5272, 1578 }, { 'e',  0, 5272, 1582 },
+    { 'r',  1, 5272,    0 }, { 'n',  1, 5273,    0 }, { 'e',  1, 5274,    0 }, { 'l',  0, 5275, 1591 },
+    { 'e',  0, 5275, 1594 }, { 't',  1, 5275,    0 }, { 'e',  0, 5276, 1600 }, { 'p',  0, 5276, 1603 },
+    { 'f',  1, 5276,    0 }, { 's',  0, 5277, 1607 }, { 'k',  0, 5277, 1608 }, { 'p',  0, 5277, 1609 },
+    { 'l',  0, 5277, 1610 }, { 'i',  1, 5277,    0 }, { 'l',  0, 5278, 1612 }, { 'l',  0, 5278, 1614 },
+    { 'n',  1, 5278,    0 }, { 'e',  0, 5279, 1619 }, { 'k',  0, 5279, 1620 }, { 'l',  2, 5279,    0 },
+    { 'n',  0, 5281, 1624 }, { 'l',  0, 5281, 1625 }, { 'a',  1, 5281,    0 }, { 'r',  0, 5282, 1632 },
+    { 'n',  1, 5282,    0 }, { 'a',  1, 5283,    0 }, { 't',  0, 5284, 1640 }, { 'r',  0, 5284, 1641 },
+    { 'l',  0, 5284, 1645 }, { 'a',  1, 5284,    0 }, { 'h',  1, 5285,    0 }, { 'l',  1, 5286,    0 },
+    { 'r',  1, 5287,    0 }, { 's',  1, 5288,    0 }, { 't',  1, 5289,    0 }, { 'g',  1, 5290,    0 },
+    { 't',  1, 5291, 1662 }, { 's',  0, 5292, 1670 }, { 'e',  1, 5292,    0 }, { 't',  0, 5293, 1673 },
+    { 'i',  1, 5293,    0 }, { 'o',  0, 5294, 1676 }, { 'r',  0, 5294, 1681 }, { 'e',  0, 5294, 1682 },
+    { 's',  0, 5294, 1683 }, { 't',  1, 5294,    0 }, { 'a',  1, 5295,    0 }, { 'e',  0, 5296, 1690 },
+    { 'n',  0, 5296, 1695 }, { 'l',  0, 5296, 1698 }, { 'm',  0, 5296, 1702 }, { 'i',  1, 5296,    0 },
+    { 'k',  0, 5297, 1710 }, { 'o',  1, 5297,    0 }, { 'r',  0, 5298, 1715 }, { 'n',  1, 5298,    0 },
+    { 'n',  0, 5299, 1720 }, { 'y',  0, 5299, 1722 }, { 'm',  1, 5299,    0 }, { 'p',  1, 5300,    0 },
+    { 'f',  0, 5301, 1728 }, { 'v',  0, 5301, 1729 }, { 't',  0, 5301, 1731 }, { 'u',  1, 5301,    0 },
+    { 'r',  1, 5302,    0 }, { 's',  1, 5303,    0 }, { 'p',  0, 5304, 1743 }, { 'r',  1, 5304,    0 },
+    { 'y',  0, 5305, 1749 }, { 'r',  0, 5305, 1752 }, { 's',  1, 5305, 1754 }, { 'e',  0, 5306, 1760 },
+    { 's',  1, 5306,    0 }, { 'e',  0, 5307, 1764 }, { 's',  1, 5307,    0 }, { 'e',  0, 5308, 1768 },
+    { 'f',  0, 5308, 1769 }, { 'n',  0, 5308, 1773 }, { 'e',  0, 5308, 1774 }, { 'f',  0, 5308, 1775 },
+    { 'g',  1, 5308,    0 }, { 't',  0, 5309, 1783 }, { 'o',  1, 5309,    0 }, { 'l',  1, 5310,    0 },
+    { 'u',  1, 5311,    0 }, { 'r',  1, 5312,    0 }, { 't',  2, 5313, 1791 }, { 'm',  0, 5315, 1796 },
+    { 'b',  0, 5315, 1797 }, { 'p',  0, 5315, 1798 }, { 'p',  1, 5315,    0 }, { 'u',  1, 5316,    0 },
+    { 'q',  0, 5317, 1802 }, { 'a',  1, 5317,    0 }, { 'e',  1, 5318,    0 }, { 's',  1, 5319,    0 },
+    { 'i',  1, 5320,    0 }, { 't',  0, 5321, 1814 }, { 'u',  1, 5321,    0 }, { 'o',  1, 5322,    0 },
+    { 'o',  1, 5323,    0 }, { 'u',  1, 5324,    0 }, { 'r',  1, 5325,    0 }, { 'l',  1, 5326,    0 },
+    { 'u',  1, 5327,    0 }, { 't',  2, 5328, 1825 }, { 'm',  0, 5330, 1830 }, { 'b',  0, 5330, 1831 },
+    { 'p',  0, 5330, 1832 }, { 'k',  0, 5330, 1834 }, { 'o',  1, 5330,    0 }, { 'r',  0, 5331, 1837 },
+    { 't',  0, 5331, 1839 }, { 'n',  0, 5331, 1842 }, { 'l',  0, 5331, 1843 }, { 'c',  0, 5331, 1846 },
+    { '4',  0, 5331, 1848 }, { 'f',  1, 5331,    0 }, { 's',  1, 5332,    0 }, { 'v',  0, 5333, 1852 },
+    { 'a',  1, 5333,    0 }, { 's',  1, 5334,    0 }, { 'p',  0, 5335, 1855 }, { 'm',  0, 5335, 1857 },
+    { 'b',  1, 5335, 1861 }, { 'd',  0, 5336, 1863 }, { 't',  0, 5336, 1867 }, { 'r',  0, 5336, 1868 },
+    { 'r',  1, 5336,    0 }, { 'e',  0, 5337, 1872 }, { 'g',  1, 5337,    0 }, { 't',  0, 5338, 1881 },
+    { 'n',  1, 5338,    0 }, { 'u',  1, 5339,    0 }, { 'm',  1, 5340,    0 }, { 'i',  1, 5341,    0 },
+    { 'k',  0, 5342, 1891 }, { 'a',  1, 5342,    0 }, { 'e',  0, 5343, 1897 }, { 'e',  0, 5343, 1900 },
+    { 'c',  0, 5343, 1904 }, { 't',  0, 5343, 1906 }, { 'e',  0, 5343, 1908 }, { 'n',  1, 5343, 1912 },
+    { 'p',  0, 5344, 1914 }, { 'o',  1, 5344,    0 }, { 'n',  1, 5345,    0 }, { 'p',  1, 5346,    0 },
+    { 'o',  1, 5347,    0 }, { 'r',  1, 5348,    0 }, { 'n',  1, 5349, 1929 }, { 'p',  0, 5350, 1931 },
+    { 'e',  0, 5350, 1936 }, { 'l',  1, 5350,    0 }, { 't',  0, 5351, 1946 }, { 's',  1, 5351,    0 },
+    { 'p',  1, 5352,    0 }, { 't',  1, 5353,    0 }, { 'i',  0, 5354, 1950 }, { 'o',  1, 5354,    0 },
+    { 'o',  0, 5355, 1954 }, { 'g',  1, 5355,    0 }, { 'e',  1, 5356,    0 }, { 'i',  1, 5357,    0 },
+    { 'r',  0, 5358, 1962 }, { 'p',  0, 5358, 1964 }, { 'r',  0, 5358, 1965 }, { 'a',  1, 5358,    0 },
+    { 'r',  0, 5359, 1975 }, { 'q',  0, 5359, 1977 }, { 'p',  0, 5359, 1978 }, { 'h',  0, 5359, 1983 },
+    { 's',  0, 5359, 1999 }, { 'e',  0, 5359, 2000 }, { 'p',  0, 5359, 2004 }, { 's',  0, 5359, 2005 },
+    { 'e',  0, 5359, 2008 }, { 'e',  0, 5359, 2009 }, { 'e',  0, 5359, 2020 }, { 'n',  0, 5359, 2021 },
+    { 'f',  0, 5359, 2024 }, { 'r',  1, 5359,    0 }, { 'u',  1, 5360,    0 }, { 'a',  1, 5361,    0 },
+    { 'e',  0, 5362,   24 }, { 'l',  1, 5362,    0 }, { 'l',  1, 5363,    0 }, { 's',  0, 5364,   37 },
+    { 't',  0, 5364,   41 }, { 'a',  0, 5364,   43 }, { 'D',  1, 5364,    0 }, { 'D',  1, 5365,    0 },
+    { 'M',  1, 5366,    0 }, { 'P',  1, 5367,    0 }, { 'T',  1, 5368,    0 }, { 'i',  1, 5369,    0 },
+    { 'u',  1, 5370,    0 }, { 'e',  1, 5371,    0 }, { 'r',  1, 5372,    0 }, { 'u',  1, 5373,    0 },
+    { 'r',  1, 5374,    0 }, { 'h',  1, 5375,    0 }, { 't',  1, 5376,    0 }, { 'd',  0, 5377,   84 },
+    { 'e',  1, 5377,    0 }, { 'a',  1, 5378,    0 }, { 'C',  1, 5379,    0 }, { 'D',  1, 5380,    0 },
+    { 'L',  2, 5381,    0 }, { 'R',  1, 5383,    0 }, { 'U',  1, 5384,    0 }, { 'V',  1, 5385,    0 },
+    { 'r',  1, 5386,    0 }, { 'e',  1, 5387,    0 }, { 'f',  1, 5388,    0 }, { 'g',  1, 5389,    0 },
+    { 'e',  1, 5390,  115 }, { 'r',  1, 5391,    0 }, { 't',  0, 5392,  129 }, { 'm',  1, 5392,    0 },
+    { 'e',  1, 5393,    0 }, { 'n',  0, 5394,  135 }, { 'i',  1, 5394,    0 }, { 'b',  1, 5395,    0 },
+    { 'n',  1, 5396,    0 }, { 'S',  1, 5397,    0 }, { 'V',  1, 5398,    0 }, { 'r',  1, 5399,    0 },
+    { 'r',  6, 5400,    0 }, { 't',  1, 5406,    0 }, { 'n',  1, 5407,    0 }, { 'w',  1, 5408,    0 },
+    { 'u',  1, 5409,    0 }, { 'a',  1, 5410,    0 }, { 's',  0, 5411,  198 }, { 'a',  1, 5411,    0 },
+    { 'e',  1, 5412,    0 }, { 'b',  1, 5413,    0 }, { 'e',  1, 5414,    0 }, { 'g',  1, 5415,    0 },
+    { 'r',  1, 5416,    0 }, { 'i',  1, 5417,    0 }, { 'u',  1, 5418,    0 }, { 'w',  1, 5419,    0 },
+    { 'o',  1, 5420,    0 }, { 'g',  1, 5421,    0 }, { 'e',  2, 5422,  248 }, { 'i',  1, 5424,    0 },
+    { 'D',  1, 5425,    0 }, { 'T',  1, 5426,    0 }, { 'V',  1, 5427,    0 }, { 'c',  1, 5428,    0 },
+    { 'r',  1, 5429,    0 }, { 'g',  1, 5430,    0 }, { 'u',  1, 5431,    0 }, { 'l',  1, 5432,    0 },
+    { 'e',  1, 5433,    0 }, { 's',  1, 5434,    0 }, { 'a',  1, 5435,    0 }, { 'l',  1, 5436,    0 },
+    { 'r',  1, 5437,    0 }, { 'f',  1, 5438,    0 }, { 'g',  1, 5439,    0 }, { 'f',  1, 5440,    0 },
+    { 'g',  1, 5441,    0 }, { 'e',  1, 5442,    0 }, { 'i',  1, 5443,    0 }, { 'S',  1, 5444,    0 },
+    { 't',  1, 5445,    0 }, { 'l',  1, 5446,    0 }, { 'v',  1, 5447,    0 }, { 'G',  1, 5448,    0 },
+    { 'L',  1, 5449,    0 }, { 'e',  0, 5450,  305 }, { 'k',  0, 5450,  307 }, { 'a',  1, 5450,    0 },
+    { 'g',  1, 5451,    0 }, { 'C',  1, 5452,    0 }, { 'b',  1, 5453,    0 }, { 'm',  1, 5454,    0 },
+    { 'a',  1, 5455,    0 }, { 's',  1, 5456,    0 }, { 'a',  1, 5457,    0 }, { 't',  1, 5458,    0 },
+    { 's',  3, 5459,  323 }, { 'c',  1, 5462,    0 }, { 'e',  1, 5463,    0 }, { 'h',  1, 5464,    0 },
+    { 'a',  1, 5465,    0 }, { 's',  1, 5466,    0 }, { 'c',  1, 5467,    0 }, { 'e',  1, 5468,    0 },
+    { 'd',  1, 5469,    0 }, { 't',  1, 5470,    0 }, { 'n',  0, 5471,  355 }, { 'r',  1, 5471,    0 },
+    { 'r',  0, 5472,  365 }, { 'a',  1, 5472,    0 }, { 'r',  1, 5473,    0 }, { 'l',  1, 5474,    0 },
+    { 'n',  1, 5475,    0 }, { 'r',  1, 5476,    0 }, { 'e',  1, 5477,    0 }, { 't',  0, 5478,  383 },
+    { 't',  1, 5478,    0 }, { 'e',  2, 5479,    0 }, { 'n',  1, 5481,    0 }, { 'r',  1, 5482,    0 },
+    { 'e',  1, 5483,    0 }, { 'o',  2, 5484,    0 }, { 'l',  1, 5486,    0 }, { 'e',  1, 5487,    0 },
+    { 'r',  1, 5488,    0 }, { 'p',  3, 5489,    0 }, { 'e',  1, 5492,    0 }, { 'r',  1, 5493,    0 },
+    { 'm',  1, 5494,    0 }, { 'a',  1, 5495,    0 }, { 'l',  1, 5496,    0 }, { 'o',  1, 5497,    0 },
+    { 'e',  1, 5498,    0 }, { 'i',  1, 5499,    0 }, { 'p',  1, 5500,    0 }, { 'i',  1, 5501,    0 },
+    { 'I',  1, 5502,    0 }, { 'S',  1, 5503,    0 }, { 'U',  1, 5504,    0 }, { 'E',  1, 5505,    0 },
+    { 'd',  1, 5506,    0 }, { 'a',  1, 5507,    0 }, { 'e',  1, 5508,    0 }, { 'o',  1, 5509,    0 },
+    { 'a',  1, 5510,    0 }, { 'q',  1, 5511,    0 }, { 'u',  1, 5512,    0 }, { 'i',  1, 5513,    0 },
+    { 'D',  1, 5514,    0 }, { 'i',  1, 5515,    0 }, { 'a',  1, 5516,    0 }, { 'r',  1, 5517,    0 },
+    { 'a',  1, 5518,    0 }, { 'l',  1, 5519,    0 }, { 'w',  2, 5520,  516 }, { 'A',  1, 5522,    0 },
+    { 'l',  1, 5523,    0 }, { 'r',  1, 5524,    0 }, { 'w',  0, 5525,  523 }, { 'a',  1, 5525,    0 },
+    { 'e',  1, 5526,    0 }, { 'i',  1, 5527,    0 }, { 'n',  0, 5528,  528 }, { 'a',  1, 5528,    0 },
+    { 'i',  1, 5529,    0 }, { 'd',  1, 5530,    0 }, { 'm',  0, 5531,  590 }, { 'p',  1, 5531,    0 },
+    { 'a',  8, 5532,    0 }, { 'b',  1, 5540,  614 }, { 'r',  0, 5541,  618 }, { 'e',  1, 5541,    0 },
+    { 'q',  0, 5542,  633 }, { 'n',  1, 5542,    0 }, { 'n',  1, 5543,    0 }, { 's',  1, 5544,    0 },
+    { 'i',  1, 5545,    0 }, { 'm',  1, 5546,  642 }, { 'g',  1, 5547,    0 }, { 'r',  1, 5548,    0 },
+    { 'e',  0, 5549,  653 }, { 'v',  0, 5549,  654 }, { 'n',  0, 5549,  659 }, { 'c',  0, 5549,  662 },
+    { 't',  0, 5549,  664 }, { 'u',  1, 5549,    0 }, { 'm',  1, 5550,    0 }, { 'u',  1, 5551,    0 },
+    { 'r',  0, 5552,  668 }, { 'a',  1, 5552,    0 }, { 'u',  1, 5553,    0 }, { 'g',  1, 5554,    0 },
+    { 'o',  1, 5555,    0 }, { 'q',  1, 5556,    0 }, { 'r',  1, 5557,    0 }, { 'u',  1, 5558,    0 },
+    { 's',  0, 5559,  722 }, { 'e',  1, 5559,    0 }, { 'u',  1, 5560,    0 }, { 'u',  1, 5561,    0 },
+    { 'm',  0, 5562,  765 }, { 'v',  0, 5562,  768 }, { 'd',  1, 5562,    0 }, { 'a',  1, 5563,    0 },
+    { 'a',  1, 5564,    0 }, { 'd',  5, 5565,    0 }, { 'n',  1, 5570,    0 }, { 'r',  0, 5571,  790 },
+    { 'i',  1, 5571,    0 }, { 'q',  0, 5572,  795 }, { 'm',  1, 5572,    0 }, { 'x',  1, 5573,    0 },
+    { 't',  0, 5574,  803 }, { 'l',  0, 5574,  817 }, { 'r',  0, 5574,  818 }, { 'p',  0, 5574,  822 },
+    { 'a',  1, 5574,    0 }, { 'm',  0, 5575,  830 }, { 'q',  2, 5575,    0 }, { 'e',  1, 5577,    0 },
+    { 'e',  1, 5578,    0 }, { 'r',  1, 5579,    0 }, { 'n',  1, 5580,    0 }, { 'w',  0, 5581,  850 },
+    { 'r',  0, 5581,  855 }, { 'q',  0, 5581,  857 }, { 'v',  0, 5581,  860 }, { 'd',  1, 5581,  866 },
+    { 'a',  0, 5582,  870 }, { 'o',  1, 5582,    0 }, { 'o',  1, 5583,    0 }, { 'u',  1, 5584,    0 },
+    { 's',  0, 5585,  885 }, { 'a',  1, 5585,    0 }, { 'b',  1, 5586,    0 }, { 'r',  1, 5587,    0 },
+    { 'w',  1, 5588,    0 }, { 'r',  1, 5589,    0 }, { 'o',  1, 5590,    0 }, { 'e',  0, 5591,  904 },
+    { 'r',  1, 5591,    0 }, { 'r',  1, 5592,    0 }, { 'e',  1, 5593,    0 }, { 'n',  0, 5594,  944 },
+    { 'n',  0, 5594,  947 }, { 't',  2, 5594,    0 }, { 'D',  0, 5596,  954 }, { 's',  1, 5596,    0 },
+    { 'a',  1, 5597,    0 }, { 'n',  1, 5598,    0 }, { 'g',  1, 5599,    0 }, { 'n',  1, 5600,    0 },
+    { 'n',  1, 5601,    0 }, { 'o',  1, 5602, 1022 }, { 'o',  1, 5603,    0 }, { 't',  0, 5604, 1052 },
+    { 'r',  1, 5604,    0 }, { 'e',  1, 5605,    0 }, { 'l',  1, 5606,    0 }, { 's',  0, 5607, 1058 },
+    { 'r',  0, 5607, 1066 }, { 'u',  1, 5607,    0 }, { 'o',  1, 5608,    0 }, { 'o',  1, 5609,    0 },
+    { 'f',  1, 5610,    0 }, { 'g',  1, 5611,    0 }, { 'n',  1, 5612,    0 }, { 'r',  1, 5613,    0 },
+    { 'i',  1, 5614,    0 }, { 'r',  1, 5615,    0 }, { 'a',  1, 5616,    0 }, { 'h',  1, 5617,    0 },
+    { 'd',  0, 5618, 1120 }, { 't',  0, 5618, 1130 }, { 'y',  1, 5618,    0 }, { 's',  0, 5619, 1174 },
+    { 'm',  0, 5619, 1179 }, { 'd',  0, 5619, 1189 }, { 'u',  0, 5619, 1190 }, { 'r',  0, 5619, 1199 },
+    { 'a',  1, 5619,    0 }, { 'r',  1, 5620,    0 }, { 'r',  1, 5621,    0 }, { 'f',  1, 5622,    0 },
+    { 'g',  1, 5623,    0 }, { 'r',  1, 5624,    0 }, { 'n',  1, 5625,    0 }, { 'o',  1, 5626, 1220 },
+    { 'p',  1, 5627,    0 }, { 't',  0, 5628, 1224 }, { 'g',  1, 5628,    0 }, { 'q',  1, 5629,    0 },
+    { 'r',  0, 5630, 1227 }, { 'm',  0, 5630, 1228 }, { 'e',  1, 5630,    0 }, { 'a',  1, 5631,    0 },
+    { 'o',  1, 5632,    0 }, { 'f',  1, 5633,    0 }, { 'p',  1, 5634,    0 }, { 'g',  1, 5635,    0 },
+    { 'r',  1, 5636,    0 }, { 's',  0, 5637, 1266 }, { 'e',  0, 5637, 1270 }, { 'e',  1, 5637,    0 },
+    { 't',  0, 5638, 1297 }, { 'a',  1, 5638,    0 }, { 'r',  0, 5639, 1303 }, { 'e',  0, 5639, 1308 },
+    { 'd',  1, 5639,    0 }, { 'l',  1, 5640,    0 }, { 'u',  1, 5641,    0 }, { 'e',  1, 5642,    0 },
+    { 'u',  0, 5643, 1329 }, { 'a',  1, 5643,    0 }, { 'r',  1, 5644,    0 }, { 'i',  1, 5645,    0 },
+    { 'a',  1, 5646,    0 }, { 'x',  0, 5647, 1350 }, { 'l',  1, 5647, 1352 }, { 'w',  0, 5648, 1366 },
+    { 's',  0, 5648, 1370 }, { 'r',  1, 5648,    0 }, { 'i',  1, 5649,    0 }, { 'a',  0, 5650, 1401 },
+    { 'b',  0, 5650, 1402 }, { 'c',  0, 5650, 1403 }, { 'a',  0, 5650, 1405 }, { 'b',  0, 5650, 1406 },
+    { 'c',  0, 5650, 1407 }, { 'l',  1, 5650,    0 }, { 't',  0, 5651, 1410 }, { 'a',  1, 5651,    0 },
+    { 'm',  1, 5652,    0 }, { 'p',  1, 5653,    0 }, { 'e',  0, 5654, 1429 }, { 'e',  0, 5654, 1430 },
+    { 't',  1, 5654,    0 }, { 't',  1, 5655,    0 }, { 'g',  1, 5656,    0 }, { 'n',  0, 5657, 1452 },
+    { 'w',  0, 5657, 1458 }, { 's',  0, 5657, 1482 }, { 'n',  0, 5657, 1487 }, { 'f',  0, 5657, 1498 },
+    { 'e',  0, 5657, 1503 }, { 'a',  1, 5657,    0 }, { 'e',  1, 5658,    0 }, { 'k',  0, 5659, 1524 },
+    { 'o',  1, 5659,    0 }, { 'h',  0, 5660, 1534 }, { 'i',  1, 5660,    0 }, { 'r',  0, 5661, 1539 },
+    { 'm',  0, 5661, 1544 }, { 'o',  0, 5661, 1545 }, { 'n',  1, 5661,    0 }, { 'p',  1, 5662,    0 },
+    { 'r',  1, 5663,    0 }, { 'p',  1, 5664,    0 }, { 'q',  1, 5665,    0 }, { 'i',  1, 5666,    0 },
+    { 'm',  0, 5667, 1562 }, { 'a',  1, 5667,    0 }, { 'n',  1, 5668,    0 }, { 'r',  1, 5669,    0 },
+    { 'n',  1, 5670,    0 }, { 't',  0, 5671, 1585 }, { 'q',  0, 5671, 1587 }, { 'y',  1, 5671,    0 },
+    { 's',  0, 5672, 1605 }, { 'm',  0, 5672, 1611 }, { 'a',  1, 5672,    0 }, { 'd',  0, 5673, 1622 },
+    { 'u',  0, 5673, 1623 }, { 'r',  0, 5673, 1630 }, { 'e',  0, 5673, 1635 }, { 'r',  1, 5673,    0 },
+    { 'r',  1, 5674,    0 }, { 'a',  1, 5675,    0 }, { 'e',  1, 5676,    0 }, { 'i',  1, 5677,    0 },
+    { 'q',  1, 5678,    0 }, { 'h',  1, 5679,    0 }, { 'd',  1, 5680,    0 }, { 'a',  1, 5681,    0 },
+    { 's',  0, 5682, 1671 }, { 'n',  1, 5682,    0 }, { 'r',  1, 5683,    0 }, { 'r',  0, 5684, 1688 },
+    { 'n',  1, 5684,    0 }, { 'w',  0, 5685, 1712 }, { 'u',  1, 5685,    0 }, { 'i',  1, 5686,    0 },
+    { 'a',  1, 5687,    0 }, { 's',  0, 5688, 1739 }, { 'r',  0, 5688, 1740 }, { 'e',  1, 5688,    0 },
+    { 's',  1, 5689,    0 }, { 'u',  1, 5690,    0 }, { 'e',  1, 5691,    0 }, { 'e',  1, 5692,    0 },
+    { 'h',  1, 5693,    0 }, { 't',  0, 5694, 1785 }, { 't',  0, 5694, 1786 }, { 's',  0, 5694, 1789 },
+    { 'r',  0, 5694, 1790 }, { 'e',  1, 5694,    0 }, { 'n',  1, 5695,    0 }, { 'p',  1, 5696,    0 },
+    { 'r',  1, 5697,    0 }, { 'p',  1, 5698,    0 }, { 'q',  1, 5699,    0 }, { 'i',  1, 5700,    0 },
+    { 'm',  0, 5701, 1806 }, { 'b',  0, 5701, 1815 }, { 't',  0, 5701, 1817 }, { 'l',  0, 5701, 1818 },
+    { 'b',  0, 5701, 1819 }, { 'r',  0, 5701, 1820 }, { 't',  0, 5701, 1821 }, { 's',  0, 5701, 1824 },
+    { 'e',  1, 5701,    0 }, { 'n',  1, 5702,    0 }, { 'w',  0, 5703, 1836 }, { 'o',  1, 5703,    0 },
+    { 'y',  1, 5704,    0 }, { 'p',  1, 5705,    0 }, { 'i',  1, 5706,    0 }, { 'a',  1, 5707,    0 },
+    { 'k',  0, 5708, 1870 }, { 'l',  1, 5708,    0 }, { 'u',  1, 5709,    0 }, { 's',  0, 5710, 1884 },
+    { 'e',  0, 5710, 1886 }, { 'u',  1, 5710,    0 }, { 'd',  2, 5711,    0 }, { 'e',  1, 5713,    0 },
+    { 'w',  0, 5714, 1920 }, { 'a',  1, 5714,    0 }, { 'o',  1, 5715,    0 }, { 'n',  0, 5716, 1927 },
+    { 'r',  1, 5716,    0 }, { 'e',  1, 5717,    0 }, { 'e',  0, 5718, 1941 }, { 'i',  1, 5718,    0 },
+    { 'p',  1, 5719,    0 }, { 'h',  1, 5720,    0 }, { 'p',  1, 5721,    0 }, { 'm',  1, 5722,    0 },
+    { 't',  1, 5723,    0 }, { 'a',  1, 5724,    0 }, { 'g',  0, 5725, 1973 }, { 'r',  0, 5725, 2028 },
+    { 'n',  1, 5725,    0 }, { 's',  1, 5726,    0 }, { 'l',  1, 5727,    0 }, { 'D',  1, 5728,    0 },
+    { 'o',  1, 5729,    0 }, { 'o',  1, 5730,    0 }, { 'i',  1, 5731,    0 }, { 'l',  1, 5732,    0 },
+    { 'i',  1, 5733,    0 }, { 's',  1, 5734,    0 }, { 'r',  1, 5735,    0 }, { 'n',  1, 5736,    0 },
+    { 'I',  1, 5737,    0 }, { 'c',  1, 5738,    0 }, { 'C',  1, 5739,    0 }, { 'd',  0, 5740,   67 },
+    { 'i',  1, 5740,    0 }, { 'n',  1, 5741,    0 }, { 'l',  0, 5742,   89 }, { 'o',  1, 5742,    0 },
+    { 'o',  2, 5743,    0 }, { 'e',  1, 5745,    0 }, { 'o',  1, 5746,    0 }, { 'i',  1, 5747,    0 },
+    { 'p',  2, 5748,    0 }, { 'e',  1, 5750,    0 }, { 'o',  1, 5751,    0 }, { 'v',  1, 5752,    0 },
+    { 't',  3, 5753,    0 }, { 'h',  1, 5756,    0 }, { 'A',  1, 5757,    0 }, { 'o',  1, 5758,    0 },
+    { 'a',  1, 5759,    0 }, { 'r',  1, 5760,    0 }, { 'l',  1, 5761,    0 }, { 'r',  1, 5762,    0 },
+    { 't',  1, 5763,    0 }, { 'm',  1, 5764,    0 }, { 'e',  1, 5765,    0 }, { 't',  1, 5766,    0 },
+    { 'E',  1, 5767,    0 }, { 'F',  1, 5768,    0 }, { 'G',  1, 5769,    0 }, { 'L',  1, 5770,    0 },
+    { 'S',  1, 5771,    0 }, { 'T',  1, 5772,    0 }, { 'S',  1, 5773,    0 }, { 't',  1, 5774,    0 },
+    { 'n',  1, 5775,    0 }, { 'a',  1, 5776,    0 }, { 'r',  1, 5777,    0 }, { 'l',  0, 5778,  200 },
+    { 'c',  1, 5778,    0 }, { 'l',  1, 5779,    0 }, { 't',  1, 5780,    0 }, { 'l',  1, 5781,    0 },
+    { 'o',  1, 5782,    0 }, { 'l',  1, 5783,    0 }, { 'b',  1, 5784,    0 }, { 'n',  2, 5785,    0 },
+    { 'o',  1, 5787,    0 }, { 'h',  1, 5788,    0 }, { 'A',  1, 5789,    0 }, { 'V',  1, 5790,    0 },
+    { 'a',  1, 5791,    0 }, { 'o',  1, 5792,    0 }, { 'e',  1, 5793,    0 }, { 'e',  1, 5794,    0 },
+    { 't',  1, 5795,    0 }, { 'o',  1, 5796,    0 }, { 'h',  1, 5797,    0 }, { 'a',  1, 5798,    0 },
+    { 'l',  1, 5799,    0 }, { 'a',  1, 5800,    0 }, { 's',  0, 5801,  265 }, { 'n',  1, 5801,    0 },
+    { 'd',  1, 5802,    0 }, { 'r',  1, 5803,    0 }, { 't',  2, 5804,    0 }, { 'h',  1, 5806,    0 },
+    { 't',  2, 5807,    0 }, { 'h',  1, 5809,    0 }, { 'f',  1, 5810,    0 }, { 'g',  1, 5811,    0 },
+    { 'p',  1, 5812,    0 }, { 'r',  1, 5813,    0 }, { 'u',  1, 5814,    0 }, { 'e',  3, 5815,    0 },
+    { 'r',  1, 5818,    0 }, { 'e',  1, 5819,    0 }, { 'k',  1, 5820,    0 }, { 'r',  1, 5821,    0 },
+    { 'a',  1, 5822,    0 }, { 'l',  1, 5823,    0 }, { 'e',  1, 5824,    0 }, { 'l',  0, 5825,  315 },
+    { 't',  1, 5825,    0 }, { 't',  1, 5826,    0 }, { 'T',  1, 5827,    0 }, { 'E',  1, 5828,    0 },
+    { 'G',  1, 5829,    0 }, { 'T',  1, 5830,    0 }, { 'e',  1, 5831,    0 }, { 'r',  1, 5832,    0 },
+    { 't',  1, 5833,    0 }, { 'r',  1, 5834,    0 }, { 'e',  1, 5835,    0 }, { 'e',  1, 5836,    0 },
+    { 'r',  1, 5837,    0 }, { 'e',  3, 5838,  338 }, { 'i',  1, 5841,    0 }, { 'l',  1, 5842,    0 },
+    { 'c',  2, 5843,    0 }, { 'e',  1, 5845,    0 }, { 'D',  0, 5846,  369 }, { 'u',  1, 5846,    0 },
+    { 'e',  1, 5847,    0 }, { 's',  3, 5848,  378 }, { 'i',  1, 5851,    0 }, { 'E',  2, 5852,    0 },
+    { 'U',  1, 5854,    0 }, { 'g',  1, 5855,    0 }, { 'r',  1, 5856,    0 }, { 'i',  1, 5857,    0 },
+    { 'u',  1, 5858,    0 }, { 'w',  1, 5859,    0 }, { 'o',  1, 5860,    0 }, { 'e',  2, 5861,  417 },
+    { 'i',  1, 5863,    0 }, { 'D',  1, 5864,    0 }, { 'T',  1, 5865,    0 }, { 'V',  1, 5866,    0 },
+    { 'c',  1, 5867,    0 }, { 'r',  1, 5868,    0 }, { 'p',  1, 5869,    0 }, { 'r',  1, 5870,    0 },
+    { 'a',  1, 5871,    0 }, { 'w',  1, 5872,    0 }, { 'f',  1, 5873,    0 }, { 'g',  1, 5874,    0 },
+    { 'A',  1, 5875,    0 }, { 'r',  1, 5876,    0 }, { 'n',  1, 5877,    0 }, { 'u',  2, 5878,    0 },
+    { 'n',  1, 5880,    0 }, { 'q',  1, 5881,    0 }, { 's',  3, 5882,  466 }, { 't',  0, 5885,  470 },
+    { 't',  1, 5885,  473 }, { 'r',  1, 5886,    0 }, { 'c',  1, 5887,    0 }, { 'u',  1, 5888,    0 },
+    { 'l',  1, 5889,    0 }, { 'l',  1, 5890,    0 }, { 'o',  1, 5891,    0 }, { 'r',  0, 5892,  499 },
+    { 'r',  0, 5892,  508 }, { 'a',  1, 5892,    0 }, { 'r',  1, 5893,    0 }, { 'u',  1, 5894,    0 },
+    { 'B',  1, 5895,    0 }, { 'D',  1, 5896,    0 }, { 'r',  1, 5897,    0 }, { 'i',  1, 5898,    0 },
+    { 'r',  1, 5899,    0 }, { 'r',  1, 5900,    0 }, { 'f',  1, 5901,    0 }, { 'g',  1, 5902,    0 },
+    { 'l',  4, 5903,    0 }, { 'n',  1, 5907,    0 }, { 't',  1, 5908,    0 }, { 'e',  0, 5909,  599 },
+    { 'a',  0, 5909,  605 }, { 'b',  0, 5909,  606 }, { 'c',  0, 5909,  607 }, { 'd',  0, 5909,  608 },
+    { 'e',  0, 5909,  609 }, { 'f',  0, 5909,  610 }, { 'g',  0, 5909,  611 }, { 'h',  0, 5909,  612 },
+    { 'd',  0, 5909,  615 }, { 'q',  0, 5909,  628 }, { 't',  0, 5909,  636 }, { 'g',  0, 5909,  639 },
+    { 'i',  1, 5909,    0 }, { 'm',  1, 5910,    0 }, { 'e',  1, 5911,    0 }, { 'e',  0, 5912,  646 },
+    { 'k',  0, 5912,  648 }, { 's',  0, 5912,  665 }, { 'e',  1, 5912,    0 }, { 'p',  0, 5913,  667 },
+    { 'n',  1, 5913,    0 }, { 's',  0, 5914,  671 }, { 'e',  0, 5914,  673 }, { 'z',  1, 5914,    0 },
+    { 'u',  1, 5915,    0 }, { 'i',  1, 5916,    0 }, { 's',  0, 5917,  721 }, { 's',  0, 5917,  723 },
+    { 'b',  0, 5917,  744 }, { 'p',  0, 5917,  754 }, { 'o',  1, 5917,    0 }, { 'r',  1, 5918,    0 },
+    { 'r',  1, 5919,    0 }, { 'R',  0, 5920,  782 }, { 'S',  0, 5920,  783 }, { 'a',  1, 5920,    0 },
+    { 'c',  1, 5921,    0 }, { 'd',  1, 5922,    0 }, { 't',  0, 5923,  788 }, { 't',  0, 5923,  792 },
+    { 'e',  1, 5923,    0 }, { 'e',  1, 5924,    0 }, { 'p',  0, 5925,  824 }, { 'p',  1, 5925,    0 },
+    { 's',  1, 5926,    0 }, { 'e',  0, 5927,  833 }, { 'd',  1, 5927,    0 }, { 'r',  1, 5928,    0 },
+    { 't',  0, 5929,  840 }, { 's',  1, 5929,    0 }, { 'n',  1, 5930,    0 }, { 't',  0, 5931,  883 },
+    { 's',  0, 5931,  884 }, { 'r',  1, 5931,    0 }, { 'a',  1, 5932,    0 }, { 'o',  1, 5933,    0 },
+    { 'n',  1, 5934,    0 }, { 'p',  1, 5935,    0 }, { 'w',  0, 5936,  892 }, { 'r',  0, 5936,  906 },
+    { 's',  0, 5936,  925 }, { 't',  0, 5936,  931 }, { 'g',  1, 5936,    0 }, { 'l',  1, 5937,    0 },
+    { 'l',  0, 5938,  955 }, { 't',  1, 5938,    0 }, { 't',  1, 5939,    0 }, { 'd',  1, 5940,    0 },
+    { 't',  0, 5941,  985 }, { 't',  0, 5941, 1018 }, { 'l',  0, 5941, 1023 }, { 'x',  0, 5941, 1036 },
+    { 'o',  1, 5941,    0 }, { 's',  1, 5942,    0 }, { 'e',  1, 5943,    0 }, { 'i',  1, 5944,    0 },
+    { 'w',  0, 5945, 1075 }, { 'w',  0, 5945, 1076 }, { 't',  1, 5945,    0 }, { 'h',  1, 5946,    0 },
+    { 'e',  0, 5947, 1105 }, { 't',  0, 5947, 1106 }, { 'e',  0, 5947, 1113 }, { 's',  0, 5947, 1117 },
+    { 'l',  0, 5947, 1118 }, { 'k',  0, 5947, 1119 }, { 'v',  0, 5947, 1164 }, { 'r',  0, 5947, 1200 },
+    { 'o',  1, 5947,    0 }, { 'p',  1, 5948,    0 }, { 't',  1, 5949,    0 }, { 'h',  1, 5950,    0 },
+    { 'e',  1, 5951,    0 }, { 't',  0, 5952, 1216 }, { 'r',  0, 5952, 1221 }, { 'r',  1, 5952,    0 },
+    { 't',  1, 5953,    0 }, { 'g',  1, 5954,    0 }, { 'r',  0, 5955, 1241 }, { 'c',  1, 5955,    0 },
+    { 'x',  0, 5956, 1249 }, { 't',  2, 5956,    0 }, { 's',  1, 5958,    0 }, { 'h',  1, 5959,    0 },
+    { 'o',  1, 5960,    0 }, { 'r',  0, 5961, 1275 }, { 'r',  0, 5961, 1302 }, { 'o',  1, 5961,    0 },
+    { 'e',  1, 5962,    0 }, { 'p',  0, 5963, 1313 }, { 'd',  1, 5963,    0 }, { 'p',  0, 5964, 1339 },
+    { 'r',  1, 5964,    0 }, { 'g',  1, 5965,    0 }, { 'r',  1, 5966,    0 }, { 's',  0, 5967, 1353 },
+    { 'r',  1, 5967,    0 }, { 'g',  1, 5968,    0 }, { 'e',  1, 5969,    0 }, { 'r',  1, 5970,    0 },
+    { 'i',  1, 5971,    0 }, { 'a',  1, 5972,    0 }, { 'e',  1, 5973,    0 }, { 'e',  1, 5974,    0 },
+    { 'l',  1, 5975,    0 }, { 's',  0, 5976, 1510 }, { 'l',  0, 5976, 1515 }, { 'r',  1, 5976,    0 },
+    { 'r',  0, 5977, 1537 }, { 't',  0, 5977, 1547 }, { 'r',  1, 5977,    0 }, { 'l',  1, 5978,    0 },
+    { 'p',  1, 5979,    0 }, { 'q',  0, 5980, 1560 }, { 'm',  0, 5980, 1561 }, { 'r',  0, 5980, 1569 },
+    { 'e',  0, 5980, 1570 }, { 'f',  0, 5980, 1571 }, { 'i',  1, 5980,    0 }, { 'v',  0, 5981, 1596 },
+    { 'l',  1, 5981,    0 }, { 't',  0, 5982, 1636 }, { 'r',  1, 5982,    0 }, { 'r',  1, 5983,    0 },
+    { 'f',  1, 5984,    0 }, { 'g',  1, 5985,    0 }, { 'u',  1, 5986,    0 }, { 'r',  1, 5987,    0 },
+    { 'o',  1, 5988,    0 }, { 'c',  1, 5989,    0 }, { 't',  0, 5990, 1674 }, { 'i',  0, 5990, 1687 },
+    { 't',  0, 5990, 1703 }, { 's',  0, 5990, 1716 }, { 'd',  0, 5990, 1724 }, { 'r',  1, 5990,    0 },
+    { 't',  1, 5991,    0 }, { 'l',  0, 5992, 1744 }, { 'i',  1, 5992,    0 }, { 't',  1, 5993, 1761 },
+    { 't',  1, 5994, 1765 }, { 't',  2, 5995,    0 }, { 'q',  1, 5997, 1792 }, { 'e',  1, 5998,    0 },
+    { 'r',  1, 5999,    0 }, { 'l',  1, 6000,    0 }, { 'p',  1, 6001,    0 }, { 'q',  0, 6002, 1804 },
+    { 'm',  0, 6002, 1805 }, { 'q',  1, 6002, 1826 }, { 'e',  1, 6003,    0 }, { 'r',  1, 6004,    0 },
+    { 'm',  0, 6005, 1851 }, { 'p',  1, 6005,    0 }, { 'm',  0, 6006, 1854 }, { 'r',  0, 6006, 1862 },
+    { 'e',  4, 6006, 1874 }, { 's',  0, 6010, 1883 }, { 'm',  0, 6010, 1887 }, { 'l',  1, 6010,    0 },
+    { 'r',  1, 6011,    0 }, { 'r',  0, 6012, 1913 }, { 'r',  1, 6012,    0 }, { 'o',  1, 6013,    0 },
+    { 'o',  1, 6014,    0 }, { 'r',  0, 6015, 1930 }, { 'l',  1, 6015,    0 }, { 'a',  0, 6016, 1948 },
+    { 'i',  1, 6016,    0 }, { 't',  1, 6017,    0 }, { 'a',  0, 6018, 1955 }, { 'a',  0, 6018, 1956 },
+    { 'n',  1, 6018,    0 }, { 'c',  1, 6019,    0 }, { 'h',  0, 6020,   20 }, { 'i',  1, 6020,    0 },
+    { 'i',  1, 6021,    0 }, { 't',  0, 6022,   44 }, { 't',  0, 6022,   47 }, { 'n',  1, 6022,    0 },
+    { 'u',  1, 6023,    0 }, { 'm',  1, 6024,    0 }, { 'e',  1, 6025,    0 }, { 'l',  1, 6026,    0 },
+    { 't',  0, 6027,   56 }, { 'n',  1, 6027,    0 }, { 't',  0, 6028,   60 }, { 'l',  1, 6028,    0 },
+    { 'c',  1, 6029,    0 }, { 't',  1, 6030,    0 }, { 'n',  1, 6031,    0 }, { 't',  0, 6032,   91 },
+    { 'w',  1, 6032,    0 }, { 'f',  1, 6033,    0 }, { 'n',  1, 6034,    0 }, { 'g',  1, 6035,    0 },
+    { 'A',  1, 6036,    0 }, { 'D',  1, 6037,    0 }, { 'r',  1, 6038,    0 }, { 'w',  2, 6039,  104 },
+    { 'e',  0, 6041,  107 }, { 'R',  1, 6041,    0 }, { 'T',  1, 6042,    0 }, { 'V',  1, 6043,    0 },
+    { 't',  2, 6044,    0 }, { 'r',  1, 6046,    0 }, { 'w',  0, 6047,  117 }, { 'l',  1, 6047,    0 },
+    { 'y',  1, 6048,    0 }, { 'd',  1, 6049,    0 }, { 'i',  1, 6050,    0 }, { 'i',  1, 6051,    0 },
+    { 'a',  1, 6052,    0 }, { 'r',  1, 6053,    0 }, { 'r',  1, 6054,    0 }, { 'q',  1, 6055,    0 },
+    { 'u',  1, 6056,    0 }, { 'r',  1, 6057,    0 }, { 'e',  1, 6058,    0 }, { 'l',  1, 6059,    0 },
+    { 'i',  1, 6060,    0 }, { 'p',  1, 6061,    0 }, { 'a',  1, 6062,    0 }, { 'H',  1, 6063,    0 },
+    { 'l',  0, 6064,  185 }, { 'y',  1, 6064,    0 }, { 't',  1, 6065,    0 }, { 'e',  2, 6066,    0 },
+    { 'r',  1, 6068,    0 }, { 'e',  1, 6069,    0 }, { 'w',  2, 6070,  237 }, { 'i',  1, 6072,    0 },
+    { 'l',  1, 6073,    0 }, { 'T',  1, 6074,    0 }, { 'V',  1, 6075,    0 }, { 'r',  0, 6076,  245 },
+    { 't',  2, 6076,    0 }, { 'r',  1, 6078,    0 }, { 'e',  1, 6079,    0 }, { 'n',  1, 6080,    0 },
+    { 'w',  1, 6081,    0 }, { 'e',  1, 6082,    0 }, { 'c',  1, 6083,    0 }, { 'o',  1, 6084,    0 },
+    { 'w',  0, 6085,  260 }, { 't',  1, 6085,    0 }, { 'l',  1, 6086,    0 }, { 'E',  1, 6087,    0 },
+    { 't',  1, 6088,    0 }, { 't',  1, 6089,    0 }, { 'e',  0, 6090,  267 }, { 'o',  1, 6090,    0 },
+    { 'A',  1, 6091,    0 }, { 'R',  1, 6092,    0 }, { 't',  1, 6093,    0 }, { 'a',  1, 6094,    0 },
+    { 'r',  1, 6095,    0 }, { 't',  1, 6096,    0 }, { 't',  1, 6097,    0 }, { 'h',  1, 6098,    0 },
+    { 'a',  1, 6099,    0 }, { 'f',  0, 6100,  288 }, { 's',  0, 6100,  290 }, { 'M',  1, 6100,    0 },
+    { 'T',  1, 6101,    0 }, { 'V',  1, 6102,    0 }, { 'e',  1, 6103,    0 }, { 's',  1, 6104,    0 },
+    { 'i',  1, 6105,    0 }, { 'u',  1, 6106,    0 }, { 'p',  0, 6107,  312 }, { 'e',  1, 6107,    0 },
+    { 'n',  1, 6108,    0 }, { 's',  0, 6109,  316 }, { 'e',  1, 6109,    0 }, { 'r',  1, 6110,    0 },
+    { 'q',  1, 6111,    0 }, { 'r',  1, 6112,    0 }, { 'i',  1, 6113,    0 }, { 'd',  1, 6114,    0 },
+    { 's',  1, 6115,    0 }, { 'T',  1, 6116,    0 }, { 'e',  1, 6117,    0 }, { 't',  1, 6118,    0 },
+    { 'e',  1, 6119,    0 }, { 's',  1, 6120,    0 }, { 'E',  1, 6121,    0 }, { 'F',  1, 6122,    0 },
+    { 'T',  1, 6123,    0 }, { 'c',  1, 6124,    0 }, { 'y',  2, 6125,    0 }, { 'e',  0, 6127,  366 },
+    { 'k',  1, 6127,    0 }, { 'n',  1, 6128,    0 }, { 's',  0, 6129,  374 }, { 'p',  1, 6129,    0 },
+    { 'E',  1, 6130,    0 }, { 'S',  1, 6131,    0 }, { 'T',  1, 6132,    0 }, { 'o',  1, 6133,    0 },
+    { 'l',  1, 6134,    0 }, { 'q',  1, 6135,    0 }, { 'p',  1, 6136,    0 }, { 'l',  1, 6137,    0 },
+    { 'o',  1, 6138,    0 }, { 'l',  1, 6139,    0 }, { 'b',  1, 6140,    0 }, { 'n',  2, 6141,    0 },
+    { 'o',  1, 6143,    0 }, { 'A',  1, 6144,    0 }, { 'V',  1, 6145,    0 }, { 'a',  1, 6146,    0 },
+    { 'o',  1, 6147,    0 }, { 'e',  1, 6148,    0 }, { 'e',  1, 6149,    0 }, { 't',  1, 6150,    0 },
+    { 'o',  1, 6151,    0 }, { 'l',  1, 6152,    0 }, { 'r',  1, 6153,    0 }, { 'y',  1, 6154,    0 },
+    { 'n',  1, 6155,    0 }, { 't',  1, 6156,    0 }, { 'h',  1, 6157,    0 }, { 'r',  1, 6158,    0 },
+    { 'c',  1, 6159,    0 }, { 't',  1, 6160,    0 }, { 'b',  1, 6161,    0 }, { 'p',  1, 6162,    0 },
+    { 'i',  1, 6163,    0 }, { 'u',  1, 6164,    0 }, { 'E',  1, 6165,    0 }, { 'S',  1, 6166,    0 },
+    { 'T',  1, 6167,    0 }, { 'E',  1, 6168,    0 }, { 'e',  0, 6169,  486 }, { 'e',  0, 6169,  488 },
+    { 'a',  1, 6169,    0 }, { 'l',  1, 6170,    0 }, { 'd',  1, 6171,    0 }, { 't',  0, 6172,  494 },
+    { 'c',  2, 6172,    0 }, { 'e',  1, 6174,    0 }, { 's',  0, 6175,  513 }, { 'a',  1, 6175,    0 },
+    { 'o',  1, 6176,    0 }, { 'r',  1, 6177,    0 }, { 'b',  1, 6178,    0 }, { 'o',  1, 6179,    0 },
+    { 'r',  1, 6180,    0 }, { 't',  1, 6181,    0 }, { 'h',  1, 6182,    0 }, { 'B',  1, 6183,    0 },
+    { 'L',  1, 6184,    0 }, { 'S',  1, 6185,    0 }, { 'T',  1, 6186,    0 }, { 'S',  1, 6187,    0 },
+    { 'h',  1, 6188,    0 }, { 'l',  1, 6189,    0 }, { 'e',  0, 6190,  641 }, { 'q',  0, 6190,  643 },
+    { 's',  0, 6190,  666 }, { 'g',  1, 6190,    0 }, { 'e',  1, 6191,    0 }, { 'a',  1, 6192,    0 },
+    { 'a',  1, 6193,    0 }, { 't',  0, 6194,  770 }, { 'k',  0, 6194,  774 }, { 'r',  1, 6194,    0 },
+    { 's',  1, 6195,    0 }, { 'i',  1, 6196,    0 }, { 'a',  1, 6197,    0 }, { 'n',  1, 6198,    0 },
+    { 's',  0, 6199,  801 }, { 'r',  1, 6199,    0 }, { 'u',  1, 6200,    0 }, { 'g',  1, 6201,    0 },
+    { 'o',  1, 6202,    0 }, { 'u',  1, 6203,    0 }, { 't',  1, 6204,    0 }, { 'e',  0, 6205,  886 },
+    { 'r',  1, 6205,    0 }, { 'w',  0, 6206,  888 }, { 'a',  1, 6206,    0 }, { 'o',  1, 6207,    0 },
+    { 't',  1, 6208,    0 }, { 'e',  1, 6209,    0 }, { 'i',  1, 6210,    0 }, { 'i',  1, 6211,    0 },
+    { 'o',  1, 6212,    0 }, { 'x',  0, 6213, 1053 }, { 's',  0, 6213, 1056 }, { 's',  1, 6213,    0 },
+    { 't',  0, 6214, 1071 }, { 'a',  1, 6214,    0 }, { 't',  1, 6215,    0 }, { 'w',  1, 6216, 1203 },
+    { 'o',  1, 6217,    0 }, { 'a',  1, 6218,    0 }, { 't',  3, 6219,    0 }, { 'e',  1, 6222,    0 },
+    { 'o',  1, 6223,    0 }, { 'r',  0, 6224, 1225 }, { 't',  1, 6224,    0 }, { 'h',  1, 6225,    0 },
+    { 'a',  1, 6226,    0 }, { 'r',  1, 6227,    0 }, { 't',  1, 6228,    0 }, { 't',  1, 6229,    0 },
+    { 'w',  2, 6230,    0 }, { 'w',  1, 6232,    0 }, { 'f',  1, 6233,    0 }, { 'a',  1, 6234,    0 },
+    { 'o',  1, 6235,    0 }, { 'h',  1, 6236,    0 }, { 'r',  1, 6237,    0 }, { 'o',  1, 6238,    0 },
+    { 'h',  1, 6239,    0 }, { 'l',  0, 6240, 1409 }, { 'r',  1, 6240,    0 }, { 'd',  0, 6241, 1422 },
+    { 'r',  1, 6241,    0 }, { 'q',  0, 6242, 1433 }, { 'q',  0, 6242, 1437 }, { 'e',  2, 6242,    0 },
+    { 'k',  0, 6244, 1531 }, { 'o',  1, 6244,    0 }, { 'y',  1, 6245,    0 }, { 'r',  1, 6246,    0 },
+    { 'o',  1, 6247,    0 }, { 's',  0, 6248, 1616 }, { 'o',  1, 6248,    0 }, { 'p',  1, 6249,    0 },
+    { 't',  2, 6250,    0 }, { 'h',  1, 6252,    0 }, { 'i',  1, 6253,    0 }, { 'e',  1, 6254,    0 },
+    { 't',  1, 6255,    0 }, { 'h',  1, 6256,    0 }, { 'a',  1, 6257,    0 }, { 'm',  1, 6258,    0 },
+    { 't',  0, 6259, 1755 }, { 'e',  1, 6259,    0 }, { 'e',  1, 6260,    0 }, { 'e',  1, 6261,    0 },
+    { 'p',  1, 6262,    0 }, { 'q',  0, 6263, 1793 }, { 'q',  1, 6263, 1794 }, { 'o',  1, 6264,    0 },
+    { 'y',  1, 6265,    0 }, { 'r',  1, 6266,    0 }, { 'q',  0, 6267, 1827 }, { 'q',  1, 6267, 1828 },
+    { 'e',  0, 6268, 1849 }, { 'r',  1, 6268,    0 }, { 'd',  1, 6269,    0 }, { 'l',  1, 6270,    0 },
+    { 'q',  0, 6271, 1878 }, { 'r',  1, 6271,    0 }, { 'e',  1, 6272,    0 }, { 'i',  1, 6273,    0 },
+    { 'r',  1, 6274,    0 }, { 'n',  2, 6275,    0 }, { 'w',  1, 6277,    0 }, { 'o',  1, 6278,    0 },
+    { 'n',  1, 6279,    0 }, { 'o',  0, 6280, 1952 }, { 'g',  1, 6280,    0 }, { 't',  1, 6281,    0 },
+    { 's',  0, 6282,   25 }, { 'f',  1, 6282,    0 }, { 'u',  1, 6283,    0 }, { 's',  0, 6284,   49 },
+    { 'e',  1, 6284,    0 }, { 'C',  1, 6285,    0 }, { 'y',  2, 6286,    0 }, { 't',  1, 6288,    0 },
+    { 'o',  1, 6289,    0 }, { 'a',  1, 6290,    0 }, { 'i',  1, 6291,    0 }, { 't',  1, 6292,    0 },
+    { 'n',  1, 6293,    0 }, { 't',  3, 6294,    0 }, { 'g',  2, 6297,    0 }, { 'h',  1, 6299,    0 },
+    { 'r',  1, 6300,    0 }, { 'o',  1, 6301,    0 }, { 't',  1, 6302,    0 }, { 'B',  1, 6303,    0 },
+    { 'U',  1, 6304,    0 }, { 'i',  1, 6305,    0 }, { 'e',  1, 6306,    0 }, { 'e',  1, 6307,    0 },
+    { 'T',  1, 6308,    0 }, { 'V',  1, 6309,    0 }, { 'r',  1, 6310,    0 }, { 'l',  1, 6311,    0 },
+    { 'S',  1, 6312,    0 }, { 'e',  0, 6313,  137 }, { 'u',  1, 6313,    0 }, { 'a',  1, 6314,    0 },
+    { 'l',  1, 6315,    0 }, { 'y',  1, 6316,    0 }, { 'f',  0, 6317,  151 }, { 'u',  1, 6317,    0 },
+    { 'l',  1, 6318,    0 }, { 'e',  1, 6319,    0 }, { 's',  1, 6320,    0 }, { 'a',  1, 6321,    0 },
+    { 'l',  1, 6322,    0 }, { 'a',  1, 6323,    0 }, { 'l',  1, 6324,    0 }, { 'u',  1, 6325,    0 },
+    { 'I',  0, 6326,  197 }, { 'i',  1, 6326,    0 }, { 'C',  1, 6327,    0 }, { 'T',  1, 6328,    0 },
+    { 'f',  0, 6329,  231 }, { 'B',  1, 6329,    0 }, { 'B',  1, 6330,    0 }, { 'R',  1, 6331,    0 },
+    { 'n',  1, 6332,    0 }, { 'e',  1, 6333,    0 }, { 'e',  1, 6334,    0 }, { 'e',  1, 6335,    0 },
+    { 'A',  1, 6336,    0 }, { 'V',  1, 6337,    0 }, { 'r',  1, 6338,    0 }, { 'c',  1, 6339,    0 },
+    { 'g',  1, 6340,    0 }, { 'n',  1, 6341,    0 }, { 'V',  1, 6342,    0 }, { 't',  1, 6343,    0 },
+    { 'r',  1, 6344,  258 }, { 'a',  1, 6345,    0 }, { 'G',  1, 6346,    0 }, { 'q',  1, 6347,    0 },
+    { 'e',  1, 6348,    0 }, { 'E',  1, 6349,    0 }, { 'w',  0, 6350,  270 }, { 'r',  1, 6350,    0 },
+    { 'i',  1, 6351,    0 }, { 'A',  1, 6352,    0 }, { 'r',  1, 6353,    0 }, { 'i',  1, 6354,    0 },
+    { 'a',  1, 6355,    0 }, { 'A',  1, 6356,    0 }, { 't',  1, 6357,    0 }, { 'c',  1, 6358,    0 },
+    { 'e',  1, 6359,    0 }, { 'h',  1, 6360,    0 }, { 'e',  1, 6361,    0 }, { 'a',  1, 6362,    0 },
+    { 's',  1, 6363,    0 }, { 'n',  1, 6364,    0 }, { 'e',  1, 6365,    0 }, { 'V',  1, 6366,    0 },
+    { 't',  0, 6367,  314 }, { 'r',  3, 6367,  317 }, { 'i',  1, 6370,    0 }, { 'u',  1, 6371,    0 },
+    { 'e',  1, 6372,    0 }, { 'l',  1, 6373,    0 }, { 'e',  1, 6374,    0 }, { 'e',  1, 6375,    0 },
+    { 'r',  1, 6376,    0 }, { 'S',  1, 6377,    0 }, { 'E',  1, 6378,    0 }, { 'd',  1, 6379,    0 },
+    { 'e',  1, 6380,    0 }, { 'q',  1, 6381,    0 }, { 'u',  1, 6382,    0 }, { 'i',  1, 6383,    0 },
+    { 'a',  1, 6384,    0 }, { 'D',  1, 6385,    0 }, { 'Q',  1, 6386,    0 }, { 'e',  1, 6387,    0 },
+    { 't',  1, 6388,    0 }, { 'l',  1, 6389,    0 }, { 'q',  1, 6390,    0 }, { 'l',  1, 6391,    0 },
+    { 'i',  1, 6392,    0 }, { 'n',  1, 6393,  384 }, { 'e',  1, 6394,    0 }, { 'u',  1, 6395,    0 },
+    { 'E',  1, 6396,    0 }, { 'e',  1, 6397,    0 }, { 'w',  2, 6398,  408 }, { 'i',  1, 6400,    0 },
+    { 'l',  1, 6401,    0 }, { 'T',  1, 6402,    0 }, { 'V',  1, 6403,    0 }, { 'r',  0, 6404,  416 },
+    { 'r',  1, 6404,    0 }, { 'e',  1, 6405,    0 }, { 'n',  1, 6406,    0 }, { 'w',  1, 6407,    0 },
+    { 'e',  1, 6408,    0 }, { 'c',  1, 6409,    0 }, { 'o',  1, 6410,    0 }, { 'w',  0, 6411,  429 },
+    { 'i',  1, 6411,    0 }, { 'o',  1, 6412,    0 }, { 'e',  1, 6413,    0 }, { 'A',  1, 6414,    0 },
+    { 'A',  1, 6415,    0 }, { 't',  1, 6416,    0 }, { 'r',  1, 6417,    0 }, { 'l',  1, 6418,    0 },
+    { 'e',  1, 6419,    0 }, { 's',  1, 6420,    0 }, { 'e',  1, 6421,    0 }, { 'o',  1, 6422,    0 },
+    { 'a',  1, 6423,    0 }, { 'q',  1, 6424,    0 }, { 'l',  1, 6425,    0 }, { 'i',  1, 6426,    0 },
+    { 'q',  1, 6427,    0 }, { 'l',  0, 6428,  490 }, { 'E',  1, 6428,    0 }, { 'e',  0, 6429,  492 },
+    { 'e',  0, 6429,  509 }, { 'k',  1, 6429,    0 }, { 'n',  1, 6430,    0 }, { 'r',  0, 6431,  517 },
+    { 'w',  1, 6431,    0 }, { 'o',  1, 6432,    0 }, { 'r',  1, 6433,    0 }, { 'w',  0, 6434,  522 },
+    { 'o',  1, 6434,    0 }, { 'A',  1, 6435,    0 }, { 't',  1, 6436,    0 }, { 'a',  1, 6437,    0 },
+    { 'i',  1, 6438,    0 }, { 'e',  1, 6439,    0 }, { 'i',  1, 6440,    0 }, { 'p',  1, 6441,    0 },
+    { 'S',  1, 6442,    0 }, { 'o',  1, 6443,    0 }, { 'l',  1, 6444,    0 }, { 'n',  1, 6445,    0 },
+    { 'r',  1, 6446,    0 }, { 'n',  1, 6447,    0 }, { 'o',  1, 6448,    0 }, { 't',  0, 6449,  784 },
+    { 'r',  1, 6449,    0 }, { 's',  1, 6450,    0 }, { 't',  0, 6451,  800 }, { 'e',  1, 6451,    0 },
+    { 'c',  1, 6452,    0 }, { 'e',  0, 6453,  834 }, { 'w',  2, 6453,    0 }, { 'i',  1, 6455,    0 },
+    { 'i',  1, 6456,    0 }, { 'w',  1, 6457,    0 }, { 'r',  1, 6458,    0 }, { 'o',  1, 6459,    0 },
+    { 'r',  0, 6460,  949 }, { 's',  1, 6460,    0 }, { 'o',  1, 6461,    0 }, { 'a',  1, 6462,    0 },
+    { 't',  1, 6463,    0 }, { 's',  0, 6464, 1057 }, { 'r',  1, 6464,    0 }, { 'a',  1, 6465,    0 },
+    { 't',  1, 6466,    0 }, { 'o',  1, 6467,    0 }, { 'r',  1, 6468,    0 }, { 'a',  1, 6469,    0 },
+    { 'h',  1, 6470,    0 }, { 's',  1, 6471,    0 }, { 't',  1, 6472,    0 }, { 'x',  0, 6473, 1223 },
+    { 'r',  0, 6473, 1226 }, { 'e',  0, 6473, 1246 }, { 'r',  1, 6473,    0 }, { 'i',  1, 6474,    0 },
+    { 'o',  0, 6475, 1259 }, { 'a',  1, 6475,    0 }, { 'l',  1, 6476,    0 }, { 'r',  1, 6477,    0 },
+    { 'n',  0, 6478, 1311 }, { 't',  0, 6478, 1312 }, { 'n',  1, 6478,    0 }, { 'w',  0, 6479, 1341 },
+    { 't',  1, 6479,    0 }, { 'o',  1, 6480,    0 }, { 'w',  0, 6481, 1389 }, { 't',  1, 6481,    0 },
+    { 'o',  1, 6482,    0 }, { 'a',  1, 6483,    0 }, { 'l',  1, 6484,    0 }, { 'r',  1, 6485,    0 },
+    { 'x',  0, 6486, 1556 }, { 'e',  1, 6486,    0 }, { 'o',  1, 6487,    0 }, { 'n',  1, 6488,    0 },
+    { 'w',  1, 6489, 1648 }, { 'o',  1, 6490,    0 }, { 'a',  1, 6491,    0 }, { 'h',  1, 6492,    0 },
+    { 't',  1, 6493,    0 }, { 'g',  1, 6494,    0 }, { 'e',  1, 6495,    0 }, { 's',  1, 6496,    0 },
+    { 'e',  0, 6497, 1663 }, { 'l',  1, 6497,    0 }, { 'i',  1, 6498,    0 }, { 'q',  0, 6499, 1762 },
+    { 'q',  0, 6499, 1766 }, { 'p',  1, 6499,    0 }, { 'h',  1, 6500,    0 }, { 'q',  0, 6501, 1795 },
+    { 'x',  0, 6501, 1800 }, { 'e',  1, 6501,    0 }, { 'o',  1, 6502,    0 }, { 'q',  0, 6503, 1829 },
+    { 'o',  1, 6503,    0 }, { 'o',  1, 6504,    0 }, { 'e',  1, 6505,    0 }, { 'i',  1, 6506,    0 },
+    { 'f',  1, 6507,    0 }, { 'g',  1, 6508,    0 }, { 'o',  1, 6509,    0 }, { 'l',  1, 6510,    0 },
+    { 'r',  1, 6511,    0 }, { 's',  0, 6512, 1928 }, { 'n',  0, 6512, 1947 }, { 'g',  0, 6512, 1949 },
+    { 'l',  1, 6512,    0 }, { 'i',  1, 6513,    0 }, { 'f',  1, 6514,    0 }, { 's',  0, 6515,   48 },
+    { 's',  0, 6515,   50 }, { 'o',  1, 6515,    0 }, { 'D',  1, 6516,    0 }, { 'Q',  1, 6517,    0 },
+    { 'e',  1, 6518,    0 }, { 'c',  1, 6519,    0 }, { 'l',  4, 6520,    0 }, { 'a',  1, 6524,    0 },
+    { 'o',  1, 6525,    0 }, { 'A',  1, 6526,    0 }, { 'A',  1, 6527,    0 }, { 'R',  1, 6528,    0 },
+    { 'T',  1, 6529,    0 }, { 'L',  1, 6530,    0 }, { 'R',  1, 6531,    0 }, { 't',  2, 6532,    0 },
+    { 'r',  1, 6534,    0 }, { 'w',  1, 6535,    0 }, { 'i',  1, 6536,    0 }, { 'a',  1, 6537,    0 },
+    { 'p',  1, 6538,    0 }, { 'g',  1, 6539,    0 }, { 'e',  1, 6540,    0 }, { 'c',  1, 6541,    0 },
+    { 'e',  1, 6542,    0 }, { 'e',  1, 6543,    0 }, { 'o',  1, 6544,    0 }, { 'S',  1, 6545,    0 },
+    { 'm',  1, 6546,    0 }, { 'm',  0, 6547,  138 }, { 'l',  1, 6547,    0 }, { 'l',  1, 6548,    0 },
+    { 'S',  1, 6549,    0 }, { 'a',  1, 6550,    0 }, { 'l',  1, 6551,    0 }, { 'a',  1, 6552,    0 },
+    { 's',  0, 6553,  169 }, { 'n',  1, 6553,    0 }, { 'd',  1, 6554,    0 }, { 'c',  1, 6555,    0 },
+    { 'L',  1, 6556,    0 }, { 'm',  1, 6557,    0 }, { 'o',  1, 6558,    0 }, { 'o',  1, 6559,    0 },
+    { 'i',  1, 6560,    0 }, { 'r',  1, 6561,    0 }, { 'a',  1, 6562,    0 }, { 'i',  1, 6563,    0 },
+    { 'g',  0, 6564,  240 }, { 'B',  1, 6564,    0 }, { 'e',  1, 6565,    0 }, { 'c',  1, 6566,    0 },
+    { 'r',  1, 6567,    0 }, { 'e',  1, 6568,    0 }, { 'o',  1, 6569,    0 }, { 't',  1, 6570,    0 },
+    { 'l',  1, 6571,    0 }, { 'V',  1, 6572,    0 }, { 'e',  1, 6573,    0 }, { 'o',  1, 6574,    0 },
+    { 'B',  1, 6575,    0 }, { 'r',  1, 6576,    0 }, { 'r',  1, 6577,    0 }, { 'u',  1, 6578,    0 },
+    { 'r',  0, 6579,  264 }, { 'q',  1, 6579,    0 }, { 'r',  1, 6580,    0 }, { 'g',  1, 6581,    0 },
+    { 'r',  1, 6582,    0 }, { 'r',  1, 6583,    0 }, { 'g',  1, 6584,    0 }, { 'r',  1, 6585,    0 },
+    { 'r',  1, 6586,    0 }, { 'A',  1, 6587,    0 }, { 'e',  0, 6588,  287 }, { 'd',  1, 6588,    0 },
+    { 'i',  2, 6589,    0 }, { 'r',  1, 6591,    0 }, { 't',  1, 6592,    0 }, { 'L',  1, 6593,    0 },
+    { 'g',  1, 6594,    0 }, { 'n',  1, 6595,    0 }, { 'e',  1, 6596,    0 }, { 'E',  1, 6597,    0 },
+    { 'L',  1, 6598,    0 }, { 'T',  1, 6599,    0 }, { 'a',  1, 6600,    0 }, { 'a',  1, 6601,    0 },
+    { 'a',  1, 6602,    0 }, { 'd',  1, 6603,    0 }, { 's',  1, 6604,  327 }, { 'E',  1, 6605,    0 },
+    { 'i',  1, 6606,    0 }, { 'u',  2, 6607,    0 }, { 'q',  1, 6609,    0 }, { 's',  1, 6610,  335 },
+    { 't',  1, 6611,    0 }, { 'u',  1, 6612,    0 }, { 'l',  1, 6613,    0 }, { 'l',  1, 6614,    0 },
+    { 'l',  1, 6615,    0 }, { 'o',  1, 6616,    0 }, { 'u',  1, 6617,    0 }, { 't',  0, 6618,  367 },
+    { 'h',  1, 6618,    0 }, { 'a',  1, 6619,    0 }, { 'u',  1, 6620,    0 }, { 'a',  1, 6621,    0 },
+    { 'l',  1, 6622,    0 }, { 'a',  1, 6623,    0 }, { 'm',  1, 6624,    0 }, { 'i',  1, 6625,    0 },
+    { 'q',  1, 6626,    0 }, { 'B',  1, 6627,    0 }, { 'B',  1, 6628,    0 }, { 'L',  1, 6629,    0 },
+    { 'n',  1, 6630,    0 }, { 'e',  1, 6631,    0 }, { 'e',  1, 6632,    0 }, { 'e',  1, 6633,    0 },
+    { 'r',  1, 6634,    0 }, { 'c',  1, 6635,    0 }, { 'g',  1, 6636,    0 }, { 'n',  1, 6637,    0 },
+    { 'V',  1, 6638,    0 }, { 't',  1, 6639,    0 }, { 'r',  1, 6640,  427 }, { 'e',  1, 6641,    0 },
+    { 'w',  0, 6642,  432 }, { 'd',  0, 6642,  435 }, { 'r',  1, 6642,    0 }, { 'r',  1, 6643,    0 },
+    { 'A',  1, 6644,    0 }, { 'o',  1, 6645,    0 }, { 'e',  0, 6646,  451 }, { 'r',  1, 6646,    0 },
+    { 'e',  1, 6647,    0 }, { 'r',  1, 6648,    0 }, { 'n',  0, 6649,  460 }, { 'l',  0, 6649,  465 },
+    { 'u',  1, 6649,    0 }, { 'a',  1, 6650,    0 }, { 'l',  1, 6651,    0 }, { 'u',  1, 6652,    0 },
+    { 'q',  1, 6653,    0 }, { 'e',  1, 6654,    0 }, { 't',  1, 6655,    0 }, { 'n',  1, 6656,    0 },
+    { 'w',  0, 6657,  519 }, { 'i',  1, 6657,    0 }, { 'w',  0, 6658,  524 }, { 'r',  1, 6658,    0 },
+    { 'A',  1, 6659,    0 }, { 'r',  0, 6660,  541 }, { 'n',  1, 6660,    0 }, { 'p',  1, 6661,    0 },
+    { 'l',  1, 6662,    0 }, { 'a',  1, 6663,    0 }, { 'p',  1, 6664,    0 }, { 'n',  0, 6665,  640 },
+    { 'e',  2, 6665,    0 }, { 'g',  1, 6667,    0 }, { 'e',  0, 6668,  676 }, { 'g',  1, 6668,    0 },
+    { 'w',  2, 6669,    0 }, { 'c',  0, 6671,  785 }, { 'h',  0, 6671,  786 }, { 'c',  0, 6671,  831 },
+    { 'c',  0, 6671,  832 }, { 'l',  1, 6671,    0 }, { 'r',  1, 6672,    0 }, { 't',  0, 6673,  867 },
+    { 'm',  1, 6673,    0 }, { 'e',  1, 6674,    0 }, { 'r',  1, 6675,    0 }, { 'n',  2, 6676,    0 },
+    { 's',  0, 6678,  950 }, { 'n',  0, 6678,  967 }, { 'l',  1, 6678,    0 }, { 's',  1, 6679,    0 },
+    { 'r',  1, 6680,    0 }, { 'r',  1, 6681,    0 }, { 'a',  1, 6682,    0 }, { 'n',  2, 6683,    0 },
+    { 'r',  1, 6685,    0 }, { 'r',  1, 6686,    0 }, { 'a',  1, 6687,    0 }, { 'q',  1, 6688,    0 },
+    { 'i',  1, 6689,    0 }, { 'r',  1, 6690,    0 }, { 'g',  1, 6691,    0 }, { 'r',  1, 6692,    0 },
+    { 'e',  1, 6693,    0 }, { 'i',  1, 6694,    0 }, { 'g',  1, 6695,    0 }, { 'a',  1, 6696,    0 },
+    { 'w',  0, 6697, 1343 }, { 'a',  1, 6697,    0 }, { 'w',  0, 6698, 1416 }, { 'l',  1, 6698,    0 },
+    { 'e',  1, 6699,    0 }, { 'i',  1, 6700,    0 }, { 'q',  0, 6701, 1557 }, { 'x',  0, 6701, 1559 },
+    { 's',  0, 6701, 1584 }, { 't',  1, 6701,    0 }, { 'o',  1, 6702,    0 }, { 'r',  1, 6703,    0 },
+    { 'a',  1, 6704,    0 }, { 'a',  1, 6705,    0 }, { 'a',  1, 6706,    0 }, { 't',  1, 6707,    0 },
+    { 'e',  1, 6708,    0 }, { 'l',  1, 6709,    0 }, { 'n',  1, 6710,    0 }, { 's',  1, 6711,    0 },
+    { 'i',  0, 6712, 1779 }, { 'q',  0, 6712, 1801 }, { 'x',  0, 6712, 1803 }, { 'x',  0, 6712, 1853 },
+    { 'w',  1, 6712,    0 }, { 'f',  1, 6713,    0 }, { 'g',  1, 6714,    0 }, { 't',  1, 6715,    0 },
+    { 'h',  1, 6716,    0 }, { 'w',  0, 6717, 1921 }, { 'e',  1, 6717,    0 }, { 'i',  1, 6718,    0 },
+    { 'e',  2, 6719,    0 }, { 'o',  1, 6721,    0 }, { 'e',  1, 6722,    0 }, { 'n',  1, 6723,    0 },
+    { 'o',  1, 6724,    0 }, { 'u',  1, 6725,    0 }, { 'g',  1, 6726,    0 }, { 'k',  1, 6727,    0 },
+    { 'A',  1, 6728,    0 }, { 'D',  1, 6729,    0 }, { 'G',  1, 6730,    0 }, { 'T',  1, 6731,    0 },
+    { 'l',  1, 6732,    0 }, { 'u',  1, 6733,    0 }, { 'r',  1, 6734,    0 }, { 'r',  1, 6735,    0 },
+    { 'i',  1, 6736,    0 }, { 'e',  1, 6737,    0 }, { 'e',  1, 6738,    0 }, { 'i',  1, 6739,    0 },
+    { 'A',  1, 6740,    0 }, { 'T',  1, 6741,    0 }, { 'o',  1, 6742,    0 }, { 'n',  1, 6743,    0 },
+    { 'c',  1, 6744,    0 }, { 'r',  0, 6745,  105 }, { 'A',  1, 6745,    0 }, { 'h',  1, 6746,    0 },
+    { 'V',  1, 6747,    0 }, { 't',  1, 6748,    0 }, { 'e',  1, 6749,    0 }, { 'c',  1, 6750,    0 },
+    { 'w',  0, 6751,  116 }, { 'q',  1, 6751,    0 }, { 'a',  1, 6752,    0 }, { 'E',  0, 6753,  144 },
+    { 'S',  1, 6753,    0 }, { 'm',  1, 6754,    0 }, { 'l',  1, 6755,  165 }, { 'E',  1, 6756,    0 },
+    { 't',  1, 6757,    0 }, { 't',  1, 6758,    0 }, { 'e',  0, 6759,  171 }, { 'e',  0, 6759,  179 },
+    { 'i',  1, 6759,    0 }, { 'p',  0, 6760,  184 }, { 'n',  0, 6760,  201 }, { 'm',  1, 6760,    0 },
+    { 'm',  1, 6761,    0 }, { 'a',  1, 6762,    0 }, { 'r',  0, 6763,  238 }, { 'g',  1, 6763,    0 },
+    { 'r',  1, 6764,    0 }, { 'V',  1, 6765,    0 }, { 't',  1, 6766,    0 }, { 'r',  1, 6767,    0 },
+    { 'c',  1, 6768,    0 }, { 'w',  0, 6769,  249 }, { 'o',  1, 6769,    0 }, { 'e',  2, 6770,  251 },
+    { 'e',  1, 6772,    0 }, { 'c',  1, 6773,    0 }, { 'r',  1, 6774,  256 }, { 'a',  1, 6775,    0 },
+    { 'r',  1, 6776,    0 }, { 'e',  1, 6777,    0 }, { 'a',  1, 6778,    0 }, { 'u',  1, 6779,    0 },
+    { 'o',  1, 6780,    0 }, { 'h',  1, 6781,    0 }, { 'r',  1, 6782,    0 }, { 'o',  1, 6783,    0 },
+    { 'h',  1, 6784,    0 }, { 'r',  1, 6785,    0 }, { 'r',  1, 6786,    0 }, { 'r',  1, 6787,    0 },
+    { 'i',  1, 6788,    0 }, { 'c',  1, 6789,    0 }, { 'n',  1, 6790,    0 }, { 'y',  1, 6791,    0 },
+    { 'e',  1, 6792,    0 }, { 'e',  1, 6793,    0 }, { 'S',  1, 6794,    0 }, { 't',  0, 6795,  311 },
+    { 'r',  1, 6795,    0 }, { 'q',  1, 6796,    0 }, { 'e',  1, 6797,    0 }, { 'i',  1, 6798,    0 },
+    { 'n',  1, 6799,    0 }, { 'l',  0, 6800,  324 }, { 't',  1, 6800,    0 }, { 'e',  0, 6801,  326 },
+    { 'S',  1, 6801,    0 }, { 'l',  1, 6802,    0 }, { 'a',  1, 6803,    0 }, { 'b',  1, 6804,    0 },
+    { 'p',  1, 6805,    0 }, { 'u',  1, 6806,    0 }, { 'S',  1, 6807,    0 }, { 'E',  1, 6808,    0 },
+    { 'a',  1, 6809,    0 }, { 'l',  1, 6810,    0 }, { 'd',  1, 6811,    0 }, { 'B',  1, 6812,    0 },
+    { 'u',  1, 6813,    0 }, { 'o',  1, 6814,    0 }, { 'e',  1, 6815,    0 }, { 'n',  1, 6816,    0 },
+    { 'a',  1, 6817,    0 }, { 'n',  1, 6818,    0 }, { 'd',  1, 6819,    0 }, { 'l',  0, 6820,  385 },
+    { 'e',  1, 6820,    0 }, { 'l',  1, 6821,    0 }, { 'u',  1, 6822,    0 }, { 'r',  1, 6823,    0 },
+    { 'a',  1, 6824,    0 }, { 'e',  1, 6825,    0 }, { 'g',  0, 6826,  411 }, { 'B',  1, 6826,    0 },
+    { 'e',  1, 6827,    0 }, { 'c',  1, 6828,    0 }, { 'o',  1, 6829,    0 }, { 't',  1, 6830,    0 },
+    { 'l',  1, 6831,    0 }, { 'V',  1, 6832,    0 }, { 'e',  1, 6833,    0 }, { 'o',  1, 6834,    0 },
+    { 'B',  1, 6835,    0 }, { 's',  0, 6836,  431 }, { 'r',  1, 6836,    0 }, { 'r',  1, 6837,    0 },
+    { 'r',  1, 6838,    0 }, { 'w',  0, 6839,  449 }, { 's',  1, 6839,    0 }, { 't',  1, 6840,  456 },
+    { 's',  1, 6841,    0 }, { 'a',  1, 6842,    0 }, { 'n',  1, 6843,    0 }, { 'd',  1, 6844,    0 },
+    { 'a',  1, 6845,    0 }, { 'u',  1, 6846,    0 }, { 't',  0, 6847,  510 }, { 'h',  1, 6847,    0 },
+    { 'A',  1, 6848,    0 }, { 'u',  1, 6849,    0 }, { 'r',  1, 6850,    0 }, { 'r',  1, 6851,    0 },
+    { 'e',  0, 6852,  542 }, { 'a',  1, 6852,    0 }, { 'd',  1, 6853,    0 }, { 'c',  1, 6854,    0 },
+    { 'a',  1, 6855,    0 }, { 'd',  1, 6856,    0 }, { 'u',  1, 6857,    0 }, { 'e',  0, 6858,  675 },
+    { 'l',  1, 6858,    0 }, { 'l',  1, 6859,    0 }, { 'r',  1, 6860,    0 }, { 'e',  1, 6861,    0 },
+    { 'i',  1, 6862,    0 }, { 'e',  1, 6863,    0 }, { 'd',  1, 6864,    0 }, { 'o',  1, 6865,    0 },
+    { 'l',  1, 6866,    0 }, { 'r',  1, 6867,    0 }, { 'e',  0, 6868,  968 }, { 'e',  1, 6868,    0 },
+    { 'o',  1, 6869,    0 }, { 'r',  1, 6870,    0 }, { 'i',  1, 6871,    0 }, { 'd',  1, 6872,    0 },
+    { 'u',  1, 6873,    0 }, { 'o',  1, 6874,    0 }, { 'r',  1, 6875,    0 }, { 'r',  1, 6876,    0 },
+    { 'u',  1, 6877,    0 }, { 'm',  1, 6878,    0 }, { 'o',  1, 6879,    0 }, { 'h',  1, 6880,    0 },
+    { 'r',  1, 6881,    0 }, { 'f',  1, 6882,    0 }, { 'g',  1, 6883,    0 }, { 'l',  1, 6884,    0 },
+    { 'r',  1, 6885,    0 }, { 'r',  1, 6886,    0 }, { 'l',  1, 6887,    0 }, { 'f',  1, 6888,    0 },
+    { 'g',  1, 6889,    0 }, { 'a',  1, 6890,    0 }, { 'n',  2, 6891,    0 }, { 'r',  1, 6893,    0 },
+    { 'r',  1, 6894,    0 }, { 'r',  1, 6895,    0 }, { 'r',  1, 6896,    0 }, { 'i',  1, 6897,    0 },
+    { 'q',  0, 6898, 1658 }, { 'e',  1, 6898,    0 }, { 'u',  1, 6899,    0 }, { 'i',  1, 6900,    0 },
+    { 'n',  0, 6901, 1875 }, { 't',  1, 6901, 1876 }, { 'h',  1, 6902,    0 }, { 'a',  1, 6903,    0 },
+    { 't',  1, 6904,    0 }, { 'f',  1, 6905,    0 }, { 'g',  1, 6906,    0 }, { 'l',  1, 6907,    0 },
+    { 'r',  1, 6908,    0 }, { 'n',  0, 6909,   14 }, { 'r',  1, 6909,    0 }, { 't',  1, 6910,    0 },
+    { 'u',  1, 6911,    0 }, { 'o',  1, 6912,    0 }, { 'r',  1, 6913,    0 }, { 'w',  1, 6914,    0 },
+    { 'c',  1, 6915,    0 }, { 'o',  2, 6916,    0 }, { 'r',  1, 6918,    0 }, { 'i',  1, 6919,    0 },
+    { 'D',  0, 6920,   85 }, { 'r',  1, 6920,    0 }, { 'r',  1, 6921,    0 }, { 'r',  1, 6922,    0 },
+    { 'g',  1, 6923,    0 }, { 'e',  0, 6924,   95 }, { 'f',  1, 6924,    0 }, { 'g',  1, 6925,    0 },
+    { 'r',  1, 6926,    0 }, { 'e',  1, 6927,    0 }, { 'w',  0, 6928,  101 }, { 'A',  1, 6928,    0 },
+    { 'a',  1, 6929,    0 }, { 'r',  1, 6930,    0 }, { 't',  1, 6931,    0 }, { 'e',  1, 6932,    0 },
+    { 'o',  1, 6933,    0 }, { 'V',  1, 6934,    0 }, { 't',  1, 6935,    0 }, { 'u',  1, 6936,    0 },
+    { 'l',  1, 6937,    0 }, { 'q',  1, 6938,    0 }, { 'a',  1, 6939,    0 }, { 'L',  1, 6940,    0 },
+    { 'q',  1, 6941,    0 }, { 'e',  1, 6942,    0 }, { 'E',  1, 6943,    0 }, { 'n',  1, 6944,    0 },
+    { 'm',  1, 6945,    0 }, { 'e',  1, 6946,    0 }, { 'c',  1, 6947,    0 }, { 'h',  1, 6948,    0 },
+    { 'a',  1, 6949,    0 }, { 'e',  1, 6950,    0 }, { 'o',  1, 6951,    0 }, { 'o',  1, 6952,    0 },
+    { 't',  1, 6953,    0 }, { 'r',  0, 6954,  250 }, { 'B',  1, 6954,    0 }, { 'E',  1, 6955,    0 },
+    { 'c',  1, 6956,    0 }, { 't',  1, 6957,    0 }, { 'B',  1, 6958,    0 }, { 'r',  0, 6959,  259 },
+    { 'o',  1, 6959,    0 }, { 'a',  1, 6960,    0 }, { 'l',  0, 6961,  263 }, { 'a',  1, 6961,    0 },
+    { 'w',  0, 6962,  272 }, { 't',  1, 6962,    0 }, { 'o',  1, 6963,    0 }, { 'w',  0, 6964,  275 },
+    { 't',  1, 6964,    0 }, { 'o',  1, 6965,    0 }, { 'o',  1, 6966,    0 }, { 'r',  1, 6967,    0 },
+    { 'u',  1, 6968,    0 }, { 'k',  1, 6969,    0 }, { 'S',  1, 6970,    0 }, { 'T',  1, 6971,    0 },
+    { 'r',  1, 6972,    0 }, { 's',  1, 6973,    0 }, { 'p',  1, 6974,    0 }, { 't',  1, 6975,    0 },
+    { 'u',  1, 6976,    0 }, { 's',  1, 6977,    0 }, { 'l',  1, 6978,    0 }, { 'g',  1, 6979,    0 },
+    { 'e',  1, 6980,    0 }, { 'l',  1, 6981,    0 }, { 'e',  1, 6982,    0 }, { 'n',  1, 6983,    0 },
+    { 's',  1, 6984,    0 }, { 'e',  1, 6985,    0 }, { 'a',  1, 6986,    0 }, { 'l',  1, 6987,    0 },
+    { 'q',  1, 6988,    0 }, { 'l',  0, 6989,  339 }, { 'E',  1, 6989,    0 }, { 'e',  0, 6990,  341 },
+    { 'a',  1, 6990,    0 }, { 'b',  1, 6991,    0 }, { 't',  1, 6992,    0 }, { 's',  1, 6993,    0 },
+    { 'e',  0, 6994,  375 }, { 'l',  0, 6994,  379 }, { 't',  1, 6994,    0 }, { 'e',  0, 6995,  381 },
+    { 'n',  1, 6995,    0 }, { 'i',  1, 6996,    0 }, { 'i',  1, 6997,    0 }, { 'a',  1, 6998,    0 },
+    { 'r',  0, 6999,  409 }, { 'f',  1, 6999,    0 }, { 'r',  1, 7000,    0 }, { 'V',  1, 7001,    0 },
+    { 't',  1, 7002,    0 }, { 'w',  0, 7003,  418 }, { 'o',  1, 7003,    0 }, { 'e',  2, 7004,  420 },
+    { 'e',  1, 7006,    0 }, { 'c',  1, 7007,    0 }, { 'r',  1, 7008,  425 }, { 'a',  1, 7009,    0 },
+    { 'o',  1, 7010,    0 }, { 'o',  1, 7011,    0 }, { 'r',  1, 7012,    0 }, { 'e',  1, 7013,    0 },
+    { 'E',  1, 7014,    0 }, { 'e',  1, 7015,    0 }, { 'l',  0, 7016,  467 }, { 't',  1, 7016,    0 },
+    { 'e',  0, 7017,  469 }, { 'l',  0, 7017,  474 }, { 'a',  1, 7017,    0 }, { 'e',  1, 7018,    0 },
+    { 'r',  1, 7019,    0 }, { 'm',  0, 7020,  520 }, { 'o',  1, 7020,    0 }, { 'r',  1, 7021,    0 },
+    { 'r',  1, 7022,    0 }, { 'e',  0, 7023,  544 }, { 'e',  0, 7023,  545 }, { 'c',  1, 7023,    0 },
+    { 'o',  1, 7024,    0 }, { 'p',  0, 7025,  670 }, { 'e',  3, 7025,  677 }, { 'e',  1, 7028,    0 },
+    { 'i',  1, 7029,    0 }, { 'f',  1, 7030,    0 }, { 'g',  1, 7031,    0 }, { 's',  0, 7032,  874 },
+    { 'g',  1, 7032,    0 }, { 'w',  1, 7033,    0 }, { 'e',  1, 7034,    0 }, { 'i',  1, 7035,    0 },
+    { 'q',  0, 7036,  969 }, { 'w',  0, 7036, 1079 }, { 'o',  1, 7036,    0 }, { 'l',  0, 7037, 1204 },
+    { 'o',  1, 7037,    0 }, { 'p',  0, 7038, 1206 }, { 'w',  1, 7038,    0 }, { 'o',  1, 7039,    0 },
+    { 'p',  1, 7040,    0 }, { 'i',  1, 7041,    0 }, { 'e',  1, 7042,    0 }, { 'w',  0, 7043, 1257 },
+    { 't',  1, 7043,    0 }, { 'o',  1, 7044,    0 }, { 't',  0, 7045, 1261 }, { 'h',  1, 7045,    0 },
+    { 'e',  0, 7046, 1318 }, { 'r',  1, 7046,    0 }, { 'r',  1, 7047,    0 }, { 'e',  1, 7048,    0 },
+    { 't',  1, 7049, 1441 }, { 'h',  1, 7050,    0 }, { 'i',  1, 7051,    0 }, { 'd',  1, 7052,    0 },
+    { 'u',  1, 7053,    0 }, { 'o',  1, 7054,    0 }, { 'p',  1, 7055,    0 }, { 'r',  1, 7056,    0 },
+    { 'r',  1, 7057,    0 }, { 'm',  1, 7058,    0 }, { 'l',  0, 7059, 1725 }, { 's',  0, 7059, 1742 },
+    { 'l',  1, 7059,    0 }, { 'e',  1, 7060,    0 }, { 't',  1, 7061, 1879 }, { 'r',  1, 7062,    0 },
+    { 'a',  1, 7063,    0 }, { 't',  0, 7064, 1922 }, { 'h',  1, 7064,    0 }, { 'e',  1, 7065,    0 },
+    { 'i',  1, 7066,    0 }, { 'e',  1, 7067,    0 }, { 'o',  1, 7068,    0 }, { 'b',  1, 7069,    0 },
+    { 't',  1, 7070,    0 }, { 'a',  1, 7071,    0 }, { 'i',  1, 7072,    0 }, { 'u',  1, 7073,    0 },
+    { 't',  0, 7074,   80 }, { 'u',  1, 7074,    0 }, { 'a',  1, 7075,    0 }, { 'l',  1, 7076,    0 },
+    { 'I',  1, 7077,    0 }, { 'o',  1, 7078,    0 }, { 'o',  1, 7079,    0 }, { 'h',  1, 7080,    0 },
+    { 't',  2, 7081,    0 }, { 'h',  1, 7083,    0 }, { 'r',  1, 7084,    0 }, { 'e',  0, 7085,  100 },
+    { 'r',  1, 7085,    0 }, { 'l',  1, 7086,    0 }, { 'r',  1, 7087,    0 }, { 'V',  1, 7088,    0 },
+    { 'c',  1, 7089,    0 }, { 'r',  1, 7090,  110 }, { 'e',  1, 7091,    0 }, { 'o',  1, 7092,    0 },
+    { 'a',  1, 7093,    0 }, { 'l',  1, 7094,    0 }, { 'u',  1, 7095,    0 }, { 'l',  1, 7096,    0 },
+    { 'e',  1, 7097,    0 }, { 'u',  1, 7098,    0 }, { 'r',  0, 7099,  168 }, { 'q',  1, 7099,    0 },
+    { 'e',  0, 7100,  181 }, { 'a',  0, 7100,  202 }, { 's',  0, 7100,  203 }, { 'k',  1, 7100,    0 },
+    { 't',  1, 7101,    0 }, { 'c',  1, 7102,    0 }, { 'c',  1, 7103,    0 }, { 'r',  1, 7104,  243 },
+    { 'w',  0, 7105,  246 }, { 'o',  1, 7105,    0 }, { 'a',  1, 7106,    0 }, { 'q',  1, 7107,    0 },
+    { 't',  1, 7108,    0 }, { 'o',  1, 7109,    0 }, { 'a',  1, 7110,    0 }, { 'w',  0, 7111,  261 },
+    { 't',  1, 7111,    0 }, { 'l',  0, 7112,  266 }, { 'A',  1, 7112,    0 }, { 'w',  0, 7113,  274 },
+    { 'a',  1, 7113,    0 }, { 'w',  0, 7114,  277 }, { 'w',  0, 7114,  279 }, { 'o',  1, 7114,    0 },
+    { 'm',  1, 7115,    0 }, { 'S',  1, 7116,    0 }, { 'p',  1, 7117,    0 }, { 'h',  1, 7118,    0 },
+    { 'G',  1, 7119,    0 }, { 's',  0, 7120,  304 }, { 'a',  1, 7120,    0 }, { 'i',  1, 7121,    0 },
+    { 'a',  1, 7122,    0 }, { 's',  0, 7123,  319 }, { 'd',  1, 7123,    0 }, { 'l',  1, 7124,    0 },
+    { 'r',  0, 7125,  325 }, { 'a',  1, 7125,    0 }, { 'm',  1, 7126,    0 }, { 'g',  1, 7127,    0 },
+    { 'e',  1, 7128,    0 }, { 'r',  1, 7129,    0 }, { 'l',  0, 7130,  334 }, { 'a',  1, 7130,    0 },
+    { 'u',  1, 7131,    0 }, { 'q',  1, 7132,    0 }, { 'r',  0, 7133,  342 }, { 'l',  1, 7133,    0 },
+    { 'e',  0, 7134,  358 }, { 'i',  1, 7134,    0 }, { 'E',  1, 7135,    0 }, { 't',  0, 7136,  402 },
+    { 'b',  1, 7136,    0 }, { 'l',  1, 7137,    0 }, { 'c',  1, 7138,    0 }, { 't',  1, 7139,    0 },
+    { 'a',  1, 7140,    0 }, { 'e',  1, 7141,    0 }, { 'o',  1, 7142,    0 }, { 'r',  0, 7143,  419 },
+    { 'B',  1, 7143,    0 }, { 'E',  1, 7144,    0 }, { 'c',  1, 7145,    0 }, { 't',  1, 7146,    0 },
+    { 'B',  1, 7147,    0 }, { 'r',  0, 7148,  428 }, { 'w',  0, 7148,  446 }, { 'w',  0, 7148,  447 },
+    { 'o',  1, 7148,    0 }, { 'c',  1, 7149,    0 }, { 'q',  1, 7150,    0 }, { 't',  1, 7151,  458 },
+    { 'E',  1, 7152,    0 }, { 'l',  0, 7153,  491 }, { 's',  1, 7153,    0 }, { 'r',  1, 7154,    0 },
+    { 'w',  0, 7155,  525 }, { 'o',  1, 7155,    0 }, { 'a',  1, 7156,    0 }, { 'e',  0, 7157,  574 },
+    { 'w',  1, 7157,    0 }, { 'd',  1, 7158,    0 }, { 'l',  1, 7159,    0 }, { 'r',  1, 7160,    0 },
+    { 'f',  1, 7161,    0 }, { 'g',  1, 7162,    0 }, { 't',  0, 7163,  836 }, { 'h',  1, 7163,    0 },
+    { 'e',  0, 7164,  887 }, { 's',  0, 7164,  889 }, { 'f',  1, 7164,    0 }, { 'g',  1, 7165,    0 },
+    { 'w',  0, 7166, 1080 }, { 'w',  1, 7166,    0 }, { 's',  0, 7167, 1207 }, { 'w',  1, 7167, 1208 },
+    { 'o',  1, 7168,    0 }, { 'g',  1, 7169,    0 }, { 's',  0, 7170, 1212 }, { 'a',  1, 7170,    0 },
+    { 'w',  0, 7171, 1260 }, { 't',  0, 7171, 1262 }, { 'o',  1, 7171,    0 }, { 'o',  1, 7172,    0 },
+    { 'l',  0, 7173, 1423 }, { 'e',  1, 7173,    0 }, { 't',  1, 7174, 1443 }, { 'l',  0, 7175, 1649 },
+    { 'o',  1, 7175,    0 }, { 'p',  0, 7176, 1651 }, { 'w',  1, 7176,    0 }, { 'o',  1, 7177,    0 },
+    { 'o',  1, 7178,    0 }, { 'o',  1, 7179,    0 }, { 'e',  1, 7180,    0 }, { 'o',  1, 7181,    0 },
+    { 'q',  0, 7182, 1877 }, { 'e',  1, 7182,    0 }, { 'r',  1, 7183,    0 }, { 'r',  1, 7184,    0 },
+    { 't',  0, 7185, 1923 }, { 'f',  1, 7185,    0 }, { 'g',  1, 7186,    0 }, { 'n',  1, 7187,    0 },
+    { 'u',  1, 7188,    0 }, { 'l',  1, 7189,    0 }, { 'e',  0, 7190,   53 }, { 'l',  0, 7190,   58 },
+    { 's',  1, 7190,    0 }, { 't',  1, 7191,    0 }, { 'b',  1, 7192,    0 }, { 'v',  1, 7193,    0 },
+    { 'd',  1, 7194,    0 }, { 'n',  1, 7195,    0 }, { 'w',  0, 7196,   92 }, { 'w',  0, 7196,   93 },
+    { 't',  1, 7196,    0 }, { 'A',  1, 7197,    0 }, { 'R',  1, 7198,    0 }, { 't',  1, 7199,    0 },
+    { 'o',  1, 7200,    0 }, { 'r',  1, 7201,    0 }, { 'B',  1, 7202,    0 }, { 'o',  1, 7203,    0 },
+    { 'e',  1, 7204,    0 }, { 't',  1, 7205,    0 }, { 'B',  1, 7206,    0 }, { 'c',  1, 7207,    0 },
+    { 'r',  1, 7208,  113 }, { 'r',  1, 7209,    0 }, { 'S',  1, 7210,    0 }, { 'a',  1, 7211,    0 },
+    { 'l',  1, 7212,    0 }, { 's',  1, 7213,    0 }, { 'a',  1, 7214,    0 }, { 'u',  1, 7215,    0 },
+    { 'e',  1, 7216,    0 }, { 'A',  1, 7217,    0 }, { 'k',  1, 7218,    0 }, { 't',  1, 7219,    0 },
+    { 'B',  1, 7220,    0 }, { 'r',  0, 7221,  247 }, { 'r',  0, 7221,  252 }, { 'u',  1, 7221,    0 },
+    { 'o',  1, 7222,    0 }, { 'r',  0, 7223,  255 }, { 'r',  0, 7223,  257 }, { 'e',  1, 7223,    0 },
+    { 'r',  1, 7224,    0 }, { 'r',  1, 7225,    0 }, { 'w',  0, 7226,  280 }, { 'S',  1, 7226,    0 },
+    { 'p',  1, 7227,    0 }, { 'a',  1, 7228,    0 }, { 'i',  1, 7229,    0 }, { 'r',  1, 7230,    0 },
+    { 'c',  1, 7231,    0 }, { 'c',  1, 7232,    0 }, { 'l',  0, 7233,  318 }, { 'e',  0, 7233,  320 },
+    { 'e',  1, 7233,  321 }, { 'n',  1, 7234,    0 }, { 'e',  1, 7235,    0 }, { 'l',  1, 7236,    0 },
+    { 't',  1, 7237,    0 }, { 's',  1, 7238,    0 }, { 'n',  1, 7239,    0 }, { 'a',  1, 7240,    0 },
+    { 'u',  1, 7241,    0 }, { 'e',  1, 7242,    0 }, { 's',  0, 7243,  368 }, { 'q',  1, 7243,    0 },
+    { 'r',  1, 7244,    0 }, { 'i',  1, 7245,    0 }, { 'k',  1, 7246,    0 }, { 'A',  1, 7247,    0 },
+    { 'c',  1, 7248,    0 }, { 'c',  1, 7249,    0 }, { 'r',  1, 7250,  414 }, { 'a',  1, 7251,    0 },
+    { 'q',  1, 7252,    0 }, { 't',  1, 7253,    0 }, { 'o',  1, 7254,    0 }, { 'a',  1, 7255,    0 },
+    { 'w',  0, 7256,  448 }, { 't',  1, 7256,    0 }, { 'u',  1, 7257,    0 }, { 'E',  1, 7258,    0 },
+    { 'q',  1, 7259,    0 }, { 'i',  1, 7260,    0 }, { 'o',  1, 7261,    0 }, { 'w',  0, 7262,  526 },
+    { 't',  1, 7262,    0 }, { 'n',  0, 7263,  669 }, { 'o',  1, 7263,    0 }, { 'e',  1, 7264,    0 },
+    { 'i',  1, 7265,    0 }, { 't',  0, 7266,  780 }, { 'h',  1, 7266,    0 }, { 't',  0, 7267,  837 },
+    { 't',  0, 7267,  890 }, { 'h',  1, 7267,    0 }, { 'n',  0, 7268, 1205 }, { 's',  0, 7268, 1209 },
+    { 'o',  1, 7268,    0 }, { 'a',  1, 7269,    0 }, { 'r',  1, 7270,    0 }, { 'w',  0, 7271, 1342 },
+    { 'w',  0, 7271, 1390 }, { 'q',  0, 7271, 1442 }, { 'e',  1, 7271,    0 }, { 'w',  1, 7272,    0 },
+    { 's',  0, 7273, 1652 }, { 'o',  1, 7273,    0 }, { 'w',  1, 7274,    0 }, { 'w',  0, 7275, 1655 },
+    { 's',  0, 7275, 1656 }, { 'n',  0, 7275, 1778 }, { 'q',  0, 7275, 1880 }, { 'o',  1, 7275,    0 },
+    { 'r',  1, 7276,    0 }, { 't',  0, 7277, 1957 }, { 'h',  1, 7277,    0 }, { 't',  1, 7278,    0 },
+    { 'r',  1, 7279,    0 }, { 'e',  1, 7280,    0 }, { 'e',  1, 7281,    0 }, { 'e',  0, 7282,   79 },
+    { 'l',  1, 7282,    0 }, { 'e',  0, 7283,   82 }, { 'e',  0, 7283,   83 }, { 't',  1, 7283,    0 },
+    { 'A',  1, 7284,    0 }, { 'r',  1, 7285,    0 }, { 'i',  1, 7286,    0 }, { 'A',  1, 7287,    0 },
+    { 'w',  0, 7288,   99 }, { 'o',  1, 7288,    0 }, { 'a',  1, 7289,    0 }, { 'w',  0, 7290,  106 },
+    { 'c',  1, 7290,    0 }, { 'o',  1, 7291,    0 }, { 'a',  1, 7292,    0 }, { 't',  1, 7293,    0 },
+    { 'B',  1, 7294,    0 }, { 'e',  0, 7295,  131 }, { 'q',  1, 7295,    0 }, { 'r',  1, 7296,    0 },
+    { 'S',  1, 7297,    0 }, { 's',  0, 7298,  166 }, { 'l',  0, 7298,  167 }, { 'a',  1, 7298,    0 },
+    { 't',  0, 7299,  236 }, { 'r',  1, 7299,    0 }, { 'e',  1, 7300,    0 }, { 'o',  1, 7301,    0 },
+    { 'a',  1, 7302,    0 }, { 'a',  1, 7303,    0 }, { 'r',  0, 7304,  254 }, { 'r',  0, 7304,  262 },
+    { 'r',  1, 7304,    0 }, { 'r',  1, 7305,    0 }, { 'p',  1, 7306,    0 }, { 'a',  1, 7307,    0 },
+    { 'c',  1, 7308,    0 }, { 'n',  1, 7309,    0 }, { 'e',  1, 7310,    0 }, { 'e',  0, 7311,  308 },
+    { 'a',  1, 7311,    0 }, { 'E',  1, 7312,    0 }, { 't',  1, 7313,    0 }, { 'n',  1, 7314,    0 },
+    { 'e',  1, 7315,  330 }, { 'E',  1, 7316,    0 }, { 'e',  1, 7317,    0 }, { 't',  1, 7318,    0 },
+    { 'l',  0, 7319,  337 }, { 'a',  1, 7319,    0 }, { 'Q',  1, 7320,    0 }, { 'u',  1, 7321,    0 },
+    { 'i',  1, 7322,    0 }, { 'b',  1, 7323,    0 }, { 'e',  1, 7324,    0 }, { 'r',  1, 7325,    0 },
+    { 'k',  1, 7326,    0 }, { 't',  1, 7327,    0 }, { 'B',  1, 7328,    0 }, { 'r',  0, 7329,  421 },
+    { 'u',  1, 7329,    0 }, { 'o',  1, 7330,    0 }, { 'r',  0, 7331,  424 }, { 'r',  0, 7331,  426 },
+    { 'i',  1, 7331,    0 }, { 'a',  1, 7332,    0 }, { 'q',  1, 7333,    0 }, { 'u',  1, 7334,    0 },
+    { 's',  0, 7335,  511 }, { 'w',  0, 7335,  518 }, { 'o',  1, 7335,    0 }, { 'w',  1, 7336,    0 },
+    { 'f',  1, 7337,    0 }, { 'g',  1, 7338,    0 }, { 't',  0, 7339,  781 }, { 't',  0, 7339,  891 },
+    { 'n',  1, 7339,    0 }, { 'r',  1, 7340,    0 }, { 'r',  1, 7341,    0 }, { 'q',  0, 7342, 1444 },
+    { 'n',  0, 7342, 1650 }, { 'n',  1, 7342,    0 }, { 's',  0, 7343, 1654 }, { 'w',  0, 7343, 1893 },
+    { 'o',  1, 7343,    0 }, { 't',  0, 7344, 1958 }, { 'i',  1, 7344,    0 }, { 'I',  1, 7345,    0 },
+    { 'Q',  1, 7346,    0 }, { 'C',  1, 7347,    0 }, { 'e',  1, 7348,    0 }, { 'e',  1, 7349,    0 },
+    { 'r',  1, 7350,    0 }, { 'r',  1, 7351,    0 }, { 'g',  1, 7352,    0 }, { 'r',  1, 7353,    0 },
+    { 'w',  0, 7354,  102 }, { 'r',  0, 7354,  103 }, { 't',  1, 7354,    0 }, { 'r',  0, 7355,  109 },
+    { 'r',  0, 7355,  111 }, { 'o',  1, 7355,    0 }, { 'a',  1, 7356,    0 }, { 'u',  1, 7357,    0 },
+    { 'e',  0, 7358,  147 }, { 'q',  1, 7358,    0 }, { 'l',  0, 7359,  170 }, { 'r',  1, 7359,    0 },
+    { 't',  0, 7360,  241 }, { 'r',  0, 7360,  242 }, { 'r',  0, 7360,  244 }, { 'l',  0, 7360,  253 },
+    { 'o',  1, 7360,    0 }, { 'o',  1, 7361,    0 }, { 'a',  1, 7362,    0 }, { 'c',  1, 7363,    0 },
+    { 'e',  0, 7364,  301 }, { 'S',  1, 7364,    0 }, { 'a',  1, 7365,    0 }, { 'l',  1, 7366,    0 },
+    { 'q',  1, 7367,    0 }, { 'E',  1, 7368,    0 }, { 't',  0, 7369,  329 }, { 'E',  1, 7369,    0 },
+    { 'q',  1, 7370,    0 }, { 't',  1, 7371,    0 }, { 'E',  1, 7372,    0 }, { 'l',  0, 7373,  340 },
+    { 'u',  1, 7373,    0 }, { 'a',  1, 7374,    0 }, { 'u',  1, 7375,    0 }, { 'r',  1, 7376,    0 },
+    { 't',  0, 7377,  407 }, { 'r',  1, 7377,    0 }, { 'e',  1, 7378,    0 }, { 'o',  1, 7379,    0 },
+    { 'a',  1, 7380,    0 }, { 'a',  1, 7381,    0 }, { 'r',  0, 7382,  423 }, { 'o',  1, 7382,    0 },
+    { 'l',  0, 7383,  457 }, { 'u',  1, 7383,    0 }, { 'a',  1, 7384,    0 }, { 'r',  0, 7385,  543 },
+    { 'n',  0, 7385,  678 }, { 't',  0, 7385,  679 }, { 'h',  1, 7385,    0 }, { 's',  0, 7386, 1210 },
+    { 'r',  1, 7386,    0 }, { 'o',  1, 7387,    0 }, { 's',  0, 7388, 1653 }, { 'w',  0, 7388, 1894 },
+    { 'a',  1, 7388,    0 }, { 'n',  1, 7389,    0 }, { 'u',  1, 7390,    0 }, { 'o',  1, 7391,    0 },
+    { 'A',  1, 7392,    0 }, { 'g',  1, 7393,    0 }, { 'r',  1, 7394,    0 }, { 'o',  1, 7395,    0 },
+    { 'h',  1, 7396,    0 }, { 'r',  1, 7397,    0 }, { 'o',  1, 7398,    0 }, { 'r',  0, 7399,  112 },
+    { 'r',  0, 7399,  114 }, { 'a',  1, 7399,    0 }, { 'u',  1, 7400,    0 }, { 'o',  1, 7401,    0 },
+    { 'w',  0, 7402,  273 }, { 'w',  0, 7402,  276 }, { 'c',  1, 7402,    0 }, { 'e',  0, 7403,  300 },
+    { 'p',  1, 7403,    0 }, { 't',  1, 7404,    0 }, { 'B',  1, 7405,    0 }, { 'u',  1, 7406,    0 },
+    { 'q',  1, 7407,    0 }, { 'q',  1, 7408,    0 }, { 'u',  1, 7409,    0 }, { 'E',  1, 7410,    0 },
+    { 'q',  1, 7411,    0 }, { 'o',  1, 7412,    0 }, { 'l',  0, 7413,  380 }, { 'm',  0, 7413,  403 },
+    { 'i',  1, 7413,    0 }, { 'o',  1, 7414,    0 }, { 't',  0, 7415,  412 }, { 'r',  0, 7415,  413 },
+    { 'r',  0, 7415,  415 }, { 'l',  0, 7415,  422 }, { 'n',  0, 7415,  455 }, { 'a',  1, 7415,    0 },
+    { 'l',  0, 7416,  468 }, { 't',  0, 7416,  680 }, { 'o',  1, 7416,    0 }, { 'w',  0, 7417, 1258 },
+    { 'l',  1, 7417,    0 }, { 't',  1, 7418,    0 }, { 'o',  1, 7419,    0 }, { 'n',  1, 7420,    0 },
+    { 'c',  1, 7421,    0 }, { 'r',  1, 7422,    0 }, { 'o',  1, 7423,    0 }, { 'w',  0, 7424,   96 },
+    { 't',  1, 7424,    0 }, { 'o',  1, 7425,    0 }, { 'r',  0, 7426,  108 }, { 'r',  1, 7426,    0 },
+    { 'a',  1, 7427,    0 }, { 'w',  0, 7428,  239 }, { 'e',  0, 7428,  299 }, { 'a',  1, 7428,    0 },
+    { 'e',  1, 7429,    0 }, { 'a',  1, 7430,    0 }, { 'a',  1, 7431,    0 }, { 'u',  1, 7432,    0 },
+    { 'u',  1, 7433,    0 }, { 'a',  1, 7434,    0 }, { 'q',  1, 7435,    0 }, { 'u',  1, 7436,    0 },
+    { 't',  1, 7437,    0 }, { 'u',  1, 7438,    0 }, { 'w',  0, 7439,  410 }, { 'l',  0, 7439,  459 },
+    { 'w',  0, 7439, 1211 }, { 'D',  0, 7439,   36 }, { 'e',  1, 7439,    0 }, { 't',  1, 7440,    0 },
+    { 't',  1, 7441,    0 }, { 'u',  1, 7442,    0 }, { 'a',  1, 7443,    0 }, { 'w',  0, 7444,   94 },
+    { 'A',  1, 7444,    0 }, { 'w',  0, 7445,   98 }, { 'e',  0, 7445,  132 }, { 'r',  1, 7445,    0 },
+    { 'c',  1, 7446,    0 }, { 'r',  0, 7447,  303 }, { 'r',  0, 7447,  313 }, { 'l',  0, 7447,  322 },
+    { 'a',  1, 7447,    0 }, { 'a',  1, 7448,    0 }, { 'l',  0, 7449,  332 }, { 'u',  1, 7449,    0 },
+    { 'a',  1, 7450,    0 }, { 'e',  0, 7451,  357 }, { 'm',  0, 7451,  404 }, { 'g',  1, 7451,    0 },
+    { 'e',  0, 7452,   52 }, { 'o',  1, 7452,    0 }, { 't',  1, 7453,    0 }, { 'l',  0, 7454,   90 },
+    { 'r',  1, 7454,    0 }, { 'e',  0, 7455,  148 }, { 'e',  0, 7455,  302 }, { 'l',  0, 7455,  328 },
+    { 'l',  0, 7455,  331 }, { 'a',  1, 7455,    0 }, { 'l',  0, 7456,  336 }, { 'r',  1, 7456,    0 },
+    { 'u',  1, 7457,    0 }, { 'e',  0, 7458,   81 }, { 'r',  1, 7458,    0 }, { 'l',  0, 7459,  333 },
+    { 'a',  1, 7459,    0 }, { 'r',  1, 7460,    0 }, { 'o',  1, 7461,    0 }, { 'l',  0, 7462,   51 },
+    { 'I',  1, 7462,    0 }, { 'w',  0, 7463,   97 }, { 'n',  1, 7463,    0 }, { 't',  1, 7464,    0 },
+    { 'e',  1, 7465,    0 }, { 'g',  1, 7466,    0 }, { 'r',  1, 7467,    0 }, { 'a',  1, 7468,    0 },
+    { 'l',  0, 7469,   61 }
+};
+
+#endif /* __ENTITYTRIE_H__ */
@@ -47,11 +47,23 @@ static void TIDY_CALL filesrc_ungetByte( void* sourceData, byte bv )
   tidyBufPutByte( &fin->unget, bv );
 }
 
+static uint TIDY_CALL filesrc_getBytes( void* sourceData, byte* bytes, uint size )
+{
+  FileSource* fin = (FileSource*) sourceData;
+  uint count = 0;
+  while ( count < size && fin->unget.size > 0 )
+    bytes[ count++ ] = (byte) tidyBufPopByte( &fin->unget );
+  if ( count < size )
+    count += (uint) fread( bytes + count, 1, size - count, fin->fp );
+  return count;
+}
+
 #if SUPPORT_POSIX_MAPPED_FILES
 #  define initFileSource initStdIOFileSource
 #  define freeFileSource freeStdIOFileSource
 #endif
-int TY_(initFileSource)( TidyAllocator *allocator, TidyInputSource* inp, FILE* fp )
+int TY_(initFileSource)( TidyAllocator *allocator, TidyInputSource* inp,
+                         TidyGetBytesFunc* getBytes, FILE* fp )
 {
   FileSource* fin = NULL;
 
@@ -66,6 +78,7 @@ int TY_(initFileSource)( TidyAllocator *allocator, TidyInputSource* inp, FILE* f
   inp->eof        = filesrc_eof;
   inp->ungetByte  = filesrc_ungetByte;
   inp->sourceData = fin;
+  *getBytes = filesrc_getBytes;
 
   return 0;
 }
@@ -98,10 +111,22 @@ void TIDY_CALL TY_(filesink_putByte)( void* sinkData, byte bv )
 #endif
 }
 
-void TY_(initFileSink)( TidyOutputSink* outp, FILE* fp )
+static void TIDY_CALL filesink_putBytes( void* sinkData, const byte* bytes, uint count )
+{
+#if defined(ENABLE_DEBUG_LOG)
+  uint i;
+  for ( i = 0; i < count; ++i )
+    TY_(filesink_putByte)( sinkData, bytes[i] );
+#else
+  fwrite( bytes, 1, count, (FILE*) sinkData );
+#endif
+}
+
+void TY_(initFileSink)( TidyOutputSink* outp, TidyPutBytesFunc* putBytes, FILE* fp )
 {
   outp->putByte  = TY_(filesink_putByte);
   outp->sinkData = fp;
+  *putBytes = filesink_putBytes;
 }
 
 /*
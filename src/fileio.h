@@ -16,22 +16,26 @@
 extern "C" {
 #endif
 
-/** Allocate and initialize file input source */
-int TY_(initFileSource)( TidyAllocator *allocator, TidyInputSource* source, FILE* fp );
+/** Allocate and initialize file input source, and set getBytes to the
+    callback that reads it in blocks */
+int TY_(initFileSource)( TidyAllocator *allocator, TidyInputSource* source,
+                         TidyGetBytesFunc* getBytes, FILE* fp );
 
 /** Free file input source */
 void TY_(freeFileSource)( TidyInputSource* source, Bool closeIt );
 
 #if SUPPORT_POSIX_MAPPED_FILES
 /** Allocate and initialize file input source using Standard C I/O */
-int TY_(initStdIOFileSource)( TidyAllocator *allocator, TidyInputSource* source, FILE* fp );
+int TY_(initStdIOFileSource)( TidyAllocator *allocator, TidyInputSource* source,
+                              TidyGetBytesFunc* getBytes, FILE* fp );
 
 /** Free file input source using Standard C I/O */
 void TY_(freeStdIOFileSource)( TidyInputSource* source, Bool closeIt );
 #endif
 
-/** Initialize file output sink */
-void TY_(initFileSink)( TidyOutputSink* sink, FILE* fp );
+/** Initialize file output sink, and set putBytes to the callback that
+    writes to it in blocks */
+void TY_(initFileSink)( TidyOutputSink* sink, TidyPutBytesFunc* putBytes, FILE* fp );
 
 /* Needed for internal declarations */
 void TIDY_CALL TY_(filesink_putByte)( void* sinkData, byte bv );
@@ -55,6 +55,11 @@ typedef struct _Lexer Lexer;
 
 extern TidyAllocator TY_(g_default_allocator);
 
+/** An allocator whose blocks all live until FreeArena(); see alloc.c */
+TidyAllocator* TY_(NewArena)( TidyAllocator* allocator );
+void TY_(ResetArena)( TidyAllocator* arena );
+void TY_(FreeArena)( TidyAllocator* arena );
+
 /** Wrappers for easy memory allocation using an allocator */
 #define TidyAlloc(allocator, size) ((allocator)->vtbl->alloc((allocator), (size)))
 #define TidyRealloc(allocator, block, size) ((allocator)->vtbl->realloc((allocator), (block), (size)))
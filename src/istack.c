@@ -22,11 +22,12 @@ AttVal *TY_(DupAttrs)( TidyDocImpl* doc, AttVal *attrs)
     newattrs = TY_(NewAttribute)(doc);
     *newattrs = *attrs;
     newattrs->next = TY_(DupAttrs)( doc, attrs->next );
-    newattrs->attribute = TY_(tmbstrdup)(doc->allocator, attrs->attribute);
     newattrs->value = TY_(tmbstrdup)(doc->allocator, attrs->value);
     newattrs->dict = TY_(FindAttribute)(doc, newattrs);
-    newattrs->asp = attrs->asp ? TY_(CloneNode)(doc, attrs->asp) : NULL;
-    newattrs->php = attrs->php ? TY_(CloneNode)(doc, attrs->php) : NULL;
+    newattrs->script = no;
+    if ( attrs->script )
+        TY_(SetAttrScript)( doc, newattrs,
+                            TY_(CloneNode)(doc, TY_(AttrScript)(doc, attrs)) );
     return newattrs;
 }
 
@@ -94,7 +95,7 @@ void TY_(PushInline)( TidyDocImpl* doc, Node *node )
     istack = &(lexer->istack[lexer->istacksize]);
     istack->tag = node->tag;
 
-    istack->element = TY_(tmbstrdup)(doc->allocator, node->element);
+    istack->element = node->element;
     istack->attributes = TY_(DupAttrs)( doc, node->attributes );
     ++(lexer->istacksize);
 }
@@ -114,8 +115,7 @@ static void PopIStack( TidyDocImpl* doc )
         istack->attributes = av->next;
         TY_(FreeAttribute)( doc, av );
     }
-    TidyDocFree(doc, istack->element);
-    istack->element = NULL; /* remove the freed element */
+    istack->element = NULL;
 }
 
 static void PopIStackUntil( TidyDocImpl* doc, TidyTagId tid )
@@ -257,10 +257,10 @@ Node *TY_(InsertedToken)( TidyDocImpl* doc )
     if (lexer->inode == NULL)
     {
         lexer->lines = doc->docIn->curline;
-        lexer->columns = doc->docIn->curcol;
+        lexer->columns = TY_(InputColumn)( doc->docIn );
     }
 
-    node = TY_(NewNode)(doc->allocator, lexer);
+    node = TY_(NewNode)(lexer->nodeAllocator, lexer);
     node->type = StartTag;
     node->implicit = yes;
     node->start = lexer->txtstart;
@@ -276,7 +276,7 @@ Node *TY_(InsertedToken)( TidyDocImpl* doc )
     }
 #endif
 
-    node->element = TY_(tmbstrdup)(doc->allocator, istack->element);
+    node->element = istack->element;
     node->tag = istack->tag;
     node->attributes = TY_(DupAttrs)( doc, istack->attributes );
 
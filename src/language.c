@@ -5,6 +5,7 @@
 
  */
 
+#include "tidy-int.h"
 #include "language.h"
 #include "language_en.h"
 #include "tmbstr.h"
@@ -26,8 +27,7 @@
  */
 typedef struct {
     Bool manually_set;
-    languageDefinition *currentLanguage;
-    languageDefinition *fallbackLanguage;
+    tidyLanguageChoice choice;
     languageDefinition *languages[8];
 } tidyLanguagesType;
 
@@ -38,8 +38,10 @@ typedef struct {
  */
 static tidyLanguagesType tidyLanguages = {
     no,           /* library language was NOT manually set */
-    &language_en, /* current language */
-    &language_en, /* first fallback language */
+    {
+        &language_en, /* current language */
+        &language_en, /* first fallback language */
+    },
     {
         /* Required localization! */
         &language_en,
@@ -229,43 +231,80 @@ static const tidyLocaleMapItemImpl localeMappings[] = {
 
 
 /**
- *  The real string lookup function.
+ *  Builds the key index of a language's dictionary. Chains are linked
+ *  from the end so that each one lists its entries in dictionary order,
+ *  which keeps the first match the same one a scan would find.
  */
-static ctmbstr tidyLocalizedStringImpl( uint messageType, languageDefinition *definition, uint plural )
+static void tidyBuildLanguageIndex( languageDefinition *definition )
 {
-    int i;
     languageDictionary *dictionary = &definition->messages;
-    uint pluralForm = definition->whichPluralForm(plural);
-    
-    for (i = 0; (*dictionary)[i].value; ++i)
+    languageIndex *index = &definition->index;
+    uint i, count, key;
+
+    for (count = 0; (*dictionary)[count].value; ++count)
+        /**/;
+
+    for (i = count; i-- > 0; )
     {
-        if ( (*dictionary)[i].key == messageType && (*dictionary)[i].pluralForm == pluralForm )
+        key = (*dictionary)[i].key;
+        if ( key < TIDYSTRINGS_LAST )
         {
-            return (*dictionary)[i].value;
+            index->next[i] = index->first[key];
+            index->first[key] = (unsigned short)(i + 1);
         }
     }
+
+    index->count = count;
+    index->built = yes;
+}
+
+
+/**
+ *  Finds the entry for `messageType` in plural form `pluralForm`.
+ */
+ctmbstr TY_(tidyLocalizedStringForm)( uint messageType, languageDefinition *definition, uint pluralForm )
+{
+    languageDictionary *dictionary = &definition->messages;
+    languageIndex *index = &definition->index;
+    uint i;
+
+    if ( !index->built )
+        tidyBuildLanguageIndex( definition );
+
+    if ( messageType >= TIDYSTRINGS_LAST )
+        return NULL;
+
+    for ( i = index->first[messageType]; i; i = index->next[i - 1] )
+    {
+        if ( (*dictionary)[i - 1].pluralForm == pluralForm )
+            return (*dictionary)[i - 1].value;
+    }
     return NULL;
 }
 
 
 /**
- *  Provides a string given `messageType` in the current
- *  localization, returning the correct plural form given
- *  `quantity`.
- *
- *  This isn't currently highly optimized; rewriting some
- *  of infrastructure to use hash lookups is a preferred
- *  future optimization.
+ *  The real string lookup function.
  */
-ctmbstr TY_(tidyLocalizedStringN)( uint messageType, uint quantity )
+static ctmbstr tidyLocalizedStringImpl( uint messageType, languageDefinition *definition, uint plural )
+{
+    return TY_(tidyLocalizedStringForm)( messageType, definition, definition->whichPluralForm(plural) );
+}
+
+
+/**
+ *  Provides a string given `messageType` in the localization
+ *  `choice`, returning the correct plural form given `quantity`.
+ */
+static ctmbstr tidyLocalizedStringChoiceN( const tidyLanguageChoice *choice, uint messageType, uint quantity )
 {
     ctmbstr result;
     
-    result  = tidyLocalizedStringImpl( messageType, tidyLanguages.currentLanguage, quantity);
+    result  = tidyLocalizedStringImpl( messageType, choice->currentLanguage, quantity);
     
-    if (!result && tidyLanguages.fallbackLanguage )
+    if (!result && choice->fallbackLanguage )
     {
-        result = tidyLocalizedStringImpl( messageType, tidyLanguages.fallbackLanguage, quantity);
+        result = tidyLocalizedStringImpl( messageType, choice->fallbackLanguage, quantity);
     }
     
     if (!result)
@@ -284,13 +323,20 @@ ctmbstr TY_(tidyLocalizedStringN)( uint messageType, uint quantity )
 }
 
 
+/**
+ *  Provides a string given `messageType` in the current
+ *  localization, returning the correct plural form given
+ *  `quantity`.
+ */
+ctmbstr TY_(tidyLocalizedStringN)( uint messageType, uint quantity )
+{
+    return tidyLocalizedStringChoiceN( &tidyLanguages.choice, messageType, quantity );
+}
+
+
 /**
  *  Provides a string given `messageType` in the current
  *  localization, in the non-plural form.
- *
- *  This isn't currently highly optimized; rewriting some
- *  of infrastructure to use hash lookups is a preferred
- *  future optimization.
  */
 ctmbstr TY_(tidyLocalizedString)( uint messageType )
 {
@@ -299,16 +345,57 @@ ctmbstr TY_(tidyLocalizedString)( uint messageType )
 
 
 /**
- *  Retrieves the POSIX name for a string. Result is a static char so please
- *  don't try to free it. If the name looks like a cc_ll identifier, we will
- *  return it if there's no other match.
+ *  Provides a string given `messageType` in the localization
+ *  used for the document, returning the correct plural form
+ *  given `quantity`.
+ */
+ctmbstr TY_(tidyDocLocalizedStringN)( TidyDocImpl* doc, uint messageType, uint quantity )
+{
+    const tidyLanguageChoice *choice = &tidyLanguages.choice;
+
+    if ( doc && doc->language.currentLanguage )
+        choice = &doc->language;
+
+    return tidyLocalizedStringChoiceN( choice, messageType, quantity );
+}
+
+
+/**
+ *  Provides a string given `messageType` in the localization
+ *  used for the document, in the non-plural form.
+ */
+ctmbstr TY_(tidyDocLocalizedString)( TidyDocImpl* doc, uint messageType )
+{
+    return TY_(tidyDocLocalizedStringN)( doc, messageType, 1 );
+}
+
+
+/**
+ *  Builds the index of every installed language up front, so
+ *  that looking strings up afterwards never writes to them.
+ */
+void TY_(tidyBuildLanguageIndexes)( void )
+{
+    uint i;
+
+    for (i = 0; tidyLanguages.languages[i]; ++i)
+    {
+        if ( !tidyLanguages.languages[i]->index.built )
+            TY_(tidyLocalizedStringForm)( 0, tidyLanguages.languages[i], 0 );
+    }
+}
+
+
+/**
+ *  Retrieves the POSIX name for a string into `result`, which must have
+ *  room for six characters, and returns it. If the name looks like a cc_ll
+ *  identifier, we will return it if there's no other match.
  *  @note this routine uses default allocator, see tidySetMallocCall.
  */
-tmbstr TY_(tidyNormalizedLocaleName)( ctmbstr locale )
+tmbstr TY_(tidyNormalizedLocaleName)( ctmbstr locale, tmbstr result )
 {
     uint i;
     uint len;
-    static char result[6] = "xx_yy";
     TidyAllocator * allocator = &TY_(g_default_allocator);
 
     tmbstr search = TY_(tmbstrdup)( allocator, locale );
@@ -332,6 +419,7 @@ tmbstr TY_(tidyNormalizedLocaleName)( ctmbstr locale )
     
     len = strlen( search );
     len = ( len <= 5 ? len : 5 );
+    result[len] = '\0';
     
     for ( i = 0; i < len; i++ )
     {
@@ -382,29 +470,20 @@ languageDefinition *TY_(tidyTestLanguage)( ctmbstr languageCode )
 }
 
 
-/**
- *  Tells Tidy to use a different language for output.
- *  @param  languageCode A Windows or POSIX language code, and must match
- *          a TIDY_LANGUAGE for an installed language.
- *  @result Indicates that a setting was applied, but not necessarily the
- *          specific request, i.e., true indicates a language and/or region
- *          was applied. If es_mx is requested but not installed, and es is
- *          installed, then es will be selected and this function will return
- *          true. However the opposite is not true; if es is requested but
- *          not present, Tidy will not try to select from the es_XX variants.
- */
-Bool TY_(tidySetLanguage)( ctmbstr languageCode )
+static Bool tidySelectLanguage( ctmbstr languageCode, tidyLanguageChoice *choice )
 {
     languageDefinition *dict1 = NULL;
     languageDefinition *dict2 = NULL;
-    tmbstr wantCode = NULL;
+    char wantCode[6];
     char lang[3] = "";
     
-    if ( !languageCode || !(wantCode = TY_(tidyNormalizedLocaleName)( languageCode )) )
+    if ( !languageCode )
     {
         return no;
     }
     
+    TY_(tidyNormalizedLocaleName)( languageCode, wantCode );
+    
     /* We want to use the specified language as the currentLanguage, and set
      fallback language as necessary. We have either a two or five digit code,
      either or both of which might be installed. Let's test both of them:
@@ -414,25 +493,25 @@ Bool TY_(tidySetLanguage)( ctmbstr languageCode )
     
     if ( strlen( wantCode ) > 2 )
     {
-        strncpy(lang, wantCode, 2);
+        memcpy(lang, wantCode, 2);
         lang[2] = '\0';
         dict2 = TY_(tidyTestLanguage( lang ) ); /* BACKUP language? */
     }
     
     if ( dict1 && dict2 )
     {
-        tidyLanguages.currentLanguage = dict1;
-        tidyLanguages.fallbackLanguage = dict2;
+        choice->currentLanguage = dict1;
+        choice->fallbackLanguage = dict2;
     }
     if ( dict1 && !dict2 )
     {
-        tidyLanguages.currentLanguage = dict1;
-        tidyLanguages.fallbackLanguage = NULL;
+        choice->currentLanguage = dict1;
+        choice->fallbackLanguage = NULL;
     }
     if ( !dict1 && dict2 )
     {
-        tidyLanguages.currentLanguage = dict2;
-        tidyLanguages.fallbackLanguage = NULL;
+        choice->currentLanguage = dict2;
+        choice->fallbackLanguage = NULL;
     }
     if ( !dict1 && !dict2 )
     {
@@ -443,12 +522,38 @@ Bool TY_(tidySetLanguage)( ctmbstr languageCode )
 }
 
 
+/**
+ *  Tells Tidy to use a different language for output.
+ *  @param  languageCode A Windows or POSIX language code, and must match
+ *          a TIDY_LANGUAGE for an installed language.
+ *  @result Indicates that a setting was applied, but not necessarily the
+ *          specific request, i.e., true indicates a language and/or region
+ *          was applied. If es_mx is requested but not installed, and es is
+ *          installed, then es will be selected and this function will return
+ *          true. However the opposite is not true; if es is requested but
+ *          not present, Tidy will not try to select from the es_XX variants.
+ */
+Bool TY_(tidySetLanguage)( ctmbstr languageCode )
+{
+    return tidySelectLanguage( languageCode, &tidyLanguages.choice );
+}
+
+
+/**
+ *  Tells Tidy to use a different language for one document's output.
+ */
+Bool TY_(tidySetDocLanguage)( TidyDocImpl* doc, ctmbstr languageCode )
+{
+    return tidySelectLanguage( languageCode, &doc->language );
+}
+
+
 /**
  *  Gets the current language used by Tidy.
  */
 ctmbstr TY_(tidyGetLanguage)()
 {
-    languageDefinition *langDef = tidyLanguages.currentLanguage;
+    languageDefinition *langDef = tidyLanguages.choice.currentLanguage;
     languageDictionary *langDict = &langDef->messages;
     return (*langDict)[0].value;
 }
@@ -490,16 +595,10 @@ ctmbstr TY_(tidyDefaultString)( uint messageType )
  */
 static const uint tidyStringKeyListSize()
 {
-    static uint array_size = 0;
-    
-    if ( array_size == 0 )
-    {
-        while ( language_en.messages[array_size].value != NULL ) {
-            array_size++;
-        }
-    }
-    
-    return array_size;
+    if ( !language_en.index.built )
+        tidyBuildLanguageIndex( &language_en );
+
+    return language_en.index.count;
 }
 
 
@@ -545,16 +644,7 @@ uint TY_(getNextStringKey)( TidyIterator* iter )
  */
 static const uint tidyLanguageListSize()
 {
-    static uint array_size = 0;
-    
-    if ( array_size == 0 )
-    {
-        while ( localeMappings[array_size].winName ) {
-            array_size++;
-        }
-    }
-    
-    return array_size;
+    return sizeof(localeMappings)/sizeof(localeMappings[0]) - 1;
 }
 
 /**
@@ -613,13 +703,10 @@ ctmbstr TY_(TidyLangPosixName)( const tidyLocaleMapItemImpl *item )
  */
 static const uint tidyInstalledLanguageListSize()
 {
-    static uint array_size = 0;
+    uint array_size = 0;
     
-    if ( array_size == 0 )
-    {
-        while ( tidyLanguages.languages[array_size] ) {
-            array_size++;
-        }
+    while ( tidyLanguages.languages[array_size] ) {
+        array_size++;
     }
     
     return array_size;
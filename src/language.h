@@ -59,18 +59,48 @@ typedef struct languageDictionaryEntry {
 typedef languageDictionaryEntry const languageDictionary[600];
 
 
+/**
+ *  Key-indexed access to a `languageDictionary`, so that finding a
+ *  string doesn't mean walking the whole array. `first[key]` is one
+ *  more than the position of the first entry for `key`, and `next[i]`
+ *  is one more than the position of the following entry with the same
+ *  key as entry `i`; zero ends either. language.c fills this in for
+ *  every installed language when the first document is created.
+ */
+typedef struct languageIndex {
+    Bool built;
+    uint count;                 /* entries in the dictionary */
+    unsigned short first[TIDYSTRINGS_LAST];
+    unsigned short next[600];
+} languageIndex;
+
+
 /**
  *  Finally, a complete language definition. The item `pluralForm`
  *  is a function pointer that will provide the correct plural
  *  form given the value `n`. The actual function is present in
- *  each language header and is language dependent.
+ *  each language header and is language dependent. The language
+ *  headers leave `index` out, so it starts zeroed.
  */
 typedef struct languageDefinition {
     uint (*whichPluralForm)(uint n);
     languageDictionary messages;
+    languageIndex index;
 } languageDefinition;
 
 
+/**
+ *  A language and the one to try next for strings it lacks. Tidy keeps
+ *  one for the process, set by tidySetLanguage(), and each document has
+ *  one of its own, set by tidySetDocLanguage(); a document whose choice
+ *  has no `currentLanguage` uses the process's.
+ */
+typedef struct tidyLanguageChoice {
+    languageDefinition *currentLanguage;
+    languageDefinition *fallbackLanguage;
+} tidyLanguageChoice;
+
+
 /**
  *  The function getNextWindowsLanguage() returns pointers to this type;
  *  it gives LibTidy implementors the ability to determine how Windows
@@ -115,6 +145,13 @@ Bool TY_(tidySetLanguage)( ctmbstr languageCode );
  */
 ctmbstr TY_(tidyGetLanguage)(void);
 
+/**
+ *  Tells Tidy to use a different language for one document's output,
+ *  without affecting other documents. Arguments and result are as for
+ *  `tidySetLanguage()`.
+ */
+Bool TY_(tidySetDocLanguage)( TidyDocImpl* doc, ctmbstr languageCode );
+
 
 /**
  *  Indicates whether or not the current language was set by a
@@ -147,6 +184,39 @@ ctmbstr TY_(tidyLocalizedStringN)( uint messageType, uint quantity );
  */
 ctmbstr TY_(tidyLocalizedString)( uint messageType );
 
+/**
+ *  Provides a string given `messageType` in the localization used for
+ *  the document's output, for `quantity`.
+ */
+ctmbstr TY_(tidyDocLocalizedStringN)( TidyDocImpl* doc, uint messageType, uint quantity );
+
+/**
+ *  Provides a string given `messageType` in the localization used for
+ *  the document's output, for the single case.
+ */
+ctmbstr TY_(tidyDocLocalizedString)( TidyDocImpl* doc, uint messageType );
+
+/**
+ *  Returns the languageDefinition if the languageCode is installed in
+ *  Tidy, otherwise NULL.
+ */
+languageDefinition *TY_(tidyTestLanguage)( ctmbstr languageCode );
+
+/**
+ *  Finds the string for `messageType` in plural form `pluralForm` of
+ *  `definition` alone, without falling back to another language, by
+ *  way of the language's index. The console's tidylangcheck sample
+ *  compares it with a walk of every installed dictionary.
+ */
+ctmbstr TY_(tidyLocalizedStringForm)( uint messageType, languageDefinition *definition, uint pluralForm );
+
+/**
+ *  Builds the string indexes of all installed languages. They're shared
+ *  by all documents, so this is done once, by the first `tidyCreate()`;
+ *  afterwards the languages are only read.
+ */
+void TY_(tidyBuildLanguageIndexes)( void );
+
 
 /** @} */
 /** @name Documentation Generation */
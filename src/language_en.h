@@ -119,6 +119,22 @@ static languageDefinition language_en = { whichPluralForm_en, {
         "If set to <var>no</var> any existing name attribute is removed if an "
         "<code>id</code> attribute exists or has been added. "
     },
+    {/* Important notes for translators:
+        - Use only <code></code>, <var></var>, <em></em>, <strong></strong>, and
+          <br/>.
+        - Entities, tags, attributes, etc., should be enclosed in <code></code>.
+        - Option values should be enclosed in <var></var>.
+        - It's very important that <br/> be self-closing!
+        - The strings "Tidy" and "HTML Tidy" are the program name and must not
+          be translated. */
+      TidyArenaAllocation,          0,
+        "This option specifies if Tidy should allocate the elements and "
+        "attributes of the document from large blocks of memory that are "
+        "released all at once, when the document is parsed again or released. "
+        "<br/>"
+        "This makes parsing and releasing large documents faster, at the cost "
+        "of not reusing the memory of elements Tidy discards along the way. "
+    },
     {/* Important notes for translators:
         - Use only <code></code>, <var></var>, <em></em>, <strong></strong>, and
           <br/>.
@@ -706,6 +722,25 @@ static languageDefinition language_en = { whichPluralForm_en, {
         "<br/>"
         "Note this feature is not supported on some platforms. "
     },
+    {/* Important notes for translators:
+        - Use only <code></code>, <var></var>, <em></em>, <strong></strong>, and
+          <br/>.
+        - Entities, tags, attributes, etc., should be enclosed in <code></code>.
+        - Option values should be enclosed in <var></var>.
+        - It's very important that <br/> be self-closing!
+        - The strings "Tidy" and "HTML Tidy" are the program name and must not
+          be translated. */
+        TidyZeroCopyInput,            0,
+        "This option specifies if Tidy should leave text that it doesn't need to "
+        "change in the input buffer rather than copying it, when parsing UTF-8 "
+        "input from a string or buffer. Only the text content of elements is "
+        "left in place; attribute values are always copied. "
+        "<br/>"
+        "This reduces memory use for large documents, but the input buffer must "
+        "then remain valid and unchanged until the document is released. "
+        "<br/>"
+        "It has no effect on input read from files or custom input sources. "
+    },
     {/* Important notes for translators:
      - Use only <code></code>, <var></var>, <em></em>, <strong></strong>, and
      <br/>.
@@ -1160,6 +1195,23 @@ static languageDefinition language_en = { whichPluralForm_en, {
         "attributes with HTML/XHTML color names where defined, e.g. replace "
         "<code>#ffffff</code> with <code>white</code>. "
     },
+    {/* Important notes for translators:
+      - Use only <code></code>, <var></var>, <em></em>, <strong></strong>, and
+      <br/>.
+      - Entities, tags, attributes, etc., should be enclosed in <code></code>.
+      - Option values should be enclosed in <var></var>.
+      - It's very important that <br/> be self-closing!
+      - The strings "Tidy" and "HTML Tidy" are the program name and must not
+      be translated. */
+        TidyReportRepeats,            0,
+        "This option specifies how many times Tidy reports any one kind of "
+        "message, such as <code>DISCARDING_UNEXPECTED</code>. Further messages "
+        "of the same kind are still counted in the number of warnings and "
+        "errors, but they are neither output nor passed to callbacks, and the "
+        "summary says how many were left out. "
+        "<br/>"
+        "If set to <var>0</var>, then every message is reported. "
+    },
     {/* Important notes for translators:
       - Use only <code></code>, <var></var>, <em></em>, <strong></strong>, and
       <br/>.
@@ -1920,6 +1972,7 @@ static languageDefinition language_en = { whichPluralForm_en, {
     { STRING_NO_ERRORS,             0,   "No warnings or errors were found.\n"                                     },
     { STRING_NO_SYSID,              0,   "No system identifier in emitted doctype"                                 },
     { STRING_NOT_ALL_SHOWN,         0,   "Tidy found %u %s and %u %s! Not all warnings/errors were shown.\n"       },
+    { STRING_REPEATS_NOT_SHOWN,     0,   "... and %u more %s messages were not shown."                             },
     {/* This console output should be limited to 78 characters per line.
       - The strings "Tidy" and "HTML Tidy" are the program name and must not be translated. */
       TEXT_GENERAL_INFO,            0,
@@ -2193,6 +2246,7 @@ static languageDefinition language_en = { whichPluralForm_en, {
     { TC_LABEL_FILE,                0,   "file"                                                                    },
     { TC_LABEL_LANG,                0,   "lang"                                                                    },
     { TC_LABEL_LEVL,                0,   "level"                                                                   },
+    { TC_LABEL_NUM,                 0,   "number"                                                                  },
     { TC_LABEL_OPT,                 0,   "option"                                                                  },
     { TC_MAIN_ERROR_LOAD_CONFIG,    0,   "Loading config file \"%s\" problems, err = %d"                             },
     { TC_OPT_ACCESS,                0,
@@ -2208,6 +2262,7 @@ static languageDefinition language_en = { whichPluralForm_en, {
     { TC_OPT_CONFIG,                0,   "set configuration options from the specified <file>"                     },
     { TC_OPT_ERRORS,                0,   "show only errors and warnings"                                           },
     { TC_OPT_FILE,                  0,   "write errors and warnings to the specified <file>"                       },
+    { TC_OPT_FILES0,                0,   "tidy the NUL-separated list of files in <file>, '-' for stdin"           },
     { TC_OPT_GDOC,                  0,   "produce clean version of html exported by Google Docs"                   },
     { TC_OPT_HELP,                  0,   "list the command line options"                                           },
     { TC_OPT_HELPCFG,               0,   "list all configuration options"                                          },
@@ -2216,6 +2271,7 @@ static languageDefinition language_en = { whichPluralForm_en, {
     { TC_OPT_IBM858,                0,   "use IBM-858 (CP850+Euro) for input, US-ASCII for output"                 },
     { TC_OPT_INDENT,                0,   "indent element content"                                                  },
     { TC_OPT_ISO2022,               0,   "use ISO-2022 for both input and output"                                  },
+    { TC_OPT_JOBS,                  0,   "tidy up to <number> files at a time, 0 for one per processor"            },
 
     {/* The strings "Tidy" and "HTML Tidy" are the program name and must not be translated. */
       TC_OPT_LANGUAGE,              0,
@@ -2281,6 +2337,7 @@ static languageDefinition language_en = { whichPluralForm_en, {
     { TC_STRING_OUT_OF_MEMORY,      0,   "Out of memory. Bailing out."                                             },
     { TC_STRING_FATAL_ERROR,        0,   "Fatal error: impossible value for id='%d'."                              },
     { TC_STRING_FILE_MANIP,         0,   "File manipulation"                                                       },
+    { TC_STRING_JOBS_MUST_SPECIFY,  0,   "-jobs must be followed by a number, 0 or more."                          },
     { TC_STRING_PROCESS_DIRECTIVES, 0,   "Processing directives"                                                   },
     { TC_STRING_CHAR_ENCODING,      0,   "Character encodings"                                                     },
     { TC_STRING_LANG_MUST_SPECIFY,  0,   "A POSIX or Windows locale must be specified."                            },
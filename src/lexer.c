@@ -41,6 +41,11 @@
 #include "streamio.h"
 #include "sprtf.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define TIDY_SSE2_SCAN 1
+#  include <emmintrin.h>
+#endif
+
 #if defined(ENABLE_DEBUG_LOG)
 /* #define DEBUG_ALLOCATION   special EXTRA allocation debug information - VERY NOISY */
 static void check_me(char *name);
@@ -50,8 +55,8 @@ static char buffer[(MX_TXT*4)+8]; /* NOTE extra for '...'\0 tail */
 static tmbstr get_text_string(Lexer* lexer, Node *node)
 {
     uint len = node->end - node->start;
-    tmbstr cp = lexer->lexbuf + node->start;
-    tmbstr end = lexer->lexbuf + node->end;
+    ctmbstr cp = NodeTextBuf(lexer, node) + node->start;
+    ctmbstr end = NodeTextBuf(lexer, node) + node->end;
     unsigned char c;
     uint i = 0;
     Bool insp = no;
@@ -192,8 +197,8 @@ static void Show_Node( TidyDocImpl* doc, const char *msg, Node *node )
 /* swallows closing '>' */
 static AttVal *ParseAttrs( TidyDocImpl* doc, Bool *isempty );
 
-static tmbstr ParseAttribute( TidyDocImpl* doc, Bool* isempty, 
-                             Node **asp, Node **php );
+static ctmbstr ParseAttribute( TidyDocImpl* doc, Bool* isempty, 
+                              Node **asp, Node **php );
 
 static tmbstr ParseValue( TidyDocImpl* doc, ctmbstr name, Bool foldCase,
                          Bool *isempty, int *pdelim );
@@ -204,7 +209,45 @@ static void AddAttrToList( AttVal** list, AttVal* av );
 
 /* used to classify characters for lexical purposes */
 #define MAP(c) ((unsigned)c < 128 ? lexmap[(unsigned)c] : 0)
-static uint lexmap[128];
+
+#define LEX_NL  (newline|white)
+#define LEX_WS  (white)
+#define LEX_NC  (namechar)
+#define LEX_DG  (digit|digithex|namechar)
+#define LEX_LC  (lowercase|letter|namechar)
+#define LEX_LX  (lowercase|letter|namechar|digithex)
+#define LEX_UC  (uppercase|letter|namechar)
+#define LEX_UX  (uppercase|letter|namechar|digithex)
+
+/* The classes of the ASCII characters, constant so that documents
+   on different threads can share it. */
+static const uint lexmap[128] = {
+         0,      0,      0,      0,      0,      0,      0,      0,  /* 00-07 */
+         0, LEX_WS, LEX_NL,      0, LEX_NL, LEX_NL,      0,      0,  /* 08-0f */
+         0,      0,      0,      0,      0,      0,      0,      0,  /* 10-17 */
+         0,      0,      0,      0,      0,      0,      0,      0,  /* 18-1f */
+    LEX_WS,      0,      0,      0,      0,      0,      0,      0,  /* 20-27 */
+         0,      0,      0,      0,      0, LEX_NC, LEX_NC,      0,  /* 28-2f */
+    LEX_DG, LEX_DG, LEX_DG, LEX_DG, LEX_DG, LEX_DG, LEX_DG, LEX_DG,  /* 30-37 */
+    LEX_DG, LEX_DG, LEX_NC,      0,      0,      0,      0,      0,  /* 38-3f */
+         0, LEX_UX, LEX_UX, LEX_UX, LEX_UX, LEX_UX, LEX_UX, LEX_UC,  /* 40-47 */
+    LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC,  /* 48-4f */
+    LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC, LEX_UC,  /* 50-57 */
+    LEX_UC, LEX_UC, LEX_UC,      0,      0,      0,      0, LEX_NC,  /* 58-5f */
+         0, LEX_LX, LEX_LX, LEX_LX, LEX_LX, LEX_LX, LEX_LX, LEX_LC,  /* 60-67 */
+    LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC,  /* 68-6f */
+    LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC, LEX_LC,  /* 70-77 */
+    LEX_LC, LEX_LC, LEX_LC,      0,      0,      0,      0,      0  /* 78-7f */
+};
+
+#undef LEX_NL
+#undef LEX_WS
+#undef LEX_NC
+#undef LEX_DG
+#undef LEX_LC
+#undef LEX_LX
+#undef LEX_UC
+#undef LEX_UX
 
 #define IsValidXMLAttrName(name) TY_(IsValidXMLID)(name)
 #define IsValidXMLElemName(name) TY_(IsValidXMLID)(name)
@@ -867,7 +910,7 @@ uint TY_(ToUpper)(uint c)
  this is useful when trailing quotemark
  is missing on an attribute
 */
-static tmbchar LastChar( tmbstr str )
+static tmbchar LastChar( ctmbstr str )
 {
     if ( str && *str )
     {
@@ -886,6 +929,18 @@ static tmbchar LastChar( tmbstr str )
     #define StartEndTag 4
 */
 
+static void InitLexer( TidyDocImpl* doc, Lexer* lexer )
+{
+    lexer->allocator = doc->allocator;
+    lexer->lines = 1;
+    lexer->columns = 1;
+    lexer->state = LEX_CONTENT;
+
+    lexer->versions = (VERS_ALL|VERS_PROPRIETARY);
+    lexer->doctype = VERS_UNKNOWN;
+    lexer->root = &doc->root;
+}
+
 Lexer* TY_(NewLexer)( TidyDocImpl* doc )
 {
     Lexer* lexer = (Lexer*) TidyDocAlloc( doc, sizeof(Lexer) );
@@ -893,15 +948,11 @@ Lexer* TY_(NewLexer)( TidyDocImpl* doc )
     if ( lexer != NULL )
     {
         TidyClearMemory( lexer, sizeof(Lexer) );
+        InitLexer( doc, lexer );
 
-        lexer->allocator = doc->allocator;
-        lexer->lines = 1;
-        lexer->columns = 1;
-        lexer->state = LEX_CONTENT;
-
-        lexer->versions = (VERS_ALL|VERS_PROPRIETARY);
-        lexer->doctype = VERS_UNKNOWN;
-        lexer->root = &doc->root;
+        lexer->nodeAllocator = doc->allocator;
+        if ( cfgBool(doc, TidyArenaAllocation) )
+            lexer->nodeAllocator = TY_(NewArena)( doc->allocator );
     }
     return lexer;
 }
@@ -912,6 +963,267 @@ static Bool EndOfInput( TidyDocImpl* doc )
     return ( !doc->docIn->pushed && TY_(IsEOF)(doc->docIn) );
 }
 
+/* Side table for rarely used node and attribute fields */
+
+static uint rareHash( const void* owner, uint size )
+{
+    return (uint)( ((size_t) owner >> 4) % size );
+}
+
+static void* GetRareField( TidyDocImpl* doc, const void* owner )
+{
+    Lexer* lexer = doc->lexer;
+    RareField* p;
+
+    for ( p = lexer->rare[rareHash(owner, lexer->raresize)]; p; p = p->next )
+    {
+        if ( p->owner == owner )
+            return p->value;
+    }
+    return NULL;
+}
+
+static void GrowRareFields( TidyDocImpl* doc )
+{
+    Lexer* lexer = doc->lexer;
+    uint i, size = lexer->raresize ? 2 * lexer->raresize : 64;
+    RareField** rare = (RareField**) TidyDocAlloc( doc, size * sizeof(RareField*) );
+
+    TidyClearMemory( rare, size * sizeof(RareField*) );
+    for ( i = 0; i < lexer->raresize; ++i )
+    {
+        while ( lexer->rare[i] )
+        {
+            RareField* p = lexer->rare[i];
+            uint h = rareHash( p->owner, size );
+
+            lexer->rare[i] = p->next;
+            p->next = rare[h];
+            rare[h] = p;
+        }
+    }
+    TidyDocFree( doc, lexer->rare );
+    lexer->rare = rare;
+    lexer->raresize = size;
+}
+
+/* a NULL value removes the owner's entry */
+static void SetRareField( TidyDocImpl* doc, const void* owner, void* value )
+{
+    Lexer* lexer = doc->lexer;
+    RareField *p, **pp;
+    uint h;
+
+    if ( lexer->raresize )
+    {
+        pp = &lexer->rare[rareHash(owner, lexer->raresize)];
+        for ( ; (p = *pp) != NULL; pp = &p->next )
+        {
+            if ( p->owner != owner )
+                continue;
+
+            if ( value )
+                p->value = value;
+            else
+            {
+                *pp = p->next;
+                TidyDocFree( doc, p );
+                lexer->rarecount--;
+            }
+            return;
+        }
+    }
+
+    if ( !value )
+        return;
+
+    if ( lexer->rarecount >= lexer->raresize )
+        GrowRareFields( doc );
+
+    h = rareHash( owner, lexer->raresize );
+    p = (RareField*) TidyDocAlloc( doc, sizeof(RareField) );
+    p->owner = owner;
+    p->value = value;
+    p->next = lexer->rare[h];
+    lexer->rare[h] = p;
+    lexer->rarecount++;
+}
+
+/* empties the table but keeps its buckets */
+static void ClearRareFields( TidyDocImpl* doc )
+{
+    Lexer* lexer = doc->lexer;
+    uint i;
+
+    for ( i = 0; i < lexer->raresize; ++i )
+    {
+        while ( lexer->rare[i] )
+        {
+            RareField* next = lexer->rare[i]->next;
+            TidyDocFree( doc, lexer->rare[i] );
+            lexer->rare[i] = next;
+        }
+    }
+    lexer->rarecount = 0;
+}
+
+static void FreeRareFields( TidyDocImpl* doc )
+{
+    ClearRareFields( doc );
+    TidyDocFree( doc, doc->lexer->rare );
+}
+
+/* Interned element and attribute names */
+
+static uint nameHash( ctmbstr s, uint len )
+{
+    uint hashval = 0;
+
+    while ( len-- > 0 )
+        hashval = (byte) *s++ + 31*hashval;
+    return hashval;
+}
+
+static void GrowNames( TidyDocImpl* doc )
+{
+    Lexer* lexer = doc->lexer;
+    uint i, size = lexer->namesize ? 2 * lexer->namesize : 256;
+    InternedName** names = (InternedName**)
+        TidyDocAlloc( doc, size * sizeof(InternedName*) );
+
+    TidyClearMemory( names, size * sizeof(InternedName*) );
+    for ( i = 0; i < lexer->namesize; ++i )
+    {
+        while ( lexer->names[i] )
+        {
+            InternedName* p = lexer->names[i];
+            uint h = nameHash( p->name, p->len ) % size;
+
+            lexer->names[i] = p->next;
+            p->next = names[h];
+            names[h] = p;
+        }
+    }
+    TidyDocFree( doc, lexer->names );
+    lexer->names = names;
+    lexer->namesize = size;
+}
+
+static ctmbstr Intern( TidyDocImpl* doc, ctmbstr name, uint len )
+{
+    Lexer* lexer = doc->lexer;
+    uint hashval = nameHash( name, len );
+    InternedName* p;
+    tmbstr copy;
+
+    if ( lexer->namesize )
+    {
+        for ( p = lexer->names[hashval % lexer->namesize]; p; p = p->next )
+        {
+            if ( p->len == len && memcmp(p->name, name, len) == 0 )
+                return p->name;
+        }
+    }
+
+    if ( lexer->namecount >= lexer->namesize )
+        GrowNames( doc );
+
+    p = (InternedName*) TidyDocAlloc( doc, sizeof(InternedName) + len + 1 );
+    copy = (tmbstr) (p + 1);
+    memcpy( copy, name, len );
+    copy[len] = '\0';
+
+    p->name = TY_(BuiltInTagName)( doc, copy );
+    if ( !p->name )
+        p->name = TY_(BuiltInAttrName)( doc, copy );
+    if ( !p->name )
+        p->name = copy;
+    p->len = len;
+
+    hashval %= lexer->namesize;
+    p->next = lexer->names[hashval];
+    lexer->names[hashval] = p;
+    lexer->namecount++;
+    return p->name;
+}
+
+ctmbstr TY_(InternName)( TidyDocImpl* doc, ctmbstr name )
+{
+    return name ? Intern( doc, name, TY_(tmbstrlen)(name) ) : NULL;
+}
+
+ctmbstr TY_(InternNameN)( TidyDocImpl* doc, ctmbstr name, uint len )
+{
+    uint n = 0;
+
+    if ( !name )
+        return NULL;
+    while ( n < len && name[n] )
+        ++n;
+    return n > 0 ? Intern( doc, name, n ) : NULL;
+}
+
+/* interned names are shared, so they are never changed in place */
+static ctmbstr InternLower( TidyDocImpl* doc, ctmbstr name )
+{
+    tmbstr lower;
+    ctmbstr interned;
+
+    if ( !name )
+        return NULL;
+    lower = TY_(tmbstrtolower)( TY_(tmbstrdup)(doc->allocator, name) );
+    interned = TY_(InternName)( doc, lower );
+    TidyDocFree( doc, lower );
+    return interned;
+}
+
+static void ClearNames( TidyDocImpl* doc )
+{
+    Lexer* lexer = doc->lexer;
+    uint i;
+
+    for ( i = 0; i < lexer->namesize; ++i )
+    {
+        while ( lexer->names[i] )
+        {
+            InternedName* next = lexer->names[i]->next;
+            TidyDocFree( doc, lexer->names[i] );
+            lexer->names[i] = next;
+        }
+    }
+    lexer->namecount = 0;
+}
+
+static void FreeNames( TidyDocImpl* doc )
+{
+    ClearNames( doc );
+    TidyDocFree( doc, doc->lexer->names );
+}
+
+const Dict* TY_(NodeWas)( TidyDocImpl* doc, Node *node )
+{
+    return node->coerced ? (const Dict*) GetRareField( doc, node ) : NULL;
+}
+
+void TY_(SetNodeWas)( TidyDocImpl* doc, Node *node, const Dict* was )
+{
+    if ( was || node->coerced )
+        SetRareField( doc, node, (void*) was );
+    node->coerced = ( was != NULL );
+}
+
+Node* TY_(AttrScript)( TidyDocImpl* doc, AttVal *av )
+{
+    return av->script ? (Node*) GetRareField( doc, av ) : NULL;
+}
+
+void TY_(SetAttrScript)( TidyDocImpl* doc, AttVal *av, Node *script )
+{
+    if ( script || av->script )
+        SetRareField( doc, av, script );
+    av->script = ( script != NULL );
+}
+
 void TY_(FreeLexer)( TidyDocImpl* doc )
 {
     Lexer *lexer = doc->lexer;
@@ -932,11 +1244,95 @@ void TY_(FreeLexer)( TidyDocImpl* doc )
 
         TidyDocFree( doc, lexer->istack );
         TidyDocFree( doc, lexer->lexbuf );
+        FreeRareFields( doc );
+        FreeNames( doc );
+
+        /* The document tree is gone by now, see tidyDocRelease() */
+        if ( lexer->nodeAllocator != doc->allocator )
+            TY_(FreeArena)( lexer->nodeAllocator );
         TidyDocFree( doc, lexer );
         doc->lexer = NULL;
     }
 }
 
+/* Interned names outlive a document, so that the next one finds the
+   usual names already there; but not without bound, since each document
+   can bring names of its own.
+*/
+#define MAX_KEPT_NAMES 4096
+
+/* Gets the lexer ready for another document. The tree must be gone by
+   now. The buffers and tables grown so far are kept, and so is the node
+   arena, emptied, unless arena-allocation has been changed since.
+*/
+void TY_(ResetLexer)( TidyDocImpl* doc )
+{
+    Lexer *lexer = doc->lexer;
+    Lexer kept;
+
+    TY_(FreeStyles)( doc );
+
+    /* See GetToken() */
+    if ( lexer->pushed || lexer->itoken )
+    {
+        if (lexer->pushed)
+            TY_(FreeNode)( doc, lexer->itoken );
+        TY_(FreeNode)( doc, lexer->token );
+    }
+
+    while ( lexer->istacksize > 0 )
+        TY_(PopInline)( doc, NULL );
+
+    ClearRareFields( doc );
+    if ( lexer->namecount > MAX_KEPT_NAMES )
+        ClearNames( doc );
+
+    if ( lexer->nodeAllocator != doc->allocator )
+    {
+        if ( cfgBool(doc, TidyArenaAllocation) )
+            TY_(ResetArena)( lexer->nodeAllocator );
+        else
+        {
+            TY_(FreeArena)( lexer->nodeAllocator );
+            lexer->nodeAllocator = doc->allocator;
+        }
+    }
+    else if ( cfgBool(doc, TidyArenaAllocation) )
+        lexer->nodeAllocator = TY_(NewArena)( doc->allocator );
+
+    kept = *lexer;
+    TidyClearMemory( lexer, sizeof(Lexer) );
+    InitLexer( doc, lexer );
+
+    lexer->lexbuf = kept.lexbuf;
+    lexer->lexlength = kept.lexlength;
+    lexer->istack = kept.istack;
+    lexer->istacklength = kept.istacklength;
+    lexer->nodeAllocator = kept.nodeAllocator;
+    lexer->rare = kept.rare;
+    lexer->raresize = kept.raresize;
+    lexer->names = kept.names;
+    lexer->namesize = kept.namesize;
+    lexer->namecount = kept.namecount;
+}
+
+void TY_(ResolveLexerOptions)( TidyDocImpl* doc )
+{
+    LexerOptions* opts = &doc->lexer->lexOpts;
+    ulong inenc = cfg( doc, TidyInCharEncoding );
+
+    opts->xmlTags = cfgBool( doc, TidyXmlTags );
+    opts->xmlPIs = cfgBool( doc, TidyXmlPIs );
+    opts->ncr = cfgBool( doc, TidyNCR ) && inenc != BIG5 && inenc != SHIFTJIS;
+    opts->preserveEntities = cfgBool( doc, TidyPreserveEntities );
+    opts->quoteAmpersand = cfgBool( doc, TidyQuoteAmpersand );
+    opts->literalAttribs = cfgBool( doc, TidyLiteralAttribs );
+    opts->escapeScripts = cfgBool( doc, TidyEscapeScripts );
+    opts->skipNested = cfgBool( doc, TidySkipNested );
+    opts->upperCaseAttrs = cfg( doc, TidyUpperCaseAttrs );
+    opts->fixComments = cfgAutoBool( doc, TidyFixComments );
+}
+
 /* Lexer uses bigger memory chunks than pprint as
 ** it must hold the entire input document. not just
 ** the last line or three.
@@ -968,6 +1364,72 @@ static void AddByte( Lexer *lexer, tmbchar ch )
     lexer->lexbuf[ lexer->lexsize ]   = '\0';  /* debug */
 }
 
+/* Append a run of bytes in one go, growing lexbuf the same way AddByte()
+** would have for the bytes one at a time.
+*/
+static void AddBytes( Lexer *lexer, ctmbstr str, uint len )
+{
+    if ( lexer->lexsize + len + 1 >= lexer->lexlength )
+    {
+        tmbstr buf = NULL;
+        uint allocAmt = lexer->lexlength;
+        while ( lexer->lexsize + len + 1 >= allocAmt )
+        {
+            if ( allocAmt == 0 )
+                allocAmt = 8192;
+            else
+                allocAmt *= 2;
+        }
+        buf = (tmbstr) TidyRealloc( lexer->allocator, lexer->lexbuf, allocAmt );
+        if ( buf )
+        {
+          TidyClearMemory( buf + lexer->lexlength, 
+                           allocAmt - lexer->lexlength );
+          lexer->lexbuf = buf;
+          lexer->lexlength = allocAmt;
+        }
+    }
+
+    memcpy( lexer->lexbuf + lexer->lexsize, str, len );
+    lexer->lexsize += len;
+    lexer->lexbuf[ lexer->lexsize ] = '\0';  /* debug */
+}
+
+void TY_(MoveTextToEnd)( Lexer *lexer, Node *node, uint extra )
+{
+    uint start = lexer->lexsize;
+    uint len = node->end - node->start;
+    uint i;
+
+    if ( node->spanned )
+        AddBytes( lexer, lexer->spanbuf + node->start, len );
+    else
+        for ( i = node->start; i < node->end; ++i )
+            AddByte( lexer, lexer->lexbuf[i] );
+
+    while ( extra-- > 0 )
+        AddByte( lexer, '\0' );
+
+    node->start = start;
+    node->end = start + len;
+    node->spanned = no;
+}
+
+void TY_(MaterializeText)( Lexer *lexer, Node *node, uint extra )
+{
+    if ( node->spanned )
+        TY_(MoveTextToEnd)( lexer, node, extra );
+}
+
+void TY_(AppendToText)( Lexer *lexer, Node *node, tmbchar c )
+{
+    if ( node->spanned || node->end != lexer->lexsize )
+        TY_(MoveTextToEnd)( lexer, node, 0 );
+
+    AddByte( lexer, c );
+    node->end = lexer->lexsize;
+}
+
 static void ChangeChar( Lexer *lexer, tmbchar c )
 {
     if ( lexer->lexsize > 0 )
@@ -1012,7 +1474,7 @@ static void AddStringToLexer( Lexer *lexer, ctmbstr str )
 static void SetLexerLocus( TidyDocImpl* doc, Lexer *lexer )
 {
     lexer->lines = doc->docIn->curline;
-    lexer->columns = doc->docIn->curcol;
+    lexer->columns = TY_(InputColumn)( doc->docIn );
 }
 
 /*
@@ -1087,9 +1549,9 @@ static SPStatus GetSurrogatePair(TidyDocImpl* doc, Bool isXml, uint *pch)
     {
         buf[offset] = 0;
         if (type)
-            sscanf(buf + 2, "%x", &ch);
+            TY_(EntityNumber)(buf + 2, yes, &ch);
         else
-            sscanf(buf + 1, "%d", &ch);
+            TY_(EntityNumber)(buf + 1, no, &ch);
 
         if (TY_(IsHighSurrogate)(ch))
         {
@@ -1176,13 +1638,14 @@ static void ParseEntity( TidyDocImpl* doc, GetTokenMode mode )
     ENTState entState = ENT_default;
     uint charRead = 0;
     Bool semicolon = no, found = no;
-    Bool isXml = cfgBool( doc, TidyXmlTags );
-    Bool preserveEntities = cfgBool( doc, TidyPreserveEntities );
-    uint c, ch, startcol, entver = 0;
     Lexer* lexer = doc->lexer;
+    Bool isXml = lexer->lexOpts.xmlTags;
+    Bool preserveEntities = lexer->lexOpts.preserveEntities;
+    uint c, ch, startcol, entver = 0;
+    uint state = ENTITY_START;
 
     start = lexer->lexsize - 1;  /* to start at "&" */
-    startcol = doc->docIn->curcol - 1;
+    startcol = TY_(InputColumn)( doc->docIn ) - 1;
 
     while ( (c = TY_(ReadChar)(doc->docIn)) != EndOfStream )
     {
@@ -1195,9 +1658,7 @@ static void ParseEntity( TidyDocImpl* doc, GetTokenMode mode )
 
         if (charRead == 1 && c == '#')
         {
-            if ( !cfgBool(doc, TidyNCR) ||
-                 cfg(doc, TidyInCharEncoding) == BIG5 ||
-                 cfg(doc, TidyInCharEncoding) == SHIFTJIS )
+            if ( !lexer->lexOpts.ncr )
             {
                 TY_(UngetChar)('#', doc->docIn);
                 return;
@@ -1218,6 +1679,9 @@ static void ParseEntity( TidyDocImpl* doc, GetTokenMode mode )
         if ( entFn[entState](c) )
         {
             TY_(AddCharToLexer)( lexer, c );
+            /* match names as they are read rather than look them up */
+            if ( entState == ENT_default )
+                state = TY_(EntityNext)( state, c );
             continue;
         }
 
@@ -1252,7 +1716,10 @@ static void ParseEntity( TidyDocImpl* doc, GetTokenMode mode )
     {
         /* Lookup entity code and version
         */
-        found = TY_(EntityInfo)( lexer->lexbuf+start, isXml, &ch, &entver );
+        if ( entState == ENT_default )
+            found = TY_(EntityStateInfo)( state, isXml, &ch, &entver );
+        else
+            found = TY_(EntityInfo)( lexer->lexbuf+start, isXml, &ch, &entver );
     }
 
     /* Issue #483 - Deal with 'surrogate pairs' */
@@ -1374,7 +1841,7 @@ static void ParseEntity( TidyDocImpl* doc, GetTokenMode mode )
                 ch = ' ';
             TY_(AddCharToLexer)( lexer, ch );
 
-            if ( ch == '&' && !cfgBool(doc, TidyQuoteAmpersand) )
+            if ( ch == '&' && !lexer->lexOpts.quoteAmpersand )
                 AddStringToLexer( lexer, "amp;" );
         }
 
@@ -1387,7 +1854,7 @@ static tmbchar ParseTagName( TidyDocImpl* doc )
 {
     Lexer *lexer = doc->lexer;
     uint c = lexer->lexbuf[ lexer->txtstart ];
-    Bool xml = cfgBool(doc, TidyXmlTags);
+    Bool xml = lexer->lexOpts.xmlTags;
 
     /* fold case of first character in buffer */
     if (!xml && TY_(IsUpper)(c))
@@ -1445,7 +1912,7 @@ Node *TY_(NewNode)(TidyAllocator* allocator, Lexer *lexer)
 Node *TY_(CloneNode)( TidyDocImpl* doc, Node *element )
 {
     Lexer* lexer = doc->lexer;
-    Node *node = TY_(NewNode)( lexer->allocator, lexer );
+    Node *node = TY_(NewNode)( lexer->nodeAllocator, lexer );
 
     node->start = lexer->lexsize;
     node->end   = lexer->lexsize;
@@ -1457,7 +1924,7 @@ Node *TY_(CloneNode)( TidyDocImpl* doc, Node *element )
         node->closed     = element->closed;
         node->implicit   = element->implicit;
         node->tag        = element->tag;
-        node->element    = TY_(tmbstrdup)( doc->allocator, element->element );
+        node->element    = element->element;
         node->attributes = TY_(DupAttrs)( doc, element->attributes );
     }
     return node;
@@ -1487,11 +1954,13 @@ void TY_(FreeAttrs)( TidyDocImpl* doc, Node *node )
 /* doesn't repair attribute list linkage */
 void TY_(FreeAttribute)( TidyDocImpl* doc, AttVal *av )
 {
-    TY_(FreeNode)( doc, av->asp );
-    TY_(FreeNode)( doc, av->php );
-    TidyDocFree( doc, av->attribute );
+    if ( av->script )
+    {
+        TY_(FreeNode)( doc, TY_(AttrScript)(doc, av) );
+        TY_(SetAttrScript)( doc, av, NULL );
+    }
     TidyDocFree( doc, av->value );
-    TidyDocFree( doc, av );
+    TidyFree( TidyDocNodeAllocator(doc), av );
 }
 
 /* detach attribute from node
@@ -1553,9 +2022,10 @@ void TY_(FreeNode)( TidyDocImpl* doc, Node *node )
 
         TY_(FreeAttrs)( doc, node );
         TY_(FreeNode)( doc, node->content );
-        TidyDocFree( doc, node->element );
+        if ( node->coerced )
+            TY_(SetNodeWas)( doc, node, NULL );
         if (RootNode != node->type)
-            TidyDocFree( doc, node );
+            TidyFree( TidyDocNodeAllocator(doc), node );
         else
             node->content = NULL;
 
@@ -1565,16 +2035,53 @@ void TY_(FreeNode)( TidyDocImpl* doc, Node *node )
 
 Node* TY_(TextToken)( Lexer *lexer )
 {
-    Node *node = TY_(NewNode)( lexer->allocator, lexer );
+    Node *node = TY_(NewNode)( lexer->nodeAllocator, lexer );
     node->start = lexer->txtstart;
     node->end = lexer->txtend;
     return node;
 }
 
+/*
+  Text token read from the input stream. With zero-copy-input, if the
+  text just lexed is byte for byte the same as the input at the offset
+  where the token began, point the node at the input instead and give
+  the space in lexbuf back. One byte of slack is kept on either side of
+  the span, since a few callers peek just outside a node's text. Empty
+  text stays in lexbuf: callers test its first byte, which there is the
+  space the lexer trimmed rather than whatever follows in the input.
+*/
+static Node* InputTextToken( TidyDocImpl* doc )
+{
+    Lexer* lexer = doc->lexer;
+    Node* node = TY_(TextToken)( lexer );
+    uint len = lexer->txtend - lexer->txtstart;
+
+    if ( lexer->spanbuf && lexer->lexsize == lexer->txtend && len > 0
+         && lexer->txtinput > 0 && lexer->txtinput < lexer->spansize
+         && len < lexer->spansize - lexer->txtinput
+         && memcmp( lexer->spanbuf + lexer->txtinput,
+                    lexer->lexbuf + lexer->txtstart, len ) == 0 )
+    {
+        node->start = lexer->txtinput;
+        node->end = lexer->txtinput + len;
+        node->spanned = yes;
+        lexer->lexsize = lexer->txtstart;
+        lexer->lexbuf[lexer->lexsize] = '\0';  /* debug */
+    }
+    return node;
+}
+
+/* note where in the input the text of the current token starts */
+static void SetTextInput( TidyDocImpl* doc, Lexer *lexer )
+{
+    if ( lexer->spanbuf )
+        lexer->txtinput = TY_(BufferInputOffset)( doc->docIn );
+}
+
 /* used for creating preformatted text from Word2000 */
 Node *TY_(NewLineNode)( Lexer *lexer )
 {
-    Node *node = TY_(NewNode)( lexer->allocator, lexer );
+    Node *node = TY_(NewNode)( lexer->nodeAllocator, lexer );
     node->start = lexer->lexsize;
     TY_(AddCharToLexer)( lexer, (uint)'\n' );
     node->end = lexer->lexsize;
@@ -1584,7 +2091,7 @@ Node *TY_(NewLineNode)( Lexer *lexer )
 /* used for adding a &nbsp; for Word2000 */
 Node* TY_(NewLiteralTextNode)( Lexer *lexer, ctmbstr txt )
 {
-    Node *node = TY_(NewNode)( lexer->allocator, lexer );
+    Node *node = TY_(NewNode)( lexer->nodeAllocator, lexer );
     node->start = lexer->lexsize;
     AddStringToLexer( lexer, txt );
     node->end = lexer->lexsize;
@@ -1594,11 +2101,10 @@ Node* TY_(NewLiteralTextNode)( Lexer *lexer, ctmbstr txt )
 static Node* TagToken( TidyDocImpl* doc, NodeType type )
 {
     Lexer* lexer = doc->lexer;
-    Node* node = TY_(NewNode)( lexer->allocator, lexer );
+    Node* node = TY_(NewNode)( lexer->nodeAllocator, lexer );
     node->type = type;
-    node->element = TY_(tmbstrndup)( doc->allocator,
-                                     lexer->lexbuf + lexer->txtstart,
-                                     lexer->txtend - lexer->txtstart );
+    node->element = TY_(InternNameN)( doc, lexer->lexbuf + lexer->txtstart,
+                                      lexer->txtend - lexer->txtstart );
     node->start = lexer->txtstart;
     node->end = lexer->txtstart;
 
@@ -1611,7 +2117,7 @@ static Node* TagToken( TidyDocImpl* doc, NodeType type )
 static Node* NewToken(TidyDocImpl* doc, NodeType type)
 {
     Lexer* lexer = doc->lexer;
-    Node* node = TY_(NewNode)(lexer->allocator, lexer);
+    Node* node = TY_(NewNode)(lexer->nodeAllocator, lexer);
     node->type = type;
     node->start = lexer->txtstart;
     node->end = lexer->txtend;
@@ -1918,7 +2424,7 @@ static Node* NewDocTypeNode( TidyDocImpl* doc )
     if ( !html )
         return NULL;
 
-    doctype = TY_(NewNode)( doc->allocator, NULL );
+    doctype = TY_(NewNode)( TidyDocNodeAllocator(doc), NULL );
     doctype->type = DocTypeTag;
     TY_(InsertNodeBeforeElement)(html, doctype);
     return doctype;
@@ -1947,11 +2453,11 @@ Bool TY_(SetXHTMLDocType)( TidyDocImpl* doc )
     if (!doctype)
     {
         doctype = NewDocTypeNode(doc);
-        doctype->element = TY_(tmbstrdup)(doc->allocator, "html");
+        doctype->element = TY_(InternName)(doc, "html");
     }
     else
     {
-        doctype->element = TY_(tmbstrtolower)(doctype->element);
+        doctype->element = InternLower(doc, doctype->element);
     }
 
     switch(dtmode)
@@ -2116,12 +2622,12 @@ Bool TY_(FixDocType)( TidyDocImpl* doc )
 
     if (doctype)
     {
-        doctype->element = TY_(tmbstrtolower)(doctype->element);
+        doctype->element = InternLower(doc, doctype->element);
     }
     else
     {
         doctype = NewDocTypeNode(doc);
-        doctype->element = TY_(tmbstrdup)(doc->allocator, "html");
+        doctype->element = TY_(InternName)(doc, "html");
     }
 
     TY_(RepairAttrValue)(doc, doctype, "PUBLIC", GetFPIFromVers(guessed));
@@ -2147,7 +2653,7 @@ Bool TY_(FixXmlDecl)( TidyDocImpl* doc )
     }
     else
     {
-        xml = TY_(NewNode)(lexer->allocator, lexer);
+        xml = TY_(NewNode)(lexer->nodeAllocator, lexer);
         xml->type = XmlDecl;
         if ( root->content )
             TY_(InsertNodeBeforeElement)(root->content, xml);
@@ -2179,14 +2685,14 @@ Bool TY_(FixXmlDecl)( TidyDocImpl* doc )
 Node* TY_(InferredTag)(TidyDocImpl* doc, TidyTagId id)
 {
     Lexer *lexer = doc->lexer;
-    Node *node = TY_(NewNode)( lexer->allocator, lexer );
-    const Dict* dict = TY_(LookupTagDef)(id);
+    Node *node = TY_(NewNode)( lexer->nodeAllocator, lexer );
+    const Dict* dict = TY_(LookupTagDef)(doc, id);
 
     assert( dict != NULL );
 
     node->type = StartTag;
     node->implicit = yes;
-    node->element = TY_(tmbstrdup)(doc->allocator, dict->name);
+    node->element = TY_(InternName)(doc, dict->name);
     node->tag = dict;
     node->start = lexer->txtstart;
     node->end = lexer->txtend;
@@ -2237,7 +2743,7 @@ static Node *GetCDATA( TidyDocImpl* doc, Node *container )
      *  If yes, then avoid incrementing nested...
     \*/
     Bool nonested = ((nodeIsSCRIPT(container) || (nodeIsSTYLE(container))) && 
-        cfgBool(doc, TidySkipNested)) ? yes : no;
+        lexer->lexOpts.skipNested) ? yes : no;
 
     SetLexerLocus( doc, lexer );
     lexer->waswhite = no;
@@ -2384,7 +2890,7 @@ static Node *GetCDATA( TidyDocImpl* doc, Node *container )
                 /*\ if javascript insert backslash before / 
                  *  Issue #348 - Add option, escape-scripts, to skip
                 \*/
-                if ((TY_(IsJavaScript)(container)) && cfgBool(doc, TidyEscapeScripts) &&
+                if ((TY_(IsJavaScript)(container)) && lexer->lexOpts.escapeScripts &&
                     !TY_(IsHTML5Mode)(doc) )    /* Is #700 - This only applies to legacy html4 mode */
                 {
                     /* Issue #281 - only warn if adding the escape! */
@@ -2419,7 +2925,7 @@ void TY_(UngetToken)( TidyDocImpl* doc )
 #if defined(ENABLE_DEBUG_LOG)
 #  define CondReturnTextNode(doc, skip) \
             if (lexer->txtend > lexer->txtstart) { \
-                Node *_node = TY_(TextToken)(lexer); \
+                Node *_node = InputTextToken(doc); \
                 lexer->token = _node; \
                 GTDBG(doc,"text_node",_node); \
                 return _node; \
@@ -2429,7 +2935,7 @@ void TY_(UngetToken)( TidyDocImpl* doc )
 #  define CondReturnTextNode(doc, skip) \
             if (lexer->txtend > lexer->txtstart) \
             { \
-                lexer->token = TY_(TextToken)(lexer); \
+                lexer->token = InputTextToken(doc); \
                 return lexer->token; \
             }
 #endif
@@ -2514,6 +3020,200 @@ static void check_me(char *name)
 }
 #endif
 
+/*
+  Length of the well-formed UTF-8 sequence at s, which starts with a byte
+  >= 0x80, or 0 if it is malformed, truncated, or decodes to something
+  ReadChar() would report or AddCharToLexer() would not store unchanged
+  (surrogates, U+FFFE, U+FFFF and U+00A0 when nbsp is no).
+*/
+static uint UTF8SequenceLength( const byte* s, uint len, Bool nbsp )
+{
+    byte c = s[0];
+
+    if ( c >= 0xC2 && c <= 0xDF )
+    {
+        if ( len >= 2 && (s[1] & 0xC0) == 0x80
+             && (nbsp || c != 0xC2 || s[1] != 0xA0) )
+            return 2;
+    }
+    else if ( c >= 0xE0 && c <= 0xEF )
+    {
+        if ( len >= 3 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80
+             && !(c == 0xE0 && s[1] < 0xA0)
+             && !(c == 0xED && s[1] > 0x9F)
+             && !(c == 0xEF && s[1] == 0xBF && s[2] >= 0xBE) )
+            return 3;
+    }
+    else if ( c >= 0xF0 && c <= 0xF4 )
+    {
+        if ( len >= 4 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80
+             && (s[3] & 0xC0) == 0x80
+             && !(c == 0xF0 && s[1] < 0x90)
+             && !(c == 0xF4 && s[1] > 0x8F) )
+            return 4;
+    }
+    return 0;
+}
+
+/*
+  Text fast path. Returns the length of the leading run of bytes that the
+  LEX_CONTENT state would copy to lexbuf unchanged: printable ASCII other
+  than '<' and '&', plus single spaces. A space that follows another space
+  ends the run, since it may have to be collapsed. For UTF-8 input, valid
+  multibyte sequences are part of the run too, so only the exact offset of
+  an invalid one is left to ReadChar() and its error reporting. The number
+  of characters in the run is stored in *chars. The caller guarantees that
+  the character before the run was not white space.
+*/
+static uint TextRunLength( ctmbstr run, uint len, Bool utf8, Bool nbsp,
+                           uint* chars )
+{
+    const byte* s = (const byte*) run;
+    uint i = 0, n = 0, k;
+
+    while ( i < len )
+    {
+        byte c = s[i];
+
+        if ( c == ' ' )
+        {
+            if ( i > 0 && s[i-1] == ' ' )
+                break;
+            k = 1;
+        }
+        else if ( c >= 0x21 && c <= 0x7E )
+        {
+            if ( c == '<' || c == '&' )
+                break;
+            k = 1;
+        }
+        else if ( c < 0x80 || !utf8
+                  || (k = UTF8SequenceLength(s + i, len - i, nbsp)) == 0 )
+            break;
+
+        i += k;
+        ++n;
+
+#if TIDY_SSE2_SCAN
+        /* skip whole blocks of plain ASCII text */
+        {
+            const __m128i lo = _mm_set1_epi8( 0x21 );
+            const __m128i hi = _mm_set1_epi8( 0x7E );
+            const __m128i lt = _mm_set1_epi8( '<' );
+            const __m128i amp = _mm_set1_epi8( '&' );
+            const __m128i sp = _mm_set1_epi8( ' ' );
+
+            /* compare each byte with its predecessor, so i must be > 0 */
+            while ( i + 16 <= len )
+            {
+                __m128i v = _mm_loadu_si128( (const __m128i*)(s + i) );
+                __m128i p = _mm_loadu_si128( (const __m128i*)(s + i - 1) );
+                /* signed compare: bytes >= 0x80 are negative, so count as low */
+                __m128i ctl = _mm_cmplt_epi8( v, lo );
+                __m128i space = _mm_andnot_si128( _mm_cmpeq_epi8(p, sp),
+                                                  _mm_cmpeq_epi8(v, sp) );
+                __m128i bad = _mm_or_si128(
+                                  _mm_or_si128( _mm_andnot_si128(space, ctl),
+                                                _mm_cmpgt_epi8(v, hi) ),
+                                  _mm_or_si128( _mm_cmpeq_epi8(v, lt),
+                                                _mm_cmpeq_epi8(v, amp) ) );
+                int mask = _mm_movemask_epi8( bad );
+
+                if ( mask != 0 )
+                {
+                    /* the scalar code decides about the offending byte */
+                    while ( (mask & 1) == 0 )
+                    {
+                        mask >>= 1;
+                        ++i;
+                        ++n;
+                    }
+                    break;
+                }
+                i += 16;
+                n += 16;
+            }
+        }
+#endif
+    }
+
+    *chars = n;
+    return i;
+}
+
+/*
+  Copy a run of plain text straight from the input to lexbuf, instead of
+  going through ReadChar() and AddCharToLexer() one character at a time.
+  Only called in LEX_CONTENT right after a character that was not white
+  space, once leading white space has been dealt with. Valid UTF-8 is
+  copied as is; single byte encodings are transcoded through their table.
+*/
+static void AddTextRun( TidyDocImpl* doc, Lexer* lexer, GetTokenMode mode )
+{
+    StreamIn* in = doc->docIn;
+    Bool nbsp = ( mode != Preformatted );
+    const byte* map;
+    ctmbstr run = NULL;
+    uint i, n, k, chars, len = TY_(PeekRawRun)( in, &run );
+
+    if ( len == 0 )
+        return;
+
+    if ( in->encoding == UTF8 )
+    {
+        i = TextRunLength( run, len, yes, nbsp, &chars );
+        AddBytes( lexer, run, i );
+    }
+    else
+    {
+        /* copy the ASCII parts, transcode other bytes through the table */
+        map = TY_(SingleByteUTF8Map)( in );
+        i = chars = 0;
+        while ( i < len )
+        {
+            const byte* m;
+
+            n = TextRunLength( run + i, len - i, no, nbsp, &k );
+            AddBytes( lexer, run + i, n );
+            i += n;
+            chars += k;
+
+            if ( i == len || !map || (byte) run[i] < 128 )
+                break;
+
+            m = map + ((byte) run[i] - 128) * 4;
+            if ( m[0] == 0 || (!nbsp && m[1] == 0xC2 && m[2] == 0xA0) )
+                break;
+            if ( m[0] & SBMAP_LOCATES )
+            {
+                /* the column just before the character, as ReadChar() */
+                lexer->lines = in->curline;
+                lexer->columns = TY_(InputColumn)( in ) + chars;
+            }
+            AddBytes( lexer, (ctmbstr) m + 1, m[0] & ~SBMAP_LOCATES );
+            ++i;
+            ++chars;
+        }
+    }
+
+    if ( i > 0 )
+    {
+        TY_(SkipRawRun)( in, i, chars );
+        lexer->waswhite = ( run[i-1] == ' ' );
+    }
+}
+
+/* Whether malformed comments are to be fixed. With fix-bad-comments
+   "auto" this depends on the version seen so far, which is worked out
+   only when a comment needs it, and then kept in *fix for the token.
+*/
+static Bool FixComments( TidyDocImpl* doc, TidyTriState* fix )
+{
+    if ( *fix == TidyAutoState )
+        *fix = (TY_(HTMLVersion)(doc) & HT50) ? TidyNoState : TidyYesState;
+    return *fix == TidyYesState;
+}
+
 static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
 {
     Lexer* lexer = doc->lexer;
@@ -2521,22 +3221,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
     Bool isempty = no;
     AttVal *attributes = NULL;
     Node *node;
-    Bool fixComments;
-    
-    switch ( cfgAutoBool(doc, TidyFixComments) )
-    {
-        case TidyYesState:
-            fixComments = yes;
-            break;
-
-        case TidyNoState:
-            fixComments = no;
-            break;
-
-        default:
-            fixComments = (TY_(HTMLVersion)(doc) & HT50) == 0;
-            break;
-    }
+    TidyTriState fixComments = lexer->lexOpts.fixComments;
 
     /* Lexer->token must be set on return. Nullify it for safety. */
     lexer->token = NULL;
@@ -2545,6 +3230,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
     lexer->waswhite = no;
 
     lexer->txtstart = lexer->txtend = lexer->lexsize;
+    SetTextInput( doc, lexer );
 
     while ((c = TY_(ReadChar)(doc->docIn)) != EndOfStream)
     {
@@ -2575,6 +3261,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                     --(lexer->lexsize);
                     lexer->waswhite = no;
                     SetLexerLocus( doc, lexer );
+                    SetTextInput( doc, lexer );
                     continue;
                 }
 
@@ -2613,6 +3300,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                     mode = MixedContent;
 
                 lexer->waswhite = no;
+                AddTextRun( doc, lexer, mode );
                 continue;
 
             case LEX_GT:  /* < */
@@ -2628,14 +3316,14 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
 
                     TY_(AddCharToLexer)(lexer, c);
 
-                    if (TY_(IsLetter)(c) || (cfgBool(doc, TidyXmlTags) && TY_(IsXMLNamechar)(c)))
+                    if (TY_(IsLetter)(c) || (lexer->lexOpts.xmlTags && TY_(IsXMLNamechar)(c)))
                     {
                         lexer->lexsize -= 3;
                         lexer->txtend = lexer->lexsize;
                         TY_(UngetChar)(c, doc->docIn);
                         lexer->state = LEX_ENDTAG;
                         lexer->lexbuf[lexer->lexsize] = '\0';  /* debug */
-                        doc->docIn->curcol -= 2;
+                        doc->docIn->curpos -= 2;
 
                         /* if some text before the </ return it now */
                         if (lexer->txtend > lexer->txtstart)
@@ -2646,7 +3334,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                                 lexer->lexsize -= 1;
                                 lexer->txtend = lexer->lexsize;
                             }
-                            lexer->token = TY_(TextToken)(lexer);
+                            lexer->token = InputTextToken(doc);
                             node = lexer->token;
                             GTDBG(doc,"text", node);
                             return node;
@@ -2830,7 +3518,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                 }
 
                 /* check for start tag */
-                if (TY_(IsLetter)(c) || (cfgBool(doc, TidyXmlTags) && TY_(IsXMLNamechar)(c)))
+                if (TY_(IsLetter)(c) || (lexer->lexOpts.xmlTags && TY_(IsXMLNamechar)(c)))
                 {
                     TY_(UngetChar)(c, doc->docIn);     /* push back letter */
                     TY_(UngetChar)('<', doc->docIn);
@@ -2855,7 +3543,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
 
             case LEX_ENDTAG:  /* </letter */
                 lexer->txtstart = lexer->lexsize - 1;
-                doc->docIn->curcol += 2;
+                doc->docIn->curpos += 2;
                 c = ParseTagName( doc );
                 lexer->token = TagToken( doc, EndTag );  /* create endtag token */
                 lexer->lexsize = lexer->txtend = lexer->txtstart;
@@ -2948,7 +3636,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                             TY_(Report)( doc, NULL, lexer->token, UNKNOWN_ELEMENT );
                     }
                 }
-                else if ( !cfgBool(doc, TidyXmlTags) )
+                else if ( !lexer->lexOpts.xmlTags )
                 {
                     TY_(ConstrainVersion)( doc, lexer->token->tag->versions );
                     TY_(RepairDuplicateAttributes)( doc, lexer->token, no );
@@ -2966,7 +3654,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                 c = TY_(ReadChar)(doc->docIn);
 
                 /* Fix hyphens at beginning of tag */
-                if ( c != '-' && fixComments && lexer->lexsize - lexer->txtstart == 1 )
+                if ( c != '-' && FixComments(doc, &fixComments) && lexer->lexsize - lexer->txtstart == 1 )
                 {
                     lexer->lexbuf[lexer->lexsize - 1] = '=';
                 }
@@ -2990,13 +3678,13 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                          */
                         if ( (TY_(HTMLVersion)(doc) & HT50) )
                         {
-                            if ( fixComments )
+                            if ( FixComments(doc, &fixComments) )
                                 TY_(Report)(doc, NULL, NULL, MALFORMED_COMMENT );
                             /* Otherwise for HTML5, it's safe to ignore. */
                         }
                         else
                         {
-                            if ( fixComments )
+                            if ( FixComments(doc, &fixComments) )
                                 TY_(Report)(doc, NULL, NULL, MALFORMED_COMMENT );
                             else
                                 TY_(Report)(doc, NULL, NULL, MALFORMED_COMMENT_WARN );
@@ -3035,7 +3723,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                 badcomment++;
 
                 /* fix hyphens in the middle */
-                if ( fixComments )
+                if ( FixComments(doc, &fixComments) )
                     lexer->lexbuf[lexer->lexsize - 2] = '=';
 
                 /* if '-' then look for '>' to end the comment */
@@ -3046,7 +3734,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                 }
 
                 /* fix hyphens end, and continue to look for --> */
-                if ( fixComments )
+                if ( FixComments(doc, &fixComments) )
                     lexer->lexbuf[lexer->lexsize - 1] = '=';
 
                 /* http://tidy.sf.net/bug/1266647 */
@@ -3067,7 +3755,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                 lexer->waswhite = no;
 
                 /* make a note of the version named by the 1st doctype */
-                if (lexer->doctype == VERS_UNKNOWN && lexer->token && !cfgBool(doc, TidyXmlTags))
+                if (lexer->doctype == VERS_UNKNOWN && lexer->token && !lexer->lexOpts.xmlTags)
                 {
                     lexer->doctype = FindGivenVersion(doc, lexer->token);
                     if (lexer->doctype != VERS_HTML5)
@@ -3108,7 +3796,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                     }
                 }
 
-                if (cfgBool(doc, TidyXmlPIs) || lexer->isvoyager) /* insist on ?> as terminator */
+                if (lexer->lexOpts.xmlPIs || lexer->isvoyager) /* insist on ?> as terminator */
                 {
                     if (c != '?')
                         continue;
@@ -3152,9 +3840,9 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
 
                     lexer->token = PIToken(doc);
                     lexer->token->closed = closed;
-                    lexer->token->element = TY_(tmbstrndup)(doc->allocator,
-                                                            lexer->lexbuf +
-                                                            lexer->txtstart - i, i);
+                    lexer->token->element = TY_(InternNameN)(doc,
+                                                             lexer->lexbuf +
+                                                             lexer->txtstart - i, i);
                 }
                 else
                 {
@@ -3251,7 +3939,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                 /* get pseudo-attribute */
                 if (c != '?')
                 {
-                    tmbstr name;
+                    ctmbstr name;
                     Node *asp, *php;
                     AttVal *av = NULL;
                     int pdelim = 0;
@@ -3417,7 +4105,7 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
                 lexer->lexsize -= 1;
                 lexer->txtend = lexer->lexsize;
             }
-            lexer->token = TY_(TextToken)(lexer);
+            lexer->token = InputTextToken(doc);
             node = lexer->token;
             GTDBG(doc,"textstring", node);
             return node;  /* the textstring token */
@@ -3445,26 +4133,6 @@ static Node* GetTokenFromStream( TidyDocImpl* doc, GetTokenMode mode )
     return NULL;
 }
 
-static void MapStr( ctmbstr str, uint code )
-{
-    while ( *str )
-    {
-        uint i = (byte) *str++;
-        lexmap[i] |= code;
-    }
-}
-
-void TY_(InitMap)(void)
-{
-    MapStr("\r\n\f", newline|white);
-    MapStr(" \t", white);
-    MapStr("-.:_", namechar);
-    MapStr("0123456789", digit|digithex|namechar);
-    MapStr("abcdefghijklmnopqrstuvwxyz", lowercase|letter|namechar);
-    MapStr("ABCDEFGHIJKLMNOPQRSTUVWXYZ", uppercase|letter|namechar);
-    MapStr("abcdefABCDEF", digithex);
-}
-
 /*
  parser for ASP within start tags
 
@@ -3567,12 +4235,12 @@ static Node *ParsePhp( TidyDocImpl* doc )
 
 /* consumes the '>' terminating start tags */
 /* @TODO: float the errors back to the calling method */
-static tmbstr  ParseAttribute( TidyDocImpl* doc, Bool *isempty,
+static ctmbstr ParseAttribute( TidyDocImpl* doc, Bool *isempty,
                               Node **asp, Node **php )
 {
     Lexer* lexer = doc->lexer;
     int start, len = 0;
-    tmbstr attr = NULL;
+    ctmbstr attr = NULL;
     uint c, lastc;
 
     *asp = NULL;  /* clear asp pointer */
@@ -3697,9 +4365,9 @@ static tmbstr  ParseAttribute( TidyDocImpl* doc, Bool *isempty,
         /* what should be done about non-namechar characters? */
         /* currently these are incorporated into the attr name */
 
-        if ( cfg(doc, TidyUpperCaseAttrs) != TidyUppercasePreserve )
+        if ( lexer->lexOpts.upperCaseAttrs != TidyUppercasePreserve )
         {
-            if ( !cfgBool(doc, TidyXmlTags) && TY_(IsUpper)(c) )
+            if ( !lexer->lexOpts.xmlTags && TY_(IsUpper)(c) )
                 c = TY_(ToLower)(c);
         }
 
@@ -3710,8 +4378,7 @@ static tmbstr  ParseAttribute( TidyDocImpl* doc, Bool *isempty,
 
     /* handle attribute names with multibyte chars */
     len = lexer->lexsize - start;
-    attr = (len > 0 ? TY_(tmbstrndup)(doc->allocator,
-                                      lexer->lexbuf+start, len) : NULL);
+    attr = (len > 0 ? TY_(InternNameN)(doc, lexer->lexbuf+start, len) : NULL);
     lexer->lexsize = start;
     return attr;
 }
@@ -3833,7 +4500,7 @@ static tmbstr ParseValue( TidyDocImpl* doc, ctmbstr name,
      embed element with script attributes where newlines
      are significant and must be preserved
     */
-    if ( cfgBool(doc, TidyLiteralAttribs) )
+    if ( lexer->lexOpts.literalAttribs )
         munge = no;
 
  /* skip white space before the '=' */
@@ -4131,7 +4798,7 @@ static Bool IsValidAttrName( ctmbstr attr )
 /* create a new attribute */
 AttVal *TY_(NewAttribute)( TidyDocImpl* doc )
 {
-    AttVal *av = (AttVal*) TidyDocAlloc( doc, sizeof(AttVal) );
+    AttVal *av = (AttVal*) TidyAlloc( TidyDocNodeAllocator(doc), sizeof(AttVal) );
     TidyClearMemory( av, sizeof(AttVal) );
     return av;
 }
@@ -4141,7 +4808,7 @@ AttVal* TY_(NewAttributeEx)( TidyDocImpl* doc, ctmbstr name, ctmbstr value,
                              int delim )
 {
     AttVal *av = TY_(NewAttribute)(doc);
-    av->attribute = TY_(tmbstrdup)(doc->allocator, name);
+    av->attribute = TY_(InternName)(doc, name);
     av->value = TY_(tmbstrdup)(doc->allocator, value);
     av->delim = delim;
     av->dict = TY_(FindAttribute)( doc, av );
@@ -4186,7 +4853,7 @@ static AttVal* ParseAttrs( TidyDocImpl* doc, Bool *isempty )
 
     while ( !EndOfInput(doc) )
     {
-        tmbstr attribute = ParseAttribute( doc, isempty, &asp, &php );
+        ctmbstr attribute = ParseAttribute( doc, isempty, &asp, &php );
 
         if (attribute == NULL)
         {
@@ -4194,7 +4861,7 @@ static AttVal* ParseAttrs( TidyDocImpl* doc, Bool *isempty )
             if (asp)
             {
                 av = TY_(NewAttribute)(doc);
-                av->asp = asp;
+                TY_(SetAttrScript)( doc, av, asp );
                 AddAttrToList( &list, av ); 
                 continue;
             }
@@ -4203,7 +4870,7 @@ static AttVal* ParseAttrs( TidyDocImpl* doc, Bool *isempty )
             if (php)
             {
                 av = TY_(NewAttribute)(doc);
-                av->php = php;
+                TY_(SetAttrScript)( doc, av, php );
                 AddAttrToList( &list, av ); 
                 continue;
             }
@@ -4214,7 +4881,7 @@ static AttVal* ParseAttrs( TidyDocImpl* doc, Bool *isempty )
         value = ParseValue( doc, attribute, no, isempty, &delim );
 
         if (attribute && (IsValidAttrName(attribute) ||
-            (cfgBool(doc, TidyXmlTags) && IsValidXMLAttrName(attribute))))
+            (lexer->lexOpts.xmlTags && IsValidXMLAttrName(attribute))))
         {
             av = TY_(NewAttribute)(doc);
             av->delim = delim ? delim : '"';
@@ -4267,7 +4934,7 @@ static Node *ParseDocTypeDecl(TidyDocImpl* doc)
     uint delim = 0;
     Bool hasfpi = yes;
 
-    Node* node = TY_(NewNode)(lexer->allocator, lexer);
+    Node* node = TY_(NewNode)(lexer->nodeAllocator, lexer);
     node->type = DocTypeTag;
     node->start = lexer->txtstart;
     node->end = lexer->txtend;
@@ -4352,9 +5019,9 @@ static Node *ParseDocTypeDecl(TidyDocImpl* doc)
             /* read document type name */
             if (TY_(IsWhite)(c) || c == '>' || c == '[')
             {
-                node->element = TY_(tmbstrndup)(doc->allocator,
-                                                lexer->lexbuf + start,
-                                                lexer->lexsize - start - 1);
+                node->element = TY_(InternNameN)(doc,
+                                                 lexer->lexbuf + start,
+                                                 lexer->lexsize - start - 1);
                 if (c == '>' || c == '[')
                 {
                     --(lexer->lexsize);
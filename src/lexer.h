@@ -256,11 +256,10 @@ struct _AttVal
 {
     AttVal*           next;
     const Attribute*  dict;
-    Node*             asp;
-    Node*             php;
-    int               delim;
-    tmbstr            attribute;
+    ctmbstr           attribute;
     tmbstr            value;
+    unsigned          delim  : 8;
+    unsigned          script : 1;   /* ASP/PHP section, see AttrScript() */
 };
 
 
@@ -284,7 +283,7 @@ struct _IStack
 {
     IStack*     next;
     const Dict* tag;        /* tag's dictionary definition */
-    tmbstr      element;    /* name (NULL for text nodes) */
+    ctmbstr     element;    /* name (NULL for text nodes) */
     AttVal*     attributes;
 };
 
@@ -302,24 +301,84 @@ struct _Node
     Node*       last;
 
     AttVal*     attributes;
-    const Dict* was;            /* old tag when it was changed */
     const Dict* tag;            /* tag's dictionary definition */
 
-    tmbstr      element;        /* name (NULL for text nodes) */
+    ctmbstr     element;        /* name (NULL for text nodes) */
 
     uint        start;          /* start of span onto text array */
     uint        end;            /* end of span onto text array */
-    NodeType    type;           /* TextNode, StartTag, EndTag etc. */
 
     uint        line;           /* current line of document */
     uint        column;         /* current column of document */
 
-    Bool        closed;         /* true if closed by explicit end tag */
-    Bool        implicit;       /* true if inferred */
-    Bool        linebreak;      /* true if followed by a line break */
+    unsigned    type      : 8;  /* NodeType: TextNode, StartTag, EndTag etc. */
+    unsigned    closed    : 1;  /* true if closed by explicit end tag */
+    unsigned    implicit  : 1;  /* true if inferred */
+    unsigned    linebreak : 1;  /* true if followed by a line break */
+    unsigned    spanned   : 1;  /* true if start/end index the input buffer */
+    unsigned    coerced   : 1;  /* true if the tag was changed, see NodeWas() */
 };
 
 
+/*
+  Fields that few nodes and attributes need live in a side table of
+  the lexer, keyed by the owner's address: the tag of a coerced node,
+  and the node of an attribute that is an ASP or PHP section.
+*/
+
+typedef struct _RareField
+{
+    const void*         owner;
+    void*               value;
+    struct _RareField*  next;
+} RareField;
+
+/*
+  Element and attribute names are interned in a table of the lexer, so
+  equal names share one string that lives as long as the document tree
+  and can be compared by address. Names of built-in tags and attributes
+  point at the static definition.
+*/
+
+typedef struct _InternedName
+{
+    ctmbstr                 name;
+    uint                    len;
+    struct _InternedName*   next;
+} InternedName;
+
+/*
+  Options read for every character, token or attribute while parsing.
+  ResolveLexerOptions() and ResolveParserOptions() copy them out of the
+  configuration when a parse starts, and again whenever the parser
+  itself changes one of them. In a release build reading an option is
+  one load either way; the copies list in one place what the lexer and
+  parser depend on, and spare _DEBUG builds a checked call per read.
+*/
+
+typedef struct _LexerOptions
+{
+    Bool xmlTags;               /* TidyXmlTags */
+    Bool xmlPIs;                /* TidyXmlPIs */
+    Bool ncr;                   /* TidyNCR, unless the input encoding
+                                   is BIG5 or SHIFTJIS */
+    Bool preserveEntities;      /* TidyPreserveEntities */
+    Bool quoteAmpersand;        /* TidyQuoteAmpersand */
+    Bool literalAttribs;        /* TidyLiteralAttribs */
+    Bool escapeScripts;         /* TidyEscapeScripts */
+    Bool skipNested;            /* TidySkipNested */
+    uint upperCaseAttrs;        /* TidyUpperCaseAttrs */
+    TidyTriState fixComments;   /* TidyFixComments; "auto" is settled
+                                   per comment, see FixComments() */
+} LexerOptions;
+
+typedef struct _ParserOptions
+{
+    Bool coerceEndTags;         /* TidyCoerceEndTags */
+    Bool omitOptionalTags;      /* TidyOmitOptionalTags */
+    Bool showBodyOnly;          /* TidyBodyOnly is yes */
+} ParserOptions;
+
 /*
   The following are private to the lexer
   Use NewLexer() to create a lexer, and
@@ -349,6 +408,9 @@ struct _Lexer
     Node* root;             /* remember root node of the document */
     Node* parent;           /* remember parent node for CDATA elements */
     
+    LexerOptions lexOpts;   /* see ResolveLexerOptions() */
+    ParserOptions parseOpts; /* see ResolveParserOptions() */
+
     Bool seenEndBody;       /* true if a </body> tag has been encountered */
     Bool seenEndHtml;       /* true if a </html> tag has been encountered */
 
@@ -365,6 +427,17 @@ struct _Lexer
     uint lexlength;         /* allocated */
     uint lexsize;           /* used */
 
+    /*
+      With zero-copy-input, text nodes whose content is identical to
+      the UTF-8 input are left in the caller's buffer, and only text
+      that was rewritten is kept in lexbuf. Attribute values are still
+      copied: AttVal::value is a NUL terminated string that callers
+      free, rewrite and hand out through tidyAttrValue().
+    */
+    ctmbstr spanbuf;        /* caller's input buffer, or NULL */
+    uint spansize;          /* size of spanbuf */
+    uint txtinput;          /* input offset of current text token */
+
     /* Inline stack for compatibility with Mosaic */
     Node* inode;            /* for deferring text node */
     IStack* insert;         /* for inferring inline tags */
@@ -376,9 +449,25 @@ struct _Lexer
     TagStyle *styles;          /* used for cleaning up presentation markup */
 
     TidyAllocator* allocator; /* allocator */
+    TidyAllocator* nodeAllocator; /* Nodes and AttVals, an arena with arena-allocation */
+
+    RareField** rare;       /* hash table, see NodeWas() and AttrScript() */
+    uint raresize;          /* buckets */
+    uint rarecount;         /* entries */
+
+    InternedName** names;   /* hash table, see InternName() */
+    uint namesize;          /* buckets */
+    uint namecount;         /* entries */
 };
 
 
+/* Buffer that node->start and node->end index: lexbuf, or the input
+** buffer for text nodes left in place by zero-copy-input.
+*/
+#define NodeTextBuf(lexer, node) \
+    ((node)->spanned ? (lexer)->spanbuf : (ctmbstr)(lexer)->lexbuf)
+
+
 /* Lexer Functions
 */
 
@@ -405,11 +494,28 @@ uint TY_(ToLower)(uint c);
 uint TY_(ToUpper)(uint c);
 
 Lexer* TY_(NewLexer)( TidyDocImpl* doc );
+void TY_(ResetLexer)( TidyDocImpl* doc );
 void TY_(FreeLexer)( TidyDocImpl* doc );
 
+/* copy the options in LexerOptions out of the configuration */
+void TY_(ResolveLexerOptions)( TidyDocImpl* doc );
+
 /* store character c as UTF-8 encoded byte stream */
 void TY_(AddCharToLexer)( Lexer *lexer, uint c );
 
+/* copy a text node to the end of lexbuf, reserving extra zeroed bytes
+   after it, so that it can be modified in place and may grow */
+void TY_(MoveTextToEnd)( Lexer *lexer, Node *node, uint extra );
+
+/* copy a text node left in the input buffer into lexbuf, so that it
+   can be modified in place; extra zeroed bytes are reserved after it */
+void TY_(MaterializeText)( Lexer *lexer, Node *node, uint extra );
+
+/* append a byte to a text node, first copying its text to the end of
+   lexbuf unless it is already there: the bytes after a node may belong
+   to another node, or be space the lexer has given back */
+void TY_(AppendToText)( Lexer *lexer, Node *node, tmbchar c );
+
 /*
   Used for elements and text nodes
   element name is NULL for text nodes
@@ -429,6 +535,19 @@ Node* TY_(NewNode)( TidyAllocator* allocator, Lexer* lexer );
 /* used to clone heading nodes when split by an <HR> */
 Node* TY_(CloneNode)( TidyDocImpl* doc, Node *element );
 
+/* the interned copy of a name, see InternedName; NULL for NULL, and
+   like tmbstrndup() InternNameN() stops at a NUL and maps "" to NULL */
+ctmbstr TY_(InternName)( TidyDocImpl* doc, ctmbstr name );
+ctmbstr TY_(InternNameN)( TidyDocImpl* doc, ctmbstr name, uint len );
+
+/* the tag node had before CoerceNode() changed it, or NULL */
+const Dict* TY_(NodeWas)( TidyDocImpl* doc, Node *node );
+void TY_(SetNodeWas)( TidyDocImpl* doc, Node *node, const Dict* was );
+
+/* the AspTag or PhpTag node of an attribute that is one, or NULL */
+Node* TY_(AttrScript)( TidyDocImpl* doc, AttVal *av );
+void TY_(SetAttrScript)( TidyDocImpl* doc, AttVal *av, Node *script );
+
 /* free node's attributes */
 void TY_(FreeAttrs)( TidyDocImpl* doc, Node *node );
 
@@ -516,8 +635,6 @@ typedef enum
 
 Node* TY_(GetToken)( TidyDocImpl* doc, GetTokenMode mode );
 
-void TY_(InitMap)(void);
-
 
 /* create a new attribute */
 AttVal* TY_(NewAttribute)( TidyDocImpl* doc );
@@ -19,6 +19,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <sys/mman.h>
 
@@ -26,6 +27,7 @@
 typedef struct
 {
     TidyAllocator *allocator;
+    FILE *fp;
     const byte *base;
     size_t pos, size;
 } MappedFileSource;
@@ -33,6 +35,8 @@ typedef struct
 static int TIDY_CALL mapped_getByte( void* sourceData )
 {
     MappedFileSource* fin = (MappedFileSource*) sourceData;
+    if ( fin->pos >= fin->size )
+        return EndOfStream;
     return fin->base[fin->pos++];
 }
 
@@ -45,38 +49,67 @@ static Bool TIDY_CALL mapped_eof( void* sourceData )
 static void TIDY_CALL mapped_ungetByte( void* sourceData, byte ARG_UNUSED(bv) )
 {
     MappedFileSource* fin = (MappedFileSource*) sourceData;
-    fin->pos--;
+    if ( fin->pos > 0 )
+        fin->pos--;
 }
 
-int TY_(initFileSource)( TidyAllocator *allocator, TidyInputSource* inp, FILE* fp )
+static uint TIDY_CALL mapped_getBytes( void* sourceData, byte* bytes, uint size )
+{
+    MappedFileSource* fin = (MappedFileSource*) sourceData;
+    if ( size > fin->size - fin->pos )
+        size = (uint)( fin->size - fin->pos );
+    memcpy( bytes, fin->base + fin->pos, size );
+    fin->pos += size;
+    return size;
+}
+
+/* Only regular files that haven't been read from yet are mapped;
+   pipes, terminals and devices keep using standard I/O.
+*/
+int TY_(initFileSource)( TidyAllocator *allocator, TidyInputSource* inp,
+                         TidyGetBytesFunc* getBytes, FILE* fp )
 {
     MappedFileSource* fin;
     struct stat sbuf;
+    void* base;
     int fd;
 
+    fd = fileno(fp);
+    if ( fd == -1
+         || fstat(fd, &sbuf) == -1
+         || !S_ISREG(sbuf.st_mode)
+         || sbuf.st_size <= 0
+         || (off_t)(size_t)sbuf.st_size != sbuf.st_size
+         || ftell(fp) != 0 )
+        return TY_(initStdIOFileSource)( allocator, inp, getBytes, fp );
+
+    base = mmap( 0, (size_t)sbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    if ( base == MAP_FAILED )
+        return TY_(initStdIOFileSource)( allocator, inp, getBytes, fp );
+
     fin = (MappedFileSource*) TidyAlloc( allocator, sizeof(MappedFileSource) );
     if ( !fin )
-        return -1;
-
-    fd = fileno(fp);
-    if ( fstat(fd, &sbuf) == -1
-         || sbuf.st_size == 0
-         || (fin->base = mmap(0, fin->size = sbuf.st_size, PROT_READ,
-                              MAP_SHARED, fd, 0)) == MAP_FAILED)
     {
-        TidyFree( allocator, fin );
-        /* Fallback on standard I/O */
-        return TY_(initStdIOFileSource)( allocator, inp, fp );
+        munmap( base, (size_t)sbuf.st_size );
+        return -1;
     }
 
-    fin->pos = 0;
+#ifdef MADV_SEQUENTIAL
+    /* The lexer reads front to back exactly once. */
+    madvise( base, (size_t)sbuf.st_size, MADV_SEQUENTIAL );
+#endif
+
     fin->allocator = allocator;
-    fclose(fp);
+    fin->fp = fp;
+    fin->base = (const byte*) base;
+    fin->size = (size_t)sbuf.st_size;
+    fin->pos = 0;
 
     inp->getByte    = mapped_getByte;
     inp->eof        = mapped_eof;
     inp->ungetByte  = mapped_ungetByte;
     inp->sourceData = fin;
+    *getBytes = mapped_getBytes;
 
     return 0;
 }
@@ -87,12 +120,37 @@ void TY_(freeFileSource)( TidyInputSource* inp, Bool closeIt )
     {
         MappedFileSource* fin = (MappedFileSource*) inp->sourceData;
         munmap( (void*)fin->base, fin->size );
+        if ( closeIt && fin->fp )
+            fclose( fin->fp );
         TidyFree( fin->allocator, fin );
     }
     else
         TY_(freeStdIOFileSource)( inp, closeIt );
 }
 
+uint TY_(MappedFileRun)( TidyInputSource* inp, ctmbstr* run )
+{
+    MappedFileSource* fin;
+    size_t len;
+
+    if ( inp->getByte != mapped_getByte )
+        return 0;
+
+    fin = (MappedFileSource*) inp->sourceData;
+    len = fin->size - fin->pos;
+    if ( len > 0x7FFFFFFF )
+        return 0;
+    *run = (ctmbstr) fin->base + fin->pos;
+    return (uint) len;
+}
+
+void TY_(SkipMappedFileRun)( TidyInputSource* inp, uint count )
+{
+    MappedFileSource* fin = (MappedFileSource*) inp->sourceData;
+    assert( inp->getByte == mapped_getByte );
+    fin->pos += count;
+}
+
 #endif /* SUPPORT_POSIX_MAPPED_FILES */
 
 
@@ -12,4 +12,13 @@
 int TY_(DocParseFileWithMappedFile)( TidyDocImpl* doc, ctmbstr filnam );
 #endif
 
+#if SUPPORT_POSIX_MAPPED_FILES
+/* Unread part of a memory mapped file source, so that StreamIn can
+   read it in place. Returns 0 if the source isn't mapped, or if the
+   rest of the file is too large to index with a uint.
+*/
+uint TY_(MappedFileRun)( TidyInputSource* inp, ctmbstr* run );
+void TY_(SkipMappedFileRun)( TidyInputSource* inp, uint count );
+#endif
+
 #endif /* __TIDY_MAPPED_IO_H__ */
@@ -38,7 +38,7 @@ ctmbstr TY_(tidyLibraryVersion)(void)
  *********************************************************************/
 
 /* Returns the given node's tag as a string. */
-static char* TagToString(Node* tag, char* buf, size_t count)
+static char* TagToString(TidyDocImpl* doc, Node* tag, char* buf, size_t count)
 {
     *buf = 0;
     if (tag)
@@ -50,9 +50,9 @@ static char* TagToString(Node* tag, char* buf, size_t count)
         else if (tag->type == DocTypeTag)
             TY_(tmbsnprintf)(buf, count, "<!DOCTYPE>");
         else if (tag->type == TextNode)
-            TY_(tmbsnprintf)(buf, count, "%s", tidyLocalizedString(STRING_PLAIN_TEXT));
+            TY_(tmbsnprintf)(buf, count, "%s", TY_(tidyDocLocalizedString)(doc, STRING_PLAIN_TEXT));
         else if (tag->type == XmlDecl)
-            TY_(tmbsnprintf)(buf, count, "%s", tidyLocalizedString(STRING_XML_DECLARATION));
+            TY_(tmbsnprintf)(buf, count, "%s", TY_(tidyDocLocalizedString)(doc, STRING_XML_DECLARATION));
         else if (tag->element)
             TY_(tmbsnprintf)(buf, count, "%s", tag->element);
     }
@@ -96,7 +96,7 @@ static ctmbstr HTMLVersion( TidyDocImpl* doc )
     uint version = versionEmitted == 0 ? declared : versionEmitted;
     ctmbstr result = TY_(HTMLVersionNameFromCode)(version, 0);
     if (!result)
-        result = tidyLocalizedString(STRING_HTML_PROPRIETARY);
+        result = TY_(tidyDocLocalizedString)(doc, STRING_HTML_PROPRIETARY);
     return result;
 }
 
@@ -107,26 +107,10 @@ static ctmbstr HTMLVersion( TidyDocImpl* doc )
  *********************************************************************/
 
 
-/* Writes messages to the output sink unless they are suppressed by one of the
-** message callback filters, or suppressed by the configuration settings.
-** Report messages are messages that are included in the "error table," and
-** dialogue messages are any other output that Tidy traditionally emits.
-*/
-static void messageOut( TidyMessageImpl *message )
+/* Updates the count of each report type. */
+static void countMessage( TidyDocImpl *doc, TidyReportLevel level )
 {
-    TidyDocImpl *doc;
-    Bool go = yes;
-
-    if ( !message )
-        return;
-
-    doc = message->tidyDoc;
-
-    /* The filter has had a chance to suppress *any* message from output. */
-    go = message->allowMessage;
-
-    /* Update the count of each report type. */
-    switch ( message->level )
+    switch ( level )
     {
         case TidyInfo:
             doc->infoMessages++;
@@ -152,71 +136,170 @@ static void messageOut( TidyMessageImpl *message )
         default:
             break;
     }
+}
+
+
+/* Determines whether the configuration keeps a message out of the output
+** sink. `errors` is the error count including this message.
+*/
+static Bool messageIsHidden( TidyDocImpl *doc, uint code, TidyReportLevel level, Bool muted, uint errors )
+{
+    Bool go = yes;
 
     /* Suppress report messages if they've been muted. */
-    go = go & !message->muted;
+    go = go & !muted;
 
     /* Suppress report messages if we've already reached the reporting limit. */
-    if ( message->level <= TidyFatal )
+    if ( level <= TidyFatal )
     {
-        go = go & ( doc->errors < cfg(doc, TidyShowErrors) );
+        go = go & ( errors < cfg(doc, TidyShowErrors) );
     }
 
     /* Let TidyQuiet silence a lot of things. */
     if ( cfgBool( doc, TidyQuiet ) == yes )
     {
-        go = go && message->code != STRING_DOCTYPE_GIVEN;
-        go = go && message->code != STRING_CONTENT_LOOKS;
-        go = go && message->code != STRING_NO_SYSID;
-        go = go && message->level != TidyDialogueInfo;
-        go = go && message->level != TidyConfig;
-        go = go && message->level != TidyInfo;
-        go = go && !(message->level >= TidyDialogueSummary &&
-                            message->code != STRING_NEEDS_INTERVENTION);
+        go = go && code != STRING_DOCTYPE_GIVEN;
+        go = go && code != STRING_CONTENT_LOOKS;
+        go = go && code != STRING_NO_SYSID;
+        go = go && level != TidyDialogueInfo;
+        go = go && level != TidyConfig;
+        go = go && level != TidyInfo;
+        go = go && !(level >= TidyDialogueSummary &&
+                            code != STRING_NEEDS_INTERVENTION);
     }
 
     /* Let !TidyShowInfo silence some things. */
     if ( cfgBool( doc, TidyShowInfo ) == no )
     {
-        go = go && message->level != TidyInfo;
+        go = go && level != TidyInfo;
 
         /* Temporary; TidyShowInfo shouldn't affect TidyDialogueInfo, but
            right now such messages are hidden until we granularize the
            output controls. */
-        go = go && message->level != TidyDialogueInfo;
+        go = go && level != TidyDialogueInfo;
     }
 
     /* Let !TidyShowWarnings silence some things. */
     if ( cfgBool( doc, TidyShowWarnings ) == no )
     {
-        go = go && message->level != TidyWarning;
+        go = go && level != TidyWarning;
     }
 
+    return !go;
+}
+
+
+/* Writes messages to the output sink unless they are suppressed by one of the
+** message callback filters, or suppressed by the configuration settings.
+** Report messages are messages that are included in the "error table," and
+** dialogue messages are any other output that Tidy traditionally emits.
+*/
+static void messageOut( TidyMessageImpl *message )
+{
+    TidyDocImpl *doc;
+    Bool go = yes;
+
+    if ( !message )
+        return;
+
+    doc = message->tidyDoc;
+
+    countMessage( doc, message->level );
+
+    /* The filter has had a chance to suppress *any* message from output. */
+    go = message->allowMessage;
+
+    /* Recorded messages are read back as data, not written out. */
+    go = go && !doc->messageRecords.recording;
+
+    go = go && !messageIsHidden( doc, message->code, message->level,
+                                 message->muted, doc->errors );
+
     /* Output the message if applicable. */
     if ( go )
     {
-        TidyOutputSink *outp = &doc->errout->sink;
         ctmbstr cp;
         byte b = '\0';
-        for ( cp = message->messageOutput; *cp; ++cp )
+        for ( cp = TY_(getMessageOutput)(message); *cp; ++cp )
         {
             b = (*cp & 0xff);
             if (b == (byte)'\n')
                 TY_(WriteChar)( b, doc->errout );   /* for EOL translation */
             else
-                outp->putByte( outp->sinkData, b ); /* #383 - no encoding */
+                TY_(WriteByte)( b, doc->errout );   /* #383 - no encoding */
         }
 
         /* Always add a trailing newline. Reports require this, and dialogue
            messages will be better spaced out without having to fill the
            language file with superflous newlines. */
         TY_(WriteChar)( '\n', doc->errout );
+        TY_(FlushStreamOut)( doc->errout );
     }
 
     TY_(tidyMessageRelease)(message);
 }
 
 
+/* Counts a report that exceeds the report-repeats limit for its code. Such
+** reports are neither output, nor recorded, nor passed to callbacks.
+*/
+Bool TY_(SkipRepeatedMessage)( TidyDocImpl* doc, uint code, TidyReportLevel level )
+{
+    TidyMutedMessages *list = &(doc->muted);
+    uint limit = cfg( doc, TidyReportRepeats );
+
+    if ( limit == 0 || level > TidyFatal || code <= TIDYSTRINGS_FIRST || code >= TIDYSTRINGS_LAST )
+        return no;
+
+    if ( !list->repeats )
+    {
+        uint size = sizeof(uint) * (TIDYSTRINGS_LAST - TIDYSTRINGS_FIRST);
+        list->repeats = (uint*)TidyAlloc( doc->allocator, size );
+        TidyClearMemory( list->repeats, size );
+    }
+
+    if ( ++list->repeats[code - TIDYSTRINGS_FIRST] <= limit )
+        return no;
+
+    countMessage( doc, level );
+    return yes;
+}
+
+
+/* Starts the report-repeats counts over, keeping their table. */
+void TY_(ResetRepeatedMessages)( TidyDocImpl* doc )
+{
+    TidyMutedMessages *list = &(doc->muted);
+
+    if ( list->repeats )
+        TidyClearMemory( list->repeats,
+                         sizeof(uint) * (TIDYSTRINGS_LAST - TIDYSTRINGS_FIRST) );
+}
+
+
+/* Counts a message that would be neither written to the output sink nor
+** seen by any callback, so that its caller can skip building it. While
+** the document records its messages, none is written to the sink.
+*/
+Bool TY_(SkipHiddenMessage)( TidyDocImpl* doc, uint code, TidyReportLevel level )
+{
+    uint errors = doc->errors + ( level == TidyError ? 1 : 0 );
+
+    if ( doc->messageCallback )
+        return no;
+
+    if ( level <= TidyFatal && ( doc->reportFilter || doc->reportCallback ) )
+        return no;
+
+    if ( !doc->messageRecords.recording
+         && !messageIsHidden( doc, code, level, TY_(MessageIsMuted)( doc, code ), errors ) )
+        return no;
+
+    countMessage( doc, level );
+    return yes;
+}
+
+
 /*********************************************************************
  * Report Formatting
  * In order to provide a single, predictable reporting system, Tidy
@@ -253,7 +336,7 @@ static messageFormatter formatStandardDynamic;
 ** this it makes it simple to output new reports, or to change report level by
 ** modifying this array.
 */
-static struct _dispatchTable {
+static const struct _dispatchTable {
     uint code;                 /**< The message code. */
     TidyReportLevel level;     /**< The default TidyReportLevel of the message. */
     messageFormatter *handler; /**< The formatter for the report. */
@@ -535,7 +618,7 @@ TidyMessageImpl *formatAttributeReport(TidyDocImpl* doc, Node *element, Node *no
     char const *value = "NULL";
     char tagdesc[64];
 
-    TagToString(node, tagdesc, sizeof(tagdesc));
+    TagToString(doc, node, tagdesc, sizeof(tagdesc));
 
     if ( ( av = va_arg(args, AttVal*) ) )
     {
@@ -596,7 +679,7 @@ TidyMessageImpl *formatAttributeReport(TidyDocImpl* doc, Node *element, Node *no
         case UNEXPECTED_END_OF_FILE_ATTR:
             /* on end of file adjust reported position to end of input */
             doc->lexer->lines   = doc->docIn->curline;
-            doc->lexer->columns = doc->docIn->curcol;
+            doc->lexer->columns = TY_(InputColumn)( doc->docIn );
             return TY_(tidyMessageCreateWithLexer)(doc, code, level, tagdesc );
     }
 
@@ -616,7 +699,7 @@ TidyMessageImpl *formatEncodingReport(TidyDocImpl* doc, Node *element, Node *nod
     char buf[ 32 ] = {'\0'};
     uint c = va_arg( args, uint );
     Bool discarded = va_arg( args, Bool );
-    ctmbstr action = tidyLocalizedString(discarded ? STRING_DISCARDING : STRING_REPLACING);
+    ctmbstr action = TY_(tidyDocLocalizedString)(doc, discarded ? STRING_DISCARDING : STRING_REPLACING);
 
     switch (code)
     {
@@ -674,10 +757,10 @@ TidyMessageImpl *formatStandard(TidyDocImpl* doc, Node *element, Node *node, uin
     char elemdesc[ 256 ] = {0};
     Node* rpt = ( element ? element : node );
 
-    TagToString(node, nodedesc, sizeof(nodedesc));
+    TagToString(doc, node, nodedesc, sizeof(nodedesc));
 
     if ( element )
-        TagToString(element, elemdesc, sizeof(elemdesc));
+        TagToString(doc, element, elemdesc, sizeof(elemdesc));
 
     switch ( code )
     {
@@ -687,17 +770,17 @@ TidyMessageImpl *formatStandard(TidyDocImpl* doc, Node *element, Node *node, uin
             switch ( cfg( doc, TidyUseCustomTags ) )
             {
                 case TidyCustomBlocklevel:
-                    tagtype = tidyLocalizedString( TIDYCUSTOMBLOCKLEVEL_STRING );
+                    tagtype = TY_(tidyDocLocalizedString)( doc, TIDYCUSTOMBLOCKLEVEL_STRING );
                     break;
                 case TidyCustomEmpty:
-                    tagtype = tidyLocalizedString( TIDYCUSTOMEMPTY_STRING );
+                    tagtype = TY_(tidyDocLocalizedString)( doc, TIDYCUSTOMEMPTY_STRING );
                     break;
                 case TidyCustomInline:
-                    tagtype = tidyLocalizedString( TIDYCUSTOMINLINE_STRING );
+                    tagtype = TY_(tidyDocLocalizedString)( doc, TIDYCUSTOMINLINE_STRING );
                     break;
                 case TidyCustomPre:
                 default:
-                    tagtype = tidyLocalizedString( TIDYCUSTOMPRE_STRING );
+                    tagtype = TY_(tidyDocLocalizedString)( doc, TIDYCUSTOMPRE_STRING );
                     break;
             }
             return TY_(tidyMessageCreateWithNode)(doc, element, code, level, elemdesc, tagtype );
@@ -868,7 +951,7 @@ TidyMessageImpl *formatStandardDynamic(TidyDocImpl* doc, Node *element, Node *no
 {
     char nodedesc[ 256 ] = {0};
 
-    TagToString(node, nodedesc, sizeof(nodedesc));
+    TagToString(doc, node, nodedesc, sizeof(nodedesc));
 
     switch (code)
     {
@@ -892,37 +975,75 @@ TidyMessageImpl *formatStandardDynamic(TidyDocImpl* doc, Node *element, Node *no
  *********************************************************************/
 
 
+/* Maps each message code to its row in dispatchTable[], plus one, so that
+** reports needn't search the table. BuildDispatchIndex() fills it in once,
+** from the first tidyCreate(); after that it's only read.
+*/
+static unsigned short dispatchIndex[TIDYSTRINGS_LAST - TIDYSTRINGS_FIRST];
+static Bool dispatchIndexBuilt = no;
+
+
+void TY_(BuildDispatchIndex)( void )
+{
+    uint i;
+
+    if ( dispatchIndexBuilt )
+        return;
+
+    /* Walk backwards so that the first row for a code wins, as it
+       did when the table was searched. */
+    for ( i = 0; dispatchTable[i].code != 0; i++ )
+        continue;
+    while ( i-- > 0 )
+    {
+        assert( dispatchTable[i].code > TIDYSTRINGS_FIRST && dispatchTable[i].code < TIDYSTRINGS_LAST );
+        dispatchIndex[dispatchTable[i].code - TIDYSTRINGS_FIRST] = (unsigned short)(i + 1);
+    }
+    dispatchIndexBuilt = yes;
+}
+
+
+/* Returns the dispatchTable[] row for a message code, or NULL. */
+static const struct _dispatchTable *dispatchEntry( uint code )
+{
+    uint i;
+
+    assert( dispatchIndexBuilt );
+
+    if ( code <= TIDYSTRINGS_FIRST || code >= TIDYSTRINGS_LAST )
+        return NULL;
+
+    i = dispatchIndex[code - TIDYSTRINGS_FIRST];
+    return i ? &dispatchTable[i - 1] : NULL;
+}
+
+
 /* This function performs the heavy lifting for TY_(Report)(). Critically we
 ** can accept the va_list needed for recursion.
 */
 static void vReport(TidyDocImpl* doc, Node *element, Node *node, uint code, va_list args)
 {
-    int i = 0;
+    const struct _dispatchTable *entry = dispatchEntry( code );
     va_list args_copy;
 
-    while ( dispatchTable[i].code != 0 )
+    if ( entry )
     {
-        if ( dispatchTable[i].code == code )
-        {
-            TidyMessageImpl *message;
-            messageFormatter *handler = dispatchTable[i].handler;
-            TidyReportLevel level = dispatchTable[i].level;
+        TidyMessageImpl *message;
+        messageFormatter *handler = entry->handler;
+        TidyReportLevel level = entry->level;
 
-            va_copy(args_copy, args);
-            message = handler( doc, element, node, code, level, args_copy );
-            va_end(args_copy);
+        va_copy(args_copy, args);
+        message = handler( doc, element, node, code, level, args_copy );
+        va_end(args_copy);
 
-            messageOut( message );
+        messageOut( message );
 
-            if ( dispatchTable[i].next )
-            {
-                va_copy(args_copy, args);
-                vReport(doc, element, node, dispatchTable[i].next, args_copy);
-                va_end(args_copy);
-            }
-            break;
+        if ( entry->next )
+        {
+            va_copy(args_copy, args);
+            vReport(doc, element, node, entry->next, args_copy);
+            va_end(args_copy);
         }
-        i++;
     }
 }
 
@@ -1038,6 +1159,7 @@ static struct _dialogueDispatchTable {
     { STRING_ERROR_COUNT,          TidyDialogueSummary  }, /* ReportNumWarnings() */
     { STRING_NO_ERRORS,            TidyDialogueSummary  }, /* ReportNumWarnings() */
     { STRING_NOT_ALL_SHOWN,        TidyDialogueSummary  }, /* ReportNumWarnings() */
+    { STRING_REPEATS_NOT_SHOWN,    TidyDialogueSummary  }, /* ReportNumWarnings() */
     
     { FOOTNOTE_TRIM_EMPTY_ELEMENT, TidyDialogueFootnote },
     { TEXT_ACCESS_ADVICE1,         TidyDialogueFootnote }, /* errorSummary() */
@@ -1083,8 +1205,15 @@ TidyMessageImpl *formatDialogue( TidyDocImpl* doc, uint code, TidyReportLevel le
         case STRING_ERROR_COUNT:
         case STRING_NOT_ALL_SHOWN:
             return TY_(tidyMessageCreate)( doc, code, level,
-                                           doc->warnings, tidyLocalizedStringN( STRING_ERROR_COUNT_WARNING, doc->warnings ),
-                                           doc->errors, tidyLocalizedStringN( STRING_ERROR_COUNT_ERROR, doc->errors ) );
+                                           doc->warnings, TY_(tidyDocLocalizedStringN)( doc, STRING_ERROR_COUNT_WARNING, doc->warnings ),
+                                           doc->errors, TY_(tidyDocLocalizedStringN)( doc, STRING_ERROR_COUNT_ERROR, doc->errors ) );
+
+        case STRING_REPEATS_NOT_SHOWN:
+        {
+            uint count = va_arg(args, uint);
+            ctmbstr key = va_arg(args, ctmbstr);
+            return TY_(tidyMessageCreate)( doc, code, level, count, key );
+        }
 
         case FOOTNOTE_TRIM_EMPTY_ELEMENT:
         case STRING_HELLO_ACCESS:
@@ -1162,7 +1291,7 @@ void TY_(Dialogue)(TidyDocImpl* doc, uint code, ...)
 */
 void TY_(ErrorSummary)( TidyDocImpl* doc )
 {
-    ctmbstr encnam = tidyLocalizedString(STRING_SPECIFIED);
+    ctmbstr encnam = TY_(tidyDocLocalizedString)(doc, STRING_SPECIFIED);
     int charenc = cfg( doc, TidyCharEncoding ); 
     if ( charenc == WIN1252 ) 
         encnam = "Windows-1252";
@@ -1278,7 +1407,7 @@ void TY_(ReportMarkupVersion)( TidyDocImpl* doc )
         ctmbstr vers = TY_(HTMLVersionNameFromCode)( apparentVers, isXhtml );
 
         if ( !vers )
-            vers = tidyLocalizedString(STRING_HTML_PROPRIETARY);
+            vers = TY_(tidyDocLocalizedString)(doc, STRING_HTML_PROPRIETARY);
 
         TY_(Report)( doc, NULL, NULL, STRING_CONTENT_LOOKS, vers );
 
@@ -1294,9 +1423,27 @@ void TY_(ReportMarkupVersion)( TidyDocImpl* doc )
 */
 void TY_(ReportNumWarnings)( TidyDocImpl* doc )
 {
+    Bool repeated = no;
+    uint limit = cfg( doc, TidyReportRepeats );
+    uint code;
+
+    /* Say what the report-repeats limit left out, one line per code. */
+    if ( doc->muted.repeats )
+    {
+        for ( code = TIDYSTRINGS_FIRST + 1; code < TIDYSTRINGS_LAST; code++ )
+        {
+            uint count = doc->muted.repeats[code - TIDYSTRINGS_FIRST];
+            if ( limit > 0 && count > limit )
+            {
+                TY_(Dialogue)( doc, STRING_REPEATS_NOT_SHOWN, count - limit, TY_(tidyErrorCodeAsKey)(code) );
+                repeated = yes;
+            }
+        }
+    }
+
     if ( doc->warnings > 0 || doc->errors > 0 )
     {
-        if ( doc->errors > cfg(doc, TidyShowErrors) || !cfgBool(doc, TidyShowWarnings) )
+        if ( doc->errors > cfg(doc, TidyShowErrors) || !cfgBool(doc, TidyShowWarnings) || repeated )
         {
             TY_(Dialogue)( doc, STRING_NOT_ALL_SHOWN );
         }
@@ -1324,6 +1471,15 @@ void TY_(FreeMutedMessageList)( TidyDocImpl* doc )
 
     if ( list->list )
         TidyFree( doc->allocator, list->list );
+
+    if ( list->repeats )
+        TidyFree( doc->allocator, list->repeats );
+
+    list->list = NULL;
+    list->repeats = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    TidyClearMemory( list->bits, sizeof(list->bits) );
 }
 
 
@@ -1356,12 +1512,46 @@ void TY_(DefineMutedMessage)(TidyDocImpl* doc, const TidyOptionImpl* opt, ctmbst
     list->list[list->count] = message;
     list->count++;
     list->list[list->count] = 0;
+    list->bits[(message - REPORT_MESSAGE_FIRST) / 8] |= (byte)(1 << ((message - REPORT_MESSAGE_FIRST) % 8));
 
     /* Must come *after* adding to the list, in case it's muted, too. */
     TY_(Report)( doc, NULL, NULL, STRING_MUTING_TYPE, name );
 }
 
 
+void TY_(SetMutedMessages)( TidyDocImpl* doc, const tidyStrings* codes, uint count )
+{
+    TidyMutedMessages *list = &(doc->muted);
+    uint i;
+
+    TY_(FreeMutedMessageList)( doc );
+    if ( count == 0 )
+        return;
+
+    list->list = TidyAlloc( doc->allocator, sizeof(tidyStrings) * (count + 1) );
+    list->capacity = count;
+    list->count = count;
+    for ( i = 0; i < count; ++i )
+    {
+        tidyStrings message = codes[i];
+        list->list[i] = message;
+        list->bits[(message - REPORT_MESSAGE_FIRST) / 8] |= (byte)(1 << ((message - REPORT_MESSAGE_FIRST) % 8));
+    }
+    list->list[count] = 0;
+}
+
+
+Bool TY_(MessageIsMuted)( TidyDocImpl* doc, uint code )
+{
+    TidyMutedMessages *list = &(doc->muted);
+
+    if ( code <= REPORT_MESSAGE_FIRST || code >= REPORT_MESSAGE_LAST )
+        return no;
+
+    return ( list->bits[(code - REPORT_MESSAGE_FIRST) / 8] >> ((code - REPORT_MESSAGE_FIRST) % 8) ) & 1 ? yes : no;
+}
+
+
 TidyIterator TY_(getMutedMessageList)( TidyDocImpl* doc )
 {
     TidyMutedMessages *list = &(doc->muted);
@@ -1460,16 +1650,7 @@ uint TY_(tidyErrorCodeFromKey)(ctmbstr code)
  */
 static const uint tidyErrorCodeListSize()
 {
-    static uint array_size = 0;
-    
-    if ( array_size == 0 )
-    {
-        while ( tidyStringsKeys[array_size].key ) {
-            array_size++;
-        }
-    }
-    
-    return array_size;
+    return sizeof(tidyStringsKeys)/sizeof(tidyStringsKeys[0]) - 1;
 }
 
 /**
@@ -177,6 +177,39 @@ void TY_(ReportMarkupVersion)( TidyDocImpl* doc );
 void TY_(ReportNumWarnings)( TidyDocImpl* doc );
 
 
+/**
+ *  Counts a report beyond the `report-repeats` limit for its code, so that
+ *  it needn't be built, recorded, or passed to callbacks.
+ *  Called by the message object before it allocates a new message.
+ *  @returns Returns yes if the report was counted and should be dropped.
+ */
+Bool TY_(SkipRepeatedMessage)( TidyDocImpl* doc, uint code, TidyReportLevel level );
+
+
+/**
+ *  Starts the `report-repeats` counts over for another document.
+ *  Called by `tidyReset()`.
+ */
+void TY_(ResetRepeatedMessages)( TidyDocImpl* doc );
+
+
+/**
+ *  Counts a message that the configuration keeps out of the output sink, or
+ *  that is being recorded instead, and that no callback is listening for, so
+ *  that it needn't be built at all.
+ *  Called by the message object before it allocates a new message.
+ *  @returns Returns yes if the message was counted and should be dropped.
+ */
+Bool TY_(SkipHiddenMessage)( TidyDocImpl* doc, uint code, TidyReportLevel level );
+
+
+/**
+ *  Builds the code index used to dispatch reports. The index is shared by
+ *  all documents, so this is done once, by the first `tidyCreate()`.
+ */
+void TY_(BuildDispatchIndex)( void );
+
+
 /** @} */
 /** @} message_reporting group */
 
@@ -195,6 +228,8 @@ typedef struct _mutedMessages {
     tidyStrings* list; /**< A list of messages that won't be output. */
     uint count;        /**< Current count of the list. */
     uint capacity;     /**< Current capacity of the list. */
+    byte bits[(REPORT_MESSAGE_LAST - REPORT_MESSAGE_FIRST + 7) / 8]; /**< The list as a bitmap, by code. */
+    uint* repeats;     /**< Times each code was reported, with `report-repeats`. */
 } TidyMutedMessages;
 
 
@@ -210,6 +245,21 @@ void TY_(FreeMutedMessageList)( TidyDocImpl* doc );
  */
 void TY_(DefineMutedMessage)( TidyDocImpl* doc, const TidyOptionImpl* opt, ctmbstr name );
 
+/** Replaces the list of muted messages, quietly, with codes known to be
+ ** valid, such as those of a shared configuration.
+ ** @param doc The Tidy document.
+ ** @param codes The message codes.
+ ** @param count The number of codes.
+ */
+void TY_(SetMutedMessages)( TidyDocImpl* doc, const tidyStrings* codes, uint count );
+
+/** Indicates whether a message code is muted.
+ ** @param doc The Tidy document.
+ ** @param code The message code.
+ ** @returns Returns yes if the code is in the list of muted messages.
+ */
+Bool TY_(MessageIsMuted)( TidyDocImpl* doc, uint code );
+
 /** Start an iterator for muted messages.
  ** @param doc The Tidy document.
  ** @returns Returns an iterator token.
@@ -41,13 +41,27 @@ struct printfArg {
 
 
 
-/** Returns a pointer to an allocated array of `printfArg` given a format
- ** string and a va_list, or NULL if not successful or no parameters were
- ** given. Parameter `rv` will return with the count of zero or more
- ** parameters if successful, else -1.
+/** Returns a pointer to an array of `printfArg` allocated from `allocator`
+ ** given a format string and a va_list, or NULL if not successful or no
+ ** parameters were given. Parameter `rv` will return with the count of zero
+ ** or more parameters if successful, else -1.
  **
  */
-static struct printfArg *BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list ap, int *rv );
+static struct printfArg *BuildArgArray( TidyDocImpl *doc, TidyAllocator *allocator, ctmbstr fmt, va_list ap, int *rv );
+
+
+/** Formats `fmt` into `buf`, a buffer of sizeMessageBuf bytes, from the
+ ** arguments BuildArgArray captured, keeping the same characters that
+ ** formatting the whole string from the va_list would have kept. With
+ ** `buf` NULL it only checks that `fmt` can be formatted this way.
+ */
+static Bool FormatFromArgArray( ctmbstr fmt, const struct printfArg *args, int argcount, tmbstr buf );
+
+
+/** Size of the scratch buffer every formatted message string is built in;
+ ** the strings themselves are copied out at their exact length.
+ */
+enum { sizeMessageBuf=2048 };
 
 
 /*********************************************************************
@@ -55,6 +69,65 @@ static struct printfArg *BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list a
  *********************************************************************/
 
 
+/** Appends a record of a message to the document's records. Its arguments
+ ** live in the records' arena, so recording costs no allocation of its own
+ ** beyond the occasional growth of the list and the arena.
+ */
+static void RecordMessage( TidyDocImpl *doc,
+                           uint code,
+                           int line,
+                           int column,
+                           TidyReportLevel level,
+                           va_list args )
+{
+    TidyMessageRecords *records = &doc->messageRecords;
+    TidyMessageRecord *record;
+    ctmbstr fmtDefault = tidyDefaultString(code);
+    va_list args_copy;
+
+    if ( !records->arena )
+        records->arena = TY_(NewArena)( doc->allocator );
+
+    if ( records->count >= records->capacity )
+    {
+        records->capacity = records->capacity ? records->capacity * 2 : 64;
+        records->list = (TidyMessageRecord*)TidyRealloc( doc->allocator, records->list,
+                                                         records->capacity * sizeof(TidyMessageRecord) );
+    }
+
+    record = &records->list[ records->count++ ];
+    TidyClearMemory( record, sizeof(TidyMessageRecord) );
+
+    record->code = code;
+    record->line = line;
+    record->column = column;
+    record->level = level;
+    record->muted = TY_(MessageIsMuted)(doc, code);
+    record->messageFormat = TY_(tidyDocLocalizedString)(doc, code);
+
+    va_copy(args_copy, args);
+    record->arguments = BuildArgArray(doc, records->arena, fmtDefault, args_copy, &record->argcount);
+    va_end(args_copy);
+
+    /* As for messages, format now what the arguments can't reproduce. */
+    if ( !FormatFromArgArray(fmtDefault, record->arguments, record->argcount, NULL)
+         || !FormatFromArgArray(record->messageFormat, record->arguments, record->argcount, NULL) )
+    {
+        char buf[sizeMessageBuf];
+
+        va_copy(args_copy, args);
+        TY_(tmbvsnprintf)(buf, sizeMessageBuf, fmtDefault, args_copy);
+        va_end(args_copy);
+        record->messageDefault = TY_(tmbstrdup)(records->arena, buf);
+
+        va_copy(args_copy, args);
+        TY_(tmbvsnprintf)(buf, sizeMessageBuf, record->messageFormat, args_copy);
+        va_end(args_copy);
+        record->message = TY_(tmbstrdup)(records->arena, buf);
+    }
+}
+
+
 /** Create an internal representation of a Tidy message with all of
  ** the information that that we know about the message.
  **
@@ -62,9 +135,11 @@ static struct printfArg *BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list a
  ** place to add instantiation if expanding the API.
  **
  ** We currently know the doc, node, code, line, column, level, and
- ** args, will pre-calculate all of the other members upon creation.
- ** This ensures that we can use members directly, immediately,
- ** without having to use accessors internally.
+ ** args. The arguments are captured by value, and the formatted
+ ** strings and the message key are only built the first time one of
+ ** the accessors below asks for them, so that a message no one reads
+ ** costs no formatting at all. Internally, use the accessors rather
+ ** than the members for anything that is built lazily.
  **
  ** If any message callback filters are setup by API clients, they
  ** will be called here.
@@ -80,13 +155,27 @@ static TidyMessageImpl *tidyMessageCreateInitV( TidyDocImpl *doc,
                                                 TidyReportLevel level,
                                                 va_list args )
 {
-    TidyMessageImpl *result = TidyDocAlloc(doc, sizeof(TidyMessageImpl));
+    TidyMessageImpl *result;
     TidyDoc tdoc = tidyImplToDoc(doc);
     va_list args_copy;
-    enum { sizeMessageBuf=2048 };
-    ctmbstr pattern;
-    uint i = 0;
 
+    /* Reports past the report-repeats limit are only counted. */
+    if ( TY_(SkipRepeatedMessage)(doc, code, level) )
+        return NULL;
+
+    if ( doc->messageRecords.recording )
+    {
+        va_copy(args_copy, args);
+        RecordMessage(doc, code, line, column, level, args_copy);
+        va_end(args_copy);
+    }
+
+    /* A message that no one will see is only counted. */
+    if ( TY_(SkipHiddenMessage)(doc, code, level) )
+        return NULL;
+
+    result = TidyDocAlloc(doc, sizeof(TidyMessageImpl));
+    TidyClearMemory( result, sizeof(TidyMessageImpl) );
 
     /* Things we know... */
 
@@ -97,98 +186,36 @@ static TidyMessageImpl *tidyMessageCreateInitV( TidyDocImpl *doc,
     result->column = column;
     result->level = level;
     /* Is #719 - set 'muted' before any callbacks. */
-    result->muted = no;
-    i = 0;
-    while ((doc->muted.list) && (doc->muted.list[i] != 0))
-    {
-        if (doc->muted.list[i] == code)
-        {
-            result->muted = yes;
-            break;
-        }
-        i++;
-    }
+    result->muted = TY_(MessageIsMuted)(doc, code);
 
     /* Things we create... */
 
-    va_copy(args_copy, args);
-    result->arguments = BuildArgArray(doc, tidyDefaultString(code), args_copy, &result->argcount);
-    va_end(args_copy);
-
-    result->messageKey = TY_(tidyErrorCodeAsKey)(code);
-
     result->messageFormatDefault = tidyDefaultString(code);
-    result->messageFormat = tidyLocalizedString(code);
+    result->messageFormat = TY_(tidyDocLocalizedString)(doc, code);
 
-    result->messageDefault = TidyDocAlloc(doc, sizeMessageBuf);
     va_copy(args_copy, args);
-    TY_(tmbvsnprintf)(result->messageDefault, sizeMessageBuf, result->messageFormatDefault, args_copy);
+    result->arguments = BuildArgArray(doc, doc->allocator, result->messageFormatDefault, args_copy, &result->argcount);
     va_end(args_copy);
 
-    result->message = TidyDocAlloc(doc, sizeMessageBuf);
-    va_copy(args_copy, args);
-    TY_(tmbvsnprintf)(result->message, sizeMessageBuf, result->messageFormat, args_copy);
-    va_end(args_copy);
-
-    result->messagePosDefault = TidyDocAlloc(doc, sizeMessageBuf);
-    result->messagePos = TidyDocAlloc(doc, sizeMessageBuf);
-
-    if ( cfgBool(doc, TidyEmacs) && cfgStr(doc, TidyEmacsFile) )
-    {
-        /* Change formatting to be parsable by GNU Emacs */
-        TY_(tmbsnprintf)(result->messagePosDefault, sizeMessageBuf, "%s:%d:%d: ", cfgStr(doc, TidyEmacsFile), line, column);
-        TY_(tmbsnprintf)(result->messagePos, sizeMessageBuf, "%s:%d:%d: ", cfgStr(doc, TidyEmacsFile), line, column);
-    }
-    else if ( cfgBool(doc, TidyShowFilename) && cfgStr(doc, TidyEmacsFile) )
-    {
-        /* Include filename in output */
-        TY_(tmbsnprintf)(result->messagePosDefault, sizeMessageBuf, tidyDefaultString(FN_LINE_COLUMN_STRING),
-            cfgStr(doc, TidyEmacsFile), line, column);
-        TY_(tmbsnprintf)(result->messagePos, sizeMessageBuf, tidyLocalizedString(FN_LINE_COLUMN_STRING),
-            cfgStr(doc, TidyEmacsFile), line, column);
-    }
-    else
-    {
-        /* traditional format */
-        TY_(tmbsnprintf)(result->messagePosDefault, sizeMessageBuf, tidyDefaultString(LINE_COLUMN_STRING), line, column);
-        TY_(tmbsnprintf)(result->messagePos, sizeMessageBuf, tidyLocalizedString(LINE_COLUMN_STRING), line, column);
-    }
-
     result->messagePrefixDefault = tidyDefaultString(level);
+    result->messagePrefix = TY_(tidyDocLocalizedString)(doc, level);
 
-    result->messagePrefix = tidyLocalizedString(level);
-
-    if ( line > 0 && column > 0 )
-        pattern = "%s%s%s";      /* pattern if there's location information */
-    else
-        pattern = "%.0s%s%s";    /* otherwise if there isn't */
-
-    if ( level > TidyFatal )
-        pattern = "%.0s%.0s%s";  /* dialog doesn't have pos or prefix */
-
-    result->messageOutputDefault = TidyDocAlloc(doc, sizeMessageBuf);
-    TY_(tmbsnprintf)(result->messageOutputDefault, sizeMessageBuf, pattern,
-                     result->messagePosDefault, result->messagePrefixDefault,
-                     result->messageDefault);
+    /* Should either format need more than the captured arguments can
+       give it, format the message now while the va_list is good. */
+    if ( !FormatFromArgArray(result->messageFormatDefault, result->arguments, result->argcount, NULL)
+         || !FormatFromArgArray(result->messageFormat, result->arguments, result->argcount, NULL) )
+    {
+        char buf[sizeMessageBuf];
 
-    result->messageOutput = TidyDocAlloc(doc, sizeMessageBuf);
-    TY_(tmbsnprintf)(result->messageOutput, sizeMessageBuf, pattern,
-                     result->messagePos, result->messagePrefix,
-                     result->message);
+        va_copy(args_copy, args);
+        TY_(tmbvsnprintf)(buf, sizeMessageBuf, result->messageFormatDefault, args_copy);
+        va_end(args_copy);
+        result->messageDefault = TY_(tmbstrdup)(doc->allocator, buf);
 
-    if ( ( cfgBool(doc, TidyMuteShow) == yes ) && level <= TidyFatal )
-    {
-        /*\ Issue #655 - Unsafe to use output buffer as one of the va_list
-         *  input parameters in some snprintf implmentations.
-        \*/
-        ctmbstr pc = TY_(tidyErrorCodeAsKey)(code);
-        i = TY_(tmbstrlen)(result->messageOutputDefault);
-        if (i < sizeMessageBuf)
-            TY_(tmbsnprintf)(result->messageOutputDefault + i, sizeMessageBuf - i, " (%s)", pc );
-        i = TY_(tmbstrlen)(result->messageOutput);
-        if (i < sizeMessageBuf)
-            TY_(tmbsnprintf)(result->messageOutput + i, sizeMessageBuf - i, " (%s)", pc );
-        i = 0;
+        va_copy(args_copy, args);
+        TY_(tmbvsnprintf)(buf, sizeMessageBuf, result->messageFormat, args_copy);
+        va_end(args_copy);
+        result->message = TY_(tmbstrdup)(doc->allocator, buf);
     }
 
     result->allowMessage = yes;
@@ -199,7 +226,7 @@ static TidyMessageImpl *tidyMessageCreateInitV( TidyDocImpl *doc,
        TidyDialogue messages.*/
     if ( (result->level <= TidyFatal) && doc->reportFilter )
     {
-        result->allowMessage = result->allowMessage & doc->reportFilter( tdoc, result->level, result->line, result->column, result->messageOutput );
+        result->allowMessage = result->allowMessage & doc->reportFilter( tdoc, result->level, result->line, result->column, TY_(getMessageOutput)(result) );
     }
 
     /* reportCallback is intended to allow LibTidy users to localize messages
@@ -209,7 +236,7 @@ static TidyMessageImpl *tidyMessageCreateInitV( TidyDocImpl *doc,
     {
         TidyDoc tdoc = tidyImplToDoc( doc );
         va_copy(args_copy, args);
-        result->allowMessage = result->allowMessage & doc->reportCallback( tdoc, result->level, result->line, result->column, result->messageKey, args_copy );
+        result->allowMessage = result->allowMessage & doc->reportCallback( tdoc, result->level, result->line, result->column, TY_(getMessageKey)(result), args_copy );
         va_end(args_copy);
     }
 
@@ -278,6 +305,16 @@ TidyMessageImpl *TY_(tidyMessageCreateWithLexer)( TidyDocImpl *doc,
 }
 
 
+/* Frees the strings the accessors built for a message. */
+static void FreeMessageStrings( TidyMessageImpl *message )
+{
+    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messagePosDefault );
+    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messagePos );
+    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messageOutputDefault );
+    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messageOutput );
+}
+
+
 void TY_(tidyMessageRelease)( TidyMessageImpl *message )
 {
     if ( !message )
@@ -285,103 +322,321 @@ void TY_(tidyMessageRelease)( TidyMessageImpl *message )
     TidyDocFree( tidyDocToImpl(message->tidyDoc), message->arguments );
     TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messageDefault );
     TidyDocFree( tidyDocToImpl(message->tidyDoc), message->message );
-    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messagePosDefault );
-    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messagePos );
-    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messageOutputDefault );
-    TidyDocFree( tidyDocToImpl(message->tidyDoc), message->messageOutput );
+    FreeMessageStrings( message );
     TidyDocFree(tidyDocToImpl(message->tidyDoc), message); /* Issue #597 - and discard the message structure */
 }
 
 
+/*********************************************************************
+ * Message Records
+ *********************************************************************/
+
+
+/* Frees what the record view built from its current record. The message
+   strings belong to the record when it had to preformat them. */
+static void ClearRecordView( TidyDocImpl *doc )
+{
+    TidyMessageRecords *records = &doc->messageRecords;
+    TidyMessageImpl *view = records->view;
+    const TidyMessageRecord *record;
+
+    if ( !view || records->viewed == 0 )
+        return;
+
+    record = &records->list[ records->viewed - 1 ];
+    if ( view->messageDefault != record->messageDefault )
+        TidyDocFree( doc, view->messageDefault );
+    if ( view->message != record->message )
+        TidyDocFree( doc, view->message );
+    FreeMessageStrings( view );
+    TidyClearMemory( view, sizeof(TidyMessageImpl) );
+    records->viewed = 0;
+}
+
+
+void TY_(SetMessageRecording)( TidyDocImpl* doc, Bool recording )
+{
+    if ( recording )
+        TY_(FreeMessageRecords)( doc );
+
+    doc->messageRecords.recording = recording;
+}
+
+
+void TY_(FreeMessageRecords)( TidyDocImpl* doc )
+{
+    TidyMessageRecords *records = &doc->messageRecords;
+
+    ClearRecordView( doc );
+    if ( records->view )
+        TidyDocFree( doc, records->view );
+    if ( records->list )
+        TidyDocFree( doc, records->list );
+    if ( records->arena )
+        TY_(FreeArena)( records->arena );
+
+    records->view = NULL;
+    records->list = NULL;
+    records->arena = NULL;
+    records->count = 0;
+    records->capacity = 0;
+    records->viewed = 0;
+}
+
+
+void TY_(ClearMessageRecords)( TidyDocImpl* doc )
+{
+    TidyMessageRecords *records = &doc->messageRecords;
+
+    ClearRecordView( doc );
+    if ( records->arena )
+        TY_(ResetArena)( records->arena );
+    records->count = 0;
+}
+
+
+TidyIterator TY_(getMessageRecords)( TidyDocImpl* doc )
+{
+    size_t result = doc->messageRecords.count > 0 ? 1 : 0;
+
+    return (TidyIterator) result;
+}
+
+
+TidyMessageImpl* TY_(getNextMessageRecord)( TidyDocImpl* doc, TidyIterator* iter )
+{
+    TidyMessageRecords *records = &doc->messageRecords;
+    const TidyMessageRecord *record;
+    TidyMessageImpl *view;
+    size_t index;
+
+    assert( iter != NULL );
+    index = (size_t)*iter;
+
+    if ( index == 0 || index > records->count )
+    {
+        *iter = (TidyIterator) (size_t)0;
+        return NULL;
+    }
+
+    ClearRecordView( doc );
+    records->viewed = (uint)index;
+    record = &records->list[ index - 1 ];
+    index++;
+    *iter = (TidyIterator) ( index <= records->count ? index : (size_t)0 );
+
+    if ( !records->view )
+    {
+        records->view = (TidyMessageImpl*)TidyDocAlloc( doc, sizeof(TidyMessageImpl) );
+        TidyClearMemory( records->view, sizeof(TidyMessageImpl) );
+    }
+
+    view = records->view;
+
+    /* The view has no node, as the node may be gone by now. */
+    view->tidyDoc = doc;
+    view->tidyNode = NULL;
+    view->code = record->code;
+    view->line = record->line;
+    view->column = record->column;
+    view->level = record->level;
+    view->allowMessage = yes;
+    view->muted = record->muted;
+    view->argcount = record->argcount;
+    view->arguments = record->arguments;
+    view->messageFormatDefault = tidyDefaultString(record->code);
+    view->messageFormat = record->messageFormat;
+    view->messageDefault = (tmbstr)record->messageDefault;
+    view->message = (tmbstr)record->message;
+    view->messagePrefixDefault = tidyDefaultString(record->level);
+    view->messagePrefix = TY_(tidyDocLocalizedString)(doc, record->level);
+
+    return view;
+}
+
+
 /*********************************************************************
  * Modern Message Callback Functions
  *********************************************************************/
 
 
-TidyDocImpl* TY_(getMessageDoc)( TidyMessageImpl message )
+TidyDocImpl* TY_(getMessageDoc)( TidyMessageImpl *message )
 {
-    return message.tidyDoc;
+    return message->tidyDoc;
 }
 
-uint TY_(getMessageCode)( TidyMessageImpl message )
+uint TY_(getMessageCode)( TidyMessageImpl *message )
 {
-    return message.code;
+    return message->code;
 }
 
-ctmbstr TY_(getMessageKey)( TidyMessageImpl message )
+ctmbstr TY_(getMessageKey)( TidyMessageImpl *message )
 {
-    return message.messageKey;
+    if ( !message->messageKey )
+        message->messageKey = TY_(tidyErrorCodeAsKey)(message->code);
+    return message->messageKey;
 }
 
-int TY_(getMessageLine)( TidyMessageImpl message )
+int TY_(getMessageLine)( TidyMessageImpl *message )
 {
-    return message.line;
+    return message->line;
 }
 
-int TY_(getMessageColumn)( TidyMessageImpl message )
+int TY_(getMessageColumn)( TidyMessageImpl *message )
 {
-    return message.column;
+    return message->column;
 }
 
-TidyReportLevel TY_(getMessageLevel)( TidyMessageImpl message )
+TidyReportLevel TY_(getMessageLevel)( TidyMessageImpl *message )
 {
-    return message.level;
+    return message->level;
 }
 
-Bool TY_(getMessageIsMuted)( TidyMessageImpl message )
+Bool TY_(getMessageIsMuted)( TidyMessageImpl *message )
 {
-    return message.muted;
+    return message->muted;
 }
 
-ctmbstr TY_(getMessageFormatDefault)( TidyMessageImpl message )
+ctmbstr TY_(getMessageFormatDefault)( TidyMessageImpl *message )
 {
-    return message.messageFormatDefault;
+    return message->messageFormatDefault;
 }
 
-ctmbstr TY_(getMessageFormat)( TidyMessageImpl message )
+ctmbstr TY_(getMessageFormat)( TidyMessageImpl *message )
 {
-    return message.messageFormat;
+    return message->messageFormat;
 }
 
-ctmbstr TY_(getMessageDefault)( TidyMessageImpl message )
+
+/* The message itself, formatted from `fmt` and the captured arguments. */
+static tmbstr buildMessage( TidyMessageImpl *message, ctmbstr fmt )
 {
-    return message.messageDefault;
+    char buf[sizeMessageBuf];
+
+    FormatFromArgArray( fmt, message->arguments, message->argcount, buf );
+    return TY_(tmbstrdup)( message->tidyDoc->allocator, buf );
 }
 
-ctmbstr TY_(getMessage)( TidyMessageImpl message )
+ctmbstr TY_(getMessageDefault)( TidyMessageImpl *message )
 {
-    return message.message;
+    if ( !message->messageDefault )
+        message->messageDefault = buildMessage( message, message->messageFormatDefault );
+    return message->messageDefault;
 }
 
-ctmbstr TY_(getMessagePosDefault)( TidyMessageImpl message )
+ctmbstr TY_(getMessage)( TidyMessageImpl *message )
 {
-    return message.messagePosDefault;
+    if ( !message->message )
+        message->message = buildMessage( message, message->messageFormat );
+    return message->message;
 }
 
-ctmbstr TY_(getMessagePos)( TidyMessageImpl message )
+
+/* The position part, in the built-in or the localized language. */
+static tmbstr buildMessagePos( TidyMessageImpl *message, Bool localized )
 {
-    return message.messagePos;
+    TidyDocImpl *doc = message->tidyDoc;
+    char buf[sizeMessageBuf];
+
+    if ( cfgBool(doc, TidyEmacs) && cfgStr(doc, TidyEmacsFile) )
+    {
+        /* Change formatting to be parsable by GNU Emacs */
+        TY_(tmbsnprintf)(buf, sizeMessageBuf, "%s:%d:%d: ", cfgStr(doc, TidyEmacsFile), message->line, message->column);
+    }
+    else if ( cfgBool(doc, TidyShowFilename) && cfgStr(doc, TidyEmacsFile) )
+    {
+        /* Include filename in output */
+        TY_(tmbsnprintf)(buf, sizeMessageBuf,
+                         localized ? TY_(tidyDocLocalizedString)(doc, FN_LINE_COLUMN_STRING) : tidyDefaultString(FN_LINE_COLUMN_STRING),
+                         cfgStr(doc, TidyEmacsFile), message->line, message->column);
+    }
+    else
+    {
+        /* traditional format */
+        TY_(tmbsnprintf)(buf, sizeMessageBuf,
+                         localized ? TY_(tidyDocLocalizedString)(doc, LINE_COLUMN_STRING) : tidyDefaultString(LINE_COLUMN_STRING),
+                         message->line, message->column);
+    }
+
+    return TY_(tmbstrdup)( doc->allocator, buf );
 }
 
-ctmbstr TY_(getMessagePrefixDefault)( TidyMessageImpl message )
+ctmbstr TY_(getMessagePosDefault)( TidyMessageImpl *message )
 {
-    return message.messagePrefixDefault;
+    if ( !message->messagePosDefault )
+        message->messagePosDefault = buildMessagePos( message, no );
+    return message->messagePosDefault;
 }
 
-ctmbstr TY_(getMessagePrefix)( TidyMessageImpl message )
+ctmbstr TY_(getMessagePos)( TidyMessageImpl *message )
 {
-    return message.messagePrefix;
+    if ( !message->messagePos )
+        message->messagePos = buildMessagePos( message, yes );
+    return message->messagePos;
 }
 
+ctmbstr TY_(getMessagePrefixDefault)( TidyMessageImpl *message )
+{
+    return message->messagePrefixDefault;
+}
 
-ctmbstr TY_(getMessageOutputDefault)( TidyMessageImpl message )
+ctmbstr TY_(getMessagePrefix)( TidyMessageImpl *message )
 {
-    return message.messageOutputDefault;
+    return message->messagePrefix;
+}
+
+
+/* The complete string Tidy would output, from its parts. */
+static tmbstr buildMessageOutput( TidyMessageImpl *message, ctmbstr pos,
+                                  ctmbstr prefix, ctmbstr text )
+{
+    TidyDocImpl *doc = message->tidyDoc;
+    char buf[sizeMessageBuf];
+    ctmbstr pattern;
+    uint i;
+
+    if ( message->line > 0 && message->column > 0 )
+        pattern = "%s%s%s";      /* pattern if there's location information */
+    else
+        pattern = "%.0s%s%s";    /* otherwise if there isn't */
+
+    if ( message->level > TidyFatal )
+        pattern = "%.0s%.0s%s";  /* dialog doesn't have pos or prefix */
+
+    TY_(tmbsnprintf)(buf, sizeMessageBuf, pattern, pos, prefix, text);
+
+    if ( ( cfgBool(doc, TidyMuteShow) == yes ) && message->level <= TidyFatal )
+    {
+        /*\ Issue #655 - Unsafe to use output buffer as one of the va_list
+         *  input parameters in some snprintf implmentations.
+        \*/
+        ctmbstr pc = TY_(getMessageKey)(message);
+        i = TY_(tmbstrlen)(buf);
+        if (i < sizeMessageBuf)
+            TY_(tmbsnprintf)(buf + i, sizeMessageBuf - i, " (%s)", pc );
+    }
+
+    return TY_(tmbstrdup)( doc->allocator, buf );
 }
 
-ctmbstr TY_(getMessageOutput)( TidyMessageImpl message )
+ctmbstr TY_(getMessageOutputDefault)( TidyMessageImpl *message )
 {
-    return message.messageOutput;
+    if ( !message->messageOutputDefault )
+        message->messageOutputDefault =
+            buildMessageOutput( message, TY_(getMessagePosDefault)(message),
+                                message->messagePrefixDefault,
+                                TY_(getMessageDefault)(message) );
+    return message->messageOutputDefault;
+}
+
+ctmbstr TY_(getMessageOutput)( TidyMessageImpl *message )
+{
+    if ( !message->messageOutput )
+        message->messageOutput =
+            buildMessageOutput( message, TY_(getMessagePos)(message),
+                                message->messagePrefix,
+                                TY_(getMessage)(message) );
+    return message->messageOutput;
 }
 
 
@@ -390,15 +645,15 @@ ctmbstr TY_(getMessageOutput)( TidyMessageImpl message )
  *********************************************************************/
 
 
-TidyIterator TY_(getMessageArguments)( TidyMessageImpl message )
+TidyIterator TY_(getMessageArguments)( TidyMessageImpl *message )
 {
-    if (message.argcount > 0)
+    if (message->argcount > 0)
         return (TidyIterator) (size_t)1;
     else
         return (TidyIterator) (size_t)0;
 }
 
-TidyMessageArgument TY_(getNextMessageArgument)( TidyMessageImpl message, TidyIterator* iter )
+TidyMessageArgument TY_(getNextMessageArgument)( TidyMessageImpl *message, TidyIterator* iter )
 {
     size_t item = 0;
     size_t itemIndex;
@@ -406,7 +661,7 @@ TidyMessageArgument TY_(getNextMessageArgument)( TidyMessageImpl message, TidyIt
     
     itemIndex = (size_t)*iter;
     
-    if ( itemIndex >= 1 && itemIndex <= (size_t)message.argcount )
+    if ( itemIndex >= 1 && itemIndex <= (size_t)message->argcount )
     {
         item = itemIndex;
         itemIndex++;
@@ -416,66 +671,66 @@ TidyMessageArgument TY_(getNextMessageArgument)( TidyMessageImpl message, TidyIt
        TidyMessageArgument is really just a dumb, zero-based index; however
        this type of iterator and opaque interrogation is simply how Tidy
        does things. */
-    *iter = (TidyIterator)( itemIndex <= (size_t)message.argcount ? itemIndex : (size_t)0 );
+    *iter = (TidyIterator)( itemIndex <= (size_t)message->argcount ? itemIndex : (size_t)0 );
     return (TidyMessageArgument)item;
 }
 
 
-TidyFormatParameterType TY_(getArgType)( TidyMessageImpl message, TidyMessageArgument* arg )
+TidyFormatParameterType TY_(getArgType)( TidyMessageImpl *message, TidyMessageArgument* arg )
 {
     int argNum = (int)(size_t)*arg - 1;
-    assert( argNum <= message.argcount );
+    assert( argNum <= message->argcount );
     
-    return message.arguments[argNum].type;
+    return message->arguments[argNum].type;
 }
 
 
-ctmbstr TY_(getArgFormat)( TidyMessageImpl message, TidyMessageArgument* arg )
+ctmbstr TY_(getArgFormat)( TidyMessageImpl *message, TidyMessageArgument* arg )
 {
     int argNum = (int)(size_t)*arg - 1;
-    assert( argNum <= message.argcount );
+    assert( argNum <= message->argcount );
     
-    return message.arguments[argNum].format;
+    return message->arguments[argNum].format;
 }
 
 
-ctmbstr TY_(getArgValueString)( TidyMessageImpl message, TidyMessageArgument* arg )
+ctmbstr TY_(getArgValueString)( TidyMessageImpl *message, TidyMessageArgument* arg )
 {
     int argNum = (int)(size_t)*arg - 1;
-    assert( argNum <= message.argcount );
-    assert( message.arguments[argNum].type == tidyFormatType_STRING);
+    assert( argNum <= message->argcount );
+    assert( message->arguments[argNum].type == tidyFormatType_STRING);
     
-    return message.arguments[argNum].u.s;
+    return message->arguments[argNum].u.s;
 }
 
 
-uint TY_(getArgValueUInt)( TidyMessageImpl message, TidyMessageArgument* arg )
+uint TY_(getArgValueUInt)( TidyMessageImpl *message, TidyMessageArgument* arg )
 {
     int argNum = (int)(size_t)*arg - 1;
-    assert( argNum <= message.argcount );
-    assert( message.arguments[argNum].type == tidyFormatType_UINT);
+    assert( argNum <= message->argcount );
+    assert( message->arguments[argNum].type == tidyFormatType_UINT);
 
-    return message.arguments[argNum].u.ui;
+    return message->arguments[argNum].u.ui;
 }
 
 
-int TY_(getArgValueInt)( TidyMessageImpl message, TidyMessageArgument* arg )
+int TY_(getArgValueInt)( TidyMessageImpl *message, TidyMessageArgument* arg )
 {
     int argNum = (int)(size_t)*arg - 1;
-    assert( argNum <= message.argcount );
-    assert( message.arguments[argNum].type == tidyFormatType_INT);
+    assert( argNum <= message->argcount );
+    assert( message->arguments[argNum].type == tidyFormatType_INT);
 
-    return message.arguments[argNum].u.i;
+    return message->arguments[argNum].u.i;
 }
 
 
-double TY_(getArgValueDouble)( TidyMessageImpl message, TidyMessageArgument* arg )
+double TY_(getArgValueDouble)( TidyMessageImpl *message, TidyMessageArgument* arg )
 {
     int argNum = (int)(size_t)*arg - 1;
-    assert( argNum <= message.argcount );
-    assert( message.arguments[argNum].type == tidyFormatType_DOUBLE);
+    assert( argNum <= message->argcount );
+    assert( message->arguments[argNum].type == tidyFormatType_DOUBLE);
     
-    return message.arguments[argNum].u.d;
+    return message->arguments[argNum].u.d;
 }
 
 
@@ -487,20 +742,23 @@ double TY_(getArgValueDouble)( TidyMessageImpl message, TidyMessageArgument* arg
  *********************************************************************/
 
 
-/** Returns a pointer to an allocated array of `printfArg` given a format
- ** string and a va_list, or NULL if not successful or no parameters were
- ** given. Parameter `rv` will return with the count of zero or more
- ** parameters if successful, else -1.
+/** Returns a pointer to an array of `printfArg` allocated from `allocator`
+ ** given a format string and a va_list, or NULL if not successful or no
+ ** parameters were given. Parameter `rv` will return with the count of zero
+ ** or more parameters if successful, else -1.
  **
- ** We'll also be sure to use the document's allocator if specified, thus
- ** the requirement to pass in a TidyDocImpl.
+ ** The array is parsed into scratch space from the document's allocator,
+ ** or the stack for the usual handful of arguments, and then allocated
+ ** once at its final size, so that `allocator` may be an arena.
  **
  ** Currently Tidy only uses %c, %d, %s, %u, %X, although doubles are
  ** supported as well. Unsupported arguments will result in failure as
  ** described above.
  */
-static struct printfArg* BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list ap, int* rv )
+static struct printfArg* BuildArgArray( TidyDocImpl *doc, TidyAllocator *allocator, ctmbstr fmt, va_list ap, int* rv )
 {
+    enum { localArgs = 8 };
+    struct printfArg local[localArgs];
     int number = 0; /* the quantity of valid arguments found; returned as rv. */
     int cn = -1;    /* keeps track of which parameter index is current. */
     int i = 0;      /* typical index. */
@@ -508,6 +766,9 @@ static struct printfArg* BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list a
     const char* p;  /* current position in format string. */
     char c;         /* current character. */
     struct printfArg* nas;
+    struct printfArg* result;
+    size_t size;    /* the array and copies of its strings. */
+    tmbstr strings;
     
     /* first pass: determine number of valid % to allocate space. */
     
@@ -530,7 +791,10 @@ static struct printfArg* BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list a
         return NULL;
 
     
-    nas = (struct printfArg*)TidyDocAlloc( doc, number * sizeof( struct printfArg ) );
+    if ( number <= localArgs )
+        nas = local;
+    else
+        nas = (struct printfArg*)TidyDocAlloc( doc, number * sizeof( struct printfArg ) );
     if( !nas )
     {
         *rv = -1;
@@ -643,6 +907,7 @@ static struct printfArg* BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list a
         else
         {
             strncpy(nas[cn].format, fmt + nas[cn].formatStart, nas[cn].formatLength);
+            nas[cn].format[nas[cn].formatLength] = '\0';
         }
         
 
@@ -659,11 +924,156 @@ static struct printfArg* BuildArgArray( TidyDocImpl *doc, ctmbstr fmt, va_list a
     
     if( *rv < 0 )
     {
-        TidyDocFree( doc, nas );;
+        if ( nas != local )
+            TidyDocFree( doc, nas );
         return NULL;
     }
 
+    /* The strings often live in the caller's buffers, and the message is
+       formatted later, so keep copies of them after the array itself. */
+    for( i = 0, size = number * sizeof( struct printfArg ); i < number; i++ )
+    {
+        if ( nas[i].type == tidyFormatType_STRING && nas[i].u.s )
+            size += TY_(tmbstrlen)( nas[i].u.s ) + 1;
+    }
+
+    result = (struct printfArg*)TidyAlloc( allocator, size );
+    memcpy( result, nas, number * sizeof( struct printfArg ) );
+    strings = (tmbstr)( result + number );
+    for( i = 0; i < number; i++ )
+    {
+        if ( result[i].type == tidyFormatType_STRING && result[i].u.s )
+        {
+            TY_(tmbstrcpy)( strings, result[i].u.s );
+            result[i].u.s = strings;
+            strings += TY_(tmbstrlen)( strings ) + 1;
+        }
+    }
+
+    if ( nas != local )
+        TidyDocFree( doc, nas );
+
     *rv = number;
-    return nas;
+    return result;
+}
+
+
+/** Appends one conversion, `spec`, of `arg` to the `*len` characters of
+ ** `buf`, keeping to the `limit` characters TY_(tmbvsnprintf) leaves in
+ ** a buffer of sizeMessageBuf. Returns no if the conversion produced a
+ ** NUL, which ends the string just as it did when formatted whole.
+ */
+static Bool AppendArg( tmbstr buf, uint *len, uint limit, ctmbstr spec,
+                       const struct printfArg *arg )
+{
+    uint avail = limit - *len;
+    int want = 0;
+
+    if ( avail == 0 )
+        return yes;
+
+    /* TY_(tmbsnprintf) keeps count - 2 characters */
+    switch ( arg->type )
+    {
+        case tidyFormatType_INT:
+            want = TY_(tmbsnprintf)( buf + *len, avail + 2, spec, arg->u.i );
+            break;
+        case tidyFormatType_UINT:
+            want = TY_(tmbsnprintf)( buf + *len, avail + 2, spec, arg->u.ui );
+            break;
+        case tidyFormatType_STRING:
+            want = TY_(tmbsnprintf)( buf + *len, avail + 2, spec, arg->u.s );
+            break;
+        case tidyFormatType_DOUBLE:
+            want = TY_(tmbsnprintf)( buf + *len, avail + 2, spec, arg->u.d );
+            break;
+        default:
+            break;
+    }
+
+    avail = TY_(tmbstrlen)( buf + *len );
+    *len += avail;
+    return ( want <= 0 || (uint)want <= avail || *len == limit );
+}
+
+
+/** Formats `fmt` piece by piece from the captured arguments; see the
+ ** declaration above. Conversions are parsed as BuildArgArray parses
+ ** them, and each must ask for the type that was captured for its
+ ** position. A translation may use fewer arguments than the built-in
+ ** string, but not more.
+ */
+static Bool FormatFromArgArray( ctmbstr fmt, const struct printfArg *args, int argcount, tmbstr buf )
+{
+    const uint limit = sizeMessageBuf - 2;
+    char spec[FORMAT_LENGTH];
+    TidyFormatParameterType type;
+    ctmbstr p = fmt, start;
+    uint len = 0;
+    int cn = 0;
+    char c;
+
+    if ( !fmt || argcount < 0 )
+        return no;
+
+    while ( ( c = *p++ ) != 0 )
+    {
+        if ( c != '%' || *p == '%' )
+        {
+            if ( c == '%' )
+                p++;  /* %% */
+            if ( buf && len < limit )
+                buf[len++] = c;
+            continue;
+        }
+
+        start = p - 1;
+        c = *p++;
+        while ( c >= '0' && c <= '9' )
+            c = *p++;
+        if ( c == '.' )
+        {
+            c = *p++;
+            while ( c >= '0' && c <= '9' )
+                c = *p++;
+        }
+
+        switch ( c )
+        {
+            case 'c': case 'u': case 'X': case 'x': case 'o':
+                type = tidyFormatType_UINT;
+                break;
+            case 'd': case 'i':
+                type = tidyFormatType_INT;
+                break;
+            case 's':
+                type = tidyFormatType_STRING;
+                break;
+            case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+                type = tidyFormatType_DOUBLE;
+                break;
+            default:
+                return no;
+        }
+
+        if ( cn >= argcount || args[cn].type != type || p - start >= FORMAT_LENGTH )
+            return no;
+
+        if ( buf )
+        {
+            memcpy( spec, start, p - start );
+            spec[p - start] = '\0';
+            if ( !AppendArg( buf, &len, limit, spec, &args[cn] ) )
+            {
+                buf = NULL;  /* the string ended inside the conversion */
+                len = 0;
+            }
+        }
+        cn++;
+    }
+
+    if ( buf )
+        buf[len] = '\0';
+    return yes;
 }
 
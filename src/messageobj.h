@@ -28,6 +28,9 @@
 
 /** Creates a TidyMessageImpl, but without line numbers, such as used for
  ** information report output.
+ **
+ ** These creators return NULL for a message that the configuration hides
+ ** and no callback would see; such a message is only counted.
  */
 TidyMessageImpl *TY_(tidyMessageCreate)( TidyDocImpl *doc,
                                          uint code,
@@ -63,55 +66,55 @@ void TY_(tidyMessageRelease)( TidyMessageImpl *message );
 
 
 /** get the document the message came from. */
-TidyDocImpl* TY_(getMessageDoc)( TidyMessageImpl message );
+TidyDocImpl* TY_(getMessageDoc)( TidyMessageImpl *message );
 
 /** get the message key code. */
-uint TY_(getMessageCode)( TidyMessageImpl message );
+uint TY_(getMessageCode)( TidyMessageImpl *message );
 
 /** get the message key string. */
-ctmbstr TY_(getMessageKey)( TidyMessageImpl message );
+ctmbstr TY_(getMessageKey)( TidyMessageImpl *message );
 
 /** get the line number the message applies to. */
-int TY_(getMessageLine)( TidyMessageImpl message );
+int TY_(getMessageLine)( TidyMessageImpl *message );
 
 /** get the column the message applies to. */
-int TY_(getMessageColumn)( TidyMessageImpl message );
+int TY_(getMessageColumn)( TidyMessageImpl *message );
 
 /** get the TidyReportLevel of the message. */
-TidyReportLevel TY_(getMessageLevel)( TidyMessageImpl message );
+TidyReportLevel TY_(getMessageLevel)( TidyMessageImpl *message );
 
 /** get whether or not the message was muted by the configuration. */
-Bool TY_(getMessageIsMuted)( TidyMessageImpl message );
+Bool TY_(getMessageIsMuted)( TidyMessageImpl *message );
 
 /** the built-in format string */
-ctmbstr TY_(getMessageFormatDefault)( TidyMessageImpl message );
+ctmbstr TY_(getMessageFormatDefault)( TidyMessageImpl *message );
 
 /** the localized format string */
-ctmbstr TY_(getMessageFormat)( TidyMessageImpl message );
+ctmbstr TY_(getMessageFormat)( TidyMessageImpl *message );
 
 /** the message, formatted, default language */
-ctmbstr TY_(getMessageDefault)( TidyMessageImpl message );
+ctmbstr TY_(getMessageDefault)( TidyMessageImpl *message );
 
 /** the message, formatted, localized */
-ctmbstr TY_(getMessage)( TidyMessageImpl message );
+ctmbstr TY_(getMessage)( TidyMessageImpl *message );
 
 /** the position part, default language */
-ctmbstr TY_(getMessagePosDefault)( TidyMessageImpl message );
+ctmbstr TY_(getMessagePosDefault)( TidyMessageImpl *message );
 
 /** the position part, localized */
-ctmbstr TY_(getMessagePos)( TidyMessageImpl message );
+ctmbstr TY_(getMessagePos)( TidyMessageImpl *message );
 
 /** the prefix part, default language */
-ctmbstr TY_(getMessagePrefixDefault)( TidyMessageImpl message );
+ctmbstr TY_(getMessagePrefixDefault)( TidyMessageImpl *message );
 
 /** the prefix part, localized */
-ctmbstr TY_(getMessagePrefix)( TidyMessageImpl message );
+ctmbstr TY_(getMessagePrefix)( TidyMessageImpl *message );
 
 /** the complete message, as would be output in the CLI */
-ctmbstr TY_(getMessageOutputDefault)( TidyMessageImpl message );
+ctmbstr TY_(getMessageOutputDefault)( TidyMessageImpl *message );
 
 /* the complete message, as would be output in the CLI, localized */
-ctmbstr TY_(getMessageOutput)( TidyMessageImpl message );
+ctmbstr TY_(getMessageOutput)( TidyMessageImpl *message );
 
 
 /** @} end messageobj_message_api group */
@@ -123,19 +126,19 @@ ctmbstr TY_(getMessageOutput)( TidyMessageImpl message );
  *  argument. Use `TY_(getNextMEssageArgument)` to get an opaque instance of
  *  `TidyMessageArgument` for which the subsequent interrogators will be of use.
  */
-TidyIterator TY_(getMessageArguments)( TidyMessageImpl message );
+TidyIterator TY_(getMessageArguments)( TidyMessageImpl *message );
 
 /**
  *  Returns the next `TidyMessageArgument`, for the given message, which can
  *  then be interrogated with the API, and advances the iterator.
  */
-TidyMessageArgument TY_(getNextMessageArgument)( TidyMessageImpl message, TidyIterator* iter );
+TidyMessageArgument TY_(getNextMessageArgument)( TidyMessageImpl *message, TidyIterator* iter );
 
 
 /**
  *  Returns the `TidyFormatParameterType` of the given message argument.
  */
-TidyFormatParameterType TY_(getArgType)( TidyMessageImpl message, TidyMessageArgument* arg );
+TidyFormatParameterType TY_(getArgType)( TidyMessageImpl *message, TidyMessageArgument* arg );
 
 
 /**
@@ -143,14 +146,14 @@ TidyFormatParameterType TY_(getArgType)( TidyMessageImpl message, TidyMessageArg
  *  this string is cleared upon termination of the callback, so do be sure to
  *  make your own copy.
  */
-ctmbstr TY_(getArgFormat)( TidyMessageImpl message, TidyMessageArgument* arg );
+ctmbstr TY_(getArgFormat)( TidyMessageImpl *message, TidyMessageArgument* arg );
 
 
 /**
  *  Returns the string value of the given message argument. An assertion
  *  will be generated if the argument type is not a string.
  */
-ctmbstr TY_(getArgValueString)( TidyMessageImpl message, TidyMessageArgument* arg );
+ctmbstr TY_(getArgValueString)( TidyMessageImpl *message, TidyMessageArgument* arg );
 
 
 /**
@@ -158,24 +161,82 @@ ctmbstr TY_(getArgValueString)( TidyMessageImpl message, TidyMessageArgument* ar
  *  assertion will be generated if the argument type is not an unsigned
  *  integer.
  */
-uint TY_(getArgValueUInt)( TidyMessageImpl message, TidyMessageArgument* arg );
+uint TY_(getArgValueUInt)( TidyMessageImpl *message, TidyMessageArgument* arg );
 
 
 /**
  *  Returns the integer value of the given message argument. An assertion
  *  will be generated if the argument type is not an integer.
  */
-int TY_(getArgValueInt)( TidyMessageImpl message, TidyMessageArgument* arg );
+int TY_(getArgValueInt)( TidyMessageImpl *message, TidyMessageArgument* arg );
 
 
 /**
  *  Returns the double value of the given message argument. An assertion
  *  will be generated if the argument type is not a double.
  */
-double TY_(getArgValueDouble)( TidyMessageImpl message, TidyMessageArgument* arg );
+double TY_(getArgValueDouble)( TidyMessageImpl *message, TidyMessageArgument* arg );
 
 
 /** @} end messageobj_args_api group */
+/** @defgroup messageobj_records Message Records */
+/** @{ */
+
+
+/** A message kept as data while the document records its messages, in
+ ** place of a TidyMessageImpl; the strings are only formatted when the
+ ** record is read back.
+ */
+typedef struct _TidyMessageRecord {
+    uint                code;           /**< the message code */
+    int                 line;           /**< the line message applies to */
+    int                 column;         /**< the column the message applies to */
+    TidyReportLevel     level;          /**< the severity level of the message */
+    Bool                muted;          /**< whether the configuration mutes it */
+    int                 argcount;       /**< the number of arguments */
+    struct printfArg*   arguments;      /**< the arguments, in the arena */
+    ctmbstr             messageFormat;  /**< the localized format when recorded */
+    ctmbstr             messageDefault; /**< preformatted only when the arguments can't be used */
+    ctmbstr             message;        /**< preformatted only when the arguments can't be used */
+} TidyMessageRecord;
+
+
+/** The document's record of its messages. */
+typedef struct _TidyMessageRecords {
+    Bool                recording;      /**< whether messages are being recorded */
+    TidyMessageRecord*  list;           /**< the records, in the order reported */
+    uint                count;          /**< current count of the list */
+    uint                capacity;       /**< current capacity of the list */
+    TidyAllocator*      arena;          /**< holds the records' arguments */
+    TidyMessageImpl*    view;           /**< the record last read back */
+    uint                viewed;         /**< its index in the list plus one, or 0 */
+} TidyMessageRecords;
+
+
+/** Starts or stops recording messages. Starting discards any records that
+ ** were kept before.
+ */
+void TY_(SetMessageRecording)( TidyDocImpl* doc, Bool recording );
+
+/** Frees all of the document's message records. */
+void TY_(FreeMessageRecords)( TidyDocImpl* doc );
+
+/** Discards the document's message records, keeping their storage for
+ ** the records of the next document.
+ */
+void TY_(ClearMessageRecords)( TidyDocImpl* doc );
+
+/** Initializes the TidyIterator to point to the first message record. */
+TidyIterator TY_(getMessageRecords)( TidyDocImpl* doc );
+
+/** Returns the next message record as a message that can be interrogated
+ ** with the API above, and advances the iterator. The message remains
+ ** valid until the next record is read.
+ */
+TidyMessageImpl* TY_(getNextMessageRecord)( TidyDocImpl* doc, TidyIterator* iter );
+
+
+/** @} end messageobj_records group */
 /** @} end internal_api group */
 
 #endif /* messageobj_h */
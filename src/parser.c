@@ -18,7 +18,7 @@
   Issue #72 - Need to know to avoid error-reporting - no warning only if --show-body-only yes
   Issue #132 - likewise avoid warning if showing body only
  */
-#define showingBodyOnly(doc) (cfgAutoBool(doc,TidyBodyOnly) == TidyYesState) ? yes : no
+#define showingBodyOnly(doc) ((doc)->lexer->parseOpts.showBodyOnly)
 
 
 Bool TY_(CheckNodeIntegrity)(Node *node)
@@ -72,7 +72,7 @@ Bool TY_(IsNewNode)(Node *node)
 
 void TY_(CoerceNode)(TidyDocImpl* doc, Node *node, TidyTagId tid, Bool obsolete, Bool unexpected)
 {
-    const Dict* tag = TY_(LookupTagDef)(tid);
+    const Dict* tag = TY_(LookupTagDef)(doc, tid);
     Node* tmp = TY_(InferredTag)(doc, tag->id);
 
     if (obsolete)
@@ -82,15 +82,13 @@ void TY_(CoerceNode)(TidyDocImpl* doc, Node *node, TidyTagId tid, Bool obsolete,
     else
         TY_(Report)(doc, node, tmp, REPLACING_ELEMENT);
 
-    TidyDocFree(doc, tmp->element);
-    TidyDocFree(doc, tmp);
+    TidyFree(TidyDocNodeAllocator(doc), tmp);
 
-    node->was = node->tag;
+    TY_(SetNodeWas)( doc, node, node->tag );
     node->tag = tag;
     node->type = StartTag;
     node->implicit = yes;
-    TidyDocFree(doc, node->element);
-    node->element = TY_(tmbstrdup)(doc->allocator, tag->name);
+    node->element = TY_(InternName)(doc, tag->name);
 }
 
 /* extract a node and its children from a markup tree */
@@ -393,7 +391,7 @@ static void TrimTrailingSpace( TidyDocImpl* doc, Node *element, Node *last )
     {
         if (last->end > last->start)
         {
-            c = (byte) lexer->lexbuf[ last->end - 1 ];
+            c = (byte) NodeTextBuf(lexer, last)[ last->end - 1 ];
 
             if ( c == ' ' )
             {
@@ -413,7 +411,7 @@ Bool TY_(IsBlank)(Lexer *lexer, Node *node)
     if ( isBlank )
         isBlank = ( node->end == node->start ||       /* Zero length */
                     ( node->end == node->start+1      /* or one blank. */
-                      && lexer->lexbuf[node->start] == ' ' ) );
+                      && NodeTextBuf(lexer, node)[node->start] == ' ' ) );
     return isBlank;
 }
 
@@ -433,7 +431,7 @@ static void TrimInitialSpace( TidyDocImpl* doc, Node *element, Node *text )
     Node *prev, *node;
 
     if ( TY_(nodeIsText)(text) && 
-         lexer->lexbuf[text->start] == ' ' && 
+         NodeTextBuf(lexer, text)[text->start] == ' ' && 
          text->start < text->end )
     {
         if ( (element->tag->model & CM_INLINE) &&
@@ -443,17 +441,18 @@ static void TrimInitialSpace( TidyDocImpl* doc, Node *element, Node *text )
 
             if (TY_(nodeIsText)(prev))
             {
-                if (prev->end == 0 || lexer->lexbuf[prev->end - 1] != ' ')
-                    lexer->lexbuf[(prev->end)++] = ' ';
+                if (prev->end == 0 || NodeTextBuf(lexer, prev)[prev->end - 1] != ' ')
+                    TY_(AppendToText)( lexer, prev, ' ' );
 
                 ++(element->start);
             }
             else /* create new node */
             {
-                node = TY_(NewNode)(lexer->allocator, lexer);
-                node->start = (element->start)++;
-                node->end = element->start;
-                lexer->lexbuf[node->start] = ' ';
+                node = TY_(NewNode)(lexer->nodeAllocator, lexer);
+                node->start = lexer->lexsize;
+                TY_(AddCharToLexer)( lexer, ' ' );
+                node->end = lexer->lexsize;
+                ++(element->start);
                 TY_(InsertNodeBeforeElement)(element ,node);
                 DEBUG_LOG(SPRTF("TrimInitialSpace: Created text node, inserted before <%s>\n",
                     (element->element ? element->element : "unknown")));
@@ -525,7 +524,7 @@ static Bool CleanTrailingWhitespace(TidyDocImpl* doc, Node* node)
 
     /* evil adjacent text nodes, Tidy should not generate these :-( */
     if (TY_(nodeIsText)(next) && next->start < next->end
-        && TY_(IsWhite)(doc->lexer->lexbuf[next->start]))
+        && TY_(IsWhite)(NodeTextBuf(doc->lexer, next)[next->start]))
         return yes;
 
     return no;
@@ -574,11 +573,11 @@ static void CleanSpaces(TidyDocImpl* doc, Node* node)
         next = node->next;
 
         if (TY_(nodeIsText)(node) && CleanLeadingWhitespace(doc, node))
-            while (node->start < node->end && TY_(IsWhite)(doc->lexer->lexbuf[node->start]))
+            while (node->start < node->end && TY_(IsWhite)(NodeTextBuf(doc->lexer, node)[node->start]))
                 ++(node->start);
 
         if (TY_(nodeIsText)(node) && CleanTrailingWhitespace(doc, node))
-            while (node->end > node->start && TY_(IsWhite)(doc->lexer->lexbuf[node->end - 1]))
+            while (node->end > node->start && TY_(IsWhite)(NodeTextBuf(doc->lexer, node)[node->end - 1]))
                 --(node->end);
 
         if (TY_(nodeIsText)(node) && !(node->start < node->end))
@@ -860,7 +859,7 @@ void TY_(ParseBlock)( TidyDocImpl* doc, Node *element, GetTokenMode mode)
     {
         /* end tag for this element */
         if (node->type == EndTag && node->tag &&
-            (node->tag == element->tag || element->was == node->tag))
+            (node->tag == element->tag || TY_(NodeWas)(doc, element) == node->tag))
         {
             TY_(FreeNode)( doc, node );
 
@@ -1148,9 +1147,8 @@ void TY_(ParseBlock)( TidyDocImpl* doc, Node *element, GetTokenMode mode)
                         TY_(Report)(doc, element, node, DISCARDING_UNEXPECTED );
                         TY_(FreeNode)( doc, node );
                         node = element->parent;
-                        TidyDocFree(doc, node->element);
-                        node->element = TY_(tmbstrdup)(doc->allocator, "th");
-                        node->tag = TY_(LookupTagDef)( TidyTag_TH );
+                        node->element = TY_(InternName)(doc, "th");
+                        node->tag = TY_(LookupTagDef)( doc, TidyTag_TH );
                         continue;
                     }
                 }
@@ -1159,7 +1157,7 @@ void TY_(ParseBlock)( TidyDocImpl* doc, Node *element, GetTokenMode mode)
                     TY_(Report)(doc, element, node, MISSING_ENDTAG_BEFORE );
                 
                 /* #521, warn on missing optional end-tags if not omitting them. */
-                if ( cfgBool( doc, TidyOmitOptionalTags ) == no && TY_(nodeHasCM)(element, CM_OPT) )
+                if ( !doc->lexer->parseOpts.omitOptionalTags && TY_(nodeHasCM)(element, CM_OPT) )
                     TY_(Report)(doc, element, node, MISSING_ENDTAG_OPTIONAL );
 
 
@@ -1246,7 +1244,7 @@ void TY_(ParseBlock)( TidyDocImpl* doc, Node *element, GetTokenMode mode)
              (nodeIsA(element) || DescendantOf(element, TidyTag_A)) )
         {
             if (node->type != EndTag && node->attributes == NULL
-                && cfgBool(doc, TidyCoerceEndTags) )
+                && doc->lexer->parseOpts.coerceEndTags )
             {
                 node->type = EndTag;
                 TY_(Report)(doc, element, node, COERCE_TO_ENDTAG);
@@ -1368,7 +1366,7 @@ static NodeTraversalSignal FindDescendant_cb(TidyDocImpl* ARG_UNUSED(doc), Node*
             (node->element != NULL &&
             cb_data->node_to_find != NULL &&
             cb_data->node_to_find->element != NULL &&
-            0 == TY_(tmbstrcmp)(cb_data->node_to_find->element, node->element)))
+            cb_data->node_to_find->element == node->element))
         {
             cb_data->found_node = node;
             return ExitTraversal;
@@ -1656,7 +1654,7 @@ void TY_(ParseInline)( TidyDocImpl* doc, Node *element, GetTokenMode mode )
              && !nodeIsSUP(node)
              && !nodeIsQ(node)
              && !nodeIsSPAN(node)
-             && cfgBool(doc, TidyCoerceEndTags)
+             && doc->lexer->parseOpts.coerceEndTags
            )
         {
             /* proceeds only if "node" does not have any attribute and
@@ -1738,9 +1736,8 @@ void TY_(ParseInline)( TidyDocImpl* doc, Node *element, GetTokenMode mode )
              )
            )
         {
-            node->tag = TY_(LookupTagDef)( TidyTag_BR );
-            TidyDocFree(doc, node->element);
-            node->element = TY_(tmbstrdup)(doc->allocator, "br");
+            node->tag = TY_(LookupTagDef)( doc, TidyTag_BR );
+            node->element = TY_(InternName)(doc, "br");
             TrimSpaces(doc, element);
             TY_(InsertNodeAtEnd)(element, node);
             continue;
@@ -1900,7 +1897,7 @@ void TY_(ParseInline)( TidyDocImpl* doc, Node *element, GetTokenMode mode )
             /* other fixes by Dave Raggett */
             /* if (node->attributes == NULL) */
             if (node->type != EndTag && node->attributes == NULL
-                && cfgBool(doc, TidyCoerceEndTags) )
+                && doc->lexer->parseOpts.coerceEndTags )
             {
                 node->type = EndTag;
                 TY_(Report)(doc, element, node, COERCE_TO_ENDTAG);
@@ -2376,7 +2373,7 @@ void TY_(ParseList)(TidyDocImpl* doc, Node *list, GetTokenMode ARG_UNUSED(mode))
         {
             uint ch, ix = node->start;
             /* Issue #572 - Skip whitespace. */
-            while (ix < node->end && (ch = (lexer->lexbuf[ix] & 0xff))
+            while (ix < node->end && (ch = (NodeTextBuf(lexer, node)[ix] & 0xff))
                 && (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'))
                 ++ix;
             if (ix >= node->end)
@@ -3504,7 +3501,7 @@ void TY_(ParseTitle)(TidyDocImpl* doc, Node *title, GetTokenMode ARG_UNUSED(mode
     while ((node = TY_(GetToken)(doc, MixedContent)) != NULL)
     {
         if (node->tag == title->tag && node->type == StartTag
-            && cfgBool(doc, TidyCoerceEndTags) )
+            && doc->lexer->parseOpts.coerceEndTags )
         {
             TY_(Report)(doc, title, node, COERCE_TO_ENDTAG);
             node->type = EndTag;
@@ -3652,7 +3649,7 @@ void TY_(ParseHead)(TidyDocImpl* doc, Node *head, GetTokenMode ARG_UNUSED(mode))
              *  if configured to --omit-otpional-tags yes
              *  Issue #314 - and if --show-body-only
             \*/
-            if (!cfgBool( doc, TidyOmitOptionalTags ) &&
+            if (!doc->lexer->parseOpts.omitOptionalTags &&
                 !showingBodyOnly(doc) )
             {
                 TY_(Report)(doc, head, node, TAG_NOT_ALLOWED_IN);
@@ -3860,7 +3857,7 @@ void TY_(ParseBody)(TidyDocImpl* doc, Node *body, GetTokenMode mode)
 
         if ( TY_(nodeIsText)(node) &&
              node->end <= node->start + 1 &&
-             lexer->lexbuf[node->start] == ' ' )
+             NodeTextBuf(lexer, node)[node->start] == ' ' )
             iswhitenode = yes;
 
         /* deal with comments etc. */
@@ -4239,6 +4236,7 @@ void TY_(ParseHTML)(TidyDocImpl* doc, Node *html, GetTokenMode mode)
 
     DEBUG_LOG(SPRTF("Entering ParseHTML...\n"));
     TY_(SetOptionBool)( doc, TidyXmlTags, no );
+    TY_(ResolveLexerOptions)( doc );
 
     for (;;)
     {
@@ -4596,6 +4594,15 @@ static void AttributeChecks(TidyDocImpl* doc, Node* node)
     }
 }
 
+void TY_(ResolveParserOptions)( TidyDocImpl* doc )
+{
+    ParserOptions* opts = &doc->lexer->parseOpts;
+
+    opts->coerceEndTags = cfgBool( doc, TidyCoerceEndTags );
+    opts->omitOptionalTags = cfgBool( doc, TidyOmitOptionalTags );
+    opts->showBodyOnly = ( cfgAutoBool(doc, TidyBodyOnly) == TidyYesState );
+}
+
 /*
   HTML is the top level element
 */
@@ -4665,6 +4672,7 @@ void TY_(ParseDocument)(TidyDocImpl* doc)
                 {
                     TY_(SetOptionBool)( doc, TidyUpperCaseTags, no );
                     TY_(SetOptionInt)( doc, TidyUpperCaseAttrs, no );
+                    TY_(ResolveLexerOptions)( doc );
                 }
             }
         }
@@ -4784,8 +4792,7 @@ static void ParseXMLElement(TidyDocImpl* doc, Node *element, GetTokenMode mode)
     while ((node = TY_(GetToken)(doc, mode)) != NULL)
     {
         if (node->type == EndTag &&
-           node->element && element->element &&
-           TY_(tmbstrcmp)(node->element, element->element) == 0)
+           node->element && node->element == element->element)
         {
             TY_(FreeNode)( doc, node);
             element->closed = yes;
@@ -4820,7 +4827,7 @@ static void ParseXMLElement(TidyDocImpl* doc, Node *element, GetTokenMode mode)
 
     if (TY_(nodeIsText)(node) && mode != Preformatted)
     {
-        if ( lexer->lexbuf[node->start] == ' ' )
+        if ( NodeTextBuf(lexer, node)[node->start] == ' ' )
         {
             node->start++;
 
@@ -4838,7 +4845,7 @@ static void ParseXMLElement(TidyDocImpl* doc, Node *element, GetTokenMode mode)
 
     if (TY_(nodeIsText)(node) && mode != Preformatted)
     {
-        if ( lexer->lexbuf[node->end - 1] == ' ' )
+        if ( NodeTextBuf(lexer, node)[node->end - 1] == ' ' )
         {
             node->end--;
 
@@ -4853,6 +4860,7 @@ void TY_(ParseXMLDocument)(TidyDocImpl* doc)
     Node *node, *doctype = NULL;
 
     TY_(SetOptionBool)( doc, TidyXmlTags, yes );
+    TY_(ResolveLexerOptions)( doc );
 
     doc->xmlDetected = yes;
 
@@ -172,6 +172,14 @@ Bool TY_(IsBlank)(Lexer *lexer, Node *node);
 Bool TY_(IsJavaScript)(Node *node);
 
 
+/**
+ *  Copies the options in ParserOptions out of the configuration. This is
+ *  done when a parse starts.
+ *  @param doc The Tidy document.
+ */
+void TY_(ResolveParserOptions)( TidyDocImpl* doc );
+
+
 /**
  *  Parses a document after lexing using the HTML parser. It begins by properly
  *  configuring the overall HTML structure, and subsequently processes all
@@ -46,22 +46,21 @@ static Bool ShouldIndent( TidyDocImpl* doc, Node *node );
 /*\
  * Issue #228 20150715 - macros to access --vertical-space tri state configuration parameter
 \*/
-#define TidyClassicVS ((cfgAutoBool( doc, TidyVertSpace ) == TidyYesState) ? yes : no)
-#define TidyAddVS ((cfgAutoBool( doc, TidyVertSpace ) == TidyAutoState) ? no : yes )
+#define TidyClassicVS ((doc->pprint.opts.vertSpace == TidyYesState) ? yes : no)
+#define TidyAddVS ((doc->pprint.opts.vertSpace == TidyAutoState) ? no : yes )
 
 /*\
  * 20150515 - support using tabs instead of spaces - Issue #108
  * GH: https://github.com/htacg/tidy-html5/issues/108 - Keep indent with tabs #108
  * SF: https://sourceforge.net/p/tidy/feature-requests/3/ - #3 tabs in place of spaces
 \*/
-static uint indent_char = ' ';
-void TY_(PPrintTabs)(void)
+void TY_(PPrintTabs)( TidyDocImpl* doc )
 {
-    indent_char = '\t';
+    doc->pprint.indent_char = '\t';
 }
-void TY_(PPrintSpaces)(void)
+void TY_(PPrintSpaces)( TidyDocImpl* doc )
 {
-    indent_char = ' ';
+    doc->pprint.indent_char = ' ';
 }
 
 /* #431953 - start RJ Wraplen adjusted for smooth international ride */
@@ -266,6 +265,7 @@ void TY_(InitPrintBuf)( TidyDocImpl* doc )
     InitIndent( &doc->pprint.indent[1] );
     doc->pprint.allocator = doc->allocator;
     doc->pprint.line = 0;
+    doc->pprint.indent_char = ' ';
 }
 
 void TY_(FreePrintBuf)( TidyDocImpl* doc )
@@ -274,6 +274,47 @@ void TY_(FreePrintBuf)( TidyDocImpl* doc )
     TY_(InitPrintBuf)( doc );
 }
 
+void TY_(ResolvePrinterOptions)( TidyDocImpl* doc )
+{
+    PrinterOptions* opts = &doc->pprint.opts;
+
+    opts->wrapLen = cfg( doc, TidyWrapLen );
+    opts->indentSpaces = cfg( doc, TidyIndentSpaces );
+    opts->tabSize = cfg( doc, TidyTabSize );
+    opts->outCharEncoding = cfg( doc, TidyOutCharEncoding );
+    opts->upperCaseAttrs = cfg( doc, TidyUpperCaseAttrs );
+    opts->indentContent = cfgAutoBool( doc, TidyIndentContent );
+    opts->vertSpace = cfgAutoBool( doc, TidyVertSpace );
+    opts->htmlVersion = doc->lexer ? TY_(HTMLVersion)( doc ) : 0;
+    opts->xmlTags = cfgBool( doc, TidyXmlTags );
+    opts->xmlOut = cfgBool( doc, TidyXmlOut );
+    opts->xhtmlOut = cfgBool( doc, TidyXhtmlOut );
+    opts->upperCaseTags = cfgBool( doc, TidyUpperCaseTags );
+    opts->numEntities = cfgBool( doc, TidyNumEntities );
+    opts->quoteMarks = cfgBool( doc, TidyQuoteMarks );
+    opts->quoteAmpersand = cfgBool( doc, TidyQuoteAmpersand );
+    opts->quoteNbsp = cfgBool( doc, TidyQuoteNbsp );
+    opts->preserveEntities = cfgBool( doc, TidyPreserveEntities );
+    opts->punctWrap = cfgBool( doc, TidyPunctWrap );
+    opts->wrapAttVals = cfgBool( doc, TidyWrapAttVals );
+    opts->wrapScriptlets = cfgBool( doc, TidyWrapScriptlets );
+    opts->indentAttributes = cfgBool( doc, TidyIndentAttributes );
+    opts->literalAttribs = cfgBool( doc, TidyLiteralAttribs );
+    opts->omitOptionalTags = cfgBool( doc, TidyOmitOptionalTags );
+    opts->breakBeforeBR = cfgBool( doc, TidyBreakBeforeBR );
+}
+
+/* as InitPrintBuf(), but keeps the line buffer grown so far */
+void TY_(ResetPrintBuf)( TidyDocImpl* doc )
+{
+    uint* linebuf = doc->pprint.linebuf;
+    uint lbufsize = doc->pprint.lbufsize;
+
+    TY_(InitPrintBuf)( doc );
+    doc->pprint.linebuf = linebuf;
+    doc->pprint.lbufsize = lbufsize;
+}
+
 static void expand( TidyPrintImpl* pprint, uint len )
 {
     uint* ip;
@@ -362,7 +403,7 @@ static Bool WantIndent( TidyDocImpl* doc )
     Bool wantIt = GetSpaces(pprint) > 0;
     if ( wantIt )
     {
-        Bool indentAttrs = cfgBool( doc, TidyIndentAttributes );
+        Bool indentAttrs = pprint->opts.indentAttributes;
         wantIt = ( ( !IsWrapInAttrVal(pprint) || indentAttrs ) &&
                    !IsWrapInString(pprint) );
     }
@@ -372,21 +413,21 @@ static Bool WantIndent( TidyDocImpl* doc )
 
 static uint  WrapOff( TidyDocImpl* doc )
 {
-    uint saveWrap = cfg( doc, TidyWrapLen );
-    TY_(SetOptionInt)( doc, TidyWrapLen, 0xFFFFFFFF );  /* very large number */
+    uint saveWrap = doc->pprint.opts.wrapLen;
+    doc->pprint.opts.wrapLen = 0xFFFFFFFF;  /* very large number */
     return saveWrap;
 }
 
 static void  WrapOn( TidyDocImpl* doc, uint saveWrap )
 {
-    TY_(SetOptionInt)( doc, TidyWrapLen, saveWrap );
+    doc->pprint.opts.wrapLen = saveWrap;
 }
 
 static uint  WrapOffCond( TidyDocImpl* doc, Bool onoff )
 {
     if ( onoff )
         return WrapOff( doc );
-    return cfg( doc, TidyWrapLen );
+    return doc->pprint.opts.wrapLen;
 }
 
 
@@ -426,7 +467,7 @@ static uint AddString( TidyPrintImpl* pprint, ctmbstr str )
 static Bool SetWrap( TidyDocImpl* doc, uint indent )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    Bool wrap = ( indent + pprint->linelen < cfg(doc, TidyWrapLen) );
+    Bool wrap = ( indent + pprint->linelen < pprint->opts.wrapLen );
     if ( wrap )
     {
         if ( pprint->indent[0].spaces < 0 )
@@ -458,7 +499,7 @@ static Bool SetWrapAttr( TidyDocImpl* doc,
     TidyPrintImpl* pprint = &doc->pprint;
     TidyIndent *ind = pprint->indent + 0;
 
-    Bool wrap = ( indent + pprint->linelen < cfg(doc, TidyWrapLen) );
+    Bool wrap = ( indent + pprint->linelen < pprint->opts.wrapLen );
     if ( wrap )
     {
         if ( ind[0].spaces < 0 )
@@ -553,15 +594,15 @@ static void WriteIndentChar(TidyDocImpl* doc )
     TidyPrintImpl* pprint = &doc->pprint;
     uint i;
     uint spaces = GetSpaces(pprint);
-    uint tabsize = cfg(doc, TidyTabSize);
-    if (spaces && (indent_char == '\t') && tabsize)
+    uint tabsize = pprint->opts.tabSize;
+    if (spaces && (pprint->indent_char == '\t') && tabsize)
     {
         spaces /= tabsize;  // set number of tabs to output
         if (spaces == 0)    // with a minimum of one
             spaces = 1;
     }
     for (i = 0; i < spaces; i++)
-        TY_(WriteChar)(indent_char, doc->docOut); /* 20150515 - Issue #108 */
+        TY_(WriteChar)(pprint->indent_char, doc->docOut); /* 20150515 - Issue #108 */
 
 }
 
@@ -598,7 +639,7 @@ static void WrapLine( TidyDocImpl* doc )
 static Bool CheckWrapLine( TidyDocImpl* doc )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    if ( GetSpaces(pprint) + pprint->linelen >= cfg(doc, TidyWrapLen) )
+    if ( GetSpaces(pprint) + pprint->linelen >= pprint->opts.wrapLen )
     {
         WrapLine( doc );
         return yes;
@@ -609,7 +650,7 @@ static Bool CheckWrapLine( TidyDocImpl* doc )
 static Bool CheckWrapIndent( TidyDocImpl* doc, uint indent )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    if ( GetSpaces(pprint) + pprint->linelen >= cfg(doc, TidyWrapLen) )
+    if ( GetSpaces(pprint) + pprint->linelen >= pprint->opts.wrapLen )
     {
         WrapLine( doc );
         if ( pprint->indent[ 0 ].spaces < 0 )
@@ -769,8 +810,8 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
     tmbchar entity[128];
     ctmbstr p;
     TidyPrintImpl* pprint  = &doc->pprint;
-    uint outenc = cfg( doc, TidyOutCharEncoding );
-    Bool qmark = cfgBool( doc, TidyQuoteMarks );
+    uint outenc = pprint->opts.outCharEncoding;
+    Bool qmark = pprint->opts.quoteMarks;
 
     if ( c == ' ' && !(mode & (PREFORMATTED | COMMENT | ATTRIBVALUE | CDATA)))
     {
@@ -779,7 +820,7 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
         {
             ctmbstr ent = "&nbsp;";
             /* by default XML doesn't define &nbsp; */
-            if ( cfgBool(doc, TidyNumEntities) || cfgBool(doc, TidyXmlTags) )
+            if ( pprint->opts.numEntities || pprint->opts.xmlTags )
                 ent = "&#160;";
             AddString( pprint, ent );
             return;
@@ -815,8 +856,8 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
           quoted as &amp; The latter is required
           for XML where naked '&' are illegal.
         */
-        if ( c == '&' && cfgBool(doc, TidyQuoteAmpersand)
-             && !cfgBool(doc, TidyPreserveEntities)
+        if ( c == '&' && pprint->opts.quoteAmpersand
+             && !pprint->opts.preserveEntities
              && ( mode != OtherNamespace) ) /* #130 MathML attr and entity fix! */
         {
             AddString( pprint, "&amp;" );
@@ -837,10 +878,10 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
 
         if ( c == 160 && outenc != RAW )
         {
-            if ( cfgBool(doc, TidyQuoteNbsp) )
+            if ( pprint->opts.quoteNbsp )
             {
-                if ( cfgBool(doc, TidyNumEntities) ||
-                     cfgBool(doc, TidyXmlTags) )
+                if ( pprint->opts.numEntities ||
+                     pprint->opts.xmlTags )
                     AddString( pprint, "&#160;" );
                 else
                     AddString( pprint, "&nbsp;" );
@@ -859,7 +900,7 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
     case UTF16:
     case UTF16LE:
     case UTF16BE:
-        if (!(mode & PREFORMATTED) && cfg(doc, TidyPunctWrap))
+        if (!(mode & PREFORMATTED) && pprint->opts.punctWrap)
         {
             WrapPoint wp = CharacterWrapPoint(c);
             if (wp == WrapBefore)
@@ -873,7 +914,7 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
         /* Allow linebreak at Chinese punctuation characters */
         /* There are not many spaces in Chinese */
         AddChar( pprint, c );
-        if (!(mode & PREFORMATTED)  && cfg(doc, TidyPunctWrap))
+        if (!(mode & PREFORMATTED)  && pprint->opts.punctWrap)
         {
             WrapPoint wp = Big5WrapPoint(c);
             if (wp == WrapBefore)
@@ -897,8 +938,8 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
     {
         if (c > 255)  /* multi byte chars */
         {
-            uint vers = TY_(HTMLVersion)( doc );
-            if ( !cfgBool(doc, TidyNumEntities) && (p = TY_(EntityName)(c, vers)) )
+            uint vers = pprint->opts.htmlVersion;
+            if ( !pprint->opts.numEntities && (p = TY_(EntityName)(c, vers)) )
                 TY_(tmbsnprintf)(entity, sizeof(entity), "&%s;", p);
             else
                 TY_(tmbsnprintf)(entity, sizeof(entity), "&#%u;", c);
@@ -933,7 +974,7 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
     }
 
     /* use numeric entities only  for XML */
-    if ( cfgBool(doc, TidyXmlTags) )
+    if ( pprint->opts.xmlTags )
     {
         /* if ASCII use numeric entities for chars > 127 */
         if ( c > 127 && outenc == ASCII )
@@ -951,8 +992,8 @@ static void PPrintChar( TidyDocImpl* doc, uint c, uint mode )
     /* default treatment for ASCII */
     if ( outenc == ASCII && (c > 126 || (c < ' ' && c != '\t')) )
     {
-        uint vers = TY_(HTMLVersion)( doc );
-        if (!cfgBool(doc, TidyNumEntities) && (p = TY_(EntityName)(c, vers)) )
+        uint vers = pprint->opts.htmlVersion;
+        if (!pprint->opts.numEntities && (p = TY_(EntityName)(c, vers)) )
             TY_(tmbsnprintf)(entity, sizeof(entity), "&%s;", p);
         else
             TY_(tmbsnprintf)(entity, sizeof(entity), "&#%u;", c);
@@ -1001,11 +1042,11 @@ static void PPrintText( TidyDocImpl* doc, uint mode, uint indent,
             ix = IncrWS( ix, end, indent, ixWS );
         }
         */
-        c = (byte) doc->lexer->lexbuf[ix];
+        c = (byte) NodeTextBuf(doc->lexer, node)[ix];
 
         /* look for UTF-8 multibyte character */
         if ( c > 0x7F )
-             ix += TY_(GetUTF8)( doc->lexer->lexbuf + ix, &c );
+             ix += TY_(GetUTF8)( NodeTextBuf(doc->lexer, node) + ix, &c );
 
         if ( c == '\n' )
         {
@@ -1013,8 +1054,8 @@ static void PPrintText( TidyDocImpl* doc, uint mode, uint indent,
             ixWS = TextStartsWithWhitespace( doc->lexer, node, ix+1, mode );
             ix = IncrWS( ix, end, indent, ixWS );
         }
-        else if (( c == '&' ) && (TY_(HTMLVersion)(doc) == HT50) &&
-            (((ix + 1) == end) || (((ix + 1) < end) && (isspace(doc->lexer->lexbuf[ix+1] & 0xff)))) )
+        else if (( c == '&' ) && (doc->pprint.opts.htmlVersion == HT50) &&
+            (((ix + 1) == end) || (((ix + 1) < end) && (isspace(NodeTextBuf(doc->lexer, node)[ix+1] & 0xff)))) )
         {
             /*\
              * Issue #207 - This is an unambiguous ampersand need not be 'quoted' in HTML5
@@ -1034,7 +1075,7 @@ static void PPrintAttrValue( TidyDocImpl* doc, uint indent,
                              ctmbstr value, uint delim, Bool wrappable, Bool scriptAttr )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    Bool scriptlets = cfgBool(doc, TidyWrapScriptlets);
+    Bool scriptlets = pprint->opts.wrapScriptlets;
 
     uint mode = PREFORMATTED | ATTRIBVALUE;
     if ( wrappable )
@@ -1054,7 +1095,7 @@ static void PPrintAttrValue( TidyDocImpl* doc, uint indent,
     AddChar( pprint, '=' );
 
     /* don't wrap after "=" for xml documents */
-    if ( !cfgBool(doc, TidyXmlOut) || cfgBool(doc, TidyXhtmlOut) )
+    if ( !pprint->opts.xmlOut || pprint->opts.xhtmlOut )
     {
         SetWrap( doc, indent );
         CheckWrapIndent( doc, indent );
@@ -1068,7 +1109,7 @@ static void PPrintAttrValue( TidyDocImpl* doc, uint indent,
 
     if ( value )
     {
-        uint wraplen = cfg( doc, TidyWrapLen );
+        uint wraplen = pprint->opts.wrapLen;
         int attrStart = SetInAttrVal( pprint );
         int strStart = ClearInString( pprint );
 
@@ -1092,7 +1133,7 @@ static void PPrintAttrValue( TidyDocImpl* doc, uint indent,
             }
             else if (c == '"')
             {
-                if ( cfgBool(doc, TidyQuoteMarks) )
+                if ( pprint->opts.quoteMarks )
                     AddString( pprint, "&quot;" );
                 else
                     AddChar( pprint, c );
@@ -1105,7 +1146,7 @@ static void PPrintAttrValue( TidyDocImpl* doc, uint indent,
             }
             else if ( c == '\'' )
             {
-                if ( cfgBool(doc, TidyQuoteMarks) )
+                if ( pprint->opts.quoteMarks )
                     AddString( pprint, "&#39;" );
                 else
                     AddChar( pprint, c );
@@ -1126,7 +1167,7 @@ static void PPrintAttrValue( TidyDocImpl* doc, uint indent,
             {
                 /* No indent inside Javascript literals */
                 TY_(PFlushLine)( doc, (strStart < 0
-                                       && !cfgBool(doc, TidyLiteralAttribs) ?
+                                       && !pprint->opts.literalAttribs ?
                                        indent : 0) );
                 continue;
             }
@@ -1140,7 +1181,7 @@ static void PPrintAttrValue( TidyDocImpl* doc, uint indent,
 
 static uint AttrIndent( TidyDocImpl* doc, Node* node, AttVal* ARG_UNUSED(attr) )
 {
-  uint spaces = cfg( doc, TidyIndentSpaces );
+  uint spaces = doc->pprint.opts.indentSpaces;
   uint xtra = 2;  /* 1 for the '<', another for the ' ' */
   if ( node->element == NULL )
     return spaces;
@@ -1168,14 +1209,14 @@ static void PPrintAttribute( TidyDocImpl* doc, uint indent,
                              Node *node, AttVal *attr )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    Bool xmlOut    = cfgBool( doc, TidyXmlOut );
-    Bool xhtmlOut  = cfgBool( doc, TidyXhtmlOut );
-    Bool wrapAttrs = cfgBool( doc, TidyWrapAttVals );
-    uint ucAttrs   = cfg( doc, TidyUpperCaseAttrs );
-    Bool indAttrs  = cfgBool( doc, TidyIndentAttributes );
+    Bool xmlOut    = pprint->opts.xmlOut;
+    Bool xhtmlOut  = pprint->opts.xhtmlOut;
+    Bool wrapAttrs = pprint->opts.wrapAttVals;
+    uint ucAttrs   = pprint->opts.upperCaseAttrs;
+    Bool indAttrs  = pprint->opts.indentAttributes;
     uint xtra      = AttrIndent( doc, node, attr );
     Bool first     = AttrNoIndentFirst( /*doc,*/ node, attr );
-    tmbstr name    = attr->attribute;
+    ctmbstr name   = attr->attribute;
     Bool wrappable = no;
     tchar c;
 
@@ -1199,7 +1240,7 @@ static void PPrintAttribute( TidyDocImpl* doc, uint indent,
     if ( !xmlOut && !xhtmlOut && attr->dict )
     {
         if ( TY_(IsScript)(doc, name) )
-            wrappable = cfgBool( doc, TidyWrapScriptlets );
+            wrappable = pprint->opts.wrapScriptlets;
         else if (!(attrIsCONTENT(attr) || attrIsVALUE(attr) || attrIsALT(attr) || attrIsTITLE(attr)) && wrapAttrs )
             wrappable = yes;
     }
@@ -1254,7 +1295,7 @@ static void PPrintAttrs( TidyDocImpl* doc, uint indent, Node *node )
     AttVal* av;
 
     /* add xml:space attribute to pre and other elements */
-    if ( cfgBool(doc, TidyXmlOut) && cfgBool(doc, TidyXmlSpace) &&
+    if ( pprint->opts.xmlOut && cfgBool(doc, TidyXmlSpace) &&
          !TY_(GetAttrByName)(node, "xml:space") &&
          TY_(XMLPreserveWhiteSpace)(doc, node) )
     {
@@ -1267,15 +1308,15 @@ static void PPrintAttrs( TidyDocImpl* doc, uint indent, Node *node )
         {
             PPrintAttribute( doc, indent, node, av );
         }
-        else if ( av->asp != NULL )
-        {
-            AddChar( pprint, ' ' );
-            PPrintAsp( doc, indent, av->asp );
-        }
-        else if ( av->php != NULL )
+        else if ( av->script )
         {
+            Node* script = TY_(AttrScript)( doc, av );
+
             AddChar( pprint, ' ' );
-            PPrintPhp( doc, indent, av->php );
+            if ( script->type == AspTag )
+                PPrintAsp( doc, indent, script );
+            else
+                PPrintPhp( doc, indent, script );
         }
     }
 }
@@ -1287,9 +1328,9 @@ Bool TY_(TextNodeEndWithSpace)( Lexer *lexer, Node *node )
         uint i, c = '\0'; /* initialised to avoid warnings */
         for (i = node->start; i < node->end; ++i)
         {
-            c = (byte) lexer->lexbuf[i];
+            c = (byte) NodeTextBuf(lexer, node)[i];
             if ( c > 0x7F )
-                i += TY_(GetUTF8)( lexer->lexbuf + i, &c );
+                i += TY_(GetUTF8)( NodeTextBuf(lexer, node) + i, &c );
         }
 
         if ( c == ' ' || c == '\n' )
@@ -1411,11 +1452,11 @@ static void PPrintTag( TidyDocImpl* doc,
                        uint mode, uint indent, Node *node )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    Bool uc = cfgBool( doc, TidyUpperCaseTags );
-    Bool xhtmlOut = cfgBool( doc, TidyXhtmlOut );
-    Bool xmlOut = cfgBool( doc, TidyXmlOut );
+    Bool uc = pprint->opts.upperCaseTags;
+    Bool xhtmlOut = pprint->opts.xhtmlOut;
+    Bool xmlOut = pprint->opts.xmlOut;
     tchar c;
-    tmbstr s = node->element;
+    ctmbstr s = node->element;
 
     AddChar( pprint, '<' );
 
@@ -1456,14 +1497,14 @@ static void PPrintTag( TidyDocImpl* doc,
      *  A complete list of the void elements in HTML:
      *  area, base, br, col, command, embed, hr, img, input, keygen, link, meta, param, source, track, wbr
     \*/
-    if ((node->type == StartEndTag && TY_(HTMLVersion)(doc) == HT50) && !TY_(isVoidElement)(node) )
+    if ((node->type == StartEndTag && pprint->opts.htmlVersion == HT50) && !TY_(isVoidElement)(node) )
     {
         PPrintEndTag( doc, mode, indent, node );
     }
 
-    if ( (node->type != StartEndTag || xhtmlOut || (node->type == StartEndTag && TY_(HTMLVersion)(doc) == HT50)) && !(mode & PREFORMATTED) )
+    if ( (node->type != StartEndTag || xhtmlOut || (node->type == StartEndTag && pprint->opts.htmlVersion == HT50)) && !(mode & PREFORMATTED) )
     {
-        uint wraplen = cfg( doc, TidyWrapLen );
+        uint wraplen = pprint->opts.wrapLen;
         CheckWrapIndent( doc, indent );
 
         if ( indent + pprint->linelen < wraplen )
@@ -1494,8 +1535,8 @@ static void PPrintEndTag( TidyDocImpl* doc, uint ARG_UNUSED(mode),
                           uint ARG_UNUSED(indent), Node *node )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    Bool uc = cfgBool( doc, TidyUpperCaseTags );
-    tmbstr s = node->element;
+    Bool uc = pprint->opts.upperCaseTags;
+    ctmbstr s = node->element;
     tchar c;
 
     AddString( pprint, "</" );
@@ -1537,8 +1578,8 @@ static void PPrintComment( TidyDocImpl* doc, uint indent, Node* node )
 static void PPrintDocType( TidyDocImpl* doc, uint indent, Node *node )
 {
     TidyPrintImpl* pprint = &doc->pprint;
-    uint wraplen = cfg( doc, TidyWrapLen );
-    uint spaces = cfg( doc, TidyIndentSpaces );
+    uint wraplen = pprint->opts.wrapLen;
+    uint spaces = pprint->opts.indentSpaces;
     AttVal* fpi = TY_(GetAttrByName)(node, "PUBLIC");
     AttVal* sys = TY_(GetAttrByName)(node, "SYSTEM");
 
@@ -1601,7 +1642,7 @@ static void PPrintPI( TidyDocImpl* doc, uint indent, Node *node )
 {
     TidyPrintImpl* pprint = &doc->pprint;
     tchar c;
-    tmbstr s;
+    ctmbstr s;
 
     SetWrap( doc, indent );
     AddString( pprint, "<?" );
@@ -1620,8 +1661,8 @@ static void PPrintPI( TidyDocImpl* doc, uint indent, Node *node )
     /* set CDATA to pass < and > unescaped */
     PPrintText( doc, CDATA, indent, node );
 
-    if (cfgBool(doc, TidyXmlOut) ||
-        cfgBool(doc, TidyXhtmlOut) || node->closed)
+    if (pprint->opts.xmlOut ||
+        pprint->opts.xhtmlOut || node->closed)
         AddChar( pprint, '?' );
 
     AddChar( pprint, '>' );
@@ -1638,8 +1679,8 @@ static void PPrintXmlDecl( TidyDocImpl* doc, uint indent, Node *node )
     saveWrap = WrapOff( doc );
 
     /* no case translation for XML declaration pseudo attributes */
-    ucAttrs = cfg(doc, TidyUpperCaseAttrs);
-    TY_(SetOptionInt)(doc, TidyUpperCaseAttrs, no);
+    ucAttrs = pprint->opts.upperCaseAttrs;
+    pprint->opts.upperCaseAttrs = TidyUppercaseNo;
 
     AddString( pprint, "<?xml" );
 
@@ -1652,8 +1693,8 @@ static void PPrintXmlDecl( TidyDocImpl* doc, uint indent, Node *node )
     if ( NULL != (att = TY_(GetAttrByName)(node, "standalone")) )
       PPrintAttribute( doc, indent, node, att );
 
-    /* restore old config value */
-    TY_(SetOptionInt)(doc, TidyUpperCaseAttrs, ucAttrs);
+    /* restore old value */
+    pprint->opts.upperCaseAttrs = ucAttrs;
 
     if ( node->end <= 0 || doc->lexer->lexbuf[node->end - 1] != '?' )
         AddChar( pprint, '?' );
@@ -1782,11 +1823,11 @@ static int TextEndsWithNewline(Lexer *lexer, Node *node, uint mode )
          *  Skip non-newline whitespace. 
          *  Issue #379 - Only if ix is GT start can it be decremented!
         \*/
-        while ( ix > node->start && (ch = (lexer->lexbuf[ix] & 0xff))
+        while ( ix > node->start && (ch = (NodeTextBuf(lexer, node)[ix] & 0xff))
                  && ( ch == ' ' || ch == '\t' || ch == '\r' ) )
             --ix;
 
-        if ( lexer->lexbuf[ ix ] == '\n' )
+        if ( NodeTextBuf(lexer, node)[ ix ] == '\n' )
           return node->end - ix - 1; /* #543262 tidy eats all memory */
     }
     return -1;
@@ -1820,7 +1861,7 @@ static int TextStartsWithWhitespace( Lexer *lexer, Node *node, uint start, uint
     {
         uint ch, ix = start;
         /* Skip whitespace. */
-        while ( ix < node->end && (ch = (lexer->lexbuf[ix] & 0xff))
+        while ( ix < node->end && (ch = (NodeTextBuf(lexer, node)[ix] & 0xff))
                 && ( ch==' ' || ch=='\t' || ch=='\r' ) )
             ++ix;
 
@@ -1835,8 +1876,8 @@ static Bool HasCDATA( Lexer* lexer, Node* node )
     /* Scan forward through the textarray. Since the characters we're
     ** looking for are < 0x7f, we don't have to do any UTF-8 decoding.
     */
-    ctmbstr start = lexer->lexbuf + node->start;
-    int len = node->end - node->start + 1;
+    ctmbstr start = NodeTextBuf(lexer, node) + node->start;
+    int len = node->end - node->start;
 
     if ( node->type != TextNode )
         return no;
@@ -1854,7 +1895,7 @@ void PPrintScriptStyle( TidyDocImpl* doc, uint mode, uint indent, Node *node )
     ctmbstr commentEnd = DEFAULT_COMMENT_END;
     Bool    hasCData = no;
     int     contentIndent = -1;
-    Bool    xhtmlOut = cfgBool( doc, TidyXhtmlOut );
+    Bool    xhtmlOut = pprint->opts.xhtmlOut;
 
     if ( InsideHead(doc, node) )
       TY_(PFlushLineSmart)( doc, indent );
@@ -1951,7 +1992,7 @@ void PPrintScriptStyle( TidyDocImpl* doc, uint mode, uint indent, Node *node )
         pprint->indent[ 0 ].spaces = indent;
     }
     PPrintEndTag( doc, mode, indent, node );
-    if ( cfgAutoBool(doc, TidyIndentContent) == TidyNoState
+    if ( pprint->opts.indentContent == TidyNoState
          && node->next != NULL &&
          !( TY_(nodeHasCM)(node, CM_INLINE) || TY_(nodeIsText)(node) ) )
         TY_(PFlushLineSmart)( doc, indent );
@@ -1961,7 +2002,7 @@ void PPrintScriptStyle( TidyDocImpl* doc, uint mode, uint indent, Node *node )
 
 static Bool ShouldIndent( TidyDocImpl* doc, Node *node )
 {
-    TidyTriState indentContent = cfgAutoBool( doc, TidyIndentContent );
+    TidyTriState indentContent = doc->pprint.opts.indentContent;
     if ( indentContent == TidyNoState )
         return no;
 
@@ -2042,8 +2083,8 @@ static void PPrintMathML( TidyDocImpl* doc, uint indent, Node *node )
 void TY_(PPrintTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node )
 {
     Node *content, *last;
-    uint spaces = cfg( doc, TidyIndentSpaces );
-    Bool xhtml = cfgBool( doc, TidyXhtmlOut );
+    uint spaces = doc->pprint.opts.indentSpaces;
+    Bool xhtml = doc->pprint.opts.xhtmlOut;
 
     if ( node == NULL )
         return;
@@ -2100,7 +2141,7 @@ void TY_(PPrintTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node )
 
         if ( nodeIsBR(node) && node->prev &&
              !(nodeIsBR(node->prev) || (mode & PREFORMATTED)) &&
-             cfgBool(doc, TidyBreakBeforeBR) )
+             doc->pprint.opts.breakBeforeBR )
             TY_(PFlushLineSmart)( doc, indent );
 
         if ( nodeIsHR(node) )
@@ -2159,7 +2200,7 @@ void TY_(PPrintTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node )
             indent = indprev;
             PPrintEndTag( doc, mode, indent, node );
 
-            if ( cfgAutoBool(doc, TidyIndentContent) == TidyNoState
+            if ( doc->pprint.opts.indentContent == TidyNoState
                  && node->next != NULL )
                 TY_(PFlushLineSmart)( doc, indent );
         }
@@ -2212,10 +2253,10 @@ void TY_(PPrintTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node )
         }
         else /* other tags */
         {
-            Bool indcont  = ( cfgAutoBool(doc, TidyIndentContent) != TidyNoState );
+            Bool indcont  = ( doc->pprint.opts.indentContent != TidyNoState );
             /* Issue #582 - Seems this is no longer used
                Bool indsmart = ( cfgAutoBool(doc, TidyIndentContent) == TidyAutoState ); */
-            Bool hideend  = cfgBool( doc, TidyOmitOptionalTags );
+            Bool hideend  = doc->pprint.opts.omitOptionalTags;
             Bool classic  = TidyClassicVS; /* #228 - cfgBool( doc, TidyVertSpace ); */
             uint contentIndent = indent;
 
@@ -2332,7 +2373,7 @@ void TY_(PPrintTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node )
 
 void TY_(PPrintXMLTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node )
 {
-    Bool xhtmlOut = cfgBool( doc, TidyXhtmlOut );
+    Bool xhtmlOut = doc->pprint.opts.xhtmlOut;
     if (node == NULL)
         return;
 
@@ -2384,7 +2425,7 @@ void TY_(PPrintXMLTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node )
     }
     else /* some kind of container element */
     {
-        uint spaces = cfg( doc, TidyIndentSpaces );
+        uint spaces = doc->pprint.opts.indentSpaces;
         Node *content;
         Bool mixed = no;
         uint cindent;
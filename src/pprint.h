@@ -45,6 +45,43 @@ typedef struct _TidyIndent
     int attrStringStart;
 } TidyIndent;
 
+/* Options read for every character, tag or attribute printed. They
+** are copied out of the configuration by ResolvePrinterOptions() before
+** a document or node is printed; wrapLen and upperCaseAttrs are changed
+** here, not in the configuration, while wrapping or case folding is
+** suspended, so printing never writes to a configuration that other
+** documents may share. htmlVersion is worked out once here rather than
+** by HTMLVersion() for every tag and entity, which for documents with
+** a legacy doctype means a walk of the doctype table each time.
+*/
+typedef struct _PrinterOptions
+{
+    uint wrapLen;               /* TidyWrapLen */
+    uint indentSpaces;          /* TidyIndentSpaces */
+    uint tabSize;               /* TidyTabSize */
+    uint outCharEncoding;       /* TidyOutCharEncoding */
+    uint upperCaseAttrs;        /* TidyUpperCaseAttrs */
+    TidyTriState indentContent; /* TidyIndentContent */
+    TidyTriState vertSpace;     /* TidyVertSpace */
+    uint htmlVersion;           /* HTMLVersion() of the document */
+    Bool xmlTags;               /* TidyXmlTags */
+    Bool xmlOut;                /* TidyXmlOut */
+    Bool xhtmlOut;              /* TidyXhtmlOut */
+    Bool upperCaseTags;         /* TidyUpperCaseTags */
+    Bool numEntities;           /* TidyNumEntities */
+    Bool quoteMarks;            /* TidyQuoteMarks */
+    Bool quoteAmpersand;        /* TidyQuoteAmpersand */
+    Bool quoteNbsp;             /* TidyQuoteNbsp */
+    Bool preserveEntities;      /* TidyPreserveEntities */
+    Bool punctWrap;             /* TidyPunctWrap */
+    Bool wrapAttVals;           /* TidyWrapAttVals */
+    Bool wrapScriptlets;        /* TidyWrapScriptlets */
+    Bool indentAttributes;      /* TidyIndentAttributes */
+    Bool literalAttribs;        /* TidyLiteralAttribs */
+    Bool omitOptionalTags;      /* TidyOmitOptionalTags */
+    Bool breakBeforeBR;         /* TidyBreakBeforeBR */
+} PrinterOptions;
+
 typedef struct _TidyPrintImpl
 {
     TidyAllocator *allocator; /* Allocator */
@@ -57,11 +94,19 @@ typedef struct _TidyPrintImpl
   
     uint ixInd;
     TidyIndent indent[2];  /* Two lines worth of indent state */
+
+    uint indent_char;      /* ' ' or '\t', see PPrintTabs() */
+
+    PrinterOptions opts;   /* see ResolvePrinterOptions() */
 } TidyPrintImpl;
 
 
 void TY_(InitPrintBuf)( TidyDocImpl* doc );
 void TY_(FreePrintBuf)( TidyDocImpl* doc );
+void TY_(ResetPrintBuf)( TidyDocImpl* doc );
+
+/* copy the options in PrinterOptions out of the configuration */
+void TY_(ResolvePrinterOptions)( TidyDocImpl* doc );
 
 void TY_(PFlushLine)( TidyDocImpl* doc, uint indent );
 
@@ -83,7 +128,7 @@ void TY_(PPrintXMLTree)( TidyDocImpl* doc, uint mode, uint indent, Node *node );
 /*\
  * 20150515 - support using tabs instead of spaces
 \*/
-void TY_(PPrintTabs)(void);
-void TY_(PPrintSpaces)(void);
+void TY_(PPrintTabs)( TidyDocImpl* doc );
+void TY_(PPrintSpaces)( TidyDocImpl* doc );
 
 #endif /* __PPRINT_H__ */
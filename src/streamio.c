@@ -15,6 +15,7 @@
 
 #include "streamio.h"
 #include "tidy-int.h"
+#include "mappedio.h"
 #include "lexer.h"
 #include "message.h"
 #include "utf8.h"
@@ -29,6 +30,7 @@ static uint ReadCharFromStream( StreamIn* in );
 
 static uint ReadByte( StreamIn* in );
 static void UngetByte( StreamIn* in, uint byteValue );
+static Bool RefillRawBuffer( StreamIn* in );
 
 static void PutByte( uint byteValue, StreamOut* out );
 
@@ -41,18 +43,26 @@ static uint DecodeIbm850(uint c);
 static uint DecodeLatin0(uint c);
 
 static uint PopChar( StreamIn *in );
+static void PushChar( uint c, StreamIn *in );
 
 /******************************
 ** Static (duration) Globals
 ******************************/
 
+/* stderr isn't a constant, so this sink finds it when writing rather
+   than having it stored in the shared stream below. */
+static void TIDY_CALL stderrsink_putByte( void* sinkData, byte bv )
+{
+    TY_(filesink_putByte)( stderr, bv );
+}
+
 static StreamOut stderrStreamOut = 
 {
     ASCII,
     FSM_ASCII,
     DEFAULT_NL_CONFIG,
     FileIO,
-    { 0, TY_(filesink_putByte) }
+    { 0, stderrsink_putByte }
 };
 
 static StreamOut stdoutStreamOut = 
@@ -66,8 +76,6 @@ static StreamOut stdoutStreamOut =
 
 StreamOut* TY_(StdErrOutput)(void)
 {
-  if ( stderrStreamOut.sink.sinkData == 0 )
-      stderrStreamOut.sink.sinkData = stderr;
   return &stderrStreamOut;
 }
 
@@ -75,6 +83,7 @@ void  TY_(ReleaseStreamOut)( TidyDocImpl *doc,  StreamOut* out )
 {
     if ( out && out != &stderrStreamOut && out != &stdoutStreamOut )
     {
+        TY_(FlushStreamOut)( out );
         if ( out->iotype == FileIO )
             fclose( (FILE*) out->sink.sinkData );
         TidyDocFree( doc, out );
@@ -85,40 +94,71 @@ void  TY_(ReleaseStreamOut)( TidyDocImpl *doc,  StreamOut* out )
 ** Source
 ************************/
 
-static void InitLastPos( StreamIn *in );
-
 StreamIn* TY_(initStreamIn)( TidyDocImpl* doc, int encoding )
 {
     StreamIn *in = (StreamIn*) TidyDocAlloc( doc, sizeof(StreamIn) );
 
     TidyClearMemory( in, sizeof(StreamIn) );
     in->curline = 1;
-    in->curcol = 1;
     in->encoding = encoding;
     in->state = FSM_ASCII;
     in->doc = doc;
+    in->keeptabs = cfgBool( doc, TidyKeepTabs );
+    in->tabsize = cfg( doc, TidyTabSize );
     in->bufsize = CHARBUF_SIZE;
+    in->sbmapenc = -1;
     in->allocator = doc->allocator;
     in->charbuf = (tchar*)TidyDocAlloc(doc, sizeof(tchar) * in->bufsize);
-    InitLastPos( in );
+    in->linecap = LINESTART_SIZE;
+    in->linestart = (uint*)TidyDocAlloc(doc, sizeof(uint) * in->linecap);
+    in->linestart[0] = 0;
     return in;
 }
 
 void TY_(freeStreamIn)(StreamIn* in)
 {
+    /* leave the buffer where the parser stopped, as tidyBufGetByte would */
+    if ( in->iotype == BufferIO && in->rawbuf )
+        ((TidyBuffer*) in->source.sourceData)->next = in->rawpos;
+    TidyFree(in->allocator, in->rawmem);
     TidyFree(in->allocator, in->charbuf);
+    TidyFree(in->allocator, in->linestart);
     TidyFree(in->allocator, in);
 }
 
+/* Read the source in blocks through its getBytes callback, if it has one */
+static void InitRawBuffer( StreamIn* in )
+{
+    if ( in->getBytes )
+    {
+        in->rawmem = (byte*) TidyAlloc( in->allocator, RAWBUF_SIZE );
+        in->rawbuf = in->rawmem;
+    }
+}
+
 StreamIn* TY_(FileInput)( TidyDocImpl* doc, FILE *fp, int encoding )
 {
     StreamIn *in = TY_(initStreamIn)( doc, encoding );
-    if ( TY_(initFileSource)( doc->allocator, &in->source, fp ) != 0 )
+    if ( TY_(initFileSource)( doc->allocator, &in->source, &in->getBytes, fp ) != 0 )
     {
         TY_(freeStreamIn)( in );
         return NULL;
     }
     in->iotype = FileIO;
+#if SUPPORT_POSIX_MAPPED_FILES
+    {
+        ctmbstr run;
+        uint len = TY_(MappedFileRun)( &in->source, &run );
+        if ( len > 0 )
+        {
+            TY_(SkipMappedFileRun)( &in->source, len );
+            in->rawbuf = (const byte*) run;
+            in->rawlen = len;
+            return in;
+        }
+    }
+#endif
+    InitRawBuffer( in );
     return in;
 }
 
@@ -127,14 +167,26 @@ StreamIn* TY_(BufferInput)( TidyDocImpl* doc, TidyBuffer* buf, int encoding )
     StreamIn *in = TY_(initStreamIn)( doc, encoding );
     tidyInitInputBuffer( &in->source, buf );
     in->iotype = BufferIO;
+    if ( buf->bp )
+    {
+        in->rawbuf = buf->bp;
+        in->rawpos = buf->next;
+        in->rawlen = buf->size;
+    }
     return in;
 }
 
+static int TIDY_CALL blocksrc_getByte( void* sourceData );
+static uint TIDY_CALL blocksrc_getBytes( void* sourceData, byte* bytes, uint size );
+
 StreamIn* TY_(UserInput)( TidyDocImpl* doc, TidyInputSource* source, int encoding )
 {
     StreamIn *in = TY_(initStreamIn)( doc, encoding );
     memcpy( &in->source, source, sizeof(TidyInputSource) );
+    if ( source->getByte == blocksrc_getByte )
+        in->getBytes = blocksrc_getBytes;
     in->iotype = UserIO;
+    InitRawBuffer( in );
     return in;
 }
 
@@ -204,36 +256,47 @@ int TY_(ReadBOMEncoding)(StreamIn *in)
     return -1;
 }
 
-static void InitLastPos( StreamIn *in )
+/* Takes a line break, which starts a new line at the next position */
+static void NewLine( StreamIn *in )
 {
-    in->curlastpos = 0;
-    in->firstlastpos = 0;
+    if ( in->curline == in->linecap )
+    {
+        in->linecap *= 2;
+        in->linestart = (uint*)TidyRealloc( in->allocator, in->linestart,
+                                            sizeof(uint) * in->linecap );
+    }
+    in->linestart[ in->curline++ ] = ++in->curpos;
 }
 
-static void PopLastPos( StreamIn *in )
+uint TY_(InputColumn)( StreamIn *in )
 {
-    in->curlastpos = (in->curlastpos+1)%LASTPOS_SIZE;
-    if ( in->curlastpos == in->firstlastpos )
-        in->firstlastpos = (in->firstlastpos+1)%LASTPOS_SIZE;
+    return in->curpos - in->linestart[ in->curline - 1 ] + 1;
 }
 
-static void SaveLastPos( StreamIn *in )
+/* Printable ASCII decodes to itself and advances the column by one in
+   every encoding that reads it as a single byte */
+static Bool IsAsciiByte( StreamIn *in )
 {
-    PopLastPos( in );
-    in->lastcols[in->curlastpos] = in->curcol;
-}
+    uint c;
 
-static void RestoreLastPos( StreamIn *in )
-{
-    if ( in->firstlastpos == in->curlastpos )
-        in->curcol = 0;
-    else
+    if ( in->rawpos >= in->rawlen )
+        return no;
+
+    c = in->rawbuf[ in->rawpos ];
+    if ( c < 32 || c >= 127 )
+        return no;
+
+    switch ( in->encoding )
     {
-        in->curcol = in->lastcols[in->curlastpos];
-        if ( in->curlastpos == 0 )
-            in->curlastpos = LASTPOS_SIZE;
-        in->curlastpos--;
+    case UTF16LE:
+    case UTF16BE:
+    case UTF16:
+#ifndef NO_NATIVE_ISO2022_SUPPORT
+    case ISO2022:
+#endif
+        return no;
     }
+    return yes;
 }
 
 uint TY_(ReadChar)( StreamIn *in )
@@ -243,14 +306,18 @@ uint TY_(ReadChar)( StreamIn *in )
     if ( in->pushed )
         return PopChar( in );
 
-    SaveLastPos( in );
-
     if ( in->tabs > 0 )
     {
-        in->curcol++;
+        in->curpos++;
         in->tabs--;
         return ' ';
     }
+
+    if ( IsAsciiByte(in) )
+    {
+        in->curpos++;
+        return in->rawbuf[ in->rawpos++ ];
+    }
     
     for (;;)
     {
@@ -261,22 +328,20 @@ uint TY_(ReadChar)( StreamIn *in )
 
         if (c == '\n')
         {
-            in->curcol = 1;
-            in->curline++;
+            NewLine( in );
             break;
         }
 
         if (c == '\t')
         {
-            Bool keeptabs = cfg( in->doc, TidyKeepTabs );
-            if (!keeptabs) {
-                uint tabsize = cfg(in->doc, TidyTabSize);
+            if (!in->keeptabs) {
+                uint tabsize = in->tabsize;
                 in->tabs = tabsize > 0 ?
-                    tabsize - ((in->curcol - 1) % tabsize) - 1
+                    tabsize - ((TY_(InputColumn)( in ) - 1) % tabsize) - 1
                     : 0;
                 c = ' ';
             }
-            in->curcol++;
+            in->curpos++;
             break;
         }
 
@@ -286,14 +351,11 @@ uint TY_(ReadChar)( StreamIn *in )
             c = ReadCharFromStream(in);
             if (c != '\n')
             {
-                TY_(UngetChar)( c, in );
+                /* not read yet as far as positions go */
+                PushChar( c, in );
                 c = '\n';
             }
-            else
-            {
-            }
-            in->curcol = 1;
-            in->curline++;
+            NewLine( in );
             break;
         }
 
@@ -323,7 +385,7 @@ uint TY_(ReadChar)( StreamIn *in )
          || in->encoding == BIG5     /* #431953 - RJ */
            )
         {
-            in->curcol++;
+            in->curpos++;
             break;
         }
 
@@ -385,7 +447,7 @@ uint TY_(ReadChar)( StreamIn *in )
             if (in->doc->lexer)
             {
                 in->doc->lexer->lines = in->curline;
-                in->doc->lexer->columns = in->curcol;
+                in->doc->lexer->columns = TY_(InputColumn)( in );
             }
                 
             if ( isMacChar )
@@ -406,7 +468,7 @@ uint TY_(ReadChar)( StreamIn *in )
         if ( c == 0 )
             continue; /* illegal char is discarded */
         
-        in->curcol++;
+        in->curpos++;
         break;
     }
 
@@ -424,19 +486,130 @@ static uint PopChar( StreamIn *in )
             in->pushed = no;
 
         if ( c == '\n' )
+            NewLine( in );
+        else
+            in->curpos++;
+    }
+    return c;
+}
+
+uint TY_(PeekRawRun)( StreamIn* in, ctmbstr* run )
+{
+    if ( in->pushed || in->tabs > 0 || !in->rawbuf )
+        return 0;
+
+    switch ( in->encoding )
+    {
+    case UTF16LE:
+    case UTF16BE:
+    case UTF16:
+#ifndef NO_NATIVE_ISO2022_SUPPORT
+    case ISO2022:
+#endif
+        return 0;
+    }
+
+    if ( in->rawpos >= in->rawlen && !RefillRawBuffer(in) )
+        return 0;
+
+    *run = (ctmbstr) in->rawbuf + in->rawpos;
+    return in->rawlen - in->rawpos;
+}
+
+void TY_(SkipRawRun)( StreamIn* in, uint count, uint chars )
+{
+    in->curpos += chars;
+    in->rawpos += count;
+}
+
+/* Mirrors what ReadChar() does with a byte >= 128; 0 leaves it to
+   ReadChar(). *locates is set for characters that ReadChar() maps
+   silently from the vendor range 128-159, where it also moves the
+   lexer's error position to the character. */
+static uint DecodeSingleByte( int encoding, uint c, Bool* locates )
+{
+    *locates = no;
+    switch ( encoding )
+    {
+    case MACROMAN:
+        c = TY_(DecodeMacRoman)( c );
+        break;
+    case IBM858:
+        c = DecodeIbm850( c );
+        break;
+    case LATIN0:
+        c = DecodeLatin0( c );
+        break;
+    }
+
+    if ( 127 < c && c < 160 )
+    {
+        if ( encoding == MACROMAN )
+            c = TY_(DecodeMacRoman)( c );
+        else if ( encoding == WIN1252 )
+            c = TY_(DecodeWin1252)( c );
+        else
+            c = 0;  /* reported as INVALID_SGML_CHARS */
+        *locates = ( c != 0 );
+    }
+    return c;
+}
+
+const byte* TY_(SingleByteUTF8Map)( StreamIn* in )
+{
+    uint i;
+
+    switch ( in->encoding )
+    {
+    case RAW:
+    case ASCII:
+    case LATIN0:
+    case LATIN1:
+    case MACROMAN:
+    case WIN1252:
+    case IBM858:
+        break;
+    default:
+        return NULL;
+    }
+
+    if ( in->sbmapenc != in->encoding )
+    {
+        for ( i = 0; i < 128; ++i )
         {
-            in->curcol = 1;
-            in->curline++;
-            PopLastPos( in );
-            return c;
+            byte* m = in->sbmap[i];
+            tmbchar buf[10];
+            uint c = i + 128;
+            int count = 0;
+            Bool locates = no;
+
+            if ( in->encoding != RAW )
+                c = DecodeSingleByte( in->encoding, c, &locates );
+
+            /* ASCII results could be markup, leave them to the lexer */
+            if ( c < 128 ||
+                 TY_(EncodeCharToUTF8Bytes)( c, buf, NULL, &count ) != 0 ||
+                 count > 3 )
+                count = 0;
+            m[0] = (byte) count | ( count && locates ? SBMAP_LOCATES : 0 );
+            memcpy( m + 1, buf, count );
         }
-        in->curcol++;
-        PopLastPos( in );
+        in->sbmapenc = in->encoding;
     }
-    return c;
+    return &in->sbmap[0][0];
 }
 
-void TY_(UngetChar)( uint c, StreamIn *in )
+uint TY_(BufferInputOffset)( StreamIn* in )
+{
+    uint pos = in->rawpos;
+
+    assert( in->iotype == BufferIO && in->rawbuf );
+    if ( in->pushed )
+        pos = pos > in->bufpos ? pos - in->bufpos : 0;
+    return pos;
+}
+
+static void PushChar( uint c, StreamIn *in )
 {
     if (c == EndOfStream)
     {
@@ -450,11 +623,20 @@ void TY_(UngetChar)( uint c, StreamIn *in )
         in->charbuf = (tchar*)TidyRealloc(in->allocator, in->charbuf, sizeof(tchar) * ++(in->bufsize));
 
     in->charbuf[(in->bufpos)++] = c;
+}
 
-    if (c == '\n')
-        --(in->curline);
+void TY_(UngetChar)( uint c, StreamIn *in )
+{
+    if (c == EndOfStream)
+        return;
+
+    PushChar( c, in );
 
-    RestoreLastPos( in );
+    /* back to where the character was read */
+    if (c == '\n' && in->curline > 1)
+        --(in->curline);
+    if (in->curpos > 0)
+        --(in->curpos);
 }
 
 
@@ -476,21 +658,31 @@ static StreamOut* initStreamOut( TidyDocImpl* doc, int encoding, uint nl )
 StreamOut* TY_(FileOutput)( TidyDocImpl *doc, FILE* fp, int encoding, uint nl )
 {
     StreamOut* out = initStreamOut( doc, encoding, nl );
-    TY_(initFileSink)( &out->sink, fp );
+    TY_(initFileSink)( &out->sink, &out->putBytes, fp );
     out->iotype = FileIO;
     return out;
 }
+static void TIDY_CALL bufsink_putBytes( void* sinkData, const byte* bytes, uint count )
+{
+    tidyBufAppend( (TidyBuffer*) sinkData, (void*) bytes, count );
+}
 StreamOut* TY_(BufferOutput)( TidyDocImpl *doc, TidyBuffer* buf, int encoding, uint nl )
 {
     StreamOut* out = initStreamOut( doc, encoding, nl );
     tidyInitOutputBuffer( &out->sink, buf );
+    out->putBytes = bufsink_putBytes;
     out->iotype = BufferIO;
     return out;
 }
+static void TIDY_CALL blocksink_putByte( void* sinkData, byte bv );
+static void TIDY_CALL blocksink_putBytes( void* sinkData, const byte* bytes, uint count );
+
 StreamOut* TY_(UserOutput)( TidyDocImpl *doc, TidyOutputSink* sink, int encoding, uint nl )
 {
     StreamOut* out = initStreamOut( doc, encoding, nl );
     memcpy( &out->sink, sink, sizeof(TidyOutputSink) );
+    if ( sink->putByte == blocksink_putByte )
+        out->putBytes = blocksink_putBytes;
     out->iotype = UserIO;
     return out;
 }
@@ -525,10 +717,17 @@ void TY_(WriteChar)( uint c, StreamOut* out )
 
     else if (out->encoding == UTF8)
     {
-        int count = 0;
-        
-        TY_(EncodeCharToUTF8Bytes)( c, NULL, &out->sink, &count );
-        if (count <= 0)
+        tmbchar buf[10];
+        int i, count = 0;
+
+        if ( c < 0x80 )
+            PutByte( c, out );
+        else if ( TY_(EncodeCharToUTF8Bytes)( c, buf, NULL, &count ) == 0 )
+        {
+            for ( i = 0; i < count; ++i )
+                PutByte( (byte) buf[i], out );
+        }
+        else if (count <= 0)
         {
             /* replacement char 0xFFFD encoded as UTF-8 */
             PutByte(0xEF, out); PutByte(0xBF, out); PutByte(0xBF, out);
@@ -860,6 +1059,51 @@ Bool TIDY_CALL tidyInitSource( TidyInputSource*  source,
   return status;
 }
 
+/* The `source` of a TidyBlockInputSource passes these the whole struct */
+static int TIDY_CALL blocksrc_getByte( void* sourceData )
+{
+  TidyBlockInputSource* source = (TidyBlockInputSource*) sourceData;
+  return source->getByte( source->sourceData );
+}
+static Bool TIDY_CALL blocksrc_eof( void* sourceData )
+{
+  TidyBlockInputSource* source = (TidyBlockInputSource*) sourceData;
+  return source->eof( source->sourceData );
+}
+static void TIDY_CALL blocksrc_ungetByte( void* sourceData, byte bv )
+{
+  TidyBlockInputSource* source = (TidyBlockInputSource*) sourceData;
+  source->ungetByte( source->sourceData, bv );
+}
+static uint TIDY_CALL blocksrc_getBytes( void* sourceData, byte* bytes, uint size )
+{
+  TidyBlockInputSource* source = (TidyBlockInputSource*) sourceData;
+  return source->getBytes( source->sourceData, bytes, size );
+}
+
+Bool TIDY_CALL tidyInitSourceBytes( TidyBlockInputSource* source,
+                                    void*             srcData,
+                                    TidyGetByteFunc   gbFunc,
+                                    TidyUngetByteFunc ugbFunc,
+                                    TidyEOFFunc       endFunc,
+                                    TidyGetBytesFunc  gbsFunc )
+{
+  Bool status = ( source && srcData && gbFunc && ugbFunc && endFunc && gbsFunc );
+
+  if ( status )
+  {
+    source->sourceData = srcData;
+    source->getByte    = gbFunc;
+    source->ungetByte  = ugbFunc;
+    source->eof        = endFunc;
+    source->getBytes   = gbsFunc;
+    tidyInitSource( &source->source, source, blocksrc_getByte,
+                    blocksrc_ungetByte, blocksrc_eof );
+  }
+
+  return status;
+}
+
 Bool TIDY_CALL tidyInitSink( TidyOutputSink* sink,
                              void*           snkData,
                              TidyPutByteFunc pbFunc )
@@ -873,6 +1117,34 @@ Bool TIDY_CALL tidyInitSink( TidyOutputSink* sink,
   return status;
 }
 
+/* The `sink` of a TidyBlockOutputSink passes these the whole struct */
+static void TIDY_CALL blocksink_putByte( void* sinkData, byte bv )
+{
+  TidyBlockOutputSink* sink = (TidyBlockOutputSink*) sinkData;
+  sink->putByte( sink->sinkData, bv );
+}
+static void TIDY_CALL blocksink_putBytes( void* sinkData, const byte* bytes, uint count )
+{
+  TidyBlockOutputSink* sink = (TidyBlockOutputSink*) sinkData;
+  sink->putBytes( sink->sinkData, bytes, count );
+}
+
+Bool TIDY_CALL tidyInitSinkBytes( TidyBlockOutputSink* sink,
+                                  void*            snkData,
+                                  TidyPutByteFunc  pbFunc,
+                                  TidyPutBytesFunc pbsFunc )
+{
+  Bool status = ( sink && snkData && pbFunc && pbsFunc );
+  if ( status )
+  {
+    sink->sinkData = snkData;
+    sink->putByte  = pbFunc;
+    sink->putBytes = pbsFunc;
+    tidyInitSink( &sink->sink, sink, blocksink_putByte );
+  }
+  return status;
+}
+
 /* GetByte must return a byte value in a signed
 ** integer so that a negative value can signal EOF
 ** without interfering w/ 0-255 legitimate byte values.
@@ -895,21 +1167,85 @@ void TIDY_CALL tidyPutByte( TidyOutputSink* sink, uint ch )
     sink->putByte( sink->sinkData, (byte) ch );
 }
 
+/* Only rawmem can be refilled; other raw buffers hold the whole input */
+static Bool RefillRawBuffer( StreamIn* in )
+{
+    uint keep;
+
+    if ( !in->rawmem )
+        return no;
+
+    keep = in->rawpos < RAWKEEP_SIZE ? in->rawpos : RAWKEEP_SIZE;
+    memmove( in->rawmem, in->rawmem + in->rawpos - keep, keep );
+    in->rawpos = keep;
+    in->rawlen = keep + in->getBytes( in->source.sourceData,
+                                      in->rawmem + keep,
+                                      RAWBUF_SIZE - keep );
+    return in->rawpos < in->rawlen;
+}
+
 static uint ReadByte( StreamIn* in )
 {
-    return tidyGetByte( &in->source );
+    if ( !in->rawbuf )
+        return tidyGetByte( &in->source );
+    if ( in->rawpos >= in->rawlen && !RefillRawBuffer(in) )
+        return EndOfStream;
+    return in->rawbuf[ in->rawpos++ ];
 }
 Bool TY_(IsEOF)( StreamIn* in )
 {
-    return tidyIsEOF( &in->source );
+    if ( !in->rawbuf )
+        return tidyIsEOF( &in->source );
+    return in->rawpos >= in->rawlen && !RefillRawBuffer( in );
 }
 static void UngetByte( StreamIn* in, uint byteValue )
 {
-    tidyUngetByte( &in->source, byteValue );
+    if ( !in->rawbuf )
+        tidyUngetByte( &in->source, byteValue );
+    else if ( in->rawpos > 0 )
+    {
+        --in->rawpos;
+        assert( in->rawbuf[in->rawpos] == (byte) byteValue );
+    }
+}
+
+/* Lets the UTF-8 decoder read successor bytes through the StreamIn */
+static int TIDY_CALL rawsrc_getByte( void* sourceData )
+{
+    return (int) ReadByte( (StreamIn*) sourceData );
+}
+static Bool TIDY_CALL rawsrc_eof( void* sourceData )
+{
+    return TY_(IsEOF)( (StreamIn*) sourceData );
+}
+static void TIDY_CALL rawsrc_ungetByte( void* sourceData, byte bv )
+{
+    UngetByte( (StreamIn*) sourceData, bv );
 }
 static void PutByte( uint byteValue, StreamOut* out )
 {
-    tidyPutByte( &out->sink, byteValue );
+    if ( !out->putBytes )
+        tidyPutByte( &out->sink, byteValue );
+    else
+    {
+        if ( out->outlen == OUTBUF_SIZE )
+            TY_(FlushStreamOut)( out );
+        out->outbuf[ out->outlen++ ] = (byte) byteValue;
+    }
+}
+
+void TY_(WriteByte)( uint b, StreamOut* out )
+{
+    PutByte( b, out );
+}
+
+void TY_(FlushStreamOut)( StreamOut* out )
+{
+    if ( out->outlen > 0 )
+    {
+        out->putBytes( out->sink.sinkData, out->outbuf, out->outlen );
+        out->outlen = 0;
+    }
 }
 
 /* read char from stream */
@@ -1016,14 +1352,22 @@ static uint ReadCharFromStream( StreamIn* in )
         int err, count = 0;
         
         /* first byte "c" is passed in separately */
-        err = TY_(DecodeUTF8BytesToChar)( &n, c, NULL, &in->source, &count );
+        if ( in->rawbuf )
+        {
+            TidyInputSource rawsrc;
+            tidyInitSource( &rawsrc, in, rawsrc_getByte,
+                            rawsrc_ungetByte, rawsrc_eof );
+            err = TY_(DecodeUTF8BytesToChar)( &n, c, NULL, &rawsrc, &count );
+        }
+        else
+            err = TY_(DecodeUTF8BytesToChar)( &n, c, NULL, &in->source, &count );
         if (!err && (n == (uint)EndOfStream) && (count == 1)) /* EOF */
             return EndOfStream;
         else if (err)
         {
             /* set error position just before offending character */
             in->doc->lexer->lines = in->curline;
-            in->doc->lexer->columns = in->curcol;
+            in->doc->lexer->columns = TY_(InputColumn)( in );
 
             TY_(ReportEncodingError)(in->doc, INVALID_UTF8, n, no);
             n = 0xFFFD; /* replacement char */
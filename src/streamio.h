@@ -56,7 +56,10 @@ typedef enum
 enum
 {
     CHARBUF_SIZE=5,
-    LASTPOS_SIZE=64
+    LINESTART_SIZE=64,   /* initial room in the line start index */
+    RAWBUF_SIZE=8192,
+    RAWKEEP_SIZE=8,
+    OUTBUF_SIZE=8192
 };
 
 /* non-raw input is cleaned up*/
@@ -69,15 +72,39 @@ struct _StreamIn
     uint   bufpos;
     uint   bufsize;
     int    tabs;
-    int    lastcols[LASTPOS_SIZE];
-    unsigned short curlastpos; /* current last position in lastcols */ 
-    unsigned short firstlastpos; /* first valid last position in lastcols */ 
-    int    curcol;
-    int    curline;
+    Bool   keeptabs;   /* TidyKeepTabs and TidyTabSize, as they */
+    uint   tabsize;    /* were when the stream was set up */
+
+    /* Positions count the columns read, with tabs expanded, and a line
+       break takes one. Line n starts at linestart[n-1], so the column is
+       worked out from curpos only when it is asked for, see
+       TY_(InputColumn)(). Ungetting a line break drops its line again.
+    */
+    uint   curpos;
+    uint   curline;
+    uint*  linestart;
+    uint   linecap;
     int    encoding;
     IOType iotype;
 
+    /* Block input: bytes rawbuf[rawpos..rawlen) are unread. rawbuf is
+       either the input itself (buffer sources, mapped files) or rawmem,
+       which is refilled through getBytes. Ungetting a byte just
+       moves rawpos back; RAWKEEP_SIZE bytes are kept across refills
+       for that. NULL rawbuf means the byte level callbacks are used.
+    */
+    const byte* rawbuf;
+    byte*  rawmem;
+    uint   rawpos;
+    uint   rawlen;
+
+    /* UTF-8 for bytes 128-255 of a single byte encoding, see
+       SingleByteUTF8Map(). Built lazily for encoding sbmapenc. */
+    int    sbmapenc;
+    byte   sbmap[128][4];
+
     TidyInputSource source;
+    TidyGetBytesFunc getBytes;  /* reads source in blocks, or NULL */
 
     /* Pointer back to document for error reporting */
     TidyDocImpl* doc;
@@ -95,6 +122,44 @@ uint      TY_(ReadChar)( StreamIn* in );
 void      TY_(UngetChar)( uint c, StreamIn* in );
 Bool      TY_(IsEOF)( StreamIn* in );
 
+/* Column of the next character ReadChar() will return, on line curline */
+uint      TY_(InputColumn)( StreamIn* in );
+
+/* Fast path for the lexer: expose the raw, not yet decoded input bytes
+** that follow the current position, or return 0 if the stream can't
+** hand them out directly (pushed back chars, pending tab expansion,
+** encodings where ASCII bytes don't stand for themselves, or sources
+** read byte by byte).
+*/
+uint      TY_(PeekRawRun)( StreamIn* in, ctmbstr* run );
+
+/* Consume count bytes, making up chars characters, from the run returned
+** by PeekRawRun(). The caller guarantees they contain no tabs, newlines
+** or control characters, so position bookkeeping is the same as if each
+** character had been read through ReadChar().
+*/
+void      TY_(SkipRawRun)( StreamIn* in, uint count, uint chars );
+
+/* For single byte encodings, a table giving for each byte 128-255 the
+** UTF-8 form of the character ReadChar() would return for it: the
+** length, then the bytes. A length of 0 marks bytes that ReadChar()
+** reports or discards, which must be read the slow way. Returns NULL
+** for other encodings. SBMAP_LOCATES is or'ed into the length of the
+** vendor characters (WIN1252 smart quotes and the like) for which
+** ReadChar() sets the lexer's lines and columns to the character's
+** position, so that the caller can do the same.
+*/
+#define SBMAP_LOCATES 0x80
+
+const byte* TY_(SingleByteUTF8Map)( StreamIn* in );
+
+/* Offset into a buffer source of the next character ReadChar() will
+** return. Pushed back characters are assumed to be single bytes, so
+** the result is only an estimate after multibyte characters were
+** pushed back.
+*/
+uint      TY_(BufferInputOffset)( StreamIn* in );
+
 
 /************************
 ** Sink
@@ -107,6 +172,13 @@ struct _StreamOut
     uint  nl;
     IOType iotype;
     TidyOutputSink sink;
+    TidyPutBytesFunc putBytes;  /* writes to sink in blocks, or NULL */
+
+    /* Output for sinks with a putBytes callback is staged here until
+       FlushStreamOut(). Other sinks get each byte as it is written.
+    */
+    uint  outlen;
+    byte  outbuf[OUTBUF_SIZE];
 };
 
 StreamOut* TY_(FileOutput)( TidyDocImpl *doc, FILE* fp, int encoding, uint newln );
@@ -118,6 +190,8 @@ StreamOut* TY_(StdErrOutput)(void);
 void       TY_(ReleaseStreamOut)( TidyDocImpl *doc, StreamOut* out );
 
 void TY_(WriteChar)( uint c, StreamOut* out );
+void TY_(WriteByte)( uint b, StreamOut* out ); /* no encoding or newline translation */
+void TY_(FlushStreamOut)( StreamOut* out );
 void TY_(outBOM)( StreamOut *out );
 
 ctmbstr TY_(GetEncodingNameFromTidyId)(uint id);
@@ -12,6 +12,7 @@
 #include "message.h"
 #include "tmbstr.h"
 #include "sprtf.h"
+#include "tagshash.h"
 
 /* Attribute checking methods */
 static CheckAttribs CheckIMG;
@@ -162,11 +163,10 @@ static CheckAttribs CheckHTML;
 
 /*\ 
  * Issue #167 & #169 & #232
- * Tidy defaults to HTML5 mode
- * but allow this table to be ADJUSTED if NOT HTML5
- * was static const Dict tag_defs[] = 
+ * Tidy defaults to HTML5 mode. The rows that are different if NOT
+ * HTML5 are copied into each document, see tag_defs_html4[] below.
 \*/
-static Dict tag_defs[] =
+static const Dict tag_defs[] =
 {
   { TidyTag_UNKNOWN,    "unknown!",   VERS_UNKNOWN,         NULL,                       (0),                                           NULL,          NULL           },
 
@@ -334,16 +334,79 @@ static Dict tag_defs[] =
   { (TidyTagId)0,        NULL,         0,                    NULL,                       (0),                                           NULL,          NULL           }
 };
 
+/*\
+ * The HTML4 versions of the rows of tag_defs[] that differ before HTML5.
+ * Each document has its own copy of these rows, in this order, and its
+ * lookups return them instead of the shared rows. AdjustTags() and
+ * ResetTags() fill the copies from this table or from tag_defs[], so
+ * switching modes never writes to shared data and the nodes already
+ * pointing at a row see the change.
+ *
+ * Issue #167 & #169 - TidyTag_A is inline in HTML4
+ * Issue #196 - TidyTag_CAPTION allows %flow; in HTML5, but only %inline; in HTML4
+ * Issue #232 - TidyTag_OBJECT not in head in HTML5, but still allowed in HTML4
+ * Issue #461 - TidyTag_BUTTON is a block in HTML4, whereas it is inline in HTML5
+\*/
+static const Dict tag_defs_html4[N_TAG_OVERLAY] =
+{
+  { TidyTag_A,          "a",          VERS_ELEM_A,          &TY_(W3CAttrsFor_A)[0],          (CM_INLINE),                                   TY_(ParseInline),   NULL           },
+  { TidyTag_CAPTION,    "caption",    VERS_ELEM_CAPTION,    &TY_(W3CAttrsFor_CAPTION)[0],    (CM_TABLE),                                    TY_(ParseInline),   CheckCaption   },
+  { TidyTag_OBJECT,     "object",     VERS_ELEM_OBJECT,     &TY_(W3CAttrsFor_OBJECT)[0],     (CM_OBJECT|CM_IMG|CM_INLINE|CM_PARAM|CM_HEAD), TY_(ParseBlock),    NULL           },
+  { TidyTag_BUTTON,     "button",     VERS_ELEM_BUTTON,     &TY_(W3CAttrsFor_BUTTON)[0],     (CM_INLINE),                                   TY_(ParseBlock),    NULL           },
+};
+
+/* Returns the document's overlay row for `np` if it has one, else `np`.
+   Must agree with the order of tag_defs_html4[]. */
+static const Dict* tagsOverlay( TidyTagImpl* tags, const Dict* np )
+{
+    switch ( np->id )
+    {
+    case TidyTag_A:       return &tags->overlay[0];
+    case TidyTag_CAPTION: return &tags->overlay[1];
+    case TidyTag_OBJECT:  return &tags->overlay[2];
+    case TidyTag_BUTTON:  return &tags->overlay[3];
+    default:              return np;
+    }
+}
+
+/* FNV-1a with ASCII letters folded to lower case. The tables in
+   tagshash.h were generated against this exact function, so keep it
+   in step with build/namehash/namehash.rb. */
 static uint tagsHash(ctmbstr s)
 {
-    uint hashval;
+    uint hashval = TAG_HASH_SEED;
+    uint c;
 
-    for (hashval = 0; *s != '\0'; s++)
-        hashval = *s + 31*hashval;
+    for ( ; *s != '\0'; s++ )
+    {
+        c = (byte)*s;
+        if ( c >= 'A' && c <= 'Z' )
+            c += 'a' - 'A';
+        hashval = (hashval ^ c) * 16777619u;
+    }
 
-    return hashval % ELEMENT_HASH_SIZE;
+    return hashval;
 }
 
+/* The built-in tags sit in a static perfect hash, so a single probe
+   either finds the tag or proves it isn't one of ours. */
+static const Dict* tagsBuiltIn( TidyTagImpl* tags, ctmbstr s, uint hashval )
+{
+    uint bucket = (hashval >> 16) & (TAG_HASH_BUCKETS - 1);
+    uint ix = tag_hash_slot[(hashval + tag_hash_disp[bucket]) & (TAG_HASH_SLOTS - 1)];
+    const Dict *np;
+
+    if ( ix == 0 )
+        return NULL;
+
+    np = &tag_defs[ix - 1];
+    if ( s == np->name || TY_(tmbstrcmp)(s, np->name) == 0 )
+        return tagsOverlay( tags, np );
+    return NULL;
+}
+
+/* Declared tags are entered in the hash when they are declared and
+   stay there until FreeDeclaredTags() removes them. */
 static const Dict *tagsInstall(TidyDocImpl* doc, TidyTagImpl* tags, const Dict* old)
 {
     DictHash *np;
@@ -354,7 +417,7 @@ static const Dict *tagsInstall(TidyDocImpl* doc, TidyTagImpl* tags, const Dict*
         np = (DictHash *)TidyDocAlloc(doc, sizeof(*np));
         np->tag = old;
 
-        hashval = tagsHash(old->name);
+        hashval = tagsHash(old->name) % ELEMENT_HASH_SIZE;
         np->next = tags->hashtab[hashval];
         tags->hashtab[hashval] = np;
     }
@@ -364,7 +427,7 @@ static const Dict *tagsInstall(TidyDocImpl* doc, TidyTagImpl* tags, const Dict*
 
 static void tagsRemoveFromHash( TidyDocImpl* doc, TidyTagImpl* tags, ctmbstr s )
 {
-    uint h = tagsHash(s);
+    uint h = tagsHash(s) % ELEMENT_HASH_SIZE;
     DictHash *p, *prev = NULL;
     for (p = tags->hashtab[h]; p && p->tag; p = p->next)
     {
@@ -407,26 +470,20 @@ static const Dict* tagsLookup( TidyDocImpl* doc, TidyTagImpl* tags, ctmbstr s )
 {
     const Dict *np;
     const DictHash* p;
+    uint hashval;
 
     if (!s)
         return NULL;
 
-    /* this breaks if declared elements get changed between two   */
-    /* parser runs since Tidy would use the cached version rather */
-    /* than the new one.                                          */
-    /* However, as FreeDeclaredTags() correctly cleans the hash   */
-    /* this should not be true anymore.                           */
-    for (p = tags->hashtab[tagsHash(s)]; p && p->tag; p = p->next)
-        if (TY_(tmbstrcmp)(s, p->tag->name) == 0)
-            return p->tag;
-
-    for (np = tag_defs + 1; np < tag_defs + N_TIDY_TAGS; ++np)
-        if (TY_(tmbstrcmp)(s, np->name) == 0)
-            return tagsInstall(doc, tags, np);
+    hashval = tagsHash(s);
+    if ( (np = tagsBuiltIn(tags, s, hashval)) != NULL )
+        return np;
 
-    for (np = tags->declared_tag_list; np; np = np->next)
-        if (TY_(tmbstrcmp)(s, np->name) == 0)
-            return tagsInstall(doc, tags, np);
+    /* A miss costs the probe above plus one short chain of declared
+       tags, so unknown names need no cache of their own. */
+    for (p = tags->hashtab[hashval % ELEMENT_HASH_SIZE]; p; p = p->next)
+        if (s == p->tag->name || TY_(tmbstrcmp)(s, p->tag->name) == 0)
+            return p->tag;
 
     return NULL;
 }
@@ -464,6 +521,7 @@ static void declare( TidyDocImpl* doc, TidyTagImpl* tags,
             np = NewDict( doc, name );
             np->next = tags->declared_tag_list;
             tags->declared_tag_list = np;
+            tagsInstall( doc, tags, np );
         }
 
         /* Make sure we are not over-writing predefined tags */
@@ -583,6 +641,7 @@ Bool TY_(FindTag)( TidyDocImpl* doc, Node *node )
 
         TY_(DeclareUserTag)( doc, opt, node->element );
         node->tag = tagsLookup(doc, &doc->tags, node->element);
+        doc->tags.declaredCustom = yes;
 
         /* Output a message the first time we encounter an autonomous custom 
            tag. This applies despite the HTML5 mode. */
@@ -594,7 +653,17 @@ Bool TY_(FindTag)( TidyDocImpl* doc, Node *node )
     return no;
 }
 
-const Dict* TY_(LookupTagDef)( TidyTagId tid )
+ctmbstr TY_(BuiltInTagName)( TidyDocImpl* doc, ctmbstr name )
+{
+    const Dict *np = tagsLookup( doc, &doc->tags, name );
+
+    /* declared tags have allocated names that may go away */
+    if ( np && np->id != TidyTag_UNKNOWN )
+        return np->name;
+    return NULL;
+}
+
+static const Dict* tagsSharedDef( TidyTagId tid )
 {
     const Dict *np;
 
@@ -605,6 +674,28 @@ const Dict* TY_(LookupTagDef)( TidyTagId tid )
     return NULL;
 }
 
+/* Copies the HTML5 or the HTML4 rows into the document's overlay. */
+static void tagsFillOverlay( TidyTagImpl* tags, Bool html5 )
+{
+    uint i;
+
+    for ( i = 0; i < N_TAG_OVERLAY; ++i )
+    {
+        const Dict *np = tagsSharedDef( tag_defs_html4[i].id );
+        assert( tagsOverlay( tags, np ) == &tags->overlay[i] );
+        tags->overlay[i] = html5 ? *np : tag_defs_html4[i];
+    }
+}
+
+const Dict* TY_(LookupTagDef)( TidyDocImpl* doc, TidyTagId tid )
+{
+    const Dict *np = tagsSharedDef( tid );
+
+    if ( np )
+        return tagsOverlay( &doc->tags, np );
+    return NULL;
+}
+
 Parser* TY_(FindParser)( TidyDocImpl* doc, Node *node )
 {
     const Dict* np = tagsLookup( doc, &doc->tags, node->element );
@@ -648,6 +739,31 @@ void TY_(DefineTag)( TidyDocImpl* doc, UserTagType tagType, ctmbstr name )
         declare( doc, &doc->tags, name, vers, cm, parser, 0 );
 }
 
+/* Tells which user tag type a declared tag was declared as */
+static Bool tagIsOfType( const Dict* np, UserTagType tagType )
+{
+    switch ( tagType )
+    {
+    case tagtype_empty:
+        return ( np->model & CM_EMPTY ) != 0;
+
+    case tagtype_inline:
+        return ( np->model & CM_INLINE ) != 0;
+
+    case tagtype_block:
+        return ( (np->model & CM_BLOCK) != 0 &&
+                 np->parser == TY_(ParseBlock) );
+
+    case tagtype_pre:
+        return ( (np->model & CM_BLOCK) != 0 &&
+                 np->parser == TY_(ParsePre) );
+
+    case tagtype_null:
+        break;
+    }
+    return no;
+}
+
 TidyIterator   TY_(GetDeclaredTagList)( TidyDocImpl* doc )
 {
     return (TidyIterator) doc->tags.declared_tag_list;
@@ -660,36 +776,57 @@ ctmbstr        TY_(GetNextDeclaredTag)( TidyDocImpl* ARG_UNUSED(doc),
     Dict* curr;
     for ( curr = (Dict*) *iter; name == NULL && curr != NULL; curr = curr->next )
     {
-        switch ( tagType )
-        {
-        case tagtype_empty:
-            if ( (curr->model & CM_EMPTY) != 0 )
-                name = curr->name;
-            break;
+        if ( tagIsOfType(curr, tagType) )
+            name = curr->name;
+    }
+    *iter = (TidyIterator) curr;
+    return name;
+}
 
-        case tagtype_inline:
-            if ( (curr->model & CM_INLINE) != 0 )
-                name = curr->name;
-            break;
+Dict* TY_(CopyDeclaredTags)( TidyDocImpl* doc, uint* count )
+{
+    const Dict* np;
+    Dict* copies = NULL;
+    uint n = 0;
 
-        case tagtype_block:
-            if ( (curr->model & CM_BLOCK) != 0 &&
-                 curr->parser == TY_(ParseBlock) )
-                name = curr->name;
-            break;
+    for ( np = doc->tags.declared_tag_list; np; np = np->next )
+        ++n;
+    if ( n > 0 )
+        copies = (Dict*) TidyDocAlloc( doc, n * sizeof(Dict) );
 
-        case tagtype_pre:
-            if ( (curr->model & CM_BLOCK) != 0 &&
-                 curr->parser == TY_(ParsePre) )
-                name = curr->name;
-            break;
+    *count = n;
+    for ( n = 0, np = doc->tags.declared_tag_list; np; np = np->next, ++n )
+    {
+        copies[n] = *np;
+        copies[n].name = TY_(tmbstrdup)( doc->allocator, np->name );
+        copies[n].next = NULL;
+    }
+    return copies;
+}
 
-        case tagtype_null:
-            break;
-        }
+/* Declared in the reverse order, so that they end up listed as they were
+   in the document that was copied. */
+void TY_(DeclareTagCopies)( TidyDocImpl* doc, const Dict* copies, uint count,
+                            UserTagType tagType )
+{
+    uint i = count;
+
+    while ( i-- > 0 )
+    {
+        const Dict* np = &copies[i];
+        if ( tagType == tagtype_null || tagIsOfType(np, tagType) )
+            declare( doc, &doc->tags, np->name, np->versions, np->model,
+                     np->parser, np->chkattrs );
     }
-    *iter = (TidyIterator) curr;
-    return name;
+}
+
+void TY_(FreeTagCopies)( TidyAllocator* allocator, Dict* copies, uint count )
+{
+    uint i;
+
+    for ( i = 0; i < count; ++i )
+        TidyFree( allocator, copies[i].name );
+    TidyFree( allocator, copies );
 }
 
 void TY_(InitTags)( TidyDocImpl* doc )
@@ -707,6 +844,8 @@ void TY_(InitTags)( TidyDocImpl* doc )
     xml->chkattrs = 0;
     xml->attrvers = NULL;
     tags->xml_tags = xml;
+
+    tagsFillOverlay( tags, yes );
 }
 
 /* By default, zap all of them.  But allow
@@ -719,31 +858,8 @@ void TY_(FreeDeclaredTags)( TidyDocImpl* doc, UserTagType tagType )
 
     for ( curr=tags->declared_tag_list; curr; curr = next )
     {
-        Bool deleteIt = yes;
+        Bool deleteIt = ( tagType == tagtype_null || tagIsOfType(curr, tagType) );
         next = curr->next;
-        switch ( tagType )
-        {
-        case tagtype_empty:
-            deleteIt = ( curr->model & CM_EMPTY ) != 0;
-            break;
-
-        case tagtype_inline:
-            deleteIt = ( curr->model & CM_INLINE ) != 0;
-            break;
-
-        case tagtype_block:
-            deleteIt = ( (curr->model & CM_BLOCK) != 0 &&
-                         curr->parser == TY_(ParseBlock) );
-            break;
-
-        case tagtype_pre:
-            deleteIt = ( (curr->model & CM_BLOCK) != 0 &&
-                         curr->parser == TY_(ParsePre) );
-            break;
-
-        case tagtype_null:
-            break;
-        }
 
         if ( deleteIt )
         {
@@ -765,53 +881,12 @@ void TY_(FreeDeclaredTags)( TidyDocImpl* doc, UserTagType tagType )
  * If the <!DOCTYPE ...> is found to NOT be HTML5,
  * then adjust tags to HTML4 mode
  *
- * NOTE: For each change added to here, there must 
- * be a RESET added in TY_(ResetTags) below!
+ * NOTE: Each tag that changes needs a row in
+ * tag_defs_html4[] and a case in tagsOverlay()!
 \*/
 void TY_(AdjustTags)( TidyDocImpl *doc )
 {
-    Dict *np = (Dict *)TY_(LookupTagDef)( TidyTag_A );
-    TidyTagImpl* tags = &doc->tags;
-    if (np) 
-    {
-        np->parser = TY_(ParseInline);
-        np->model  = CM_INLINE;
-    }
-
-/*\
- * Issue #196
- * TidyTag_CAPTION allows %flow; in HTML5,
- * but only %inline; in HTML4
-\*/
-    np = (Dict *)TY_(LookupTagDef)( TidyTag_CAPTION );
-    if (np)
-    {
-        np->parser = TY_(ParseInline);
-    }
-
-/*\
- * Issue #232
- * TidyTag_OBJECT not in head in HTML5,
- * but still allowed in HTML4
-\*/
-    np = (Dict *)TY_(LookupTagDef)( TidyTag_OBJECT );
-    if (np)
-    {
-        np->model |= CM_HEAD; /* add back allowed in head */
-    }
-
-/*\
- * Issue #461
- * TidyTag_BUTTON is a block in HTML4,
- * whereas it is inline in HTML5
-\*/
-    np = (Dict *)TY_(LookupTagDef)(TidyTag_BUTTON);
-    if (np)
-    {
-        np->parser = TY_(ParseBlock);
-    }
-
-    tagsEmptyHash(doc, tags); /* not sure this is really required, but to be sure */
+    tagsFillOverlay( &doc->tags, no );
     doc->HTML5Mode = no;   /* set *NOT* HTML5 mode */
 
 }
@@ -824,41 +899,11 @@ Bool TY_(IsHTML5Mode)( TidyDocImpl *doc )
 
 /*\
  * Issue #285
- * Reset the table to default HTML5 mode.
- * For every change made in the above AdjustTags,
- * the equivalent reset must be added here.
+ * Reset the document's tags to default HTML5 mode.
 \*/
 void TY_(ResetTags)( TidyDocImpl *doc )
 {
-    Dict *np = (Dict *)TY_(LookupTagDef)( TidyTag_A );
-    TidyTagImpl* tags = &doc->tags;
-    if (np) 
-    {
-        np->parser = TY_(ParseBlock);
-        np->model  = (CM_INLINE|CM_BLOCK|CM_MIXED);
-    }
-    np = (Dict *)TY_(LookupTagDef)( TidyTag_CAPTION );
-    if (np)
-    {
-        np->parser = TY_(ParseBlock);
-    }
-
-    np = (Dict *)TY_(LookupTagDef)( TidyTag_OBJECT );
-    if (np)
-    {
-        np->model = (CM_OBJECT|CM_IMG|CM_INLINE|CM_PARAM); /* reset */
-    }
-    /*\
-     * Issue #461
-     * TidyTag_BUTTON reset to inline in HTML5
-    \*/
-    np = (Dict *)TY_(LookupTagDef)(TidyTag_BUTTON);
-    if (np)
-    {
-        np->parser = TY_(ParseInline);
-    }
-
-    tagsEmptyHash( doc, tags ); /* not sure this is really required, but to be sure */
+    tagsFillOverlay( &doc->tags, yes );
     doc->HTML5Mode = yes;   /* set HTML5 mode */
 }
 
@@ -1040,7 +1085,7 @@ Bool TY_(nodeHasText)( TidyDocImpl* doc, Node* node )
     for ( ix = node->start; ix < node->end; ++ix )
     {
         /* whitespace */
-        if ( !TY_(IsWhite)( lexer->lexbuf[ix] ) )
+        if ( !TY_(IsWhite)( NodeTextBuf(lexer, node)[ix] ) )
             return yes;
     }
   }
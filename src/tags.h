@@ -106,11 +106,18 @@ typedef struct _DictHash
 
 /** This structure consists of the lists of all tags known to Tidy.
  */
+/** The number of built-in tags whose content model differs between HTML5
+ ** and earlier versions of HTML.
+ */
+#define N_TAG_OVERLAY 4
+
 typedef struct _TidyTagImpl
 {
     Dict* xml_tags;                        /**< Placeholder for all xml tags. */
     Dict* declared_tag_list;               /**< User-declared tags. */
-    DictHash* hashtab[ELEMENT_HASH_SIZE];  /**< All of Tidy's built-in tags. */
+    DictHash* hashtab[ELEMENT_HASH_SIZE];  /**< Declared tags by name; built-in tags are in tagshash.h. */
+    Dict overlay[N_TAG_OVERLAY];           /**< This document's own rows for the tags whose content model depends on the HTML version. */
+    Bool declaredCustom;                   /**< Autonomous custom tags have been declared, see TY_(FindTag)(). */
 } TidyTagImpl;
 
 
@@ -123,10 +130,18 @@ void TY_(DeclareUserTag)( TidyDocImpl* doc, const TidyOptionImpl* opt, ctmbstr n
 
 
 /** Interface for finding a tag by TidyTagId.
+ ** @param doc The Tidy document.
  ** @param tid The TidyTagId to search for.
  ** @returns An instance of a Tidy tag.
  */
-const Dict* TY_(LookupTagDef)( TidyTagId tid );
+const Dict* TY_(LookupTagDef)( TidyDocImpl* doc, TidyTagId tid );
+
+/** Interface for finding the static name of a built-in tag.
+ ** @param doc The Tidy document.
+ ** @param name The name to search for.
+ ** @returns The built-in tag's name if it is exactly `name`, else NULL.
+ */
+ctmbstr TY_(BuiltInTagName)( TidyDocImpl* doc, ctmbstr name );
 
 /** Assigns the node's tag.
  ** @param doc The Tidy document.
@@ -187,6 +202,33 @@ ctmbstr        TY_(GetNextDeclaredTag)( TidyDocImpl* doc, UserTagType tagType,
                                         TidyIterator* iter );
 
 
+/** Copies the declared tags, for a shared configuration.
+ ** @param doc The Tidy document.
+ ** @param count Set to the number of tags copied.
+ ** @result The copies, allocated with the document's allocator.
+ */
+Dict*   TY_(CopyDeclaredTags)( TidyDocImpl* doc, uint* count );
+
+
+/** Declares tags copied by TY_(CopyDeclaredTags)() in the document.
+ ** @param doc The Tidy document.
+ ** @param copies The copied tags.
+ ** @param count The number of copied tags.
+ ** @param tagType Declares only the tags of this type, or all of them
+ **        with tagtype_null.
+ */
+void    TY_(DeclareTagCopies)( TidyDocImpl* doc, const Dict* copies, uint count,
+                               UserTagType tagType );
+
+
+/** Frees tags copied by TY_(CopyDeclaredTags)().
+ ** @param allocator The allocator they were copied with.
+ ** @param copies The copied tags.
+ ** @param count The number of copied tags.
+ */
+void    TY_(FreeTagCopies)( TidyAllocator* allocator, Dict* copies, uint count );
+
+
 /** Initializes tags and tag structures for the given Tidy document.
  ** @param doc The Tidy document.
  */
@@ -200,13 +242,14 @@ void TY_(FreeTags)( TidyDocImpl* doc );
 
 
 /** Tidy defaults to HTML5 mode. If the <!DOCTYPE ...> is found to NOT be
- ** HTML5, then adjust the tags table to HTML4 mode.
+ ** HTML5, then adjust the document's tags to HTML4 mode. Only the document's
+ ** own overlay rows change, so the nodes already pointing at them follow.
  ** @param doc The Tidy document.
  */
 void TY_(AdjustTags)( TidyDocImpl *doc );
 
 
-/** Reset the tags table back to default HTML5 mode.
+/** Reset the document's tags back to default HTML5 mode.
  ** @param doc The Tidy document.
  */
 void TY_(ResetTags)( TidyDocImpl *doc );
@@ -0,0 +1,48 @@
+#ifndef __TAGSHASH_H__
+#define __TAGSHASH_H__
+
+/* tagshash.h -- perfect hash over the names in tag_defs
+
+  THIS FILE IS MACHINE GENERATED by build/namehash/namehash.rb from
+  src/tags.c; do not edit it by hand. Regenerate it whenever a row
+  is added to, removed from or moved within tag_defs.
+
+  (c) 2017 HTACG
+  See tidy.h for the copyright notice.
+*/
+
+#define TAG_HASH_SEED     0x811c9dc7u
+#define TAG_HASH_BUCKETS  64u
+#define TAG_HASH_SLOTS    256u
+
+/* added to the hash before masking, indexed by bits 16 and up */
+static const unsigned short tag_hash_disp[TAG_HASH_BUCKETS] =
+{
+     10,   2,   0,   0,   3,   3,   1,   3,   6,   0,   0,  11,   0,   0,   0,   0,
+      0,   0,   3,   2,   2,   0,   0,   9,   5,   0,   1,   6,   1,   0,   4,   2,
+      0,   2,   1,   4,   1,   1,   3,   0,   0,   0,   9,   6,   1,   1,   0,   7,
+      0,   0,   0,   8,   0,   0,   5,   4,   0,   0,   0,   4,   0,   0,   0,   0
+};
+
+/* tag_defs index + 1 of the name in each slot; 0 marks a free slot */
+static const unsigned short tag_hash_slot[TAG_HASH_SLOTS] =
+{
+    130,  75,   0,  10, 133, 119,  51,  26,  24, 115,   0, 108,   0,  84,   0, 134,
+     21,  41,   0, 107,  50,  66,  32,   0,  29,  82,   7,  86, 131,  64,   0,   0,
+      0,   0,   0,  88,  68,  48,  53, 124,  96,  62,  77,   0,   0,   0,   0, 127,
+    110,   0,   0, 122,   0,   0, 100, 150,  61,   0,   0,   0,   0,   0, 144,   0,
+      0,   0,   0,   0,   0, 145,   0,   0,  23, 132,  18,  76,  58,  74,   0,   0,
+     31, 152,   2,  27, 138, 146,  97,  92,  40,  85, 125,  16,  78,  37,   5,   0,
+      0,  98,  12,   0,   0, 136,  20,   0,   0,   0,   0,   0,   0,  33,   0,  34,
+      0,  30,   0,  95,   0,   0,  22,   0, 142,   0, 123,   0,  63, 117,  55,  89,
+    102, 126,  71,   0, 129,   0, 137,  99, 109,   0,   0,   0,  83,  54, 141, 140,
+      0,   0, 105,   0, 103,   0,   0,   0,   4,   0, 151,   0,   0,  43,   0,   0,
+      0,   0,  80,   0,  36,   0,   0, 135, 106, 116,   0,   0,   0,  49,   0,   0,
+     28, 101,  57,   0,  67,   0,   0,  15, 118,  25,   0,   0,   0,   0,   0,   8,
+     52,  42,  69, 147,  70, 148,  47, 121,   0,   0,  38,   9,   6,  87,   0, 128,
+     13, 143,   3,   0,   0,   0, 149,  17,   0,   0,   0, 104,   0,  93,  94,   0,
+     46,   0,   0,  14,  35, 111,   0,  81, 120,  56,  45,  39,  11, 112,  59,   0,
+     79, 114,   0, 113,  65,  60,   0,  72,   0, 139,  44,   0,  91,  19,  90,  73
+};
+
+#endif /* __TAGSHASH_H__ */
@@ -16,6 +16,8 @@
 #include "pprint.h"
 #include "access.h"
 #include "message.h"
+#include "messageobj.h"
+#include "language.h"
 
 #ifndef MAX
 #define MAX(a,b) (((a) > (b))?(a):(b))
@@ -70,6 +72,7 @@ struct _TidyDocImpl
     uint                infoMessages;
     uint                docErrors;
     int                 parseStatus;
+    TidyMessageRecords  messageRecords; /* messages kept as data, if asked for */
 
     uint                badAccess;   /* for accessibility errors */
     uint                badLayout;   /* for bad style errors */
@@ -79,6 +82,7 @@ struct _TidyDocImpl
 
     Bool                HTML5Mode;   /* current mode is html5 */
     Bool                xmlDetected; /* true if XML was used/detected */
+    Bool                snapshotPending; /* parsing took a config snapshot that no save has restored */
 
     /* Memory allocator */
     TidyAllocator*      allocator;
@@ -87,6 +91,7 @@ struct _TidyDocImpl
     void*               appData;
     uint                nClassId;
     Bool                inputHadBOM;
+    tidyLanguageChoice  language;    /* set by tidySetDocLanguage() */
 
 #if PRESERVE_FILE_TIMES
     struct utimbuf      filetimes;
@@ -112,6 +117,8 @@ struct _TidyMessageImpl
     int                 argcount;    /* the number of arguments */
     struct printfArg*   arguments;   /* the arguments' values and types */
 
+    /* The key and the formatted strings below are NULL until first asked
+       for through the accessors in messageobj.c, which build them. */
     ctmbstr             messageKey;             /* the message code as a key string */
 
     ctmbstr             messageFormatDefault;   /* the built-in format string */
@@ -146,6 +153,9 @@ struct _TidyMessageImpl
 #define tidyOptionToImpl( topt )        ((const TidyOptionImpl*)(topt))
 #define tidyImplToOption( option )      ((TidyOption)(option))
 
+#define tidyConfigToImpl( tcfg )        ((TidySharedConfig*)(tcfg))
+#define tidyImplToConfig( shared )      ((TidyCompiledConfig)(shared))
+
 
 /** Wrappers for easy memory allocation using the document's allocator */
 #define TidyDocAlloc(doc, size) TidyAlloc((doc)->allocator, size)
@@ -153,6 +163,10 @@ struct _TidyMessageImpl
 #define TidyDocFree(doc, block) TidyFree((doc)->allocator, block)
 #define TidyDocPanic(doc, msg) TidyPanic((doc)->allocator, msg)
 
+/** Allocator for the Node and AttVal structures of the document tree */
+#define TidyDocNodeAllocator(doc) \
+    ((doc)->lexer ? (doc)->lexer->nodeAllocator : (doc)->allocator)
+
 int          TY_(DocParseStream)( TidyDocImpl* impl, StreamIn* in );
 
 /*
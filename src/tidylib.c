@@ -18,6 +18,15 @@
 
 */
 
+#if defined(_WIN32)
+#  if !defined(_WIN32_WINNT) || (_WIN32_WINNT < 0x0600)
+#    undef _WIN32_WINNT
+#    define _WIN32_WINNT 0x0600  /* InitOnceExecuteOnce() */
+#  endif
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#endif
 #include <errno.h>
 
 #include "tidy-int.h"
@@ -43,6 +52,7 @@
 /* Create/Destroy a Tidy "document" object */
 static TidyDocImpl* tidyDocCreate( TidyAllocator *allocator );
 static void         tidyDocRelease( TidyDocImpl* impl );
+static void         tidyDocReset( TidyDocImpl* impl );
 
 static int          tidyDocStatus( TidyDocImpl* impl );
 
@@ -101,17 +111,20 @@ void TIDY_CALL          tidyRelease( TidyDoc tdoc )
   tidyDocRelease( impl );
 }
 
-TidyDocImpl* tidyDocCreate( TidyAllocator *allocator )
+void TIDY_CALL          tidyReset( TidyDoc tdoc )
 {
-    TidyDocImpl* doc = (TidyDocImpl*)TidyAlloc( allocator, sizeof(TidyDocImpl) );
-    TidyClearMemory( doc, sizeof(*doc) );
-    doc->allocator = allocator;
+  TidyDocImpl* impl = tidyDocToImpl( tdoc );
+  tidyDocReset( impl );
+}
 
-    TY_(InitMap)();
-    TY_(InitTags)( doc );
-    TY_(InitAttrs)( doc );
-    TY_(InitConfig)( doc );
-    TY_(InitPrintBuf)( doc );
+/* The tables and settings shared by all documents are completed once, by
+** whichever tidyCreate() comes first, and only read after that. Creates
+** racing on other threads wait for it to finish.
+*/
+static void tidyLibraryBuild( void )
+{
+    TY_(tidyBuildLanguageIndexes)();
+    TY_(BuildDispatchIndex)();
 
     /* Set the locale for tidy's output. This both configures
     ** LibTidy to use the environment's locale as well as the
@@ -133,6 +146,46 @@ TidyDocImpl* tidyDocCreate( TidyAllocator *allocator )
         }
     }
 #endif
+}
+
+#if defined(_WIN32)
+static INIT_ONCE tidyLibraryOnce = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK tidyLibraryBuildOnce( PINIT_ONCE once, PVOID param,
+                                           PVOID* context )
+{
+    (void) once;
+    (void) param;
+    (void) context;
+    tidyLibraryBuild();
+    return TRUE;
+}
+
+static void tidyLibraryInit( void )
+{
+    InitOnceExecuteOnce( &tidyLibraryOnce, tidyLibraryBuildOnce, NULL, NULL );
+}
+#else
+static pthread_once_t tidyLibraryOnce = PTHREAD_ONCE_INIT;
+
+static void tidyLibraryInit( void )
+{
+    pthread_once( &tidyLibraryOnce, tidyLibraryBuild );
+}
+#endif
+
+TidyDocImpl* tidyDocCreate( TidyAllocator *allocator )
+{
+    TidyDocImpl* doc = (TidyDocImpl*)TidyAlloc( allocator, sizeof(TidyDocImpl) );
+    TidyClearMemory( doc, sizeof(*doc) );
+    doc->allocator = allocator;
+
+    tidyLibraryInit();
+
+    TY_(InitTags)( doc );
+    TY_(InitAttrs)( doc );
+    TY_(InitConfig)( doc );
+    TY_(InitPrintBuf)( doc );
 
     /* By default, wire tidy messages to standard error.
     ** Document input will be set by parsing routines.
@@ -166,6 +219,7 @@ void          tidyDocRelease( TidyDocImpl* doc )
         TY_(FreeAttrTable)( doc );
         TY_(FreeAttrPriorityList)( doc );
         TY_(FreeMutedMessageList( doc ));
+        TY_(FreeMessageRecords)( doc );
         TY_(FreeTags)( doc );
         /*\ 
          *  Issue #186 - Now FreeNode depend on the doctype, so the lexer is needed
@@ -176,6 +230,59 @@ void          tidyDocRelease( TidyDocImpl* doc )
     }
 }
 
+/* Drops everything that belongs to the current document, but keeps the
+** configuration and the buffers and tables that the document has grown.
+** Options changed by parsing a document that was never saved are put
+** back, as saving it would have done.
+*/
+void          tidyDocReset( TidyDocImpl* doc )
+{
+    if ( doc )
+    {
+        assert( doc->docIn == NULL );
+        assert( doc->docOut == NULL );
+
+        if ( doc->snapshotPending )
+        {
+            TY_(ResetConfigToSnapshot)( doc );
+            doc->snapshotPending = no;
+        }
+
+        TY_(FreeAnchors)( doc );
+        TY_(FreeNode)(doc, &doc->root);
+        TidyClearMemory(&doc->root, sizeof(Node));
+
+        if (doc->givenDoctype)
+            TidyDocFree(doc, doc->givenDoctype);
+        doc->givenDoctype = NULL;
+
+        /* after the tree, see tidyDocRelease() */
+        if ( doc->lexer )
+            TY_(ResetLexer)( doc );
+
+        TY_(ResetTags)( doc );
+        TY_(ResetDeclaredTags)( doc );
+        TY_(ResetPrintBuf)( doc );
+        TY_(ResetRepeatedMessages)( doc );
+        TY_(ClearMessageRecords)( doc );
+
+        doc->errors = 0;
+        doc->warnings = 0;
+        doc->accessErrors = 0;
+        doc->infoMessages = 0;
+        doc->docErrors = 0;
+        doc->parseStatus = 0;
+        doc->badAccess = 0;
+        doc->badLayout = 0;
+        doc->badChars = 0;
+        doc->badForm = 0;
+        doc->footnotes = 0;
+        doc->xmlDetected = no;
+        doc->nClassId = 0;
+        doc->inputHadBOM = no;
+    }
+}
+
 /* Let application store a chunk of data w/ each Tidy tdocance.
 ** Useful for callbacks.
 */
@@ -614,10 +721,10 @@ ctmbstr TIDY_CALL      tidyOptGetNextMutedMessage(TidyDoc tdoc, TidyIterator* it
     return result;
 }
 
-ctmbstr TIDY_CALL tidyOptGetDoc( TidyDoc ARG_UNUSED(tdoc), TidyOption opt )
+ctmbstr TIDY_CALL tidyOptGetDoc( TidyDoc tdoc, TidyOption opt )
 {
     const TidyOptionId optId = tidyOptGetId( opt );
-    return tidyLocalizedString(optId);
+    return TY_(tidyDocLocalizedString)( tidyDocToImpl(tdoc), optId );
 }
 
 #if SUPPORT_CONSOLE_APP
@@ -681,6 +788,7 @@ Bool TIDY_CALL tidyOptResetToSnapshot( TidyDoc tdoc )
     if ( impl )
     {
         TY_(ResetConfigToSnapshot)( impl );
+        impl->snapshotPending = no;
         return yes;
     }
     return no;
@@ -731,6 +839,31 @@ Bool TIDY_CALL tidyOptCopyConfig( TidyDoc to, TidyDoc from )
     return no;
 }
 
+TidyCompiledConfig TIDY_CALL tidyOptCompileConfig( TidyDoc tdoc )
+{
+    TidyDocImpl* impl = tidyDocToImpl( tdoc );
+    if ( impl )
+        return tidyImplToConfig( TY_(CompileConfig)( impl ) );
+    return NULL;
+}
+
+Bool TIDY_CALL tidyOptUseConfig( TidyDoc tdoc, TidyCompiledConfig tcfg )
+{
+    TidyDocImpl* impl = tidyDocToImpl( tdoc );
+    if ( impl )
+    {
+        TY_(UseSharedConfig)( impl, tidyConfigToImpl( tcfg ) );
+        return yes;
+    }
+    return no;
+}
+
+void TIDY_CALL tidyOptReleaseConfig( TidyCompiledConfig tcfg )
+{
+    if ( tcfg )
+        TY_(FreeSharedConfig)( tidyConfigToImpl( tcfg ) );
+}
+
 
 /* I/O and Message handling interface
 **
@@ -798,153 +931,180 @@ Bool TIDY_CALL tidySetMessageCallback( TidyDoc tdoc, TidyMessageCallback filt )
 TidyDoc TIDY_CALL tidyGetMessageDoc( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    TidyDocImpl* doc = TY_(getMessageDoc)(*message);
+    TidyDocImpl* doc = TY_(getMessageDoc)(message);
     return tidyImplToDoc(doc);
 }
 
 uint TIDY_CALL tidyGetMessageCode( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageCode)(*message);
+    return TY_(getMessageCode)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessageKey( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageKey)(*message);
+    return TY_(getMessageKey)(message);
 }
 
 int TIDY_CALL tidyGetMessageLine( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageLine)(*message);
+    return TY_(getMessageLine)(message);
 }
 
 int TIDY_CALL tidyGetMessageColumn( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageColumn)(*message);
+    return TY_(getMessageColumn)(message);
 }
 
 TidyReportLevel TIDY_CALL tidyGetMessageLevel( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageLevel)(*message);
+    return TY_(getMessageLevel)(message);
 }
 
 Bool TIDY_CALL tidyGetMessageIsMuted( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageIsMuted)(*message);
+    return TY_(getMessageIsMuted)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessageFormatDefault( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageFormatDefault)(*message);
+    return TY_(getMessageFormatDefault)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessageFormat( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageFormat)(*message);
+    return TY_(getMessageFormat)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessageDefault( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageDefault)(*message);
+    return TY_(getMessageDefault)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessage( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessage)(*message);
+    return TY_(getMessage)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessagePosDefault( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessagePosDefault)(*message);
+    return TY_(getMessagePosDefault)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessagePos( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessagePos)(*message);
+    return TY_(getMessagePos)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessagePrefixDefault( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessagePrefixDefault)(*message);
+    return TY_(getMessagePrefixDefault)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessagePrefix( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessagePrefix)(*message);
+    return TY_(getMessagePrefix)(message);
 }
 
 
 ctmbstr TIDY_CALL tidyGetMessageOutputDefault( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageOutputDefault)(*message);
+    return TY_(getMessageOutputDefault)(message);
 }
 
 ctmbstr TIDY_CALL tidyGetMessageOutput( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageOutput)(*message);
+    return TY_(getMessageOutput)(message);
 }
 
 TidyIterator TIDY_CALL tidyGetMessageArguments( TidyMessage tmessage )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getMessageArguments)(*message);
+    return TY_(getMessageArguments)(message);
 }
 
 TidyMessageArgument TIDY_CALL tidyGetNextMessageArgument( TidyMessage tmessage, TidyIterator* iter )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getNextMessageArgument)(*message, iter);
+    return TY_(getNextMessageArgument)(message, iter);
 }
 
 TidyFormatParameterType TIDY_CALL tidyGetArgType( TidyMessage tmessage, TidyMessageArgument* arg )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getArgType)(*message, arg);
+    return TY_(getArgType)(message, arg);
 }
 
 ctmbstr TIDY_CALL tidyGetArgFormat( TidyMessage tmessage, TidyMessageArgument* arg )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getArgFormat)(*message, arg);
+    return TY_(getArgFormat)(message, arg);
 }
 
 ctmbstr TIDY_CALL tidyGetArgValueString( TidyMessage tmessage, TidyMessageArgument* arg )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getArgValueString)(*message, arg);
+    return TY_(getArgValueString)(message, arg);
 }
 
 uint TIDY_CALL tidyGetArgValueUInt( TidyMessage tmessage, TidyMessageArgument* arg )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getArgValueUInt)(*message, arg);
+    return TY_(getArgValueUInt)(message, arg);
 }
 
 int TIDY_CALL tidyGetArgValueInt( TidyMessage tmessage, TidyMessageArgument* arg )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getArgValueInt)(*message, arg);
+    return TY_(getArgValueInt)(message, arg);
 }
 
 double TIDY_CALL tidyGetArgValueDouble( TidyMessage tmessage, TidyMessageArgument* arg )
 {
     TidyMessageImpl *message = tidyMessageToImpl(tmessage);
-    return TY_(getArgValueDouble)(*message, arg);
+    return TY_(getArgValueDouble)(message, arg);
+}
+
+Bool TIDY_CALL tidySetMessageRecording( TidyDoc tdoc, Bool record )
+{
+    TidyDocImpl* impl = tidyDocToImpl( tdoc );
+    if ( impl )
+    {
+        TY_(SetMessageRecording)( impl, record );
+        return yes;
+    }
+    return no;
+}
+
+TidyIterator TIDY_CALL tidyGetMessageRecords( TidyDoc tdoc )
+{
+    TidyDocImpl* impl = tidyDocToImpl( tdoc );
+    if ( impl )
+        return TY_(getMessageRecords)( impl );
+    return (TidyIterator) 0;
+}
+
+TidyMessage TIDY_CALL tidyGetNextMessageRecord( TidyDoc tdoc, TidyIterator* iter )
+{
+    TidyDocImpl* impl = tidyDocToImpl( tdoc );
+    if ( impl )
+        return tidyImplToMessage( TY_(getNextMessageRecord)( impl, iter ) );
+    return NULL;
 }
 
 
@@ -1458,6 +1618,7 @@ int         TY_(DocParseStream)( TidyDocImpl* doc, StreamIn* in )
 
     TY_(ResetTags)(doc);    /* reset table to html5 mode */
     TY_(TakeConfigSnapshot)( doc );    /* Save config state */
+    doc->snapshotPending = yes;
     TY_(FreeAnchors)( doc );
 
     TY_(FreeNode)(doc, &doc->root);
@@ -1467,12 +1628,14 @@ int         TY_(DocParseStream)( TidyDocImpl* doc, StreamIn* in )
         TidyDocFree(doc, doc->givenDoctype);
     /*\ 
      *  Issue #186 - Now FreeNode depend on the doctype, so the lexer is needed
-     *  to determine which hash is to be used, so free it last.
+     *  to determine which hash is to be used, so reset it last.
     \*/
-    TY_(FreeLexer)( doc );
+    if ( doc->lexer )
+        TY_(ResetLexer)( doc );
+    else
+        doc->lexer = TY_(NewLexer)( doc );
     doc->givenDoctype = NULL;
 
-    doc->lexer = TY_(NewLexer)( doc );
     /* doc->lexer->root = &doc->root; */
     doc->root.line = doc->lexer->lines;
     doc->root.column = doc->lexer->columns;
@@ -1487,6 +1650,18 @@ int         TY_(DocParseStream)( TidyDocImpl* doc, StreamIn* in )
         TY_(SetOptionInt)(doc, TidyInCharEncoding, bomEnc);
     }
 
+    /* text that needs no rewriting can stay in the caller's buffer */
+    if ( cfgBool(doc, TidyZeroCopyInput) && in->iotype == BufferIO
+         && in->encoding == UTF8 )
+    {
+        TidyBuffer* inbuf = (TidyBuffer*) in->source.sourceData;
+        doc->lexer->spanbuf = (ctmbstr) inbuf->bp;
+        doc->lexer->spansize = inbuf->size;
+    }
+
+    TY_(ResolveLexerOptions)( doc );
+    TY_(ResolveParserOptions)( doc );
+
     /* Tidy doesn't alter the doctype for generic XML docs */
     if ( xmlIn )
     {
@@ -1983,18 +2158,18 @@ void dbg_show_node( TidyDocImpl* doc, Node *node, int caller, int indent )
         if (len < 40) {
             /* show it all */
             for (i = node->start; i < node->end; i++) {
-                SPRTF("%c", lexer->lexbuf[i]);
+                SPRTF("%c", NodeTextBuf(lexer, node)[i]);
             }
         } else {
             /* partial display */
             uint max = 19;
             for (i = node->start; i < max; i++) {
-                SPRTF("%c", lexer->lexbuf[i]);
+                SPRTF("%c", NodeTextBuf(lexer, node)[i]);
             }
             SPRTF("...");
             i = node->end - 19;
             for (; i < node->end; i++) {
-                SPRTF("%c", lexer->lexbuf[i]);
+                SPRTF("%c", NodeTextBuf(lexer, node)[i]);
             }
         }
         SPRTF("'");
@@ -2213,9 +2388,9 @@ int         tidyDocSaveStream( TidyDocImpl* doc, StreamOut* out )
     doc->pConfigChangeCallback = NULL;
 
     if (ppWithTabs)
-        TY_(PPrintTabs)();
+        TY_(PPrintTabs)( doc );
     else
-        TY_(PPrintSpaces)();
+        TY_(PPrintSpaces)( doc );
 
     if (escapeCDATA)
         TY_(ConvertCDATANodes)(doc, &doc->root);
@@ -2255,6 +2430,7 @@ int         tidyDocSaveStream( TidyDocImpl* doc, StreamOut* out )
         */
 
         doc->docOut = out;
+        TY_(ResolvePrinterOptions)( doc );
         if ( xmlOut && !xhtmlOut )
             TY_(PPrintXMLTree)( doc, NORMAL, 0, &doc->root );
         else if ( showBodyOnly( doc, bodyOnly ) )
@@ -2265,8 +2441,10 @@ int         tidyDocSaveStream( TidyDocImpl* doc, StreamOut* out )
         TY_(PFlushLine)( doc, 0 );
         doc->docOut = NULL;
     }
+    TY_(FlushStreamOut)( out );
 
     TY_(ResetConfigToSnapshot)( doc );
+    doc->snapshotPending = no;
     doc->pConfigChangeCallback = callback;
     
     return tidyDocStatus( doc );
@@ -2410,12 +2588,14 @@ Bool TIDY_CALL tidyNodeGetText( TidyDoc tdoc, TidyNode tnod, TidyBuffer* outbuf
       Bool xhtmlOut   = cfgBool( doc, TidyXhtmlOut );
 
       doc->docOut = out;
+      TY_(ResolvePrinterOptions)( doc );
       if ( xmlOut && !xhtmlOut )
           TY_(PPrintXMLTree)( doc, NORMAL, 0, nimp );
       else
           TY_(PPrintTree)( doc, NORMAL, 0, nimp );
 
       TY_(PFlushLine)( doc, 0 );
+      TY_(FlushStreamOut)( out );
       doc->docOut = NULL;
 
       TidyDocFree( doc, out );
@@ -2442,7 +2622,7 @@ Bool TIDY_CALL tidyNodeGetValue( TidyDoc tdoc, TidyNode tnod, TidyBuffer* buf )
     case PhpTag:
     {
         tidyBufClear( buf );
-        tidyBufAppend( buf, doc->lexer->lexbuf + node->start,
+        tidyBufAppend( buf, (void*)(NodeTextBuf(doc->lexer, node) + node->start),
                        node->end - node->start );
         break;
     }
@@ -2612,6 +2792,14 @@ ctmbstr TIDY_CALL tidyGetLanguage()
     return TY_(tidyGetLanguage)();
 }
 
+Bool TIDY_CALL tidySetDocLanguage( TidyDoc tdoc, ctmbstr languageCode )
+{
+    TidyDocImpl* impl = tidyDocToImpl( tdoc );
+    if ( impl )
+        return TY_(tidySetDocLanguage)( impl, languageCode );
+    return no;
+}
+
 ctmbstr TIDY_CALL tidyLocalizedStringN( uint messageType, uint quantity )
 {
     return TY_(tidyLocalizedStringN)( messageType, quantity);